@@ -466,6 +466,18 @@ macro(dune_probe_functions)
     "sys/sendfile.h"
     DUNE_SYS_HAS_LINUX_SENDFILE)
 
+  dune_test_function(sendmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int"
+    "sys/types.h;sys/socket.h"
+    DUNE_SYS_HAS_SENDMMSG)
+
+  dune_test_function(recvmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int;struct timespec*"
+    "sys/types.h;sys/socket.h;time.h"
+    DUNE_SYS_HAS_RECVMMSG)
+
   dune_test_function(settimeofday
     "int"
     "struct timeval*;struct timezone*"
@@ -111,6 +111,7 @@ macro(dune_probe_headers)
   dune_test_header(linux/rtc.h)
   dune_test_header(linux/input.h)
   dune_test_header(linux/spi/spidev.h)
+  dune_test_header(linux/futex.h)
   dune_test_header(netdb.h)
   dune_test_header(pthread.h)
   dune_test_header(signal.h)
@@ -131,6 +132,9 @@ macro(dune_probe_headers)
   dune_test_header(sys/statvfs.h)
   dune_test_header(sys/syscall.h)
   dune_test_header(sys/reboot.h)
+  dune_test_header(sys/epoll.h)
+  dune_test_header(sys/timerfd.h)
+  dune_test_header(sys/eventfd.h)
   dune_test_header(termios.h)
   dune_test_header(unistd.h)
   dune_test_header(windows.h)
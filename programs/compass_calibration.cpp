@@ -50,13 +50,6 @@ main(int32_t argc, char** argv)
     return 1;
   }
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
-
   IMC::Message* msg = NULL;
 
   DUNE::Navigation::CompassCalibration m_ccal;
@@ -66,7 +59,12 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::LSFReader reader(argv[1]);
+    reader.addFilter(DUNE_IMC_EULERANGLES);
+    reader.addFilter(DUNE_IMC_MAGNETICFIELD);
+    reader.addFilter(DUNE_IMC_ENTITYINFO);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_EULERANGLES)
       {
@@ -114,7 +112,6 @@ main(int32_t argc, char** argv)
   Math::Matrix params = m_ccal.getCalibrationParams();
 
   std::cout << "New Parameters: " << params(0) << ", " << params(1) << ", " << params(2) << std::endl;
-  delete is;
 
   return 0;
 }
@@ -58,8 +58,6 @@ main(int32_t argc, char** argv)
   ByteBuffer buffer;
   std::ofstream lsf("FilteredData.lsf", std::ios::binary);
 
-  IMC::Message* msg;
-
   uint32_t accum = 0;
 
   bool done_first = false;
@@ -76,41 +74,40 @@ main(int32_t argc, char** argv)
 
   for (uint32_t j = 2; j < (uint32_t)argc; ++j)
   {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[j]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[j], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[j], method);
-
     uint32_t i = 0;
 
     try
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
-      {
-        if (!done_first)
-        {
-          // place an empty estimatedstate message in the log
-          IMC::EstimatedState state;
-          state.setTimeStamp(msg->getTimeStamp());
-          IMC::Packet::serialize(&state, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
-          done_first = true;
-        }
-
-        std::set<uint32_t>::const_iterator it;
-        it = ids.find(msg->getId());
+      IMC::LSFReader reader(argv[j]);
+      IMC::Header hdr;
+      const uint8_t* data = NULL;
+      uint32_t size = 0;
 
-        if (it != ids.end())
+      if (!done_first && reader.nextPacket(hdr, data, size))
+      {
+        // place an empty estimatedstate message in the log
+        IMC::EstimatedState state;
+        state.setTimeStamp(hdr.timestamp);
+        IMC::Packet::serialize(&state, buffer);
+        lsf.write(buffer.getBufferSigned(), buffer.getSize());
+        done_first = true;
+
+        if (ids.find(hdr.mgid) != ids.end())
         {
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
-
+          lsf.write((const char*)data, size);
           ++i;
         }
+      }
 
-        delete msg;
+      // Packets are filtered by their headers and copied verbatim.
+      std::set<uint32_t>::const_iterator it = ids.begin();
+      for (; it != ids.end(); ++it)
+        reader.addFilter(*it);
+
+      while (reader.nextPacket(hdr, data, size))
+      {
+        lsf.write((const char*)data, size);
+        ++i;
       }
     }
     catch (std::runtime_error& e)
@@ -121,8 +118,6 @@ main(int32_t argc, char** argv)
 
     std::cerr << i << " messages in " << argv[j] << std::endl;
     accum += i;
-
-    delete is;
   }
 
   lsf.close();
@@ -35,6 +35,10 @@ from imc.deps import *
 
 CONST_NULL_ID = 65535
 
+# Minimum number of consecutive fields of the same width that are
+# byte-swapped in bulk when decoding packets in reversed byte order.
+MIN_SWAP_RUN = 4
+
 def get_cxx_type(field_node):
     type = field_node.get('type')
     msg_type = field_node.get('message-type', 'Message')
@@ -143,7 +147,11 @@ class Message:
 
         # serializeFields()
         f = Function('serializeFields', 'uint8_t*', [Var('bfr__', 'uint8_t*')], const = True)
-        if self.has_fields():
+        if self.is_fixed_layout():
+            for field, offset in self.get_field_offsets():
+                f.add_body('IMC::serialize(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return bfr__ + c_fields_size;')
+        elif self.has_fields():
             f.add_body('uint8_t* ptr__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -157,7 +165,12 @@ class Message:
 
         # deserializeFields()
         f = Function('deserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if self.is_fixed_layout():
+            f.add_body('if (size__ < c_fields_size)\n{\nthrow BufferTooShort();\n}')
+            for field, offset in self.get_field_offsets():
+                f.add_body('Utils::ByteCopy::copy(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return c_fields_size;')
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -172,7 +185,21 @@ class Message:
 
         # reverseDeserializeFields()
         f = Function('reverseDeserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if self.is_fixed_layout() and self.has_swap_run():
+            f.add_body('if (size__ < c_fields_size)\n{\nthrow BufferTooShort();\n}')
+            f.add_body('uint8_t swap__[c_fields_size];')
+            for width, offset, count in self.get_field_runs():
+                if width == 1:
+                    f.add_body('std::memcpy(swap__ + %d, bfr__ + %d, %d);' % (offset, offset, count))
+                else:
+                    f.add_body('Utils::ByteCopy::rcopy%db(swap__ + %d, bfr__ + %d, %d);' % (width, offset, offset, count))
+            f.add_body('return %s::deserializeFields(swap__, c_fields_size);' % node.get('abbrev'))
+        elif self.is_fixed_layout():
+            f.add_body('if (size__ < c_fields_size)\n{\nthrow BufferTooShort();\n}')
+            for field, offset in self.get_field_offsets():
+                f.add_body('Utils::ByteCopy::rcopy(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return c_fields_size;')
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if consts['sizes'][field.get('type')] == 1:
@@ -239,6 +266,14 @@ class Message:
             f.add_body(self.fields_to_json())
             public.append(f)
 
+            f = Function('fieldsToJSON', 'void', [Var('w__', 'JSONWriter&')], const = True)
+            f.add_body(self.fields_to_json_writer())
+            public.append(f)
+
+            f = Function('fieldFromJSON', 'bool', [Var('name__', 'const std::string&'), Var('r__', 'JSONReader&')])
+            f.add_body(self.field_from_json())
+            public.append(f)
+
         # Nested functions.
         if self.count_nested() > 0:
             funcs = [('TimeStamp', 'double'), ('Source', 'uint16_t'),
@@ -292,6 +327,11 @@ class Message:
             hpp.append(v.as_decl())
         hpp.append('')
 
+        if self.is_fixed_layout():
+            hpp.append(comment('Serialization size of the fields') + \
+                       'static const uint16_t c_fields_size = %d;' % self.get_fixed_size())
+            hpp.append('')
+
         for function in public:
             if function.is_inline():
                 hpp.append(function)
@@ -323,6 +363,27 @@ class Message:
                 lines.append('IMC::toJSON(os__, "{0}", {0}, nindent__);'.format(get_name(field)))
         return '\n'.join(lines)
 
+    def fields_to_json_writer(self):
+        lines = []
+        for field in self._node.findall('field'):
+            if field.get('type').startswith('message'):
+                lines.append('{0}.toJSON(w__, "{0}");'.format(get_name(field)))
+            else:
+                lines.append('w__.write("{0}", {0});'.format(get_name(field)))
+        return '\n'.join(lines)
+
+    def field_from_json(self):
+        lines = []
+        for field in self._node.findall('field'):
+            lines.append('if (name__ == "{0}")\n{{'.format(get_name(field)))
+            if field.get('type').startswith('message'):
+                lines.append('{0}.fromJSON(r__);'.format(get_name(field)))
+            else:
+                lines.append('r__.read({0});'.format(get_name(field)))
+            lines.append('return true;\n}\n')
+        lines.append('return false;')
+        return '\n'.join(lines)
+
     def validate(field):
         min_value = field.get('min', None)
         cond = ''
@@ -358,6 +419,45 @@ class Message:
                 ret.append(get_name(field))
         return ret
 
+    # Messages whose fields all have a fixed size are serialized at
+    # offsets known at generation time, with a single bounds check.
+    def is_fixed_layout(self):
+        if not self.has_fields():
+            return False
+        for field in self._node.findall('field'):
+            if field.get('type') not in self._consts['fixed_types']:
+                return False
+        return True
+
+    # Retrieve a list of (field, offset) pairs of a fixed layout message.
+    def get_field_offsets(self):
+        offsets = []
+        offset = 0
+        for field in self._node.findall('field'):
+            offsets.append((field, offset))
+            offset += self._consts['sizes'][field.get('type')]
+        return offsets
+
+    # Retrieve a list of [width, offset, count] runs of consecutive
+    # fields of the same width of a fixed layout message.
+    def get_field_runs(self):
+        runs = []
+        for field, offset in self.get_field_offsets():
+            width = self._consts['sizes'][field.get('type')]
+            if len(runs) > 0 and runs[-1][0] == width:
+                runs[-1][2] += 1
+            else:
+                runs.append([width, offset, 1])
+        return runs
+
+    # Test if a fixed layout message has enough consecutive multi-byte
+    # fields of the same width to be byte-swapped in bulk.
+    def has_swap_run(self):
+        for width, offset, count in self.get_field_runs():
+            if width > 1 and count >= MIN_SWAP_RUN:
+                return True
+        return False
+
     def has_fields(self):
         return len(self._node.findall('field')) > 0
 
@@ -538,13 +638,14 @@ hpp.add_isoc_headers('ostream', 'string', 'vector')
 hpp.add_dune_headers('Config.hpp', 'IMC/Message.hpp',
                      'IMC/InlineMessage.hpp', 'IMC/MessageList.hpp',
                      'IMC/Enumerations.hpp', 'IMC/Bitfields.hpp',
-                     'IMC/SuperTypes.hpp', 'IMC/JSON.hpp')
+                     'IMC/SuperTypes.hpp', 'IMC/JSON.hpp',
+                     'IMC/JSONWriter.hpp', 'IMC/JSONReader.hpp')
 
 ################################################################################
 # Definitions.cpp                                                              #
 ################################################################################
 cpp = File('Definitions.cpp', dest_folder, md5 = xml_md5)
-cpp.add_isoc_headers('algorithm','iostream', 'iomanip', 'string', 'cstdio')
+cpp.add_isoc_headers('algorithm','iostream', 'iomanip', 'string', 'cstdio', 'cstring')
 cpp.add_dune_headers('Utils/ByteCopy.hpp', 'Utils/Utils.hpp',
                      'IMC/Exceptions.hpp', 'IMC/Definitions.hpp',
                      'IMC/Factory.hpp', 'IMC/Serialization.hpp')
@@ -51,13 +51,6 @@ main(int32_t argc, char** argv)
     return 1;
   }
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
-
   IMC::Message* msg = NULL;
 
   unsigned phototrigger_eid = 0;
@@ -67,7 +60,11 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::LSFReader reader(argv[1]);
+    reader.addFilter(DUNE_IMC_LOGBOOKENTRY);
+    reader.addFilter(DUNE_IMC_ENTITYINFO);
+
+    while ((msg = reader.next()) != 0)
     {
       if (msg->getId() == DUNE_IMC_LOGBOOKENTRY)
       {
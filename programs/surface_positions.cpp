@@ -54,17 +54,10 @@ main(int32_t argc, char** argv)
     return 1;
   }
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
-
   ByteBuffer buffer;
   std::ofstream lsf("SurfaceData.lsf", std::ios::binary);
 
-  IMC::Message* msg;
+  IMC::GpsFix fix;
 
   unsigned i = 0;
 
@@ -75,26 +68,21 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::LSFReader reader(argv[1]);
+
+    while (reader.next(fix))
     {
-      if (msg->getId() == DUNE_IMC_GPSFIX)
+      if ((fix.hacc <= MIN_HACC) &&
+          (fix.validity & IMC::GpsFix::GFV_VALID_POS) &&
+          (fix.getTimeStamp() >= timestamp))
       {
-        IMC::GpsFix* fix = static_cast<IMC::GpsFix*>(msg);
-
-        if ((fix->hacc <= MIN_HACC) &&
-            (fix->validity & IMC::GpsFix::GFV_VALID_POS) &&
-            (fix->getTimeStamp() >= timestamp))
-        {
-          timestamp = fix->getTimeStamp();
+        timestamp = fix.getTimeStamp();
 
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
+        IMC::Packet::serialize(&fix, buffer);
+        lsf.write(buffer.getBufferSigned(), buffer.getSize());
 
-          ++i;
-        }
+        ++i;
       }
-
-      delete msg;
     }
   }
   catch (std::runtime_error& e)
@@ -105,8 +93,6 @@ main(int32_t argc, char** argv)
 
   lsf.close();
 
-  delete is;
-
   std::cerr << "Got " << i << " GpsFix messages." << std::endl;
 
   return 0;
@@ -0,0 +1,336 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Array copy under test.
+typedef void (*Function)(uint8_t*, const uint8_t*, size_t);
+
+//! Largest number of words copied.
+static const size_t c_max_count = 67;
+//! Largest misalignment of source and destination.
+static const size_t c_max_offset = 8;
+//! Guard bytes around the destination area.
+static const size_t c_guard = 16;
+//! Value of guard bytes.
+static const uint8_t c_guard_value = 0xA5;
+
+//! Packet header layout as (field size, number of fields) pairs.
+static const unsigned c_header[] = {2, 3, 8, 1, 2, 1, 1, 1, 2, 1, 1, 1, 0};
+//! SimulatedState payload layout.
+static const unsigned c_simulated_state[] = {8, 2, 4, 16, 0};
+//! EstimatedState payload layout.
+static const unsigned c_estimated_state[] = {8, 2, 4, 18, 0};
+//! Depth payload layout.
+static const unsigned c_depth[] = {4, 1, 0};
+//! Rpm payload layout.
+static const unsigned c_rpm[] = {2, 1, 0};
+
+//! Check an array copy against a byte by byte reversal for all
+//! counts and alignments up to the limits above.
+//! @param function implementation.
+//! @param size word size.
+//! @param data random source data.
+//! @return true if all copies match the reference.
+static bool
+checkArrayCopy(Function function, size_t size, const std::vector<uint8_t>& data)
+{
+  std::vector<uint8_t> dest(c_max_count * size + c_max_offset + 2 * c_guard);
+
+  for (size_t count = 0; count <= c_max_count; ++count)
+  {
+    for (size_t src_off = 0; src_off < c_max_offset; ++src_off)
+    {
+      for (size_t dst_off = 0; dst_off < c_max_offset; ++dst_off)
+      {
+        std::fill(dest.begin(), dest.end(), c_guard_value);
+
+        const uint8_t* src = &data[src_off];
+        uint8_t* dst = &dest[c_guard + dst_off];
+        function(dst, src, count);
+
+        for (size_t i = 0; i < count * size; ++i)
+        {
+          size_t word = i - i % size;
+          if (dst[i] != src[word + size - 1 - i % size])
+            return false;
+        }
+
+        for (size_t i = 0; i < c_guard + dst_off; ++i)
+        {
+          if (dest[i] != c_guard_value)
+            return false;
+        }
+
+        for (size_t i = c_guard + dst_off + count * size; i < dest.size(); ++i)
+        {
+          if (dest[i] != c_guard_value)
+            return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+//! Reverse the byte order of consecutive fields.
+//! @param ptr first field.
+//! @param layout (field size, number of fields) pairs, terminated by zero.
+//! @return pointer past the last field.
+static uint8_t*
+swapFields(uint8_t* ptr, const unsigned* layout)
+{
+  for (; layout[0] != 0; layout += 2)
+  {
+    for (unsigned i = 0; i < layout[1]; ++i)
+    {
+      std::reverse(ptr, ptr + layout[0]);
+      ptr += layout[0];
+    }
+  }
+
+  return ptr;
+}
+
+//! Serialize a message and convert the packet to the opposite byte
+//! order, as if sent by a host of different endianness.
+//! @param msg message.
+//! @param layout payload layout.
+//! @return byte-swapped packet.
+static std::vector<uint8_t>
+serializeSwapped(const IMC::Message& msg, const unsigned* layout)
+{
+  Utils::ByteBuffer bfr;
+  IMC::Packet::serialize(&msg, bfr);
+
+  std::vector<uint8_t> packet(bfr.getBuffer(), bfr.getBuffer() + bfr.getSize());
+  uint8_t* ptr = swapFields(&packet[0], c_header);
+  ptr = swapFields(ptr, layout);
+
+  uint16_t crc = CRC16::compute(&packet[0], ptr - &packet[0]);
+  ByteCopy::rcopy2b(ptr, (const uint8_t*)&crc);
+  return packet;
+}
+
+//! Decode a byte-swapped packet of a message.
+//! @param msg message.
+//! @param layout payload layout.
+//! @return decoded message or NULL if the packet was not decoded as
+//! a byte-swapped one.
+static IMC::Message*
+decodeSwapped(const IMC::Message& msg, const unsigned* layout)
+{
+  std::vector<uint8_t> packet = serializeSwapped(msg, layout);
+
+  IMC::Header hdr;
+  IMC::Packet::deserializeHeader(hdr, &packet[0], packet.size());
+  if (hdr.sync != DUNE_IMC_CONST_SYNC_REV)
+    return NULL;
+
+  return IMC::Packet::deserialize(&packet[0], packet.size());
+}
+
+//! Decode a byte-swapped packet of a message.
+//! @param msg message.
+//! @param layout payload layout.
+//! @return true if the decoded message equals the original.
+static bool
+checkSwappedPacket(const IMC::Message& msg, const unsigned* layout)
+{
+  IMC::Message* msg_d = decodeSwapped(msg, layout);
+  bool rv = (msg_d != NULL) && (msg == *msg_d);
+  delete msg_d;
+  return rv;
+}
+
+//! Check the header fields of a decoded message.
+//! @param msg original message.
+//! @param msg_d decoded message.
+//! @return true if all header fields match.
+static bool
+checkHeader(const IMC::Message& msg, const IMC::Message& msg_d)
+{
+  return msg_d.getId() == msg.getId()
+  && msg_d.getTimeStamp() == msg.getTimeStamp()
+  && msg_d.getSource() == msg.getSource()
+  && msg_d.getSourceEntity() == msg.getSourceEntity()
+  && msg_d.getDestination() == msg.getDestination()
+  && msg_d.getDestinationEntity() == msg.getDestinationEntity();
+}
+
+//! Decode a byte-swapped EstimatedState and compare its fields.
+//! @param msg original message.
+//! @return true if all fields match.
+static bool
+checkEstimatedState(const IMC::EstimatedState& msg)
+{
+  IMC::Message* msg_d = decodeSwapped(msg, c_estimated_state);
+  if (msg_d == NULL)
+    return false;
+
+  const IMC::EstimatedState* es = static_cast<const IMC::EstimatedState*>(msg_d);
+  bool rv = checkHeader(msg, *msg_d)
+  && es->lat == msg.lat && es->lon == msg.lon && es->height == msg.height
+  && es->x == msg.x && es->y == msg.y && es->z == msg.z
+  && es->phi == msg.phi && es->theta == msg.theta && es->psi == msg.psi
+  && es->u == msg.u && es->v == msg.v && es->w == msg.w
+  && es->vx == msg.vx && es->vy == msg.vy && es->vz == msg.vz
+  && es->p == msg.p && es->q == msg.q && es->r == msg.r
+  && es->depth == msg.depth && es->alt == msg.alt;
+
+  delete msg_d;
+  return rv;
+}
+
+//! Decode a byte-swapped single value message and compare its value.
+//! @param msg original message.
+//! @param layout payload layout.
+//! @return true if the header and value match.
+template <typename Type>
+static bool
+checkValue(const Type& msg, const unsigned* layout)
+{
+  IMC::Message* msg_d = decodeSwapped(msg, layout);
+  if (msg_d == NULL)
+    return false;
+
+  bool rv = checkHeader(msg, *msg_d)
+  && static_cast<const Type*>(msg_d)->value == msg.value;
+
+  delete msg_d;
+  return rv;
+}
+
+int
+main(void)
+{
+  Test test("Utils::ByteCopy");
+
+  Math::Random::Generator* prng = Math::Random::Factory::create(Math::Random::Factory::c_default, 1);
+
+  std::vector<uint8_t> data(c_max_count * 8 + c_max_offset);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (uint8_t)prng->random();
+
+  test.boolean("rcopy2b() arrays", checkArrayCopy(ByteCopy::rcopy2b, 2, data));
+  test.boolean("rcopy4b() arrays", checkArrayCopy(ByteCopy::rcopy4b, 4, data));
+  test.boolean("rcopy8b() arrays", checkArrayCopy(ByteCopy::rcopy8b, 8, data));
+
+  {
+    IMC::SimulatedState msg;
+    msg.setTimeStamp(1431.25);
+    msg.setSource(0x1234);
+    msg.setSourceEntity(56);
+    msg.setDestination(0x789A);
+    msg.setDestinationEntity(188);
+    msg.lat = 0.7188139;
+    msg.lon = -0.1519748;
+    msg.height = 10.5f;
+    msg.x = 1.0f;
+    msg.y = -2.0f;
+    msg.z = 3.5f;
+    msg.phi = 0.1f;
+    msg.theta = -0.2f;
+    msg.psi = 3.1f;
+    msg.u = 1.25f;
+    msg.v = -0.5f;
+    msg.w = 0.125f;
+    msg.p = 0.01f;
+    msg.q = -0.02f;
+    msg.r = 0.03f;
+    msg.svx = 4.0f;
+    msg.svy = -5.0f;
+    msg.svz = 6.0f;
+    test.boolean("byte-swapped SimulatedState", checkSwappedPacket(msg, c_simulated_state));
+  }
+
+  {
+    IMC::EstimatedState msg;
+    msg.setTimeStamp(1431.5);
+    msg.setSource(0x2001);
+    msg.setSourceEntity(12);
+    msg.setDestination(0x4002);
+    msg.setDestinationEntity(255);
+    msg.lat = 0.7188139;
+    msg.lon = -0.1519748;
+    msg.height = 0.25f;
+    msg.x = 120.5f;
+    msg.y = -35.75f;
+    msg.z = 4.5f;
+    msg.phi = 0.015f;
+    msg.theta = -0.03f;
+    msg.psi = 1.57f;
+    msg.u = 1.5f;
+    msg.v = 0.05f;
+    msg.w = -0.1f;
+    msg.vx = 1.2f;
+    msg.vy = -0.9f;
+    msg.vz = 0.1f;
+    msg.p = 0.001f;
+    msg.q = -0.002f;
+    msg.r = 0.004f;
+    msg.depth = 4.25f;
+    msg.alt = 17.5f;
+    test.boolean("byte-swapped EstimatedState", checkEstimatedState(msg));
+  }
+
+  {
+    IMC::Depth msg;
+    msg.setTimeStamp(1431.75);
+    msg.setSource(0x2001);
+    msg.setSourceEntity(40);
+    msg.value = 12.375f;
+    test.boolean("byte-swapped Depth", checkValue(msg, c_depth));
+  }
+
+  {
+    IMC::Rpm msg;
+    msg.setTimeStamp(1432.0);
+    msg.setSource(0x2001);
+    msg.setSourceEntity(41);
+    msg.value = -1234;
+    test.boolean("byte-swapped Rpm", checkValue(msg, c_rpm));
+  }
+
+  delete prng;
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,92 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Size of the random data buffer.
+static const size_t c_data_size = 65536;
+
+int
+main(void)
+{
+  Test test("Algorithms::CRC16");
+
+  const char* check = "123456789";
+  const uint8_t* check_data = (const uint8_t*)check;
+  test.boolean("compute() check value", CRC16::compute(check_data, 9) == 0xBB3D);
+  test.boolean("slicing-by-8 check value", CRC16::computeSlicingBy8(check_data, 9) == 0xBB3D);
+
+  Math::Random::Generator* prng = Math::Random::Factory::create(Math::Random::Factory::c_default, 1);
+
+  std::vector<uint8_t> data(c_data_size);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (uint8_t)prng->random();
+
+  bool slicing = true;
+  bool clmul = true;
+  bool block = true;
+  bool chained = true;
+
+  for (size_t len = 0; len <= 1100; ++len)
+  {
+    for (size_t offset = 0; offset < 3; ++offset)
+    {
+      const uint8_t* bfr = &data[offset];
+      uint16_t init = (uint16_t)prng->random();
+      uint16_t ref = CRC16::computeBytewise(bfr, len, init);
+
+      slicing &= CRC16::computeSlicingBy8(bfr, len, init) == ref;
+      clmul &= CRC16::computeCarrylessMultiply(bfr, len, init) == ref;
+      block &= CRC16::computeBlock(bfr, len, init) == ref;
+      chained &= CRC16::compute(bfr + len / 2, len - len / 2, CRC16::compute(bfr, len / 2, init)) == ref;
+    }
+  }
+
+  test.boolean("slicing-by-8 matches reference", slicing);
+  test.boolean("carry-less multiply matches reference", clmul);
+  test.boolean("computeBlock() matches reference", block);
+  test.boolean("compute() in chunks matches reference", chained);
+  test.boolean("carry-less multiply on 64 KiB",
+               CRC16::computeCarrylessMultiply(&data[0], data.size())
+               == CRC16::computeBytewise(&data[0], data.size()));
+
+  delete prng;
+
+  return test.getReturnValue();
+}
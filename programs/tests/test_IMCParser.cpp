@@ -0,0 +1,229 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Number of messages in the test stream.
+static const unsigned c_count = 1000;
+
+//! Append a serialized message to a stream.
+static void
+append(std::vector<uint8_t>& stream, IMC::Message* msg)
+{
+  ByteBuffer bfr;
+  uint16_t size = IMC::Packet::serialize(msg, bfr);
+  stream.insert(stream.end(), bfr.getBuffer(), bfr.getBuffer() + size);
+}
+
+//! Build a stream of messages interleaved with garbage.
+static void
+buildStream(std::vector<uint8_t>& stream, bool garbage)
+{
+  IMC::EstimatedState state;
+  IMC::Heartbeat hbeat;
+  uint8_t noise[] = {0xfe, 0x00, 0x54, 0x54, 0x12, 0xfe, 0x33};
+
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    IMC::Message* msg = &hbeat;
+    if (i % 2 == 0)
+    {
+      state.x = i;
+      msg = &state;
+    }
+
+    msg->setTimeStamp(i);
+    append(stream, msg);
+
+    // Noise contains loose synchronization bytes but no complete
+    // synchronization number, which would be a valid packet start.
+    if (garbage && i % 10 == 0)
+      stream.insert(stream.end(), noise + (i / 10) % sizeof(noise), noise + sizeof(noise));
+  }
+}
+
+//! Filter that skips packets of a single message type.
+class SkipFilter: public IMC::Parser::Filter
+{
+public:
+  SkipFilter(uint16_t id):
+    m_id(id)
+  { }
+
+  bool
+  accept(const IMC::Header& hdr)
+  {
+    return hdr.mgid != m_id;
+  }
+
+private:
+  uint16_t m_id;
+};
+
+//! Parse a stream in chunks of a given size, skipping Heartbeat
+//! packets.
+//! @return number of EstimatedState messages correctly decoded or 0
+//! if any other message is decoded.
+static unsigned
+parseFiltered(const std::vector<uint8_t>& stream, size_t chunk)
+{
+  SkipFilter filter(DUNE_IMC_HEARTBEAT);
+  IMC::Parser parser;
+  parser.setFilter(&filter);
+  unsigned count = 0;
+
+  for (size_t i = 0; i < stream.size(); i += chunk)
+  {
+    const uint8_t* p = &stream[i];
+    size_t size = std::min(chunk, stream.size() - i);
+    IMC::Message* m = NULL;
+
+    while ((m = parser.parse(p, size)) != NULL)
+    {
+      bool valid = m->getId() == DUNE_IMC_ESTIMATEDSTATE && m->getTimeStamp() == count * 2;
+      delete m;
+
+      if (!valid)
+        return 0;
+
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+//! Parse a stream in chunks of a given size.
+//! @return number of messages correctly decoded.
+static unsigned
+parseChunks(const std::vector<uint8_t>& stream, size_t chunk)
+{
+  IMC::Parser parser;
+  unsigned count = 0;
+
+  for (size_t i = 0; i < stream.size(); i += chunk)
+  {
+    const uint8_t* p = &stream[i];
+    size_t size = std::min(chunk, stream.size() - i);
+    IMC::Message* m = NULL;
+
+    while ((m = parser.parse(p, size)) != NULL)
+    {
+      if (m->getTimeStamp() == count)
+        ++count;
+
+      delete m;
+    }
+  }
+
+  return count;
+}
+
+//! Parse a stream byte by byte.
+//! @return number of messages correctly decoded.
+static unsigned
+parseBytes(const std::vector<uint8_t>& stream)
+{
+  IMC::Parser parser;
+  unsigned count = 0;
+
+  for (size_t i = 0; i < stream.size(); ++i)
+  {
+    IMC::Message* m = parser.parse(stream[i]);
+    if (m != NULL)
+    {
+      if (m->getTimeStamp() == count)
+        ++count;
+
+      delete m;
+    }
+  }
+
+  return count;
+}
+
+int
+main(void)
+{
+  Test test("IMC::Parser");
+
+  std::vector<uint8_t> stream;
+  buildStream(stream, false);
+
+  test.boolean("byte by byte", parseBytes(stream) == c_count);
+  test.boolean("whole buffer", parseChunks(stream, stream.size()) == c_count);
+  test.boolean("chunks of 1 byte", parseChunks(stream, 1) == c_count);
+  test.boolean("chunks of 7 bytes", parseChunks(stream, 7) == c_count);
+  test.boolean("chunks of 100 bytes", parseChunks(stream, 100) == c_count);
+
+  std::vector<uint8_t> noisy;
+  buildStream(noisy, true);
+
+  test.boolean("garbage: byte by byte", parseBytes(noisy) == c_count);
+  test.boolean("garbage: whole buffer", parseChunks(noisy, noisy.size()) == c_count);
+  test.boolean("garbage: chunks of 13 bytes", parseChunks(noisy, 13) == c_count);
+
+  test.boolean("filter: whole buffer", parseFiltered(stream, stream.size()) == c_count / 2);
+  test.boolean("filter: chunks of 1 byte", parseFiltered(stream, 1) == c_count / 2);
+  test.boolean("filter: chunks of 7 bytes", parseFiltered(stream, 7) == c_count / 2);
+  test.boolean("filter: garbage", parseFiltered(noisy, 13) == c_count / 2);
+
+  // Corrupt the CRC of the first message.
+  std::vector<uint8_t> corrupt(stream);
+  IMC::EstimatedState state;
+  corrupt[state.getSerializationSize() - 1] ^= 0xff;
+
+  test.boolean("bad CRC: message dropped", parseChunks(corrupt, corrupt.size()) == 0);
+
+  IMC::Parser parser;
+  const uint8_t* p = &corrupt[0];
+  size_t left = corrupt.size();
+  unsigned count = 0;
+  IMC::Message* m = NULL;
+  while ((m = parser.parse(p, left)) != NULL)
+  {
+    ++count;
+    delete m;
+  }
+
+  test.boolean("bad CRC: remaining messages", count == c_count - 1);
+  test.boolean("bad CRC: buffer consumed", left == 0);
+
+  return test.getReturnValue();
+}
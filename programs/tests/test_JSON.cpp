@@ -0,0 +1,223 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Encode a message and decode it back.
+static IMC::Message*
+roundTrip(const IMC::Message& msg)
+{
+  IMC::JSONWriter writer;
+  msg.toJSON(writer);
+  IMC::JSONReader reader(writer.getData(), writer.getSize());
+  IMC::Message* rv = reader.readMessage();
+  if (reader.readMessage() != NULL)
+    return NULL;
+  return rv;
+}
+
+//! Check that a message survives a JSON round trip.
+static bool
+checkRoundTrip(const IMC::Message& msg)
+{
+  IMC::Message* copy = roundTrip(msg);
+  bool rv = (copy != NULL) && (*copy == msg);
+  delete copy;
+  return rv;
+}
+
+//! Check that decoding a document raises InvalidJSON.
+static bool
+checkMalformed(const char* doc)
+{
+  try
+  {
+    IMC::JSONReader reader(doc, std::strlen(doc));
+    while (true)
+    {
+      IMC::Message* msg = reader.readMessage();
+      if (msg == NULL)
+        break;
+      delete msg;
+    }
+  }
+  catch (IMC::InvalidJSON& e)
+  {
+    return true;
+  }
+
+  return false;
+}
+
+int
+main(void)
+{
+  Test test("IMC::JSONWriter / IMC::JSONReader");
+
+  {
+    IMC::EstimatedState msg;
+    msg.setTimeStamp(1234567890.125);
+    msg.setSource(0x2001);
+    msg.setSourceEntity(12);
+    msg.setDestination(0x4001);
+    msg.setDestinationEntity(255);
+    msg.lat = 0.71881387640916;
+    msg.lon = -0.15195186289037;
+    msg.height = 0.1f;
+    msg.x = -1.0e-7f;
+    msg.z = 3.4e38f;
+    msg.psi = -3.14159265f;
+    test.boolean("round trip of scalar fields and header", checkRoundTrip(msg));
+  }
+
+  {
+    IMC::LogBookEntry msg;
+    msg.type = IMC::LogBookEntry::LBET_ERROR;
+    msg.context = "quote \" backslash \\ slash /";
+    msg.text = "line\nfeed\ttab";
+    msg.text += '\x01';
+    msg.text += " control and UTF-8 \xc3\xa9";
+    test.boolean("round trip of escaped strings", checkRoundTrip(msg));
+  }
+
+  {
+    IMC::DevDataBinary msg;
+    for (unsigned i = 0; i < 256; ++i)
+      msg.value.push_back((char)i);
+    test.boolean("round trip of raw data", checkRoundTrip(msg));
+  }
+
+  {
+    IMC::Goto man;
+    man.lat = 0.7188;
+    man.lon = -0.1519;
+    man.z = 2.0f;
+    man.speed = 1.5f;
+
+    IMC::PlanManeuver pman;
+    pman.maneuver_id = "goto";
+    pman.data.set(man);
+
+    IMC::PlanSpecification spec;
+    spec.plan_id = "plan";
+    spec.start_man_id = "goto";
+    spec.maneuvers.push_back(pman);
+    IMC::SetEntityParameters sep;
+    sep.name = "Camera";
+    IMC::EntityParameter param;
+    param.name = "Active";
+    param.value = "true";
+    sep.params.push_back(param);
+    spec.start_actions.push_back(sep);
+
+    IMC::PlanControl msg;
+    msg.type = IMC::PlanControl::PC_REQUEST;
+    msg.op = IMC::PlanControl::PC_START;
+    msg.request_id = 65535;
+    msg.plan_id = "plan";
+    msg.arg.set(spec);
+    test.boolean("round trip of inline messages and message lists", checkRoundTrip(msg));
+
+    msg.arg.clear();
+    test.boolean("round trip of null inline message", checkRoundTrip(msg));
+  }
+
+  {
+    const char* doc =
+      "{\"abbrev\":\"Heartbeat\",\"src\":\"1\"}\n"
+      "{\"abbrev\": \"Rpm\", \"value\": 1500, \"extra\": {\"a\": [1, {\"b\": null}], \"c\": \"x\"}}\n";
+    IMC::JSONReader reader(doc, std::strlen(doc));
+    IMC::Message* m0 = reader.readMessage();
+    IMC::Message* m1 = reader.readMessage();
+    IMC::Message* m2 = reader.readMessage();
+    test.boolean("JSON lines and unknown members",
+                 m0 != NULL && m0->getId() == DUNE_IMC_HEARTBEAT && m0->getSource() == 1
+                 && m1 != NULL && m1->getId() == DUNE_IMC_RPM
+                 && static_cast<IMC::Rpm*>(m1)->value == 1500 && m2 == NULL);
+    delete m0;
+    delete m1;
+  }
+
+  {
+    const char* doc = " [ {\"abbrev\":\"Rpm\",\"value\":\"-3\"} , {\"abbrev\":\"Heartbeat\"} ] ";
+    IMC::JSONReader reader(doc, std::strlen(doc));
+    IMC::Message* m0 = reader.readMessage();
+    IMC::Message* m1 = reader.readMessage();
+    IMC::Message* m2 = reader.readMessage();
+    test.boolean("array of messages",
+                 m0 != NULL && static_cast<IMC::Rpm*>(m0)->value == -3
+                 && m1 != NULL && m1->getId() == DUNE_IMC_HEARTBEAT && m2 == NULL);
+    delete m0;
+    delete m1;
+  }
+
+  {
+    const char* doc = "{\"abbrev\":\"LogBookEntry\",\"text\":\"\\u00e9\\ud83d\\ude00\"}";
+    IMC::JSONReader reader(doc, std::strlen(doc));
+    IMC::Message* msg = reader.readMessage();
+    test.boolean("unicode escapes",
+                 msg != NULL && static_cast<IMC::LogBookEntry*>(msg)->text == "\xc3\xa9\xf0\x9f\x98\x80");
+    delete msg;
+  }
+
+  test.boolean("missing abbrev", checkMalformed("{\"value\":1}"));
+  test.boolean("truncated document", checkMalformed("{\"abbrev\":\"Rpm\",\"value\":1"));
+  test.boolean("missing comma", checkMalformed("{\"abbrev\":\"Rpm\" \"value\":1}"));
+  test.boolean("integer out of range", checkMalformed("{\"abbrev\":\"Rpm\",\"value\":70000}"));
+  test.boolean("invalid number", checkMalformed("{\"abbrev\":\"Rpm\",\"value\":\"12a\"}"));
+  test.boolean("invalid escape", checkMalformed("{\"abbrev\":\"LogBookEntry\",\"text\":\"\\q\"}"));
+  test.boolean("deep nesting", checkMalformed(("{\"abbrev\":\"Rpm\",\"x\":" + std::string(1000, '[')).c_str()));
+
+  {
+    bool rv = false;
+    const char* doc = "{\"abbrev\":\"PlanManeuver\",\"data\":{\"abbrev\":\"Rpm\"}}";
+    try
+    {
+      IMC::JSONReader reader(doc, std::strlen(doc));
+      delete reader.readMessage();
+    }
+    catch (IMC::InvalidMessageId& e)
+    {
+      rv = true;
+    }
+    test.boolean("inline message of wrong type", rv);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,280 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Number of messages written to the test log.
+static const unsigned c_count = 20000;
+//! Interval between messages.
+static const double c_period = 0.1;
+
+//! Write a test log and, optionally, its index.
+static void
+writeLog(const std::string& path, bool index, Compression::Methods method = METHOD_UNKNOWN)
+{
+  std::ostream* os = NULL;
+  if (method == METHOD_UNKNOWN)
+    os = new std::ofstream(path.c_str(), std::ios::binary);
+  else
+    os = new Compression::FileOutput(path.c_str(), method);
+
+  std::vector<char> index_data;
+  IMC::LSFIndex::writeHeader(index_data);
+  IMC::LSFIndex builder;
+  ByteBuffer bfr;
+  uint64_t offset = 0;
+
+  IMC::EstimatedState state;
+  IMC::Heartbeat hbeat;
+
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    IMC::Message* msg = &hbeat;
+    if (i % 4 == 0)
+    {
+      state.x = i;
+      msg = &state;
+    }
+
+    msg->setTimeStamp(i * c_period);
+    msg->setSource(0x0010);
+
+    uint16_t size = IMC::Packet::serialize(msg, bfr);
+    os->write(bfr.getBufferSigned(), size);
+
+    IMC::Header hdr;
+    IMC::Packet::deserializeHeader(hdr, bfr.getBuffer(), size);
+    builder.add(hdr, offset, size);
+    if (builder.isBlockFull())
+      builder.writeBlock(index_data);
+
+    offset += size;
+  }
+
+  builder.writeBlock(index_data);
+  delete os;
+
+  if (index)
+  {
+    std::ofstream idx(IMC::LSFIndex::getPath(path).c_str(), std::ios::binary);
+    idx.write(&index_data[0], index_data.size());
+  }
+}
+
+//! Count messages and check their ids and timestamps.
+static unsigned
+countMessages(IMC::LSFReader& reader, uint16_t id, double first_time, bool& ok)
+{
+  unsigned count = 0;
+  IMC::Message* msg = NULL;
+
+  while ((msg = reader.next()) != NULL)
+  {
+    if (count == 0 && msg->getTimeStamp() != first_time)
+      ok = false;
+
+    if (id != 0 && msg->getId() != id)
+      ok = false;
+
+    ++count;
+    delete msg;
+  }
+
+  return count;
+}
+
+static void
+testReader(Test& test, const std::string& path, const std::string& label)
+{
+  IMC::LSFReader reader(path);
+
+  bool ok = true;
+  unsigned count = countMessages(reader, 0, 0.0, ok);
+  test.boolean((label + ": read all").c_str(), ok && count == c_count);
+
+  ok = true;
+  reader.rewind();
+  reader.addFilter(DUNE_IMC_ESTIMATEDSTATE);
+  count = countMessages(reader, DUNE_IMC_ESTIMATEDSTATE, 0.0, ok);
+  test.boolean((label + ": filter").c_str(), ok && count == c_count / 4);
+
+  ok = true;
+  reader.seek(1000 * c_period);
+  count = countMessages(reader, DUNE_IMC_ESTIMATEDSTATE, 1000 * c_period, ok);
+  test.boolean((label + ": seek backwards with filter").c_str(), ok && count == (c_count - 1000) / 4);
+
+  ok = true;
+  reader.clearFilter();
+  reader.seek(15001 * c_period);
+  count = countMessages(reader, 0, 15001 * c_period, ok);
+  test.boolean((label + ": seek").c_str(), ok && count == c_count - 15001);
+
+  reader.seek(c_count * c_period);
+  test.boolean((label + ": seek past end").c_str(), reader.next() == NULL);
+
+  reader.rewind();
+  reader.addSourceFilter(0x0011);
+  test.boolean((label + ": source filter").c_str(), reader.next() == NULL);
+
+  ok = true;
+  reader.clearFilter();
+  reader.addSourceFilter(0x0010);
+  reader.addFilter(DUNE_IMC_HEARTBEAT);
+  reader.setEndTime(2000 * c_period);
+  reader.seek(1000 * c_period);
+  count = 0;
+
+  IMC::Header hdr;
+  const uint8_t* data = NULL;
+  uint32_t size = 0;
+  while (reader.nextPacket(hdr, data, size))
+  {
+    if (hdr.mgid != DUNE_IMC_HEARTBEAT || size != (uint32_t)(hdr.size + DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE))
+      ok = false;
+
+    ++count;
+  }
+
+  test.boolean((label + ": raw packets").c_str(), ok && count == 750);
+
+  ok = true;
+  reader.clearFilter();
+  reader.setEndTime(c_count * c_period);
+  reader.rewind();
+  count = 0;
+
+  IMC::EstimatedState state;
+  while (reader.next(state))
+  {
+    if (state.x != count * 4)
+      ok = false;
+
+    ++count;
+  }
+
+  test.boolean((label + ": caller-provided message").c_str(), ok && count == c_count / 4);
+}
+
+//! Write a log with an EstimatedState packet whose payload is too
+//! short for the message but has a valid CRC, followed by a complete
+//! EstimatedState packet.
+static void
+writeTruncatedLog(const std::string& path)
+{
+  std::ofstream os(path.c_str(), std::ios::binary);
+
+  IMC::EstimatedState state;
+  state.x = 1.0f;
+  ByteBuffer bfr;
+  IMC::Packet::serialize(&state, bfr);
+
+  std::vector<uint8_t> packet(bfr.getBuffer(), bfr.getBuffer() + DUNE_IMC_CONST_HEADER_SIZE + 10);
+  uint16_t payload = 10;
+  IMC::serialize(payload, &packet[4]);
+  uint16_t crc = CRC16::compute(&packet[0], packet.size());
+  packet.resize(packet.size() + DUNE_IMC_CONST_FOOTER_SIZE);
+  IMC::serialize(crc, &packet[packet.size() - DUNE_IMC_CONST_FOOTER_SIZE]);
+  os.write((const char*)&packet[0], packet.size());
+
+  state.x = 2.0f;
+  uint16_t size = IMC::Packet::serialize(&state, bfr);
+  os.write(bfr.getBufferSigned(), size);
+}
+
+int
+main(void)
+{
+  Test test("IMC::LSFReader");
+
+  Path dir = Path("/tmp") / "dune-test-lsf";
+  dir.create();
+
+  std::string indexed = (dir / "Indexed.lsf").str();
+  writeLog(indexed, true);
+
+  std::string plain = (dir / "Plain.lsf").str();
+  writeLog(plain, false);
+
+  std::string compressed = (dir / "Compressed.lsf.gz").str();
+  writeLog(compressed, true, METHOD_GZIP);
+
+  {
+    IMC::LSFIndex index;
+    test.boolean("load index", index.load(IMC::LSFIndex::getPath(indexed)));
+    test.boolean("index blocks", index.getBlocks().size() > 1);
+    test.boolean("missing index", !index.load(IMC::LSFIndex::getPath(plain)));
+  }
+
+  {
+    IMC::LSFReader reader(indexed);
+    test.boolean("reader has index", reader.hasIndex());
+  }
+
+  testReader(test, indexed, "indexed");
+  testReader(test, plain, "plain");
+  testReader(test, compressed, "compressed");
+
+  {
+    std::string truncated = (dir / "Truncated.lsf").str();
+    writeTruncatedLog(truncated);
+
+    IMC::LSFReader reader(truncated);
+    IMC::EstimatedState state;
+    state.x = -1.0f;
+
+    bool thrown = false;
+    try
+    {
+      reader.next(state);
+    }
+    catch (IMC::BufferTooShort& e)
+    {
+      (void)e;
+      thrown = true;
+    }
+
+    test.boolean("caller-provided message: short payload throws", thrown && state.getId() == DUNE_IMC_ESTIMATEDSTATE);
+    test.boolean("caller-provided message: next packet after short payload",
+                 reader.next(state) && state.x == 2.0f);
+  }
+
+  dir.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,228 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// ISO C++ 11 headers.
+#include <atomic>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Concurrency;
+
+//! Number of producer threads.
+static const unsigned c_producers = 4;
+//! Number of elements pushed by each producer.
+static const unsigned c_count = 100000;
+
+class Producer: public Thread
+{
+public:
+  Producer(MPSCQueue<unsigned>& queue, unsigned id, DUNE::IO::Reactor* reactor = NULL):
+    m_queue(queue),
+    m_id(id),
+    m_reactor(reactor),
+    m_done(false)
+  { }
+
+  //! Test if all elements were pushed.
+  bool
+  isDone(void) const
+  {
+    return m_done.load(std::memory_order_acquire);
+  }
+
+  void
+  run(void)
+  {
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      while (!m_queue.push(m_id * c_count + i))
+        Scheduler::yield();
+
+      if (m_reactor != NULL && m_queue.isWaiting())
+        m_reactor->wakeUp();
+    }
+
+    m_done.store(true, std::memory_order_release);
+  }
+
+private:
+  MPSCQueue<unsigned>& m_queue;
+  unsigned m_id;
+  DUNE::IO::Reactor* m_reactor;
+  std::atomic<bool> m_done;
+};
+
+//! Test if all producers pushed all their elements.
+static bool
+allDone(const std::vector<Producer*>& producers)
+{
+  for (size_t i = 0; i < producers.size(); ++i)
+  {
+    if (!producers[i]->isDone())
+      return false;
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Concurrency::MPSCQueue");
+
+  {
+    MPSCQueue<unsigned> queue(5);
+    test.boolean("capacity()", queue.capacity() == 8);
+    test.boolean("empty()", queue.empty());
+
+    unsigned value = 0;
+    test.boolean("pop() on empty queue", !queue.pop(value));
+
+    bool pushed = true;
+    for (unsigned i = 0; i < queue.capacity(); ++i)
+      pushed = pushed && queue.push(i);
+
+    test.boolean("push()", pushed);
+    test.boolean("push() on full queue", !queue.push(100));
+    test.boolean("size()", queue.size() == queue.capacity());
+
+    unsigned values[3];
+    test.boolean("pop() batch", queue.pop(values, 3) == 3);
+    test.boolean("pop() batch order", values[0] == 0 && values[1] == 1 && values[2] == 2);
+
+    bool ordered = true;
+    for (unsigned i = 3; i < queue.capacity(); ++i)
+      ordered = ordered && queue.pop(value) && value == i;
+
+    test.boolean("pop() order", ordered);
+    test.boolean("empty() after pop()", queue.empty());
+    test.boolean("waitForItems() timeout", !queue.waitForItems(0.01));
+  }
+
+  {
+    MPSCQueue<unsigned> queue(256);
+    std::vector<Producer*> producers;
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers.push_back(new Producer(queue, i));
+      producers.back()->start();
+    }
+
+    std::vector<unsigned> next(c_producers, 0);
+    unsigned total = 0;
+    unsigned empty_wakeups = 0;
+    bool ordered = true;
+
+    // Keep draining until every producer is done, so that none of
+    // them is left spinning on a full queue.
+    while (total < c_producers * c_count)
+    {
+      if (!queue.waitForItems(1.0))
+      {
+        if (allDone(producers) && queue.empty())
+          break;
+        continue;
+      }
+
+      if (queue.empty())
+        ++empty_wakeups;
+
+      unsigned value = 0;
+      while (queue.pop(value))
+      {
+        unsigned id = value / c_count;
+        ordered = ordered && (value % c_count) == next[id];
+        ++next[id];
+        ++total;
+      }
+    }
+
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers[i]->join();
+      delete producers[i];
+    }
+
+    test.boolean("concurrent push()", total == c_producers * c_count);
+    test.boolean("concurrent per-producer order", ordered);
+    test.boolean("waitForItems() returns only with items", empty_wakeups == 0);
+  }
+
+  {
+    MPSCQueue<unsigned> queue(256);
+    DUNE::IO::Reactor reactor;
+    std::vector<Producer*> producers;
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers.push_back(new Producer(queue, i, &reactor));
+      producers.back()->start();
+    }
+
+    unsigned total = 0;
+    unsigned timeouts = 0;
+
+    while (total < c_producers * c_count)
+    {
+      if (timeouts > 0 && allDone(producers) && queue.empty())
+        break;
+
+      if (queue.beginWait())
+      {
+        DUNE::Time::Counter<double> counter(1.0);
+        reactor.run(1.0);
+        if (counter.overflow())
+          ++timeouts;
+      }
+
+      queue.endWait();
+
+      unsigned value = 0;
+      while (queue.pop(value))
+        ++total;
+    }
+
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers[i]->join();
+      delete producers[i];
+    }
+
+    test.boolean("waiting on a reactor", total == c_producers * c_count);
+    test.boolean("reactor woken up by producers", timeouts == 0);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,117 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Count the messages that pass the filter.
+static unsigned
+pass(Tasks::MessageFilter& filter, IMC::Message& msg, unsigned count)
+{
+  unsigned passed = 0;
+  for (unsigned i = 0; i < count; ++i)
+  {
+    if (!filter.filter(&msg))
+      ++passed;
+  }
+
+  return passed;
+}
+
+int
+main(void)
+{
+  Test test("Tasks::MessageFilter");
+
+  {
+    Tasks::MessageFilter filter;
+    IMC::Heartbeat msg;
+    test.boolean("no rules", pass(filter, msg, 10) == 10 && filter.getFilteredCount() == 0);
+  }
+
+  {
+    Tasks::MessageFilter filter;
+    std::vector<std::string> spec;
+    spec.push_back("Heartbeat:10:3");
+    spec.push_back("EstimatedState:1");
+    filter.setupRates(spec);
+
+    IMC::Heartbeat hbeat;
+    hbeat.setSourceEntity(1);
+    test.boolean("burst", pass(filter, hbeat, 5) == 3);
+
+    hbeat.setSourceEntity(2);
+    test.boolean("buckets per entity", pass(filter, hbeat, 5) == 3);
+
+    IMC::EstimatedState state;
+    test.boolean("default burst", pass(filter, state, 5) == 1);
+
+    IMC::Temperature temp;
+    test.boolean("other messages pass", pass(filter, temp, 5) == 5);
+
+    test.boolean("filtered count", filter.getFilteredCount() == 8);
+    test.boolean("filtered count per message",
+                 filter.getFilteredCount(IMC::Heartbeat::getIdStatic()) == 4
+                 && filter.getFilteredCount(IMC::EstimatedState::getIdStatic()) == 4);
+
+    Delay::wait(0.25);
+    hbeat.setSourceEntity(1);
+    test.boolean("refill", pass(filter, hbeat, 5) == 2);
+  }
+
+  {
+    Tasks::MessageFilter filter;
+    std::vector<std::string> spec;
+    spec.push_back("Heartbeat:0");
+
+    bool thrown = false;
+    try
+    {
+      filter.setupRates(spec);
+    }
+    catch (std::runtime_error&)
+    {
+      thrown = true;
+    }
+
+    test.boolean("invalid rate", thrown);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,210 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Number of threads of the concurrent test.
+static const unsigned c_threads = 4;
+//! Number of iterations of each thread.
+static const unsigned c_iterations = 20000;
+//! Number of rounds of the cross-thread release test.
+static const unsigned c_rounds = 50;
+//! Number of messages released by each cross-thread round.
+static const unsigned c_round_size = 1000;
+
+//! Produces, clones and deletes messages.
+class Worker: public Concurrency::Thread
+{
+public:
+  Worker(void):
+    m_errors(0)
+  { }
+
+  unsigned
+  getErrors(void) const
+  {
+    return m_errors;
+  }
+
+private:
+  unsigned m_errors;
+
+  void
+  run(void)
+  {
+    std::vector<IMC::Message*> msgs;
+
+    for (unsigned i = 0; i < c_iterations; ++i)
+    {
+      IMC::EstimatedState* state = static_cast<IMC::EstimatedState*>(IMC::Factory::produce(DUNE_IMC_ESTIMATEDSTATE));
+      state->x = i;
+      msgs.push_back(state);
+      msgs.push_back(state->clone());
+      msgs.push_back(new IMC::Rpm);
+
+      if (msgs.size() >= 30)
+      {
+        for (size_t j = 0; j < msgs.size(); ++j)
+        {
+          if (msgs[j]->getId() == DUNE_IMC_ESTIMATEDSTATE
+              && static_cast<IMC::EstimatedState*>(msgs[j])->x != i - (9 - j / 3))
+            ++m_errors;
+
+          delete msgs[j];
+        }
+
+        msgs.clear();
+      }
+    }
+
+    for (size_t j = 0; j < msgs.size(); ++j)
+      delete msgs[j];
+  }
+};
+
+//! Deletes messages produced by another thread.
+class Releaser: public Concurrency::Thread
+{
+public:
+  Releaser(std::vector<IMC::Message*>& msgs):
+    m_msgs(msgs)
+  { }
+
+private:
+  std::vector<IMC::Message*>& m_msgs;
+
+  void
+  run(void)
+  {
+    for (size_t i = 0; i < m_msgs.size(); ++i)
+      delete m_msgs[i];
+
+    m_msgs.clear();
+  }
+};
+
+//! Produce messages in the calling thread and delete them in a
+//! new thread.
+static void
+releaseInOtherThread(void)
+{
+  std::vector<IMC::Message*> msgs;
+  for (unsigned i = 0; i < c_round_size; ++i)
+    msgs.push_back(new IMC::EstimatedState);
+
+  Releaser releaser(msgs);
+  releaser.start();
+  releaser.stopAndJoin();
+}
+
+int
+main(void)
+{
+  Test test("IMC::MessagePool");
+
+  {
+    std::vector<uint32_t> ids;
+    IMC::Factory::getIds(ids);
+
+    bool ok = true;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+      IMC::Message* msg = IMC::Factory::produce(ids[i]);
+      if (msg == NULL || msg->getId() != ids[i])
+        ok = false;
+
+      delete msg;
+    }
+
+    test.boolean("produce() all known ids", ok);
+    test.boolean("produce() unknown id", IMC::Factory::produce(65000) == NULL);
+    test.boolean("produce() id after table", IMC::Factory::produce(0xffffffff) == NULL);
+  }
+
+  {
+    IMC::Message* a = IMC::Factory::produce(DUNE_IMC_ESTIMATEDSTATE);
+    delete a;
+    IMC::Message* b = IMC::Factory::produce(DUNE_IMC_ESTIMATEDSTATE);
+    test.boolean("produce() recycles storage", a == b);
+
+    IMC::Message* c = b->clone();
+    delete c;
+    IMC::Message* d = b->clone();
+    test.boolean("clone() recycles storage", c == d);
+
+    delete b;
+    delete d;
+  }
+
+  {
+    size_t reserved = IMC::MessagePool::getReservedSize();
+    for (unsigned i = 0; i < 10000; ++i)
+    {
+      IMC::Message* msg = new IMC::SonarData;
+      delete msg;
+    }
+
+    test.boolean("no growth in steady state", IMC::MessagePool::getReservedSize() - reserved <= 16384);
+  }
+
+  {
+    Worker workers[c_threads];
+    for (unsigned i = 0; i < c_threads; ++i)
+      workers[i].start();
+
+    unsigned errors = 0;
+    for (unsigned i = 0; i < c_threads; ++i)
+    {
+      workers[i].stopAndJoin();
+      errors += workers[i].getErrors();
+    }
+
+    test.boolean("concurrent produce(), clone() and delete", errors == 0);
+  }
+
+  {
+    releaseInOtherThread();
+    size_t reserved = IMC::MessagePool::getReservedSize();
+    for (unsigned i = 0; i < c_rounds; ++i)
+      releaseInOtherThread();
+
+    test.boolean("no growth releasing in other threads", IMC::MessagePool::getReservedSize() - reserved <= 16384);
+  }
+
+  return test.getReturnValue();
+}
@@ -29,8 +29,10 @@
 
 // ISO C++ 98 headers.
 #include <iostream>
+#include <vector>
 
 // DUNE headers.
+#include <DUNE/IO/Poll.hpp>
 #include <DUNE/Network.hpp>
 
 // Local headers.
@@ -86,5 +88,51 @@ main(void)
     test.boolean("IP address resolution", a.resolve());
   }
 
+  {
+    static const unsigned c_count = 100;
+    static const uint16_t c_port = 46931;
+
+    Address loopback = Address::Loopback;
+    UDPSocket rx;
+    UDPSocket tx;
+    rx.bind(c_port, loopback);
+
+    uint8_t data[c_count];
+    std::vector<UDPSocket::Datagram> out(c_count);
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      data[i] = (uint8_t)i;
+      out[i].data = &data[i];
+      out[i].size = 1;
+      out[i].address = loopback;
+      out[i].port = c_port;
+    }
+
+    test.boolean("Batched UDP write", tx.write(&out[0], c_count) == c_count);
+
+    uint8_t bfr[c_count][16];
+    std::vector<UDPSocket::Datagram> in(c_count);
+    unsigned received = 0;
+    bool ordered = true;
+    while (received < c_count && DUNE::IO::Poll::poll(rx, 1.0))
+    {
+      for (unsigned i = 0; i < c_count; ++i)
+      {
+        in[i].data = bfr[i];
+        in[i].size = sizeof(bfr[i]);
+      }
+
+      size_t rv = rx.read(&in[0], c_count - received);
+      for (size_t i = 0; i < rv; ++i)
+      {
+        ordered = ordered && in[i].size == 1 && in[i].data[0] == received
+        && in[i].address == loopback;
+        ++received;
+      }
+    }
+
+    test.boolean("Batched UDP read", received == c_count && ordered);
+  }
+
   return 0;
 }
@@ -0,0 +1,156 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! UDP port used by the test.
+static const uint16_t c_port = 38211;
+
+//! Counts reactor events.
+class EventCounter: public IO::Reactor::Listener
+{
+public:
+  EventCounter(UDPSocket& sock):
+    reads(0),
+    writes(0),
+    timers(0),
+    m_sock(sock)
+  { }
+
+  void
+  onReadable(const IO::NativeHandle& handle)
+  {
+    (void)handle;
+    uint8_t bfr[16];
+    m_sock.read(bfr, sizeof(bfr));
+    ++reads;
+  }
+
+  void
+  onWritable(const IO::NativeHandle& handle)
+  {
+    (void)handle;
+    ++writes;
+  }
+
+  void
+  onTimer(unsigned timer)
+  {
+    (void)timer;
+    ++timers;
+  }
+
+  volatile unsigned reads;
+  volatile unsigned writes;
+  volatile unsigned timers;
+
+private:
+  UDPSocket& m_sock;
+};
+
+int
+main(void)
+{
+  Test test("IO::Reactor");
+
+  UDPSocket rx;
+  rx.bind(c_port, Address::Loopback);
+  UDPSocket tx;
+  uint8_t data[] = {1, 2, 3};
+
+  {
+    IO::Reactor reactor;
+    EventCounter counter(rx);
+    reactor.add(rx, &counter);
+
+    test.boolean("timeout without events", reactor.run(0.05) == 0);
+
+    tx.write(data, sizeof(data), Address::Loopback, c_port);
+    tx.write(data, sizeof(data), Address::Loopback, c_port);
+    reactor.run(1.0);
+    reactor.run(1.0);
+    test.boolean("level triggered reads", counter.reads == 2);
+
+    reactor.setWritable(rx, true);
+    reactor.run(1.0);
+    test.boolean("writable notification", counter.writes == 1);
+    reactor.setWritable(rx, false);
+    reactor.run(0.05);
+    test.boolean("writable notification disabled", counter.writes == 1);
+
+    unsigned timer = reactor.addTimer(0.01, &counter);
+    double start = Clock::get();
+    while (Clock::get() - start < 0.2)
+      reactor.run(0.1);
+    test.boolean("timer expired", counter.timers >= 10 && counter.timers <= 25);
+
+    reactor.removeTimer(timer);
+    reactor.remove(rx);
+    counter.timers = 0;
+    tx.write(data, sizeof(data), Address::Loopback, c_port);
+    reactor.run(0.05);
+    test.boolean("removed handles are not notified", counter.reads == 2 && counter.timers == 0);
+    rx.read(data, sizeof(data));
+
+    reactor.wakeUp();
+    start = Clock::get();
+    reactor.run(1.0);
+    test.boolean("wake up", Clock::get() - start < 0.5);
+  }
+
+  {
+    IO::ReactorService* service = new IO::ReactorService;
+    EventCounter counter(rx);
+    service->add(rx, &counter);
+    service->addTimer(0.01, &counter);
+
+    for (unsigned i = 0; i < 5; ++i)
+      tx.write(data, sizeof(data), Address::Loopback, c_port);
+
+    double start = Clock::get();
+    while ((counter.reads < 5 || counter.timers < 5) && Clock::get() - start < 2.0)
+      Delay::wait(0.01);
+
+    service->remove(&counter);
+    test.boolean("service dispatched reads", counter.reads == 5);
+    test.boolean("service dispatched timers", counter.timers >= 5);
+
+    start = Clock::get();
+    delete service;
+    test.boolean("service stops promptly", Clock::get() - start < 0.5);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,211 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Network/Reassembler.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Split a message in fragments.
+static void
+split(const IMC::Message& msg, unsigned frag_size, unsigned uid, unsigned src,
+      std::vector<IMC::MessagePart>& parts)
+{
+  ByteBuffer bfr;
+  uint16_t size = IMC::Packet::serialize(&msg, bfr);
+  unsigned num_frags = (size + frag_size - 1) / frag_size;
+
+  parts.clear();
+  for (unsigned i = 0; i < num_frags; ++i)
+  {
+    unsigned len = std::min(frag_size, size - i * frag_size);
+    IMC::MessagePart part;
+    part.setSource(src);
+    part.uid = uid;
+    part.frag_number = i;
+    part.num_frags = num_frags;
+    part.data.assign((char*)bfr.getBuffer() + i * frag_size,
+                     (char*)bfr.getBuffer() + i * frag_size + len);
+    parts.push_back(part);
+  }
+}
+
+//! Feed fragments to a reassembler.
+//! @return true if the message was only reassembled after the last
+//! fragment and is equal to the original.
+static bool
+feed(Reassembler& r, const std::vector<IMC::MessagePart>& parts, const IMC::Message& original)
+{
+  IMC::Message* msg = NULL;
+  for (unsigned i = 0; i < parts.size(); ++i)
+  {
+    if (msg != NULL)
+      return false;
+
+    msg = r.add(&parts[i]);
+  }
+
+  bool rv = msg != NULL && *msg == original;
+  delete msg;
+  return rv;
+}
+
+int
+main(void)
+{
+  Test test("Network::Reassembler");
+
+  IMC::LogBookEntry entry;
+  entry.setTimeStamp(1.0);
+  entry.context = "Test";
+  for (unsigned i = 0; i < 1000; ++i)
+    entry.text.push_back('a' + i % 26);
+
+  std::vector<IMC::MessagePart> parts;
+  split(entry, 100, 7, 0x1234, parts);
+
+  {
+    Reassembler r;
+    test.boolean("in order", feed(r, parts, entry));
+    test.boolean("no transfers left", r.size() == 0);
+  }
+
+  {
+    Reassembler r;
+    std::vector<IMC::MessagePart> reversed(parts.rbegin(), parts.rend());
+    test.boolean("reverse order", feed(r, reversed, entry));
+  }
+
+  {
+    Reassembler r;
+    std::vector<IMC::MessagePart> shuffled(parts);
+    shuffled.insert(shuffled.end(), parts.begin(), parts.begin() + 3);
+    for (unsigned i = 0; i < shuffled.size() - 1; ++i)
+      std::swap(shuffled[i], shuffled[(i * 7) % (shuffled.size() - 1)]);
+    shuffled.push_back(parts.back());
+
+    IMC::Message* msg = NULL;
+    unsigned completed = 0;
+    for (unsigned i = 0; i < shuffled.size(); ++i)
+    {
+      IMC::Message* rv = r.add(&shuffled[i]);
+      if (rv != NULL)
+      {
+        ++completed;
+        delete msg;
+        msg = rv;
+      }
+    }
+
+    test.boolean("shuffled with duplicates", completed == 1 && msg != NULL && *msg == entry);
+    delete msg;
+  }
+
+  {
+    Reassembler r;
+    std::vector<IMC::MessagePart> other;
+    split(entry, 64, 7, 0x4321, other);
+
+    bool ok = true;
+    for (unsigned i = 0; i + 1 < parts.size(); ++i)
+      ok = ok && r.add(&parts[i]) == NULL;
+    for (unsigned i = 0; i + 1 < other.size(); ++i)
+      ok = ok && r.add(&other[i]) == NULL;
+
+    test.boolean("concurrent transfers", ok && r.size() == 2);
+    test.boolean("missing fragments", r.getFragmentsMissing(0x1234, 7) == 1);
+
+    IMC::Message* a = r.add(&parts.back());
+    IMC::Message* b = r.add(&other.back());
+    test.boolean("concurrent transfers complete", a != NULL && b != NULL && *a == entry && *b == entry);
+    delete a;
+    delete b;
+  }
+
+  {
+    Reassembler r(2);
+    std::vector<IMC::MessagePart> p1;
+    std::vector<IMC::MessagePart> p2;
+    std::vector<IMC::MessagePart> p3;
+    split(entry, 100, 1, 1, p1);
+    split(entry, 100, 2, 1, p2);
+    split(entry, 100, 3, 1, p3);
+
+    r.add(&p1[0]);
+    Delay::wait(0.01);
+    r.add(&p2[0]);
+    Delay::wait(0.01);
+    r.add(&p3[0]);
+
+    test.boolean("least recently updated evicted",
+                 r.getFragmentsMissing(1, 1) < 0
+                 && r.getFragmentsMissing(1, 2) == (int)p2.size() - 1
+                 && r.getFragmentsMissing(1, 3) == (int)p3.size() - 1);
+  }
+
+  {
+    Reassembler r(4, 0.0);
+    r.add(&parts[0]);
+    r.add(&parts[1]);
+    Delay::wait(0.01);
+
+    unsigned missing = 0;
+    bool expired = r.expire(missing);
+    test.boolean("expire", expired && missing == parts.size() - 2 && r.size() == 0);
+  }
+
+  {
+    Reassembler r;
+    IMC::MessagePart bad = parts[0];
+    bad.frag_number = bad.num_frags;
+
+    bool thrown = false;
+    try
+    {
+      r.add(&bad);
+    }
+    catch (std::runtime_error&)
+    {
+      thrown = true;
+    }
+
+    test.boolean("invalid fragment number", thrown);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,286 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// ISO C++ 11 headers.
+#include <atomic>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Transports headers.
+#include <Transports/SharedMemory/Ring.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+using Transports::SharedMemory::Ring;
+
+//! Name of the shared memory area.
+static const char* c_name = "test-shared-ring";
+//! Ring capacity.
+static const unsigned c_capacity = 4096;
+//! Number of records of the single-threaded tests.
+static const unsigned c_records = 50000;
+//! Number of records of the two-thread test.
+static const unsigned c_count = 200000;
+//! Largest record size.
+static const unsigned c_max_size = 700;
+
+//! Compute the size of a record.
+//! @param seq record sequence number.
+//! @return record size.
+static unsigned
+getSize(unsigned seq)
+{
+  return 1 + (seq * 2654435761u) % c_max_size;
+}
+
+//! Fill a record with data derived from its sequence number.
+static void
+fill(uint8_t* data, unsigned seq)
+{
+  unsigned size = getSize(seq);
+  for (unsigned i = 0; i < size; ++i)
+    data[i] = (uint8_t)(seq + i * 7);
+}
+
+//! Check the size and contents of a record.
+//! @return true if the record is the expected one.
+static bool
+check(const uint8_t* data, unsigned size, unsigned seq)
+{
+  if (size != getSize(seq))
+    return false;
+
+  for (unsigned i = 0; i < size; ++i)
+  {
+    if (data[i] != (uint8_t)(seq + i * 7))
+      return false;
+  }
+
+  return true;
+}
+
+//! Pop and check one record.
+//! @return true if a valid record was popped.
+static bool
+popRecord(Ring& ring, unsigned seq)
+{
+  unsigned size = 0;
+  const uint8_t* data = ring.peek(size);
+  if (data == NULL)
+    return false;
+
+  bool ok = check(data, size, seq);
+  ring.pop();
+  return ok;
+}
+
+class Producer: public Thread
+{
+public:
+  //! Constructor.
+  //! @param ring producer side of the ring.
+  //! @param count number of records to write.
+  //! @param delay time to wait before writing.
+  Producer(Ring& ring, unsigned count, double delay = 0.0):
+    m_ring(ring),
+    m_count(count),
+    m_delay(delay)
+  { }
+
+  void
+  run(void)
+  {
+    Delay::wait(m_delay);
+
+    for (unsigned i = 0; i < m_count; ++i)
+    {
+      uint8_t* data = NULL;
+      while ((data = m_ring.reserve(getSize(i))) == NULL)
+        Scheduler::yield();
+
+      fill(data, i);
+      m_ring.commit();
+    }
+  }
+
+private:
+  Ring& m_ring;
+  unsigned m_count;
+  double m_delay;
+};
+
+int
+main(void)
+{
+  Test test("Transports::SharedMemory::Ring");
+
+  Ring consumer(c_name, c_capacity);
+  consumer.create();
+
+  Ring producer(c_name, c_capacity);
+  producer.open();
+
+  {
+    unsigned size = 0;
+    test.boolean("empty ring", consumer.empty() && consumer.peek(size) == NULL);
+  }
+
+  {
+    // Each record takes 8 bytes of prefix plus 120 bytes of data.
+    unsigned count = 0;
+    uint8_t* data = NULL;
+    while ((data = producer.reserve(120)) != NULL)
+    {
+      std::memset(data, count, 120);
+      producer.commit();
+      ++count;
+    }
+
+    test.boolean("reserve() returns NULL when full", count == c_capacity / 128);
+
+    consumer.pop();
+    data = producer.reserve(120);
+    test.boolean("reserve() after pop()", data != NULL);
+    if (data != NULL)
+    {
+      std::memset(data, count, 120);
+      producer.commit();
+    }
+
+    unsigned size = 0;
+    const uint8_t* rec = NULL;
+    bool ok = true;
+    for (unsigned i = 1; (rec = consumer.peek(size)) != NULL; ++i)
+    {
+      if (size != 120 || rec[0] != (uint8_t)i)
+        ok = false;
+      consumer.pop();
+    }
+
+    test.boolean("records of a full ring", ok && consumer.empty());
+  }
+
+  {
+    unsigned pushed = 0;
+    unsigned popped = 0;
+    bool ok = true;
+
+    while (pushed < c_records)
+    {
+      uint8_t* data = producer.reserve(getSize(pushed));
+      if (data == NULL)
+      {
+        ok &= popRecord(consumer, popped++);
+        continue;
+      }
+
+      fill(data, pushed++);
+      producer.commit();
+
+      // Keep the ring partially filled, so that records wrap at
+      // varying positions.
+      if (pushed % 3 == 0)
+        ok &= popRecord(consumer, popped++);
+    }
+
+    while (popped < pushed)
+      ok &= popRecord(consumer, popped++);
+
+    test.boolean("wrap-around of variable size records", ok && consumer.empty());
+  }
+
+  {
+    bool ok = true;
+
+    // Abandon reservations, including one that wraps around.
+    for (unsigned i = 0; i < 64; ++i)
+    {
+      uint8_t* data = producer.reserve(getSize(i) + 1000);
+      if (data != NULL)
+        std::memset(data, 0xff, getSize(i) + 1000);
+
+      data = producer.reserve(getSize(i));
+      if (data == NULL)
+      {
+        ok = false;
+        break;
+      }
+
+      fill(data, i);
+      producer.commit();
+      ok &= popRecord(consumer, i);
+    }
+
+    test.boolean("abandoned reservations are not visible", ok && consumer.empty());
+  }
+
+  {
+    Producer thread(producer, 1, 0.2);
+    thread.start();
+
+    double start = Clock::get();
+    consumer.wait(5.0);
+    double elapsed = Clock::get() - start;
+    thread.stopAndJoin();
+
+    test.boolean("commit() wakes up a waiting consumer", elapsed < 2.5 && popRecord(consumer, 0));
+  }
+
+  {
+    Producer thread(producer, c_count);
+    thread.start();
+
+    bool ok = true;
+    unsigned count = 0;
+    double deadline = Clock::get() + 60.0;
+
+    while (count < c_count && Clock::get() < deadline)
+    {
+      if (consumer.empty())
+      {
+        consumer.wait(0.1);
+        continue;
+      }
+
+      ok &= popRecord(consumer, count++);
+    }
+
+    thread.stopAndJoin();
+
+    test.boolean("producer and consumer threads", ok && count == c_count && consumer.empty());
+  }
+
+  return test.getReturnValue();
+}
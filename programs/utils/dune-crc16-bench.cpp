@@ -0,0 +1,88 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Implementation under test.
+typedef uint16_t (*Function)(const uint8_t*, size_t, uint16_t);
+
+//! Benchmark buffer size.
+static const size_t c_bench_size = 65536;
+//! Benchmark iterations.
+static const unsigned c_bench_count = 2000;
+
+//! Compute the throughput of an implementation.
+//! @param function implementation.
+//! @param data data buffer.
+//! @return throughput in MiB/s.
+static double
+benchmark(Function function, const std::vector<uint8_t>& data)
+{
+  volatile uint16_t crc = 0;
+  double start = Clock::get();
+
+  for (unsigned i = 0; i < c_bench_count; ++i)
+    crc = function(&data[0], data.size(), crc);
+
+  double elapsed = Clock::get() - start;
+  return (c_bench_size * (double)c_bench_count) / (elapsed * 1048576.0);
+}
+
+int
+main(void)
+{
+  Math::Random::Generator* prng = Math::Random::Factory::create(Math::Random::Factory::c_default, 1);
+
+  std::vector<uint8_t> data(c_bench_size);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (uint8_t)prng->random();
+
+  delete prng;
+
+  double bytewise_rate = benchmark(CRC16::computeBytewise, data);
+  double slicing_rate = benchmark(CRC16::computeSlicingBy8, data);
+
+  std::printf("bytewise:             %8.0f MiB/s\n", bytewise_rate);
+  std::printf("slicing-by-8:         %8.0f MiB/s (%.1fx)\n", slicing_rate, slicing_rate / bytewise_rate);
+
+  if (CRC16::hasCarrylessMultiply())
+  {
+    double clmul_rate = benchmark(CRC16::computeCarrylessMultiply, data);
+    std::printf("carry-less multiply:  %8.0f MiB/s (%.1fx)\n", clmul_rate, clmul_rate / bytewise_rate);
+  }
+
+  return 0;
+}
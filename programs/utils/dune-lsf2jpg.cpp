@@ -46,31 +46,19 @@ main(int argc, char** argv)
     return 1;
   }
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
-
-  DUNE::IMC::Message* msg = NULL;
+  DUNE::IMC::CompressedImage img;
 
   Path folder = Path(argv[1]).dirname();
 
   try
   {
-    while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
-    {
-      if (msg->getId() == DUNE_IMC_COMPRESSEDIMAGE)
-      {
-        DUNE::IMC::CompressedImage* img = static_cast<DUNE::IMC::CompressedImage*>(msg);
-
-        Path fname = folder / String::str("%0.4f.jpg", img->getTimeStamp());
-        std::ofstream ofs(fname.c_str(), std::ios::binary);
-        ofs.write(&(img->data[0]), img->data.size());
-      }
+    DUNE::IMC::LSFReader reader(argv[1]);
 
-      delete msg;
+    while (reader.next(img))
+    {
+      Path fname = folder / String::str("%0.4f.jpg", img.getTimeStamp());
+      std::ofstream ofs(fname.c_str(), std::ios::binary);
+      ofs.write(&(img.data[0]), img.data.size());
     }
   }
   catch (std::runtime_error& e)
@@ -78,7 +66,5 @@ main(int argc, char** argv)
     std::cerr << "ERROR: " << e.what() << std::endl;
   }
 
-  delete is;
-
   return 0;
 }
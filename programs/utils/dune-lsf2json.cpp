@@ -0,0 +1,79 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+// Utility to export LSF files as JSON lines.                               *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <iostream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+using DUNE_NAMESPACES;
+
+//! Amount of output buffered before writing to standard output.
+static const size_t c_flush_size = 65536;
+
+int
+main(int argc, char** argv)
+{
+  if (argc != 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " Data.lsf[.gz]" << std::endl;
+    return 1;
+  }
+
+  IMC::JSONWriter writer(c_flush_size * 2);
+
+  try
+  {
+    IMC::LSFReader reader(argv[1]);
+    IMC::Message* msg = NULL;
+
+    while ((msg = reader.next()) != NULL)
+    {
+      msg->toJSON(writer);
+      writer.newLine();
+      delete msg;
+
+      if (writer.getSize() >= c_flush_size)
+      {
+        std::fwrite(writer.getData(), 1, writer.getSize(), stdout);
+        writer.clear();
+      }
+    }
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+  }
+
+  std::fwrite(writer.getData(), 1, writer.getSize(), stdout);
+  return 0;
+}
@@ -192,7 +192,6 @@ main(int argc, char** argv)
   for (; *argv != 0; argv++)
   {
     Path file(*argv);
-    std::istream* is;
 
     if (file.isDirectory())
     {
@@ -207,35 +206,41 @@ main(int argc, char** argv)
       return 1;
     }
 
-    Compression::Methods method = Compression::Factory::detect(file.c_str());
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(file.c_str(), std::ios::binary);
-    else
-      is = new Compression::FileInput(file.c_str(), method);
-
-    IMC::Message* m;
-
-    m = IMC::Packet::deserialize(*is);
+    IMC::LSFReader reader(file.str());
+    IMC::Message* m = reader.next();
     if (!m)
     {
       std::cerr << file << " contains no messages\n";
-      delete is;
       continue;
     }
 
     DUNE::Utils::ByteBuffer bb;
 
     double time_origin = m->getTimeStamp();
-    if (begin >= 0)
+
+    // Let the reader skip unwanted messages using the LSF index.
+    if (filtering)
     {
-      do
+      std::map<std::string, bool>::const_iterator itr = filter.begin();
+      for (; itr != filter.end(); ++itr)
       {
-        if (m->getTimeStamp() - time_origin >= begin)
-          break;
-        delete m;
-        m = IMC::Packet::deserialize(*is);
+        try
+        {
+          reader.addFilter(IMC::Factory::getIdFromAbbrev(itr->first));
+        }
+        catch (std::exception& e)
+        {
+          std::cerr << e.what() << std::endl;
+          return 1;
+        }
       }
-      while (m);
+    }
+
+    if (begin > 0 || filtering)
+    {
+      delete m;
+      reader.seek(time_origin + begin);
+      m = reader.next();
 
       if (!m)
       {
@@ -243,8 +248,6 @@ main(int argc, char** argv)
         return 1;
       }
     }
-    else
-      begin = 0;
 
     double start_time = Clock::getSinceEpoch();
     double now = start_time;
@@ -287,8 +290,7 @@ main(int argc, char** argv)
       if (end >= 0 && vtime >= end)
         break;
     }
-    while ((m = IMC::Packet::deserialize(*is)) != 0);
-    delete is;
+    while ((m = reader.next()) != 0);
   }
   return 0;
 }
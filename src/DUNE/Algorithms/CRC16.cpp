@@ -27,9 +27,22 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/Algorithms/CRC16.hpp>
 
+// Carry-less multiplication is only available on x86 processors and
+// selected at runtime, so the code is compiled with function-level
+// target attributes instead of global compiler flags.
+#if defined(DUNE_CPU_X86) && defined(__GNUC__)
+#  define DUNE_CRC16_CLMUL
+#  include <cpuid.h>
+#  include <emmintrin.h>
+#  include <wmmintrin.h>
+#endif
+
 namespace DUNE
 {
   namespace Algorithms
@@ -69,5 +82,232 @@ namespace DUNE
       0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
       0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
     };
+
+    //! Normal representation of the polynomial.
+    static const uint32_t c_polynomial = 0x18005;
+
+    //! Lookup tables and folding constants.
+    struct Tables
+    {
+      //! Slicing-by-8 tables: slices[k][b] is the CRC of byte b
+      //! followed by k zero bytes.
+      uint16_t slices[8][256];
+      //! Constants to fold 128-bit blocks by 128 bits.
+      uint64_t fold128[2];
+      //! Constants to fold 128-bit blocks by 512 bits.
+      uint64_t fold512[2];
+
+      Tables(void)
+      {
+        std::memcpy(slices[0], c_crc16_ibm_table, sizeof(slices[0]));
+
+        for (unsigned k = 1; k < 8; ++k)
+        {
+          for (unsigned b = 0; b < 256; ++b)
+            slices[k][b] = (slices[k - 1][b] >> 8) ^ slices[0][slices[k - 1][b] & 0xff];
+        }
+
+        getFoldConstants(128, fold128);
+        getFoldConstants(512, fold512);
+      }
+
+      //! Compute x^n mod P.
+      //! @param n exponent.
+      //! @return remainder in normal representation.
+      static uint32_t
+      getRemainder(unsigned n)
+      {
+        uint32_t r = 1;
+        for (unsigned i = 0; i < n; ++i)
+        {
+          r <<= 1;
+          if (r & 0x10000)
+            r ^= c_polynomial;
+        }
+
+        return r;
+      }
+
+      //! Reflect a remainder so that, multiplied by a reflected
+      //! 64-bit block, the product is aligned with the 128-bit block
+      //! it is folded into.
+      //! @param r remainder in normal representation.
+      //! @return reflected remainder.
+      static uint64_t
+      reflect(uint32_t r)
+      {
+        uint64_t v = 0;
+        for (unsigned k = 0; k < 16; ++k)
+        {
+          if (r & (1U << k))
+            v |= (uint64_t)1 << (16 - k);
+        }
+
+        return v;
+      }
+
+      //! Compute the constants used to fold a 128-bit block over a
+      //! given distance. The low half of the block (first eight
+      //! bytes) is multiplied by x^(distance + 64) and the high half
+      //! by x^distance.
+      //! @param distance distance in bits.
+      //! @param k constants (low half, high half).
+      static void
+      getFoldConstants(unsigned distance, uint64_t k[2])
+      {
+        k[0] = reflect(getRemainder(distance + 16));
+        k[1] = reflect(getRemainder(distance - 48));
+      }
+    };
+
+    //! Retrieve the lookup tables.
+    //! @return lookup tables.
+    static const Tables&
+    getTables(void)
+    {
+      static const Tables tables;
+      return tables;
+    }
+
+    uint16_t
+    CRC16::computeSlicingBy8(const uint8_t* buffer, size_t len, uint16_t crc)
+    {
+      const uint16_t (*t)[256] = getTables().slices;
+
+      while (len >= 8)
+      {
+        crc = t[7][(buffer[0] ^ crc) & 0xff]
+        ^ t[6][(buffer[1] ^ (crc >> 8)) & 0xff]
+        ^ t[5][buffer[2]] ^ t[4][buffer[3]]
+        ^ t[3][buffer[4]] ^ t[2][buffer[5]]
+        ^ t[1][buffer[6]] ^ t[0][buffer[7]];
+
+        buffer += 8;
+        len -= 8;
+      }
+
+      return computeBytewise(buffer, len, crc);
+    }
+
+#if defined(DUNE_CRC16_CLMUL)
+    //! Fold a 128-bit block.
+    //! @param x block.
+    //! @param k folding constants.
+    //! @return folded block.
+    __attribute__((target("pclmul,sse2")))
+    static inline __m128i
+    fold(__m128i x, __m128i k)
+    {
+      return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                           _mm_clmulepi64_si128(x, k, 0x11));
+    }
+
+    //! Compute the CRC using carry-less multiplication. The buffer is
+    //! folded into a single 128-bit block congruent with it, modulo
+    //! the polynomial, and the CRC of that block is computed with
+    //! lookup tables.
+    //! @param buffer data buffer (at least 16 bytes).
+    //! @param len data buffer length.
+    //! @param crc CRC-16-IBM value to update.
+    //! @return computed CRC-16-IBM.
+    __attribute__((target("pclmul,sse2")))
+    static uint16_t
+    computeCLMUL(const uint8_t* buffer, size_t len, uint16_t crc)
+    {
+      const Tables& tables = getTables();
+      const __m128i k128 = _mm_set_epi64x(tables.fold128[1], tables.fold128[0]);
+
+      // The initial CRC is equivalent to changing the first two bytes.
+      __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)buffer),
+                                _mm_cvtsi32_si128(crc));
+
+      if (len >= 64)
+      {
+        const __m128i k512 = _mm_set_epi64x(tables.fold512[1], tables.fold512[0]);
+
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(buffer + 16));
+        __m128i x2 = _mm_loadu_si128((const __m128i*)(buffer + 32));
+        __m128i x3 = _mm_loadu_si128((const __m128i*)(buffer + 48));
+        buffer += 64;
+        len -= 64;
+
+        while (len >= 64)
+        {
+          x = _mm_xor_si128(fold(x, k512), _mm_loadu_si128((const __m128i*)buffer));
+          x1 = _mm_xor_si128(fold(x1, k512), _mm_loadu_si128((const __m128i*)(buffer + 16)));
+          x2 = _mm_xor_si128(fold(x2, k512), _mm_loadu_si128((const __m128i*)(buffer + 32)));
+          x3 = _mm_xor_si128(fold(x3, k512), _mm_loadu_si128((const __m128i*)(buffer + 48)));
+          buffer += 64;
+          len -= 64;
+        }
+
+        x = _mm_xor_si128(fold(x, k128), x1);
+        x = _mm_xor_si128(fold(x, k128), x2);
+        x = _mm_xor_si128(fold(x, k128), x3);
+      }
+      else
+      {
+        buffer += 16;
+        len -= 16;
+      }
+
+      while (len >= 16)
+      {
+        x = _mm_xor_si128(fold(x, k128), _mm_loadu_si128((const __m128i*)buffer));
+        buffer += 16;
+        len -= 16;
+      }
+
+      uint8_t block[16];
+      _mm_storeu_si128((__m128i*)block, x);
+
+      crc = CRC16::computeSlicingBy8(block, sizeof(block), 0);
+      return CRC16::computeSlicingBy8(buffer, len, crc);
+    }
+
+    //! Test if the processor supports carry-less multiplication.
+    //! @return true if supported, false otherwise.
+    static bool
+    detectCLMUL(void)
+    {
+      unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+      if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return false;
+
+      return (ecx & bit_PCLMUL) && (edx & bit_SSE2);
+    }
+#endif
+
+    bool
+    CRC16::hasCarrylessMultiply(void)
+    {
+#if defined(DUNE_CRC16_CLMUL)
+      static const bool supported = detectCLMUL();
+      return supported;
+#else
+      return false;
+#endif
+    }
+
+    uint16_t
+    CRC16::computeCarrylessMultiply(const uint8_t* buffer, size_t len, uint16_t crc)
+    {
+#if defined(DUNE_CRC16_CLMUL)
+      if (len >= 16 && hasCarrylessMultiply())
+        return computeCLMUL(buffer, len, crc);
+#endif
+
+      return computeSlicingBy8(buffer, len, crc);
+    }
+
+    uint16_t
+    CRC16::computeBlock(const uint8_t* buffer, size_t len, uint16_t crc)
+    {
+      // Below this size folding does not pay off.
+      if (len >= 64)
+        return computeCarrylessMultiply(buffer, len, crc);
+
+      return computeSlicingBy8(buffer, len, crc);
+    }
   }
 }
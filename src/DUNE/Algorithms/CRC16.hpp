@@ -30,6 +30,9 @@
 #ifndef DUNE_ALGORITHMS_CRC16_HPP_INCLUDED_
 #define DUNE_ALGORITHMS_CRC16_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <cstddef>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -44,6 +47,12 @@ namespace DUNE
 
     //! CRC-16-IBM Algorithm.
     //! The polynomial used is x^16 + x^15 + x^2 + 1 (0x8005)
+    //!
+    //! Short buffers are processed one byte at a time. Longer buffers
+    //! are processed eight bytes at a time (slicing-by-8) or, on x86
+    //! processors supporting it, 64 bytes at a time using carry-less
+    //! multiplication (PCLMULQDQ). The implementation is selected at
+    //! runtime.
     class CRC16
     {
     public:
@@ -55,10 +64,10 @@ namespace DUNE
       static inline uint16_t
       compute(const uint8_t* buffer, uint16_t len, uint16_t crc = 0)
       {
-        while (len--)
-          crc = (crc >> 8) ^ c_crc16_ibm_table[(crc ^ *buffer++) & 0xff];
+        if (len >= c_block_threshold)
+          return computeBlock(buffer, len, crc);
 
-        return crc;
+        return computeBytewise(buffer, len, crc);
       }
 
       //! Compute the CRC-16-IBM of a given byte.
@@ -70,6 +79,59 @@ namespace DUNE
       {
         return (crc >> 8) ^ c_crc16_ibm_table[(crc ^ byte) & 0xff];
       }
+
+      //! Compute the CRC-16-IBM of a given data buffer using the best
+      //! implementation available, regardless of the buffer size.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-16-IBM value to update.
+      //! @return computed CRC-16-IBM.
+      static uint16_t
+      computeBlock(const uint8_t* buffer, size_t len, uint16_t crc = 0);
+
+      //! Compute the CRC-16-IBM of a given data buffer one byte at a
+      //! time.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-16-IBM value to update.
+      //! @return computed CRC-16-IBM.
+      static inline uint16_t
+      computeBytewise(const uint8_t* buffer, size_t len, uint16_t crc = 0)
+      {
+        while (len--)
+          crc = (crc >> 8) ^ c_crc16_ibm_table[(crc ^ *buffer++) & 0xff];
+
+        return crc;
+      }
+
+      //! Compute the CRC-16-IBM of a given data buffer eight bytes at
+      //! a time.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-16-IBM value to update.
+      //! @return computed CRC-16-IBM.
+      static uint16_t
+      computeSlicingBy8(const uint8_t* buffer, size_t len, uint16_t crc = 0);
+
+      //! Test if the processor supports carry-less multiplication.
+      //! @return true if computeCarrylessMultiply() is accelerated,
+      //! false otherwise.
+      static bool
+      hasCarrylessMultiply(void);
+
+      //! Compute the CRC-16-IBM of a given data buffer using
+      //! carry-less multiplication. If the processor does not support
+      //! it, the slicing-by-8 implementation is used.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-16-IBM value to update.
+      //! @return computed CRC-16-IBM.
+      static uint16_t
+      computeCarrylessMultiply(const uint8_t* buffer, size_t len, uint16_t crc = 0);
+
+    private:
+      //! Minimum buffer size processed by computeBlock().
+      static const uint16_t c_block_threshold = 16;
     };
   }
 }
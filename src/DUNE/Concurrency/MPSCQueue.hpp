@@ -0,0 +1,346 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_MPSC_QUEUE_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_MPSC_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <vector>
+
+// ISO C++ 11 headers.
+#include <atomic>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Bounded, lock-free, multiple producer / single consumer FIFO
+    //! queue. Each slot carries a sequence number that tells
+    //! producers and consumers if it is free or holds a published
+    //! value, so pushing and popping never take a lock. Only one
+    //! thread may wait for items, but any thread may pop elements
+    //! (e.g. producers discarding the oldest element of a full
+    //! queue).
+    //! The consumer can sleep waiting for items; producers only
+    //! touch the associated condition when the consumer is
+    //! actually sleeping.
+    template <typename T>
+    class MPSCQueue
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity maximum number of elements (rounded up
+      //! to the next power of two).
+      MPSCQueue(size_t capacity = 1024):
+        m_sleeping(false)
+      {
+        size_t size = 2;
+        while (size < capacity)
+          size <<= 1;
+
+        m_mask = size - 1;
+        m_cells = std::vector<Cell>(size);
+        for (size_t i = 0; i < size; ++i)
+          m_cells[i].sequence.store(i, std::memory_order_relaxed);
+
+        m_head.store(0, std::memory_order_relaxed);
+        m_tail.store(0, std::memory_order_relaxed);
+      }
+
+      //! Retrieve the maximum number of elements the queue can hold.
+      //! @return queue capacity.
+      size_t
+      capacity(void) const
+      {
+        return m_mask + 1;
+      }
+
+      //! Add an element to the end of the queue. Can be called
+      //! concurrently by any number of threads.
+      //! @param[in] value element to insert.
+      //! @return true if the element was inserted, false if the queue
+      //! is full.
+      bool
+      push(const T& value)
+      {
+        Cell* cell = NULL;
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+          cell = &m_cells[pos & m_mask];
+          size_t seq = cell->sequence.load(std::memory_order_acquire);
+          std::ptrdiff_t diff = (std::ptrdiff_t)seq - (std::ptrdiff_t)pos;
+
+          if (diff == 0)
+          {
+            if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+              break;
+          }
+          else if (diff < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = m_tail.load(std::memory_order_relaxed);
+          }
+        }
+
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        wakeUp();
+        return true;
+      }
+
+      //! Retrieve and remove the first element of the queue. This is
+      //! normally called by the consumer thread, but producers may
+      //! also call it to make room for new elements.
+      //! @param[out] value where to store the popped value.
+      //! @return true if an element was popped, false otherwise.
+      bool
+      pop(T& value)
+      {
+        Cell* cell = NULL;
+        size_t pos = m_head.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+          cell = &m_cells[pos & m_mask];
+          size_t seq = cell->sequence.load(std::memory_order_acquire);
+          std::ptrdiff_t diff = (std::ptrdiff_t)seq - (std::ptrdiff_t)(pos + 1);
+
+          if (diff == 0)
+          {
+            if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+              break;
+          }
+          else if (diff < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = m_head.load(std::memory_order_relaxed);
+          }
+        }
+
+        value = cell->value;
+        cell->value = T();
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+      }
+
+      //! Retrieve and remove up to a given number of elements from the
+      //! front of the queue.
+      //! @param[out] values array where to store popped values.
+      //! @param[in] count maximum number of elements to pop.
+      //! @return number of popped elements.
+      size_t
+      pop(T* values, size_t count)
+      {
+        size_t i = 0;
+        for (; i < count; ++i)
+        {
+          if (!pop(values[i]))
+            break;
+        }
+
+        return i;
+      }
+
+      //! Check if the queue has elements.
+      //! @return true if the queue has no elements, false otherwise.
+      bool
+      empty(void) const
+      {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+      }
+
+      //! Retrieve the approximate number of elements in the queue.
+      //! @return number of elements.
+      size_t
+      size(void) const
+      {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_relaxed);
+        return (tail > head) ? tail - head : 0;
+      }
+
+      //! Wait for items to be available. Must only be called by the
+      //! consumer thread.
+      //! @param[in] timeout timeout in seconds, use a negative number
+      //! to wait forever.
+      //! @return true if at least one element is available, false
+      //! if the timeout expired.
+      bool
+      waitForItems(double timeout = -1.0)
+      {
+        if (!empty())
+          return true;
+
+        if (timeout == 0)
+          return false;
+
+        double deadline = Time::Clock::get() + timeout;
+
+        ScopedCondition l(m_cond);
+        m_sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Wake ups may be stale (signalled for an element that was
+        // already consumed), so wait until there is an element or the
+        // deadline expires.
+        while (empty())
+        {
+          if (timeout < 0)
+          {
+            m_cond.wait();
+            continue;
+          }
+
+          double remaining = deadline - Time::Clock::get();
+          if (remaining <= 0)
+            break;
+
+          m_cond.wait(remaining);
+        }
+
+        m_sleeping.store(false, std::memory_order_relaxed);
+        return !empty();
+      }
+
+      //! Announce that the consumer is about to wait for items by
+      //! other means than waitForItems() (e.g., polling I/O handles
+      //! together with a wake up event signalled by producers when
+      //! isWaiting() is true). Must only be called by the consumer
+      //! thread and followed by endWait().
+      //! @return true if the queue is empty and the consumer may
+      //! block, false otherwise.
+      bool
+      beginWait(void)
+      {
+        m_sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return empty();
+      }
+
+      //! Announce that the consumer stopped waiting.
+      void
+      endWait(void)
+      {
+        m_sleeping.store(false, std::memory_order_relaxed);
+      }
+
+      //! Test if the consumer is waiting for items. Producers must
+      //! call this after push().
+      //! @return true if the consumer is waiting, false otherwise.
+      bool
+      isWaiting(void) const
+      {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return m_sleeping.load(std::memory_order_relaxed);
+      }
+
+      //! Wake up the consumer if it is waiting for items.
+      void
+      wakeUp(void)
+      {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!m_sleeping.load(std::memory_order_relaxed))
+          return;
+
+        ScopedCondition l(m_cond);
+        m_cond.signal();
+      }
+
+    private:
+      //! Queue slot.
+      struct Cell
+      {
+        Cell(void)
+        { }
+
+        Cell(const Cell& other):
+          value(other.value)
+        {
+          sequence.store(other.sequence.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        Cell&
+        operator=(const Cell& other)
+        {
+          value = other.value;
+          sequence.store(other.sequence.load(std::memory_order_relaxed), std::memory_order_relaxed);
+          return *this;
+        }
+
+        //! Slot sequence number.
+        std::atomic<size_t> sequence;
+        //! Slot value.
+        T value;
+      };
+
+      //! Slots.
+      std::vector<Cell> m_cells;
+      //! Index mask.
+      size_t m_mask;
+      //! Position of the next element to pop (consumer side).
+      std::atomic<size_t> m_head;
+      //! Keep consumer and producer positions in different cache lines.
+      char m_pad0[64];
+      //! Position of the next element to push (producer side).
+      std::atomic<size_t> m_tail;
+      //! Keep producer position and consumer state in different cache lines.
+      char m_pad1[64];
+      //! True if the consumer is waiting for items.
+      std::atomic<bool> m_sleeping;
+      //! Condition used to put the consumer to sleep.
+      Condition m_cond;
+
+      //! Non - copyable.
+      MPSCQueue(const MPSCQueue&);
+
+      //! Non - assignable.
+      MPSCQueue&
+      operator=(const MPSCQueue&);
+    };
+  }
+}
+
+#endif
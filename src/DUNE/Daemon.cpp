@@ -297,6 +297,9 @@ namespace DUNE
   {
     measureCpuUsage();
 
+    // Report tasks discarding messages.
+    m_tman->reportQueueUsage();
+
     // Dispatch available storage.
     if (m_fs_capacity > 0)
     {
@@ -42,14 +42,19 @@ namespace DUNE
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/Macros.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
 #include <DUNE/IMC/Parser.hpp>
+#include <DUNE/IMC/LSFIndex.hpp>
+#include <DUNE/IMC/LSFReader.hpp>
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 #include <DUNE/IMC/Blob.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/JSONReader.hpp>
 #include <DUNE/IMC/IridiumMessageDefinitions.hpp>
 
 #endif
@@ -31,6 +31,7 @@
 #include <algorithm>
 
 // DUNE headers.
+#include <DUNE/Concurrency/Scheduler.hpp>
 #include <DUNE/Streams/Terminal.hpp>
 #include <DUNE/Utils/String.hpp>
 #include <DUNE/IMC/Factory.hpp>
@@ -44,25 +45,48 @@ namespace DUNE
   {
     struct BackLogEntry
     {
-      BackLogEntry(const Message* msg, Tasks::AbstractTask* exc):
-        message(msg->clone()),
+      BackLogEntry(const SharedMessage& msg, Tasks::AbstractTask* exc):
+        message(msg),
         exclude(exc)
       {  }
 
-      ~BackLogEntry(void)
-      {
-        delete message;
-      }
-
       //! Message.
-      Message* message;
+      SharedMessage message;
       //! Exclude this task.
       Tasks::AbstractTask* exclude;
     };
 
+    //! Retrieve the dispatcher slot of the calling thread.
+    //! @return dispatcher slot.
+    static unsigned
+    getReaderSlot(void)
+    {
+      static std::atomic<unsigned> s_next(0);
+      static thread_local unsigned slot = s_next.fetch_add(1, std::memory_order_relaxed);
+      return slot;
+    }
+
     Bus::Bus(void):
+      m_recipients(NULL),
+      m_recipients_size(0),
+      m_epoch(0),
       m_paused(false)
-    { }
+    {
+      for (unsigned i = 0; i < c_reader_slots; ++i)
+      {
+        m_readers[i].count[0].store(0, std::memory_order_relaxed);
+        m_readers[i].count[1].store(0, std::memory_order_relaxed);
+      }
+
+      std::vector<uint32_t> ids;
+      Factory::getIds(ids);
+      for (unsigned i = 0; i < ids.size(); ++i)
+        m_recipients_size = std::max(m_recipients_size, (size_t)ids[i] + 1);
+
+      m_recipients = new std::atomic<const TransportList*>[m_recipients_size];
+      for (size_t i = 0; i < m_recipients_size; ++i)
+        m_recipients[i].store(NULL, std::memory_order_relaxed);
+    }
 
     Bus::~Bus(void)
     {
@@ -75,6 +99,55 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_bind_msgs.size(); ++i)
         delete m_bind_msgs[i];
+
+      for (size_t i = 0; i < m_recipients_size; ++i)
+        delete m_recipients[i].load(std::memory_order_relaxed);
+
+      delete [] m_recipients;
+    }
+
+    unsigned
+    Bus::enter(unsigned slot)
+    {
+      // A writer may flip the epoch between reading it and
+      // registering; it would then not wait for this reader, so
+      // retry until the registration is made in the current epoch.
+      while (true)
+      {
+        unsigned epoch = m_epoch.load();
+        unsigned parity = epoch & 1;
+        m_readers[slot].count[parity].fetch_add(1);
+        if (m_epoch.load() == epoch)
+          return parity;
+
+        m_readers[slot].count[parity].fetch_sub(1);
+      }
+    }
+
+    void
+    Bus::leave(unsigned slot, unsigned epoch)
+    {
+      m_readers[slot].count[epoch].fetch_sub(1, std::memory_order_release);
+    }
+
+    void
+    Bus::publish(uint16_t id, const TransportList* list)
+    {
+      const TransportList* old = m_recipients[id].exchange(list);
+      if (old == NULL)
+        return;
+
+      // New dispatchers will use the other set of counters and will
+      // see the new list, so we only need to wait for the ones
+      // registered in the previous epoch.
+      unsigned epoch = m_epoch.fetch_add(1) & 1;
+      for (unsigned i = 0; i < c_reader_slots; ++i)
+      {
+        while (m_readers[i].count[epoch].load() != 0)
+          Concurrency::Scheduler::yield();
+      }
+
+      delete old;
     }
 
     void
@@ -86,47 +159,138 @@ namespace DUNE
       bind->consumer = task->getName();
       bind->message_id = id;
 
-      Concurrency::ScopedRWLock l(m_lock, true);
+      Concurrency::ScopedMutex l(m_lock);
       m_bind_msgs.push_back(bind);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+
+      if (id >= m_recipients_size)
+        return;
+
+      const TransportList* current = m_recipients[id].load(std::memory_order_acquire);
+      if (current != NULL && std::find(current->begin(), current->end(), task) != current->end())
+        return;
+
+      TransportList* list = (current == NULL) ? new TransportList : new TransportList(*current);
+      list->push_back(task);
+      publish(id, list);
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
-      Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+      Concurrency::ScopedMutex l(m_lock);
+
+      if (id >= m_recipients_size)
+        return;
+
+      const TransportList* current = m_recipients[id].load(std::memory_order_acquire);
+      if (current == NULL || std::find(current->begin(), current->end(), task) == current->end())
+        return;
+
+      TransportList* list = new TransportList(*current);
+      list->erase(std::remove(list->begin(), list->end(), task), list->end());
+      publish(id, list->empty() ? NULL : list);
+      if (list->empty())
+        delete list;
     }
 
     void
     Bus::dispatch(const Message* msg, Tasks::AbstractTask* task)
     {
+      SharedMessage shared;
+      deliver(msg, shared, task);
+    }
+
+    void
+    Bus::dispatch(const SharedMessage& msg, Tasks::AbstractTask* task)
+    {
+      SharedMessage shared(msg);
+      deliver(msg.get(), shared, task);
+    }
+
+    bool
+    Bus::hasRecipients(uint16_t id, const Tasks::AbstractTask* task)
+    {
+      if (m_paused.load())
+        return true;
+
+      if (id >= m_recipients_size)
+        return false;
+
+      unsigned slot = getReaderSlot() % c_reader_slots;
+      unsigned epoch = enter(slot);
+
+      bool found = false;
+      const TransportList* dlst = m_recipients[id].load();
+      if (dlst != NULL)
+      {
+        for (TransportList::const_iterator itr = dlst->begin(); itr != dlst->end(); ++itr)
+        {
+          if (*itr != task)
+          {
+            found = true;
+            break;
+          }
+        }
+      }
+
+      leave(slot, epoch);
+      return found;
+    }
+
+    void
+    Bus::deliver(const Message* msg, SharedMessage& shared, Tasks::AbstractTask* task)
+    {
+      if (m_paused.load())
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
-        if (m_paused)
+        if (m_paused.load())
         {
-          m_back_log.push(new BackLogEntry(msg, task));
+          if (shared.isNull())
+            shared = SharedMessage(msg->clone());
+
+          m_back_log.push(new BackLogEntry(shared, task));
           return;
         }
       }
 
       uint16_t id = msg->getId();
-      Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
-      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+      if (id >= m_recipients_size)
+        return;
+
+      unsigned slot = getReaderSlot() % c_reader_slots;
+      unsigned epoch = enter(slot);
+
+      try
+      {
+        const TransportList* dlst = m_recipients[id].load();
+        if (dlst != NULL)
+        {
+          for (TransportList::const_iterator itr = dlst->begin(); itr != dlst->end(); ++itr)
+          {
+            if (*itr == task)
+              continue;
+
+            if (shared.isNull())
+              shared = SharedMessage(msg->clone());
+
+            (*itr)->receive(shared);
+          }
+        }
+      }
+      catch (...)
       {
-        if (*itr != task)
-          (*itr)->receive(msg);
+        leave(slot, epoch);
+        throw;
       }
+
+      leave(slot, epoch);
     }
 
     void
     Bus::resume(void)
     {
       m_paused_lock.lock();
-      m_paused = false;
+      m_paused.store(false);
       m_paused_lock.unlock();
 
       while (!m_back_log.empty())
@@ -143,7 +307,7 @@ namespace DUNE
     const std::vector<TransportBindings*>
     Bus::getBindings(void)
     {
-      Concurrency::ScopedRWLock l(m_lock);
+      Concurrency::ScopedMutex l(m_lock);
       return m_bind_msgs;
     }
   }
@@ -32,18 +32,19 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
-#include <map>
-#include <list>
 #include <string>
 #include <utility>
 #include <vector>
 #include <queue>
 
+// ISO C++ 11 headers.
+#include <atomic>
+
 // DUNE headers.
 #include <DUNE/Tasks/AbstractTask.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
-#include <DUNE/Concurrency/ScopedRWLock.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 
 namespace DUNE
 {
@@ -79,17 +80,36 @@ namespace DUNE
       void
       unregisterRecipient(Tasks::AbstractTask* task, uint16_t id);
 
-      //! Dispatches a message to registered listeners.
+      //! Dispatches a message to registered listeners. The message
+      //! is copied at most once and the copy is shared by all
+      //! recipients.
       //! @param msg message to dispatch.
       //! @param task do not deliver message to this task.
       void
       dispatch(const Message* msg, Tasks::AbstractTask* task = NULL);
 
+      //! Dispatches a shared message to registered listeners without
+      //! copying it.
+      //! @param msg message to dispatch.
+      //! @param task do not deliver message to this task.
+      void
+      dispatch(const SharedMessage& msg, Tasks::AbstractTask* task = NULL);
+
+      //! Test if a message with the given identification number
+      //! would be delivered to at least one recipient. While the bus
+      //! is paused every message is considered to have recipients,
+      //! since registrations may change before it is resumed.
+      //! @param id message identification number.
+      //! @param task ignore this task.
+      //! @return true if the message has recipients, false otherwise.
+      bool
+      hasRecipients(uint16_t id, const Tasks::AbstractTask* task = NULL);
+
       inline void
       pause(void)
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
-        m_paused = true;
+        m_paused.store(true);
       }
 
       void
@@ -99,13 +119,34 @@ namespace DUNE
       getBindings(void);
 
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
-      //! Table of recipients.
-      std::map<uint16_t, TransportList> m_recipients;
-      //! Internal list lock.
-      Concurrency::RWLock m_lock;
+      typedef std::vector<Tasks::AbstractTask*> TransportList;
+      //! Number of dispatchers inside each epoch. Dispatching threads
+      //! are spread over several slots to avoid sharing cache lines.
+      struct ReaderSlot
+      {
+        //! Counters of dispatchers for even and odd epochs.
+        std::atomic<unsigned> count[2];
+        //! Padding to fill a cache line.
+        char padding[64 - 2 * sizeof(std::atomic<unsigned>)];
+      };
+
+      //! Number of dispatcher slots.
+      static const unsigned c_reader_slots = 16;
+      //! Table of recipients indexed by message identification
+      //! number. Lists are never modified after being published:
+      //! registration builds a new list, swaps the pointer and waits
+      //! for ongoing dispatches before releasing the old list.
+      std::atomic<const TransportList*>* m_recipients;
+      //! Number of entries in the table of recipients.
+      size_t m_recipients_size;
+      //! Dispatcher counters.
+      ReaderSlot m_readers[c_reader_slots];
+      //! Current epoch.
+      std::atomic<unsigned> m_epoch;
+      //! Registration lock.
+      Concurrency::Mutex m_lock;
       //! Bus is paused.
-      bool m_paused;
+      std::atomic<bool> m_paused;
       //! Pause lock.
       Concurrency::Mutex m_paused_lock;
       //! List containing all generated TransportBindings for future logging/reference.
@@ -113,6 +154,35 @@ namespace DUNE
       //! Back log queue. Saves messages when Bus is paused.
       Concurrency::TSQueue<BackLogEntry*> m_back_log;
 
+      //! Deliver a message to registered listeners. The shared copy
+      //! is only created if there is at least one recipient.
+      //! @param msg message to dispatch.
+      //! @param shared shared copy of the message (may be empty).
+      //! @param task do not deliver message to this task.
+      void
+      deliver(const Message* msg, SharedMessage& shared, Tasks::AbstractTask* task);
+
+      //! Replace the list of recipients of a given message
+      //! identification number and release the old one once no
+      //! dispatcher can be using it. Must be called with the
+      //! registration lock held.
+      //! @param id message identification number.
+      //! @param list new list of recipients.
+      void
+      publish(uint16_t id, const TransportList* list);
+
+      //! Mark the calling thread as dispatching.
+      //! @param slot dispatcher slot.
+      //! @return epoch to be passed to leave().
+      unsigned
+      enter(unsigned slot);
+
+      //! Mark the calling thread as no longer dispatching.
+      //! @param slot dispatcher slot.
+      //! @param epoch epoch returned by enter().
+      void
+      leave(unsigned slot, unsigned epoch);
+
       //! Non - copyable.
       Bus(Bus const&);
 
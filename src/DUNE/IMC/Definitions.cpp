@@ -37,6 +37,7 @@
 #include <iomanip>
 #include <string>
 #include <cstdio>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Utils/ByteCopy.hpp>
@@ -118,6 +119,38 @@ namespace DUNE
       IMC::toJSON(os__, "description", description, nindent__);
     }
 
+    void
+    EntityState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+      w__.write("flags", flags);
+      w__.write("description", description);
+    }
+
+    bool
+    EntityState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "description")
+      {
+        r__.read(description);
+        return true;
+      }
+
+      return false;
+    }
+
     QueryEntityState::QueryEntityState(void)
     {
       m_header.mgid = 2;
@@ -249,6 +282,52 @@ namespace DUNE
       IMC::toJSON(os__, "deact_time", deact_time, nindent__);
     }
 
+    void
+    EntityInfo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("label", label);
+      w__.write("component", component);
+      w__.write("act_time", act_time);
+      w__.write("deact_time", deact_time);
+    }
+
+    bool
+    EntityInfo::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "label")
+      {
+        r__.read(label);
+        return true;
+      }
+
+      if (name__ == "component")
+      {
+        r__.read(component);
+        return true;
+      }
+
+      if (name__ == "act_time")
+      {
+        r__.read(act_time);
+        return true;
+      }
+
+      if (name__ == "deact_time")
+      {
+        r__.read(deact_time);
+        return true;
+      }
+
+      return false;
+    }
+
     QueryEntityInfo::QueryEntityInfo(void)
     {
       m_header.mgid = 4;
@@ -278,25 +357,30 @@ namespace DUNE
     uint8_t*
     QueryEntityInfo::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     QueryEntityInfo::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     QueryEntityInfo::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
@@ -317,6 +401,24 @@ namespace DUNE
       IMC::toJSON(os__, "id", id, nindent__);
     }
 
+    void
+    QueryEntityInfo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+    }
+
+    bool
+    QueryEntityInfo::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      return false;
+    }
+
     EntityList::EntityList(void)
     {
       m_header.mgid = 5;
@@ -379,6 +481,31 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    void
+    EntityList::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("list", list);
+    }
+
+    bool
+    EntityList::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "list")
+      {
+        r__.read(list);
+        return true;
+      }
+
+      return false;
+    }
+
     CpuUsage::CpuUsage(void)
     {
       m_header.mgid = 7;
@@ -409,25 +536,30 @@ namespace DUNE
     uint8_t*
     CpuUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     CpuUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     CpuUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -448,6 +580,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    CpuUsage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    CpuUsage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     TransportBindings::TransportBindings(void)
     {
       m_header.mgid = 8;
@@ -510,6 +660,31 @@ namespace DUNE
       IMC::toJSON(os__, "message_id", message_id, nindent__);
     }
 
+    void
+    TransportBindings::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("consumer", consumer);
+      w__.write("message_id", message_id);
+    }
+
+    bool
+    TransportBindings::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "consumer")
+      {
+        r__.read(consumer);
+        return true;
+      }
+
+      if (name__ == "message_id")
+      {
+        r__.read(message_id);
+        return true;
+      }
+
+      return false;
+    }
+
     RestartSystem::RestartSystem(void)
     {
       m_header.mgid = 9;
@@ -539,25 +714,30 @@ namespace DUNE
     uint8_t*
     RestartSystem::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     RestartSystem::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(type, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     RestartSystem::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(type, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -566,6 +746,24 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    RestartSystem::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+    }
+
+    bool
+    RestartSystem::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      return false;
+    }
+
     DevCalibrationControl::DevCalibrationControl(void)
     {
       m_header.mgid = 12;
@@ -595,25 +793,30 @@ namespace DUNE
     uint8_t*
     DevCalibrationControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DevCalibrationControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DevCalibrationControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -622,6 +825,24 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    void
+    DevCalibrationControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+    }
+
+    bool
+    DevCalibrationControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      return false;
+    }
+
     DevCalibrationState::DevCalibrationState(void)
     {
       m_header.mgid = 13;
@@ -696,6 +917,45 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DevCalibrationState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("total_steps", total_steps);
+      w__.write("step_number", step_number);
+      w__.write("step", step);
+      w__.write("flags", flags);
+    }
+
+    bool
+    DevCalibrationState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "total_steps")
+      {
+        r__.read(total_steps);
+        return true;
+      }
+
+      if (name__ == "step_number")
+      {
+        r__.read(step_number);
+        return true;
+      }
+
+      if (name__ == "step")
+      {
+        r__.read(step);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      return false;
+    }
+
     EntityActivationState::EntityActivationState(void)
     {
       m_header.mgid = 14;
@@ -758,6 +1018,31 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    EntityActivationState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+      w__.write("error", error);
+    }
+
+    bool
+    EntityActivationState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "error")
+      {
+        r__.read(error);
+        return true;
+      }
+
+      return false;
+    }
+
     QueryEntityActivationState::QueryEntityActivationState(void)
     {
       m_header.mgid = 15;
@@ -875,76 +1160,66 @@ namespace DUNE
     uint8_t*
     VehicleOperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(speed_min, ptr__);
-      ptr__ += IMC::serialize(speed_max, ptr__);
-      ptr__ += IMC::serialize(long_accel, ptr__);
-      ptr__ += IMC::serialize(alt_max_msl, ptr__);
-      ptr__ += IMC::serialize(dive_fraction_max, ptr__);
-      ptr__ += IMC::serialize(climb_fraction_max, ptr__);
-      ptr__ += IMC::serialize(bank_max, ptr__);
-      ptr__ += IMC::serialize(p_max, ptr__);
-      ptr__ += IMC::serialize(pitch_min, ptr__);
-      ptr__ += IMC::serialize(pitch_max, ptr__);
-      ptr__ += IMC::serialize(q_max, ptr__);
-      ptr__ += IMC::serialize(g_min, ptr__);
-      ptr__ += IMC::serialize(g_max, ptr__);
-      ptr__ += IMC::serialize(g_lat_max, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(rpm_rate_max, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(speed_min, bfr__ + 1);
+      IMC::serialize(speed_max, bfr__ + 5);
+      IMC::serialize(long_accel, bfr__ + 9);
+      IMC::serialize(alt_max_msl, bfr__ + 13);
+      IMC::serialize(dive_fraction_max, bfr__ + 17);
+      IMC::serialize(climb_fraction_max, bfr__ + 21);
+      IMC::serialize(bank_max, bfr__ + 25);
+      IMC::serialize(p_max, bfr__ + 29);
+      IMC::serialize(pitch_min, bfr__ + 33);
+      IMC::serialize(pitch_max, bfr__ + 37);
+      IMC::serialize(q_max, bfr__ + 41);
+      IMC::serialize(g_min, bfr__ + 45);
+      IMC::serialize(g_max, bfr__ + 49);
+      IMC::serialize(g_lat_max, bfr__ + 53);
+      IMC::serialize(rpm_min, bfr__ + 57);
+      IMC::serialize(rpm_max, bfr__ + 61);
+      IMC::serialize(rpm_rate_max, bfr__ + 65);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     VehicleOperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::deserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::deserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::deserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::deserialize(p_max, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::deserialize(q_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_min, bfr__, size__);
-      bfr__ += IMC::deserialize(g_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      Utils::ByteCopy::copy(speed_min, bfr__ + 1);
+      Utils::ByteCopy::copy(speed_max, bfr__ + 5);
+      Utils::ByteCopy::copy(long_accel, bfr__ + 9);
+      Utils::ByteCopy::copy(alt_max_msl, bfr__ + 13);
+      Utils::ByteCopy::copy(dive_fraction_max, bfr__ + 17);
+      Utils::ByteCopy::copy(climb_fraction_max, bfr__ + 21);
+      Utils::ByteCopy::copy(bank_max, bfr__ + 25);
+      Utils::ByteCopy::copy(p_max, bfr__ + 29);
+      Utils::ByteCopy::copy(pitch_min, bfr__ + 33);
+      Utils::ByteCopy::copy(pitch_max, bfr__ + 37);
+      Utils::ByteCopy::copy(q_max, bfr__ + 41);
+      Utils::ByteCopy::copy(g_min, bfr__ + 45);
+      Utils::ByteCopy::copy(g_max, bfr__ + 49);
+      Utils::ByteCopy::copy(g_lat_max, bfr__ + 53);
+      Utils::ByteCopy::copy(rpm_min, bfr__ + 57);
+      Utils::ByteCopy::copy(rpm_max, bfr__ + 61);
+      Utils::ByteCopy::copy(rpm_rate_max, bfr__ + 65);
+      return c_fields_size;
     }
 
     uint16_t
     VehicleOperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      std::memcpy(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 1, bfr__ + 1, 17);
+      return VehicleOperationalLimits::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -970,53 +1245,190 @@ namespace DUNE
       IMC::toJSON(os__, "rpm_rate_max", rpm_rate_max, nindent__);
     }
 
-    MsgList::MsgList(void)
-    {
-      m_header.mgid = 20;
-      clear();
-      msgs.setParent(this);
-    }
-
     void
-    MsgList::clear(void)
+    VehicleOperationalLimits::fieldsToJSON(JSONWriter& w__) const
     {
-      msgs.clear();
+      w__.write("op", op);
+      w__.write("speed_min", speed_min);
+      w__.write("speed_max", speed_max);
+      w__.write("long_accel", long_accel);
+      w__.write("alt_max_msl", alt_max_msl);
+      w__.write("dive_fraction_max", dive_fraction_max);
+      w__.write("climb_fraction_max", climb_fraction_max);
+      w__.write("bank_max", bank_max);
+      w__.write("p_max", p_max);
+      w__.write("pitch_min", pitch_min);
+      w__.write("pitch_max", pitch_max);
+      w__.write("q_max", q_max);
+      w__.write("g_min", g_min);
+      w__.write("g_max", g_max);
+      w__.write("g_lat_max", g_lat_max);
+      w__.write("rpm_min", rpm_min);
+      w__.write("rpm_max", rpm_max);
+      w__.write("rpm_rate_max", rpm_rate_max);
     }
 
     bool
-    MsgList::fieldsEqual(const Message& msg__) const
+    VehicleOperationalLimits::fieldFromJSON(const std::string& name__, JSONReader& r__)
     {
-      const IMC::MsgList& other__ = static_cast<const MsgList&>(msg__);
-      if (msgs != other__.msgs) return false;
-      return true;
-    }
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
 
-    int
-    MsgList::validate(void) const
-    {
-      return true;
-    }
+      if (name__ == "speed_min")
+      {
+        r__.read(speed_min);
+        return true;
+      }
 
-    uint8_t*
-    MsgList::serializeFields(uint8_t* bfr__) const
-    {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += msgs.serialize(ptr__);
-      return ptr__;
-    }
+      if (name__ == "speed_max")
+      {
+        r__.read(speed_max);
+        return true;
+      }
 
-    uint16_t
-    MsgList::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += msgs.deserialize(bfr__, size__);
-      return bfr__ - start__;
-    }
+      if (name__ == "long_accel")
+      {
+        r__.read(long_accel);
+        return true;
+      }
 
-    uint16_t
-    MsgList::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
+      if (name__ == "alt_max_msl")
+      {
+        r__.read(alt_max_msl);
+        return true;
+      }
+
+      if (name__ == "dive_fraction_max")
+      {
+        r__.read(dive_fraction_max);
+        return true;
+      }
+
+      if (name__ == "climb_fraction_max")
+      {
+        r__.read(climb_fraction_max);
+        return true;
+      }
+
+      if (name__ == "bank_max")
+      {
+        r__.read(bank_max);
+        return true;
+      }
+
+      if (name__ == "p_max")
+      {
+        r__.read(p_max);
+        return true;
+      }
+
+      if (name__ == "pitch_min")
+      {
+        r__.read(pitch_min);
+        return true;
+      }
+
+      if (name__ == "pitch_max")
+      {
+        r__.read(pitch_max);
+        return true;
+      }
+
+      if (name__ == "q_max")
+      {
+        r__.read(q_max);
+        return true;
+      }
+
+      if (name__ == "g_min")
+      {
+        r__.read(g_min);
+        return true;
+      }
+
+      if (name__ == "g_max")
+      {
+        r__.read(g_max);
+        return true;
+      }
+
+      if (name__ == "g_lat_max")
+      {
+        r__.read(g_lat_max);
+        return true;
+      }
+
+      if (name__ == "rpm_min")
+      {
+        r__.read(rpm_min);
+        return true;
+      }
+
+      if (name__ == "rpm_max")
+      {
+        r__.read(rpm_max);
+        return true;
+      }
+
+      if (name__ == "rpm_rate_max")
+      {
+        r__.read(rpm_rate_max);
+        return true;
+      }
+
+      return false;
+    }
+
+    MsgList::MsgList(void)
+    {
+      m_header.mgid = 20;
+      clear();
+      msgs.setParent(this);
+    }
+
+    void
+    MsgList::clear(void)
+    {
+      msgs.clear();
+    }
+
+    bool
+    MsgList::fieldsEqual(const Message& msg__) const
+    {
+      const IMC::MsgList& other__ = static_cast<const MsgList&>(msg__);
+      if (msgs != other__.msgs) return false;
+      return true;
+    }
+
+    int
+    MsgList::validate(void) const
+    {
+      return true;
+    }
+
+    uint8_t*
+    MsgList::serializeFields(uint8_t* bfr__) const
+    {
+      uint8_t* ptr__ = bfr__;
+      ptr__ += msgs.serialize(ptr__);
+      return ptr__;
+    }
+
+    uint16_t
+    MsgList::deserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      const uint8_t* start__ = bfr__;
+      bfr__ += msgs.deserialize(bfr__, size__);
+      return bfr__ - start__;
+    }
+
+    uint16_t
+    MsgList::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      const uint8_t* start__ = bfr__;
       bfr__ += msgs.reverseDeserialize(bfr__, size__);
       return bfr__ - start__;
     }
@@ -1027,6 +1439,24 @@ namespace DUNE
       msgs.toJSON(os__, "msgs", nindent__);
     }
 
+    void
+    MsgList::fieldsToJSON(JSONWriter& w__) const
+    {
+      msgs.toJSON(w__, "msgs");
+    }
+
+    bool
+    MsgList::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "msgs")
+      {
+        msgs.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     MsgList::setTimeStampNested(double value__)
     {
@@ -1128,76 +1558,66 @@ namespace DUNE
     uint8_t*
     SimulatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(svx, ptr__);
-      ptr__ += IMC::serialize(svy, ptr__);
-      ptr__ += IMC::serialize(svz, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(height, bfr__ + 16);
+      IMC::serialize(x, bfr__ + 20);
+      IMC::serialize(y, bfr__ + 24);
+      IMC::serialize(z, bfr__ + 28);
+      IMC::serialize(phi, bfr__ + 32);
+      IMC::serialize(theta, bfr__ + 36);
+      IMC::serialize(psi, bfr__ + 40);
+      IMC::serialize(u, bfr__ + 44);
+      IMC::serialize(v, bfr__ + 48);
+      IMC::serialize(w, bfr__ + 52);
+      IMC::serialize(p, bfr__ + 56);
+      IMC::serialize(q, bfr__ + 60);
+      IMC::serialize(r, bfr__ + 64);
+      IMC::serialize(svx, bfr__ + 68);
+      IMC::serialize(svy, bfr__ + 72);
+      IMC::serialize(svz, bfr__ + 76);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SimulatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(svx, bfr__, size__);
-      bfr__ += IMC::deserialize(svy, bfr__, size__);
-      bfr__ += IMC::deserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 8);
+      Utils::ByteCopy::copy(height, bfr__ + 16);
+      Utils::ByteCopy::copy(x, bfr__ + 20);
+      Utils::ByteCopy::copy(y, bfr__ + 24);
+      Utils::ByteCopy::copy(z, bfr__ + 28);
+      Utils::ByteCopy::copy(phi, bfr__ + 32);
+      Utils::ByteCopy::copy(theta, bfr__ + 36);
+      Utils::ByteCopy::copy(psi, bfr__ + 40);
+      Utils::ByteCopy::copy(u, bfr__ + 44);
+      Utils::ByteCopy::copy(v, bfr__ + 48);
+      Utils::ByteCopy::copy(w, bfr__ + 52);
+      Utils::ByteCopy::copy(p, bfr__ + 56);
+      Utils::ByteCopy::copy(q, bfr__ + 60);
+      Utils::ByteCopy::copy(r, bfr__ + 64);
+      Utils::ByteCopy::copy(svx, bfr__ + 68);
+      Utils::ByteCopy::copy(svy, bfr__ + 72);
+      Utils::ByteCopy::copy(svz, bfr__ + 76);
+      return c_fields_size;
     }
 
     uint16_t
     SimulatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 16, bfr__ + 16, 16);
+      return SimulatedState::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -1223,6 +1643,143 @@ namespace DUNE
       IMC::toJSON(os__, "svz", svz, nindent__);
     }
 
+    void
+    SimulatedState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height", height);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("u", u);
+      w__.write("v", v);
+      w__.write("w", w);
+      w__.write("p", p);
+      w__.write("q", q);
+      w__.write("r", r);
+      w__.write("svx", svx);
+      w__.write("svy", svy);
+      w__.write("svz", svz);
+    }
+
+    bool
+    SimulatedState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height")
+      {
+        r__.read(height);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "u")
+      {
+        r__.read(u);
+        return true;
+      }
+
+      if (name__ == "v")
+      {
+        r__.read(v);
+        return true;
+      }
+
+      if (name__ == "w")
+      {
+        r__.read(w);
+        return true;
+      }
+
+      if (name__ == "p")
+      {
+        r__.read(p);
+        return true;
+      }
+
+      if (name__ == "q")
+      {
+        r__.read(q);
+        return true;
+      }
+
+      if (name__ == "r")
+      {
+        r__.read(r);
+        return true;
+      }
+
+      if (name__ == "svx")
+      {
+        r__.read(svx);
+        return true;
+      }
+
+      if (name__ == "svy")
+      {
+        r__.read(svy);
+        return true;
+      }
+
+      if (name__ == "svz")
+      {
+        r__.read(svz);
+        return true;
+      }
+
+      return false;
+    }
+
     LeakSimulation::LeakSimulation(void)
     {
       m_header.mgid = 51;
@@ -1285,6 +1842,31 @@ namespace DUNE
       IMC::toJSON(os__, "entities", entities, nindent__);
     }
 
+    void
+    LeakSimulation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("entities", entities);
+    }
+
+    bool
+    LeakSimulation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "entities")
+      {
+        r__.read(entities);
+        return true;
+      }
+
+      return false;
+    }
+
     UASimulation::UASimulation(void)
     {
       m_header.mgid = 52;
@@ -1353,6 +1935,38 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    UASimulation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("speed", speed);
+      w__.write("data", data);
+    }
+
+    bool
+    UASimulation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     DynamicsSimParam::DynamicsSimParam(void)
     {
       m_header.mgid = 53;
@@ -1386,31 +2000,36 @@ namespace DUNE
     uint8_t*
     DynamicsSimParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(tas2acc_pgain, ptr__);
-      ptr__ += IMC::serialize(bank2p_pgain, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(tas2acc_pgain, bfr__ + 1);
+      IMC::serialize(bank2p_pgain, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DynamicsSimParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      Utils::ByteCopy::copy(tas2acc_pgain, bfr__ + 1);
+      Utils::ByteCopy::copy(bank2p_pgain, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     DynamicsSimParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      Utils::ByteCopy::rcopy(tas2acc_pgain, bfr__ + 1);
+      Utils::ByteCopy::rcopy(bank2p_pgain, bfr__ + 5);
+      return c_fields_size;
     }
 
     void
@@ -1421,6 +2040,38 @@ namespace DUNE
       IMC::toJSON(os__, "bank2p_pgain", bank2p_pgain, nindent__);
     }
 
+    void
+    DynamicsSimParam::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("tas2acc_pgain", tas2acc_pgain);
+      w__.write("bank2p_pgain", bank2p_pgain);
+    }
+
+    bool
+    DynamicsSimParam::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "tas2acc_pgain")
+      {
+        r__.read(tas2acc_pgain);
+        return true;
+      }
+
+      if (name__ == "bank2p_pgain")
+      {
+        r__.read(bank2p_pgain);
+        return true;
+      }
+
+      return false;
+    }
+
     StorageUsage::StorageUsage(void)
     {
       m_header.mgid = 100;
@@ -1453,28 +2104,33 @@ namespace DUNE
     uint8_t*
     StorageUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(available, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(available, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     StorageUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(available, bfr__ + 0);
+      Utils::ByteCopy::copy(value, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     StorageUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(available, bfr__ + 0);
+      Utils::ByteCopy::rcopy(value, bfr__ + 4);
+      return c_fields_size;
     }
 
     fp64_t
@@ -1496,6 +2152,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    StorageUsage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("available", available);
+      w__.write("value", value);
+    }
+
+    bool
+    StorageUsage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "available")
+      {
+        r__.read(available);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     CacheControl::CacheControl(void)
     {
       m_header.mgid = 101;
@@ -1565,6 +2246,38 @@ namespace DUNE
       message.toJSON(os__, "message", nindent__);
     }
 
+    void
+    CacheControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("snapshot", snapshot);
+      message.toJSON(w__, "message");
+    }
+
+    bool
+    CacheControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "snapshot")
+      {
+        r__.read(snapshot);
+        return true;
+      }
+
+      if (name__ == "message")
+      {
+        message.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     CacheControl::setTimeStampNested(double value__)
     {
@@ -1672,6 +2385,31 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    LoggingControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("name", name);
+    }
+
+    bool
+    LoggingControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      return false;
+    }
+
     LogBookEntry::LogBookEntry(void)
     {
       m_header.mgid = 103;
@@ -1746,6 +2484,45 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    LogBookEntry::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("htime", htime);
+      w__.write("context", context);
+      w__.write("text", text);
+    }
+
+    bool
+    LogBookEntry::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "htime")
+      {
+        r__.read(htime);
+        return true;
+      }
+
+      if (name__ == "context")
+      {
+        r__.read(context);
+        return true;
+      }
+
+      if (name__ == "text")
+      {
+        r__.read(text);
+        return true;
+      }
+
+      return false;
+    }
+
     LogBookControl::LogBookControl(void)
     {
       m_header.mgid = 104;
@@ -1815,6 +2592,38 @@ namespace DUNE
       msg.toJSON(os__, "msg", nindent__);
     }
 
+    void
+    LogBookControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("command", command);
+      w__.write("htime", htime);
+      msg.toJSON(w__, "msg");
+    }
+
+    bool
+    LogBookControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "command")
+      {
+        r__.read(command);
+        return true;
+      }
+
+      if (name__ == "htime")
+      {
+        r__.read(htime);
+        return true;
+      }
+
+      if (name__ == "msg")
+      {
+        msg.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     LogBookControl::setTimeStampNested(double value__)
     {
@@ -1907,6 +2716,31 @@ namespace DUNE
       IMC::toJSON(os__, "file", file, nindent__);
     }
 
+    void
+    ReplayControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("file", file);
+    }
+
+    bool
+    ReplayControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "file")
+      {
+        r__.read(file);
+        return true;
+      }
+
+      return false;
+    }
+
     ClockControl::ClockControl(void)
     {
       m_header.mgid = 106;
@@ -1941,31 +2775,36 @@ namespace DUNE
     uint8_t*
     ClockControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(clock, ptr__);
-      ptr__ += IMC::serialize(tz, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(clock, bfr__ + 1);
+      IMC::serialize(tz, bfr__ + 9);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ClockControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      Utils::ByteCopy::copy(clock, bfr__ + 1);
+      Utils::ByteCopy::copy(tz, bfr__ + 9);
+      return c_fields_size;
     }
 
     uint16_t
     ClockControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      Utils::ByteCopy::rcopy(clock, bfr__ + 1);
+      Utils::ByteCopy::rcopy(tz, bfr__ + 9);
+      return c_fields_size;
     }
 
     void
@@ -1976,6 +2815,38 @@ namespace DUNE
       IMC::toJSON(os__, "tz", tz, nindent__);
     }
 
+    void
+    ClockControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("clock", clock);
+      w__.write("tz", tz);
+    }
+
+    bool
+    ClockControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "clock")
+      {
+        r__.read(clock);
+        return true;
+      }
+
+      if (name__ == "tz")
+      {
+        r__.read(tz);
+        return true;
+      }
+
+      return false;
+    }
+
     HistoricCTD::HistoricCTD(void)
     {
       m_header.mgid = 107;
@@ -2009,31 +2880,36 @@ namespace DUNE
     uint8_t*
     HistoricCTD::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(conductivity, ptr__);
-      ptr__ += IMC::serialize(temperature, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      return ptr__;
+      IMC::serialize(conductivity, bfr__ + 0);
+      IMC::serialize(temperature, bfr__ + 4);
+      IMC::serialize(depth, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     HistoricCTD::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::deserialize(temperature, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(conductivity, bfr__ + 0);
+      Utils::ByteCopy::copy(temperature, bfr__ + 4);
+      Utils::ByteCopy::copy(depth, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     HistoricCTD::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(temperature, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(conductivity, bfr__ + 0);
+      Utils::ByteCopy::rcopy(temperature, bfr__ + 4);
+      Utils::ByteCopy::rcopy(depth, bfr__ + 8);
+      return c_fields_size;
     }
 
     void
@@ -2044,6 +2920,38 @@ namespace DUNE
       IMC::toJSON(os__, "depth", depth, nindent__);
     }
 
+    void
+    HistoricCTD::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("conductivity", conductivity);
+      w__.write("temperature", temperature);
+      w__.write("depth", depth);
+    }
+
+    bool
+    HistoricCTD::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "conductivity")
+      {
+        r__.read(conductivity);
+        return true;
+      }
+
+      if (name__ == "temperature")
+      {
+        r__.read(temperature);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      return false;
+    }
+
     HistoricTelemetry::HistoricTelemetry(void)
     {
       m_header.mgid = 108;
@@ -2081,37 +2989,40 @@ namespace DUNE
     uint8_t*
     HistoricTelemetry::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(roll, ptr__);
-      ptr__ += IMC::serialize(pitch, ptr__);
-      ptr__ += IMC::serialize(yaw, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      return ptr__;
+      IMC::serialize(altitude, bfr__ + 0);
+      IMC::serialize(roll, bfr__ + 4);
+      IMC::serialize(pitch, bfr__ + 6);
+      IMC::serialize(yaw, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 10);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     HistoricTelemetry::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(roll, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch, bfr__, size__);
-      bfr__ += IMC::deserialize(yaw, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(altitude, bfr__ + 0);
+      Utils::ByteCopy::copy(roll, bfr__ + 4);
+      Utils::ByteCopy::copy(pitch, bfr__ + 6);
+      Utils::ByteCopy::copy(yaw, bfr__ + 8);
+      Utils::ByteCopy::copy(speed, bfr__ + 10);
+      return c_fields_size;
     }
 
     uint16_t
     HistoricTelemetry::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(roll, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(yaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy2b(swap__ + 4, bfr__ + 4, 4);
+      return HistoricTelemetry::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -2124,6 +3035,52 @@ namespace DUNE
       IMC::toJSON(os__, "speed", speed, nindent__);
     }
 
+    void
+    HistoricTelemetry::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("altitude", altitude);
+      w__.write("roll", roll);
+      w__.write("pitch", pitch);
+      w__.write("yaw", yaw);
+      w__.write("speed", speed);
+    }
+
+    bool
+    HistoricTelemetry::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "altitude")
+      {
+        r__.read(altitude);
+        return true;
+      }
+
+      if (name__ == "roll")
+      {
+        r__.read(roll);
+        return true;
+      }
+
+      if (name__ == "pitch")
+      {
+        r__.read(pitch);
+        return true;
+      }
+
+      if (name__ == "yaw")
+      {
+        r__.read(yaw);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      return false;
+    }
+
     HistoricSonarData::HistoricSonarData(void)
     {
       m_header.mgid = 109;
@@ -2216,27 +3173,87 @@ namespace DUNE
       IMC::toJSON(os__, "sonar_data", sonar_data, nindent__);
     }
 
-    HistoricEvent::HistoricEvent(void)
-    {
-      m_header.mgid = 110;
-      clear();
-    }
-
     void
-    HistoricEvent::clear(void)
+    HistoricSonarData::fieldsToJSON(JSONWriter& w__) const
     {
-      text.clear();
-      type = 0;
+      w__.write("altitude", altitude);
+      w__.write("width", width);
+      w__.write("length", length);
+      w__.write("bearing", bearing);
+      w__.write("pxl", pxl);
+      w__.write("encoding", encoding);
+      w__.write("sonar_data", sonar_data);
     }
 
     bool
-    HistoricEvent::fieldsEqual(const Message& msg__) const
+    HistoricSonarData::fieldFromJSON(const std::string& name__, JSONReader& r__)
     {
-      const IMC::HistoricEvent& other__ = static_cast<const HistoricEvent&>(msg__);
-      if (text != other__.text) return false;
-      if (type != other__.type) return false;
-      return true;
-    }
+      if (name__ == "altitude")
+      {
+        r__.read(altitude);
+        return true;
+      }
+
+      if (name__ == "width")
+      {
+        r__.read(width);
+        return true;
+      }
+
+      if (name__ == "length")
+      {
+        r__.read(length);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "pxl")
+      {
+        r__.read(pxl);
+        return true;
+      }
+
+      if (name__ == "encoding")
+      {
+        r__.read(encoding);
+        return true;
+      }
+
+      if (name__ == "sonar_data")
+      {
+        r__.read(sonar_data);
+        return true;
+      }
+
+      return false;
+    }
+
+    HistoricEvent::HistoricEvent(void)
+    {
+      m_header.mgid = 110;
+      clear();
+    }
+
+    void
+    HistoricEvent::clear(void)
+    {
+      text.clear();
+      type = 0;
+    }
+
+    bool
+    HistoricEvent::fieldsEqual(const Message& msg__) const
+    {
+      const IMC::HistoricEvent& other__ = static_cast<const HistoricEvent&>(msg__);
+      if (text != other__.text) return false;
+      if (type != other__.type) return false;
+      return true;
+    }
 
     int
     HistoricEvent::validate(void) const
@@ -2278,6 +3295,31 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    HistoricEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("text", text);
+      w__.write("type", type);
+    }
+
+    bool
+    HistoricEvent::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "text")
+      {
+        r__.read(text);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      return false;
+    }
+
     ProfileSample::ProfileSample(void)
     {
       m_header.mgid = 112;
@@ -2309,28 +3351,33 @@ namespace DUNE
     uint8_t*
     ProfileSample::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(avg, ptr__);
-      return ptr__;
+      IMC::serialize(depth, bfr__ + 0);
+      IMC::serialize(avg, bfr__ + 2);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ProfileSample::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(avg, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(depth, bfr__ + 0);
+      Utils::ByteCopy::copy(avg, bfr__ + 2);
+      return c_fields_size;
     }
 
     uint16_t
     ProfileSample::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(avg, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(depth, bfr__ + 0);
+      Utils::ByteCopy::rcopy(avg, bfr__ + 2);
+      return c_fields_size;
     }
 
     void
@@ -2340,6 +3387,31 @@ namespace DUNE
       IMC::toJSON(os__, "avg", avg, nindent__);
     }
 
+    void
+    ProfileSample::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("depth", depth);
+      w__.write("avg", avg);
+    }
+
+    bool
+    ProfileSample::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "avg")
+      {
+        r__.read(avg);
+        return true;
+      }
+
+      return false;
+    }
+
     VerticalProfile::VerticalProfile(void)
     {
       m_header.mgid = 111;
@@ -2421,6 +3493,52 @@ namespace DUNE
       IMC::toJSON(os__, "lon", lon, nindent__);
     }
 
+    void
+    VerticalProfile::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("parameter", parameter);
+      w__.write("numsamples", numsamples);
+      samples.toJSON(w__, "samples");
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+    }
+
+    bool
+    VerticalProfile::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "parameter")
+      {
+        r__.read(parameter);
+        return true;
+      }
+
+      if (name__ == "numsamples")
+      {
+        r__.read(numsamples);
+        return true;
+      }
+
+      if (name__ == "samples")
+      {
+        samples.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     VerticalProfile::setTimeStampNested(double value__)
     {
@@ -2584,6 +3702,66 @@ namespace DUNE
       IMC::toJSON(os__, "services", services, nindent__);
     }
 
+    void
+    Announce::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sys_name", sys_name);
+      w__.write("sys_type", sys_type);
+      w__.write("owner", owner);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height", height);
+      w__.write("services", services);
+    }
+
+    bool
+    Announce::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sys_name")
+      {
+        r__.read(sys_name);
+        return true;
+      }
+
+      if (name__ == "sys_type")
+      {
+        r__.read(sys_type);
+        return true;
+      }
+
+      if (name__ == "owner")
+      {
+        r__.read(owner);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height")
+      {
+        r__.read(height);
+        return true;
+      }
+
+      if (name__ == "services")
+      {
+        r__.read(services);
+        return true;
+      }
+
+      return false;
+    }
+
     AnnounceService::AnnounceService(void)
     {
       m_header.mgid = 152;
@@ -2646,6 +3824,31 @@ namespace DUNE
       IMC::toJSON(os__, "service_type", service_type, nindent__);
     }
 
+    void
+    AnnounceService::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("service", service);
+      w__.write("service_type", service_type);
+    }
+
+    bool
+    AnnounceService::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "service")
+      {
+        r__.read(service);
+        return true;
+      }
+
+      if (name__ == "service_type")
+      {
+        r__.read(service_type);
+        return true;
+      }
+
+      return false;
+    }
+
     RSSI::RSSI(void)
     {
       m_header.mgid = 153;
@@ -2676,25 +3879,30 @@ namespace DUNE
     uint8_t*
     RSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     RSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     RSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -2715,6 +3923,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    RSSI::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    RSSI::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     VSWR::VSWR(void)
     {
       m_header.mgid = 154;
@@ -2744,25 +3970,30 @@ namespace DUNE
     uint8_t*
     VSWR::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     VSWR::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     VSWR::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -2783,6 +4014,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    VSWR::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    VSWR::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     LinkLevel::LinkLevel(void)
     {
       m_header.mgid = 155;
@@ -2812,25 +4061,30 @@ namespace DUNE
     uint8_t*
     LinkLevel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     LinkLevel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     LinkLevel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -2851,6 +4105,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    LinkLevel::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    LinkLevel::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Sms::Sms(void)
     {
       m_header.mgid = 156;
@@ -2919,6 +4191,38 @@ namespace DUNE
       IMC::toJSON(os__, "contents", contents, nindent__);
     }
 
+    void
+    Sms::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("number", number);
+      w__.write("timeout", timeout);
+      w__.write("contents", contents);
+    }
+
+    bool
+    Sms::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "number")
+      {
+        r__.read(number);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "contents")
+      {
+        r__.read(contents);
+        return true;
+      }
+
+      return false;
+    }
+
     SmsTx::SmsTx(void)
     {
       m_header.mgid = 157;
@@ -2993,28 +4297,67 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
-    SmsRx::SmsRx(void)
-    {
-      m_header.mgid = 158;
-      clear();
-    }
-
     void
-    SmsRx::clear(void)
+    SmsTx::fieldsToJSON(JSONWriter& w__) const
     {
-      source.clear();
-      data.clear();
+      w__.write("seq", seq);
+      w__.write("destination", destination);
+      w__.write("timeout", timeout);
+      w__.write("data", data);
     }
 
     bool
-    SmsRx::fieldsEqual(const Message& msg__) const
+    SmsTx::fieldFromJSON(const std::string& name__, JSONReader& r__)
     {
-      const IMC::SmsRx& other__ = static_cast<const SmsRx&>(msg__);
-      if (source != other__.source) return false;
-      if (data != other__.data) return false;
-      return true;
-    }
-
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
+    SmsRx::SmsRx(void)
+    {
+      m_header.mgid = 158;
+      clear();
+    }
+
+    void
+    SmsRx::clear(void)
+    {
+      source.clear();
+      data.clear();
+    }
+
+    bool
+    SmsRx::fieldsEqual(const Message& msg__) const
+    {
+      const IMC::SmsRx& other__ = static_cast<const SmsRx&>(msg__);
+      if (source != other__.source) return false;
+      if (data != other__.data) return false;
+      return true;
+    }
+
     int
     SmsRx::validate(void) const
     {
@@ -3055,6 +4398,31 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    SmsRx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("source", source);
+      w__.write("data", data);
+    }
+
+    bool
+    SmsRx::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "source")
+      {
+        r__.read(source);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     SmsState::SmsState(void)
     {
       m_header.mgid = 159;
@@ -3123,6 +4491,38 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    SmsState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("seq", seq);
+      w__.write("state", state);
+      w__.write("error", error);
+    }
+
+    bool
+    SmsState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "error")
+      {
+        r__.read(error);
+        return true;
+      }
+
+      return false;
+    }
+
     TextMessage::TextMessage(void)
     {
       m_header.mgid = 160;
@@ -3185,6 +4585,31 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    TextMessage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("origin", origin);
+      w__.write("text", text);
+    }
+
+    bool
+    TextMessage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "origin")
+      {
+        r__.read(origin);
+        return true;
+      }
+
+      if (name__ == "text")
+      {
+        r__.read(text);
+        return true;
+      }
+
+      return false;
+    }
+
     IridiumMsgRx::IridiumMsgRx(void)
     {
       m_header.mgid = 170;
@@ -3265,6 +4690,52 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    IridiumMsgRx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("origin", origin);
+      w__.write("htime", htime);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("data", data);
+    }
+
+    bool
+    IridiumMsgRx::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "origin")
+      {
+        r__.read(origin);
+        return true;
+      }
+
+      if (name__ == "htime")
+      {
+        r__.read(htime);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     IridiumMsgTx::IridiumMsgTx(void)
     {
       m_header.mgid = 171;
@@ -3339,6 +4810,45 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    IridiumMsgTx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("ttl", ttl);
+      w__.write("destination", destination);
+      w__.write("data", data);
+    }
+
+    bool
+    IridiumMsgTx::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "ttl")
+      {
+        r__.read(ttl);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     IridiumTxStatus::IridiumTxStatus(void)
     {
       m_header.mgid = 172;
@@ -3407,6 +4917,38 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    IridiumTxStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("status", status);
+      w__.write("text", text);
+    }
+
+    bool
+    IridiumTxStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      if (name__ == "text")
+      {
+        r__.read(text);
+        return true;
+      }
+
+      return false;
+    }
+
     GroupMembershipState::GroupMembershipState(void)
     {
       m_header.mgid = 180;
@@ -3469,6 +5011,31 @@ namespace DUNE
       IMC::toJSON(os__, "links", links, nindent__);
     }
 
+    void
+    GroupMembershipState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("group_name", group_name);
+      w__.write("links", links);
+    }
+
+    bool
+    GroupMembershipState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "group_name")
+      {
+        r__.read(group_name);
+        return true;
+      }
+
+      if (name__ == "links")
+      {
+        r__.read(links);
+        return true;
+      }
+
+      return false;
+    }
+
     SystemGroup::SystemGroup(void)
     {
       m_header.mgid = 181;
@@ -3537,6 +5104,38 @@ namespace DUNE
       IMC::toJSON(os__, "grouplist", grouplist, nindent__);
     }
 
+    void
+    SystemGroup::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("groupname", groupname);
+      w__.write("action", action);
+      w__.write("grouplist", grouplist);
+    }
+
+    bool
+    SystemGroup::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "groupname")
+      {
+        r__.read(groupname);
+        return true;
+      }
+
+      if (name__ == "action")
+      {
+        r__.read(action);
+        return true;
+      }
+
+      if (name__ == "grouplist")
+      {
+        r__.read(grouplist);
+        return true;
+      }
+
+      return false;
+    }
+
     LinkLatency::LinkLatency(void)
     {
       m_header.mgid = 182;
@@ -3569,28 +5168,33 @@ namespace DUNE
     uint8_t*
     LinkLatency::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(sys_src, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(sys_src, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     LinkLatency::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      Utils::ByteCopy::copy(sys_src, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     LinkLatency::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      Utils::ByteCopy::rcopy(sys_src, bfr__ + 4);
+      return c_fields_size;
     }
 
     fp64_t
@@ -3612,6 +5216,31 @@ namespace DUNE
       IMC::toJSON(os__, "sys_src", sys_src, nindent__);
     }
 
+    void
+    LinkLatency::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("sys_src", sys_src);
+    }
+
+    bool
+    LinkLatency::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "sys_src")
+      {
+        r__.read(sys_src);
+        return true;
+      }
+
+      return false;
+    }
+
     ExtendedRSSI::ExtendedRSSI(void)
     {
       m_header.mgid = 183;
@@ -3643,28 +5272,33 @@ namespace DUNE
     uint8_t*
     ExtendedRSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(units, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ExtendedRSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      Utils::ByteCopy::copy(units, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     ExtendedRSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      Utils::ByteCopy::rcopy(units, bfr__ + 4);
+      return c_fields_size;
     }
 
     fp64_t
@@ -3686,6 +5320,31 @@ namespace DUNE
       IMC::toJSON(os__, "units", units, nindent__);
     }
 
+    void
+    ExtendedRSSI::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("units", units);
+    }
+
+    bool
+    ExtendedRSSI::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "units")
+      {
+        r__.read(units);
+        return true;
+      }
+
+      return false;
+    }
+
     HistoricData::HistoricData(void)
     {
       m_header.mgid = 184;
@@ -3761,6 +5420,45 @@ namespace DUNE
       data.toJSON(os__, "data", nindent__);
     }
 
+    void
+    HistoricData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("base_lat", base_lat);
+      w__.write("base_lon", base_lon);
+      w__.write("base_time", base_time);
+      data.toJSON(w__, "data");
+    }
+
+    bool
+    HistoricData::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "base_lat")
+      {
+        r__.read(base_lat);
+        return true;
+      }
+
+      if (name__ == "base_lon")
+      {
+        r__.read(base_lon);
+        return true;
+      }
+
+      if (name__ == "base_time")
+      {
+        r__.read(base_time);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        data.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     HistoricData::setTimeStampNested(double value__)
     {
@@ -3865,15 +5563,54 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
-    HistoricSample::HistoricSample(void)
+    void
+    CompressedHistory::fieldsToJSON(JSONWriter& w__) const
     {
-      m_header.mgid = 186;
-      clear();
-      sample.setParent(this);
+      w__.write("base_lat", base_lat);
+      w__.write("base_lon", base_lon);
+      w__.write("base_time", base_time);
+      w__.write("data", data);
     }
 
-    void
-    HistoricSample::clear(void)
+    bool
+    CompressedHistory::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "base_lat")
+      {
+        r__.read(base_lat);
+        return true;
+      }
+
+      if (name__ == "base_lon")
+      {
+        r__.read(base_lon);
+        return true;
+      }
+
+      if (name__ == "base_time")
+      {
+        r__.read(base_time);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
+    HistoricSample::HistoricSample(void)
+    {
+      m_header.mgid = 186;
+      clear();
+      sample.setParent(this);
+    }
+
+    void
+    HistoricSample::clear(void)
     {
       sys_id = 0;
       priority = 0;
@@ -3958,6 +5695,66 @@ namespace DUNE
       sample.toJSON(os__, "sample", nindent__);
     }
 
+    void
+    HistoricSample::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sys_id", sys_id);
+      w__.write("priority", priority);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("t", t);
+      sample.toJSON(w__, "sample");
+    }
+
+    bool
+    HistoricSample::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sys_id")
+      {
+        r__.read(sys_id);
+        return true;
+      }
+
+      if (name__ == "priority")
+      {
+        r__.read(priority);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "t")
+      {
+        r__.read(t);
+        return true;
+      }
+
+      if (name__ == "sample")
+      {
+        sample.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     HistoricSample::setTimeStampNested(double value__)
     {
@@ -4078,6 +5875,45 @@ namespace DUNE
       data.toJSON(os__, "data", nindent__);
     }
 
+    void
+    HistoricDataQuery::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("type", type);
+      w__.write("max_size", max_size);
+      data.toJSON(w__, "data");
+    }
+
+    bool
+    HistoricDataQuery::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "max_size")
+      {
+        r__.read(max_size);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        data.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     HistoricDataQuery::setTimeStampNested(double value__)
     {
@@ -4198,6 +6034,45 @@ namespace DUNE
       cmd.toJSON(os__, "cmd", nindent__);
     }
 
+    void
+    RemoteCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("original_source", original_source);
+      w__.write("destination", destination);
+      w__.write("timeout", timeout);
+      cmd.toJSON(w__, "cmd");
+    }
+
+    bool
+    RemoteCommand::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "original_source")
+      {
+        r__.read(original_source);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "cmd")
+      {
+        cmd.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     RemoteCommand::setTimeStampNested(double value__)
     {
@@ -4317,6 +6192,45 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    void
+    CommSystemsQuery::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("comm_interface", comm_interface);
+      w__.write("model", model);
+      w__.write("list", list);
+    }
+
+    bool
+    CommSystemsQuery::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "comm_interface")
+      {
+        r__.read(comm_interface);
+        return true;
+      }
+
+      if (name__ == "model")
+      {
+        r__.read(model);
+        return true;
+      }
+
+      if (name__ == "list")
+      {
+        r__.read(list);
+        return true;
+      }
+
+      return false;
+    }
+
     TelemetryMsg::TelemetryMsg(void)
     {
       m_header.mgid = 190;
@@ -4421,6 +6335,80 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    TelemetryMsg::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("req_id", req_id);
+      w__.write("ttl", ttl);
+      w__.write("code", code);
+      w__.write("destination", destination);
+      w__.write("source", source);
+      w__.write("acknowledge", acknowledge);
+      w__.write("status", status);
+      w__.write("data", data);
+    }
+
+    bool
+    TelemetryMsg::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "ttl")
+      {
+        r__.read(ttl);
+        return true;
+      }
+
+      if (name__ == "code")
+      {
+        r__.read(code);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "source")
+      {
+        r__.read(source);
+        return true;
+      }
+
+      if (name__ == "acknowledge")
+      {
+        r__.read(acknowledge);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     LblRange::LblRange(void)
     {
       m_header.mgid = 200;
@@ -4452,28 +6440,33 @@ namespace DUNE
     uint8_t*
     LblRange::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(range, bfr__ + 1);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     LblRange::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(range, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
     LblRange::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(range, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
@@ -4495,6 +6488,31 @@ namespace DUNE
       IMC::toJSON(os__, "range", range, nindent__);
     }
 
+    void
+    LblRange::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("range", range);
+    }
+
+    bool
+    LblRange::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      return false;
+    }
+
     LblBeacon::LblBeacon(void)
     {
       m_header.mgid = 202;
@@ -4589,6 +6607,66 @@ namespace DUNE
       IMC::toJSON(os__, "transponder_delay", transponder_delay, nindent__);
     }
 
+    void
+    LblBeacon::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("beacon", beacon);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("depth", depth);
+      w__.write("query_channel", query_channel);
+      w__.write("reply_channel", reply_channel);
+      w__.write("transponder_delay", transponder_delay);
+    }
+
+    bool
+    LblBeacon::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "beacon")
+      {
+        r__.read(beacon);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "query_channel")
+      {
+        r__.read(query_channel);
+        return true;
+      }
+
+      if (name__ == "reply_channel")
+      {
+        r__.read(reply_channel);
+        return true;
+      }
+
+      if (name__ == "transponder_delay")
+      {
+        r__.read(transponder_delay);
+        return true;
+      }
+
+      return false;
+    }
+
     LblConfig::LblConfig(void)
     {
       m_header.mgid = 203;
@@ -4652,6 +6730,31 @@ namespace DUNE
       beacons.toJSON(os__, "beacons", nindent__);
     }
 
+    void
+    LblConfig::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      beacons.toJSON(w__, "beacons");
+    }
+
+    bool
+    LblConfig::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "beacons")
+      {
+        beacons.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     LblConfig::setTimeStampNested(double value__)
     {
@@ -4739,6 +6842,24 @@ namespace DUNE
       message.toJSON(os__, "message", nindent__);
     }
 
+    void
+    AcousticMessage::fieldsToJSON(JSONWriter& w__) const
+    {
+      message.toJSON(w__, "message");
+    }
+
+    bool
+    AcousticMessage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "message")
+      {
+        message.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     AcousticMessage::setTimeStampNested(double value__)
     {
@@ -4900,34 +7021,122 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
-    AcousticOperation::AcousticOperation(void)
-    {
-      m_header.mgid = 211;
-      clear();
-      msg.setParent(this);
-    }
-
     void
-    AcousticOperation::clear(void)
+    SimAcousticMessage::fieldsToJSON(JSONWriter& w__) const
     {
-      op = 0;
-      system.clear();
-      range = 0;
-      msg.clear();
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("depth", depth);
+      w__.write("sentence", sentence);
+      w__.write("txtime", txtime);
+      w__.write("modem_type", modem_type);
+      w__.write("sys_src", sys_src);
+      w__.write("seq", seq);
+      w__.write("sys_dst", sys_dst);
+      w__.write("flags", flags);
+      w__.write("data", data);
     }
 
     bool
-    AcousticOperation::fieldsEqual(const Message& msg__) const
+    SimAcousticMessage::fieldFromJSON(const std::string& name__, JSONReader& r__)
     {
-      const IMC::AcousticOperation& other__ = static_cast<const AcousticOperation&>(msg__);
-      if (op != other__.op) return false;
-      if (system != other__.system) return false;
-      if (range != other__.range) return false;
-      if (msg != other__.msg) return false;
-      return true;
-    }
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
 
-    int
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "sentence")
+      {
+        r__.read(sentence);
+        return true;
+      }
+
+      if (name__ == "txtime")
+      {
+        r__.read(txtime);
+        return true;
+      }
+
+      if (name__ == "modem_type")
+      {
+        r__.read(modem_type);
+        return true;
+      }
+
+      if (name__ == "sys_src")
+      {
+        r__.read(sys_src);
+        return true;
+      }
+
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "sys_dst")
+      {
+        r__.read(sys_dst);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
+    AcousticOperation::AcousticOperation(void)
+    {
+      m_header.mgid = 211;
+      clear();
+      msg.setParent(this);
+    }
+
+    void
+    AcousticOperation::clear(void)
+    {
+      op = 0;
+      system.clear();
+      range = 0;
+      msg.clear();
+    }
+
+    bool
+    AcousticOperation::fieldsEqual(const Message& msg__) const
+    {
+      const IMC::AcousticOperation& other__ = static_cast<const AcousticOperation&>(msg__);
+      if (op != other__.op) return false;
+      if (system != other__.system) return false;
+      if (range != other__.range) return false;
+      if (msg != other__.msg) return false;
+      return true;
+    }
+
+    int
     AcousticOperation::validate(void) const
     {
       return true;
@@ -4975,6 +7184,45 @@ namespace DUNE
       msg.toJSON(os__, "msg", nindent__);
     }
 
+    void
+    AcousticOperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("system", system);
+      w__.write("range", range);
+      msg.toJSON(w__, "msg");
+    }
+
+    bool
+    AcousticOperation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "system")
+      {
+        r__.read(system);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      if (name__ == "msg")
+      {
+        msg.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     AcousticOperation::setTimeStampNested(double value__)
     {
@@ -5115,6 +7363,24 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    void
+    AcousticSystems::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("list", list);
+    }
+
+    bool
+    AcousticSystems::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "list")
+      {
+        r__.read(list);
+        return true;
+      }
+
+      return false;
+    }
+
     AcousticLink::AcousticLink(void)
     {
       m_header.mgid = 214;
@@ -5183,6 +7449,38 @@ namespace DUNE
       IMC::toJSON(os__, "integrity", integrity, nindent__);
     }
 
+    void
+    AcousticLink::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("peer", peer);
+      w__.write("rssi", rssi);
+      w__.write("integrity", integrity);
+    }
+
+    bool
+    AcousticLink::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "peer")
+      {
+        r__.read(peer);
+        return true;
+      }
+
+      if (name__ == "rssi")
+      {
+        r__.read(rssi);
+        return true;
+      }
+
+      if (name__ == "integrity")
+      {
+        r__.read(integrity);
+        return true;
+      }
+
+      return false;
+    }
+
     AcousticRequest::AcousticRequest(void)
     {
       m_header.mgid = 215;
@@ -5270,6 +7568,59 @@ namespace DUNE
       msg.toJSON(os__, "msg", nindent__);
     }
 
+    void
+    AcousticRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("destination", destination);
+      w__.write("timeout", timeout);
+      w__.write("range", range);
+      w__.write("type", type);
+      msg.toJSON(w__, "msg");
+    }
+
+    bool
+    AcousticRequest::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "msg")
+      {
+        msg.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     AcousticRequest::setTimeStampNested(double value__)
     {
@@ -5395,6 +7746,52 @@ namespace DUNE
       IMC::toJSON(os__, "range", range, nindent__);
     }
 
+    void
+    AcousticStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("type", type);
+      w__.write("status", status);
+      w__.write("info", info);
+      w__.write("range", range);
+    }
+
+    bool
+    AcousticStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      return false;
+    }
+
     Rpm::Rpm(void)
     {
       m_header.mgid = 250;
@@ -5424,25 +7821,30 @@ namespace DUNE
     uint8_t*
     Rpm::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Rpm::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Rpm::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -5463,6 +7865,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Rpm::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Rpm::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Voltage::Voltage(void)
     {
       m_header.mgid = 251;
@@ -5492,25 +7912,30 @@ namespace DUNE
     uint8_t*
     Voltage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Voltage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Voltage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -5531,6 +7956,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Voltage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Voltage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Current::Current(void)
     {
       m_header.mgid = 252;
@@ -5560,25 +8003,30 @@ namespace DUNE
     uint8_t*
     Current::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Current::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Current::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -5599,6 +8047,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Current::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Current::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     GpsFix::GpsFix(void)
     {
       m_header.mgid = 253;
@@ -5660,70 +8126,69 @@ namespace DUNE
     uint8_t*
     GpsFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(utc_year, ptr__);
-      ptr__ += IMC::serialize(utc_month, ptr__);
-      ptr__ += IMC::serialize(utc_day, ptr__);
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(sog, ptr__);
-      ptr__ += IMC::serialize(hdop, ptr__);
-      ptr__ += IMC::serialize(vdop, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 2);
+      IMC::serialize(utc_year, bfr__ + 3);
+      IMC::serialize(utc_month, bfr__ + 5);
+      IMC::serialize(utc_day, bfr__ + 6);
+      IMC::serialize(utc_time, bfr__ + 7);
+      IMC::serialize(lat, bfr__ + 11);
+      IMC::serialize(lon, bfr__ + 19);
+      IMC::serialize(height, bfr__ + 27);
+      IMC::serialize(satellites, bfr__ + 31);
+      IMC::serialize(cog, bfr__ + 32);
+      IMC::serialize(sog, bfr__ + 36);
+      IMC::serialize(hdop, bfr__ + 40);
+      IMC::serialize(vdop, bfr__ + 44);
+      IMC::serialize(hacc, bfr__ + 48);
+      IMC::serialize(vacc, bfr__ + 52);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GpsFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(sog, bfr__, size__);
-      bfr__ += IMC::deserialize(hdop, bfr__, size__);
-      bfr__ += IMC::deserialize(vdop, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(validity, bfr__ + 0);
+      Utils::ByteCopy::copy(type, bfr__ + 2);
+      Utils::ByteCopy::copy(utc_year, bfr__ + 3);
+      Utils::ByteCopy::copy(utc_month, bfr__ + 5);
+      Utils::ByteCopy::copy(utc_day, bfr__ + 6);
+      Utils::ByteCopy::copy(utc_time, bfr__ + 7);
+      Utils::ByteCopy::copy(lat, bfr__ + 11);
+      Utils::ByteCopy::copy(lon, bfr__ + 19);
+      Utils::ByteCopy::copy(height, bfr__ + 27);
+      Utils::ByteCopy::copy(satellites, bfr__ + 31);
+      Utils::ByteCopy::copy(cog, bfr__ + 32);
+      Utils::ByteCopy::copy(sog, bfr__ + 36);
+      Utils::ByteCopy::copy(hdop, bfr__ + 40);
+      Utils::ByteCopy::copy(vdop, bfr__ + 44);
+      Utils::ByteCopy::copy(hacc, bfr__ + 48);
+      Utils::ByteCopy::copy(vacc, bfr__ + 52);
+      return c_fields_size;
     }
 
     uint16_t
     GpsFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy2b(swap__ + 0, bfr__ + 0, 1);
+      std::memcpy(swap__ + 2, bfr__ + 2, 1);
+      Utils::ByteCopy::rcopy2b(swap__ + 3, bfr__ + 3, 1);
+      std::memcpy(swap__ + 5, bfr__ + 5, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 7, bfr__ + 7, 1);
+      Utils::ByteCopy::rcopy8b(swap__ + 11, bfr__ + 11, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 27, bfr__ + 27, 1);
+      std::memcpy(swap__ + 31, bfr__ + 31, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 32, bfr__ + 32, 6);
+      return GpsFix::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -5747,6 +8212,129 @@ namespace DUNE
       IMC::toJSON(os__, "vacc", vacc, nindent__);
     }
 
+    void
+    GpsFix::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("validity", validity);
+      w__.write("type", type);
+      w__.write("utc_year", utc_year);
+      w__.write("utc_month", utc_month);
+      w__.write("utc_day", utc_day);
+      w__.write("utc_time", utc_time);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height", height);
+      w__.write("satellites", satellites);
+      w__.write("cog", cog);
+      w__.write("sog", sog);
+      w__.write("hdop", hdop);
+      w__.write("vdop", vdop);
+      w__.write("hacc", hacc);
+      w__.write("vacc", vacc);
+    }
+
+    bool
+    GpsFix::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "validity")
+      {
+        r__.read(validity);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "utc_year")
+      {
+        r__.read(utc_year);
+        return true;
+      }
+
+      if (name__ == "utc_month")
+      {
+        r__.read(utc_month);
+        return true;
+      }
+
+      if (name__ == "utc_day")
+      {
+        r__.read(utc_day);
+        return true;
+      }
+
+      if (name__ == "utc_time")
+      {
+        r__.read(utc_time);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height")
+      {
+        r__.read(height);
+        return true;
+      }
+
+      if (name__ == "satellites")
+      {
+        r__.read(satellites);
+        return true;
+      }
+
+      if (name__ == "cog")
+      {
+        r__.read(cog);
+        return true;
+      }
+
+      if (name__ == "sog")
+      {
+        r__.read(sog);
+        return true;
+      }
+
+      if (name__ == "hdop")
+      {
+        r__.read(hdop);
+        return true;
+      }
+
+      if (name__ == "vdop")
+      {
+        r__.read(vdop);
+        return true;
+      }
+
+      if (name__ == "hacc")
+      {
+        r__.read(hacc);
+        return true;
+      }
+
+      if (name__ == "vacc")
+      {
+        r__.read(vacc);
+        return true;
+      }
+
+      return false;
+    }
+
     EulerAngles::EulerAngles(void)
     {
       m_header.mgid = 254;
@@ -5788,37 +8376,39 @@ namespace DUNE
     uint8_t*
     EulerAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(psi_magnetic, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(phi, bfr__ + 8);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 24);
+      IMC::serialize(psi_magnetic, bfr__ + 32);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     EulerAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(time, bfr__ + 0);
+      Utils::ByteCopy::copy(phi, bfr__ + 8);
+      Utils::ByteCopy::copy(theta, bfr__ + 16);
+      Utils::ByteCopy::copy(psi, bfr__ + 24);
+      Utils::ByteCopy::copy(psi_magnetic, bfr__ + 32);
+      return c_fields_size;
     }
 
     uint16_t
     EulerAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 5);
+      return EulerAngles::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -5831,6 +8421,52 @@ namespace DUNE
       IMC::toJSON(os__, "psi_magnetic", psi_magnetic, nindent__);
     }
 
+    void
+    EulerAngles::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("time", time);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("psi_magnetic", psi_magnetic);
+    }
+
+    bool
+    EulerAngles::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "psi_magnetic")
+      {
+        r__.read(psi_magnetic);
+        return true;
+      }
+
+      return false;
+    }
+
     EulerAnglesDelta::EulerAnglesDelta(void)
     {
       m_header.mgid = 255;
@@ -5868,37 +8504,40 @@ namespace DUNE
     uint8_t*
     EulerAnglesDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      IMC::serialize(timestep, bfr__ + 32);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     EulerAnglesDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(time, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 8);
+      Utils::ByteCopy::copy(y, bfr__ + 16);
+      Utils::ByteCopy::copy(z, bfr__ + 24);
+      Utils::ByteCopy::copy(timestep, bfr__ + 32);
+      return c_fields_size;
     }
 
     uint16_t
     EulerAnglesDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 4);
+      Utils::ByteCopy::rcopy4b(swap__ + 32, bfr__ + 32, 1);
+      return EulerAnglesDelta::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -5911,6 +8550,52 @@ namespace DUNE
       IMC::toJSON(os__, "timestep", timestep, nindent__);
     }
 
+    void
+    EulerAnglesDelta::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("time", time);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("timestep", timestep);
+    }
+
+    bool
+    EulerAnglesDelta::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "timestep")
+      {
+        r__.read(timestep);
+        return true;
+      }
+
+      return false;
+    }
+
     AngularVelocity::AngularVelocity(void)
     {
       m_header.mgid = 256;
@@ -5946,34 +8631,37 @@ namespace DUNE
     uint8_t*
     AngularVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     AngularVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(time, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 8);
+      Utils::ByteCopy::copy(y, bfr__ + 16);
+      Utils::ByteCopy::copy(z, bfr__ + 24);
+      return c_fields_size;
     }
 
     uint16_t
     AngularVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 4);
+      return AngularVelocity::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -5985,6 +8673,45 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    AngularVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("time", time);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    AngularVelocity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     Acceleration::Acceleration(void)
     {
       m_header.mgid = 257;
@@ -6020,34 +8747,37 @@ namespace DUNE
     uint8_t*
     Acceleration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Acceleration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(time, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 8);
+      Utils::ByteCopy::copy(y, bfr__ + 16);
+      Utils::ByteCopy::copy(z, bfr__ + 24);
+      return c_fields_size;
     }
 
     uint16_t
     Acceleration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 4);
+      return Acceleration::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -6059,6 +8789,45 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    Acceleration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("time", time);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    Acceleration::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     MagneticField::MagneticField(void)
     {
       m_header.mgid = 258;
@@ -6094,34 +8863,37 @@ namespace DUNE
     uint8_t*
     MagneticField::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     MagneticField::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(time, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 8);
+      Utils::ByteCopy::copy(y, bfr__ + 16);
+      Utils::ByteCopy::copy(z, bfr__ + 24);
+      return c_fields_size;
     }
 
     uint16_t
     MagneticField::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 4);
+      return MagneticField::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -6133,7 +8905,46 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
-    GroundVelocity::GroundVelocity(void)
+    void
+    MagneticField::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("time", time);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    MagneticField::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
+    GroundVelocity::GroundVelocity(void)
     {
       m_header.mgid = 259;
       clear();
@@ -6168,34 +8979,39 @@ namespace DUNE
     uint8_t*
     GroundVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 9);
+      IMC::serialize(z, bfr__ + 17);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GroundVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(validity, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 1);
+      Utils::ByteCopy::copy(y, bfr__ + 9);
+      Utils::ByteCopy::copy(z, bfr__ + 17);
+      return c_fields_size;
     }
 
     uint16_t
     GroundVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(validity, bfr__ + 0);
+      Utils::ByteCopy::rcopy(x, bfr__ + 1);
+      Utils::ByteCopy::rcopy(y, bfr__ + 9);
+      Utils::ByteCopy::rcopy(z, bfr__ + 17);
+      return c_fields_size;
     }
 
     void
@@ -6207,6 +9023,45 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    GroundVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("validity", validity);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    GroundVelocity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "validity")
+      {
+        r__.read(validity);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     WaterVelocity::WaterVelocity(void)
     {
       m_header.mgid = 260;
@@ -6242,34 +9097,39 @@ namespace DUNE
     uint8_t*
     WaterVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 9);
+      IMC::serialize(z, bfr__ + 17);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     WaterVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(validity, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 1);
+      Utils::ByteCopy::copy(y, bfr__ + 9);
+      Utils::ByteCopy::copy(z, bfr__ + 17);
+      return c_fields_size;
     }
 
     uint16_t
     WaterVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(validity, bfr__ + 0);
+      Utils::ByteCopy::rcopy(x, bfr__ + 1);
+      Utils::ByteCopy::rcopy(y, bfr__ + 9);
+      Utils::ByteCopy::rcopy(z, bfr__ + 17);
+      return c_fields_size;
     }
 
     void
@@ -6281,6 +9141,45 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    WaterVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("validity", validity);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    WaterVelocity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "validity")
+      {
+        r__.read(validity);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     VelocityDelta::VelocityDelta(void)
     {
       m_header.mgid = 261;
@@ -6316,34 +9215,37 @@ namespace DUNE
     uint8_t*
     VelocityDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     VelocityDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(time, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 8);
+      Utils::ByteCopy::copy(y, bfr__ + 16);
+      Utils::ByteCopy::copy(z, bfr__ + 24);
+      return c_fields_size;
     }
 
     uint16_t
     VelocityDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 4);
+      return VelocityDelta::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -6355,6 +9257,45 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    VelocityDelta::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("time", time);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    VelocityDelta::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     DeviceState::DeviceState(void)
     {
       m_header.mgid = 282;
@@ -6394,40 +9335,41 @@ namespace DUNE
     uint8_t*
     DeviceState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(phi, bfr__ + 12);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 20);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DeviceState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 4);
+      Utils::ByteCopy::copy(z, bfr__ + 8);
+      Utils::ByteCopy::copy(phi, bfr__ + 12);
+      Utils::ByteCopy::copy(theta, bfr__ + 16);
+      Utils::ByteCopy::copy(psi, bfr__ + 20);
+      return c_fields_size;
     }
 
     uint16_t
     DeviceState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 6);
+      return DeviceState::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -6441,6 +9383,59 @@ namespace DUNE
       IMC::toJSON(os__, "psi", psi, nindent__);
     }
 
+    void
+    DeviceState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+    }
+
+    bool
+    DeviceState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      return false;
+    }
+
     BeamConfig::BeamConfig(void)
     {
       m_header.mgid = 283;
@@ -6474,28 +9469,33 @@ namespace DUNE
     uint8_t*
     BeamConfig::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(beam_width, ptr__);
-      ptr__ += IMC::serialize(beam_height, ptr__);
-      return ptr__;
+      IMC::serialize(beam_width, bfr__ + 0);
+      IMC::serialize(beam_height, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     BeamConfig::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::deserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(beam_width, bfr__ + 0);
+      Utils::ByteCopy::copy(beam_height, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     BeamConfig::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(beam_width, bfr__ + 0);
+      Utils::ByteCopy::rcopy(beam_height, bfr__ + 4);
+      return c_fields_size;
     }
 
     void
@@ -6505,6 +9505,31 @@ namespace DUNE
       IMC::toJSON(os__, "beam_height", beam_height, nindent__);
     }
 
+    void
+    BeamConfig::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("beam_width", beam_width);
+      w__.write("beam_height", beam_height);
+    }
+
+    bool
+    BeamConfig::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "beam_width")
+      {
+        r__.read(beam_width);
+        return true;
+      }
+
+      if (name__ == "beam_height")
+      {
+        r__.read(beam_height);
+        return true;
+      }
+
+      return false;
+    }
+
     Distance::Distance(void)
     {
       m_header.mgid = 262;
@@ -6593,6 +9618,45 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Distance::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("validity", validity);
+      location.toJSON(w__, "location");
+      beam_config.toJSON(w__, "beam_config");
+      w__.write("value", value);
+    }
+
+    bool
+    Distance::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "validity")
+      {
+        r__.read(validity);
+        return true;
+      }
+
+      if (name__ == "location")
+      {
+        location.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "beam_config")
+      {
+        beam_config.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     Distance::setTimeStampNested(double value__)
     {
@@ -6662,25 +9726,30 @@ namespace DUNE
     uint8_t*
     Temperature::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Temperature::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Temperature::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -6701,6 +9770,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Temperature::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Temperature::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Pressure::Pressure(void)
     {
       m_header.mgid = 264;
@@ -6730,25 +9817,30 @@ namespace DUNE
     uint8_t*
     Pressure::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Pressure::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Pressure::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -6769,6 +9861,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Pressure::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Pressure::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Depth::Depth(void)
     {
       m_header.mgid = 265;
@@ -6798,25 +9908,30 @@ namespace DUNE
     uint8_t*
     Depth::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Depth::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Depth::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -6837,6 +9952,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Depth::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Depth::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DepthOffset::DepthOffset(void)
     {
       m_header.mgid = 266;
@@ -6866,25 +9999,30 @@ namespace DUNE
     uint8_t*
     DepthOffset::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DepthOffset::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DepthOffset::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -6905,6 +10043,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DepthOffset::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DepthOffset::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     SoundSpeed::SoundSpeed(void)
     {
       m_header.mgid = 267;
@@ -6934,25 +10090,30 @@ namespace DUNE
     uint8_t*
     SoundSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SoundSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     SoundSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -6973,6 +10134,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SoundSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    SoundSpeed::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     WaterDensity::WaterDensity(void)
     {
       m_header.mgid = 268;
@@ -7002,25 +10181,30 @@ namespace DUNE
     uint8_t*
     WaterDensity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     WaterDensity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     WaterDensity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -7041,6 +10225,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    WaterDensity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    WaterDensity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Conductivity::Conductivity(void)
     {
       m_header.mgid = 269;
@@ -7070,25 +10272,30 @@ namespace DUNE
     uint8_t*
     Conductivity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Conductivity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Conductivity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -7109,6 +10316,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Conductivity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Conductivity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Salinity::Salinity(void)
     {
       m_header.mgid = 270;
@@ -7138,25 +10363,30 @@ namespace DUNE
     uint8_t*
     Salinity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Salinity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Salinity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -7177,6 +10407,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Salinity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Salinity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     WindSpeed::WindSpeed(void)
     {
       m_header.mgid = 271;
@@ -7210,31 +10458,36 @@ namespace DUNE
     uint8_t*
     WindSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(direction, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      return ptr__;
+      IMC::serialize(direction, bfr__ + 0);
+      IMC::serialize(speed, bfr__ + 4);
+      IMC::serialize(turbulence, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     WindSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(direction, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(direction, bfr__ + 0);
+      Utils::ByteCopy::copy(speed, bfr__ + 4);
+      Utils::ByteCopy::copy(turbulence, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     WindSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(direction, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(direction, bfr__ + 0);
+      Utils::ByteCopy::rcopy(speed, bfr__ + 4);
+      Utils::ByteCopy::rcopy(turbulence, bfr__ + 8);
+      return c_fields_size;
     }
 
     void
@@ -7245,6 +10498,38 @@ namespace DUNE
       IMC::toJSON(os__, "turbulence", turbulence, nindent__);
     }
 
+    void
+    WindSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("direction", direction);
+      w__.write("speed", speed);
+      w__.write("turbulence", turbulence);
+    }
+
+    bool
+    WindSpeed::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "direction")
+      {
+        r__.read(direction);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "turbulence")
+      {
+        r__.read(turbulence);
+        return true;
+      }
+
+      return false;
+    }
+
     RelativeHumidity::RelativeHumidity(void)
     {
       m_header.mgid = 272;
@@ -7275,25 +10560,30 @@ namespace DUNE
     uint8_t*
     RelativeHumidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     RelativeHumidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     RelativeHumidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -7314,6 +10604,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    RelativeHumidity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    RelativeHumidity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DevDataText::DevDataText(void)
     {
       m_header.mgid = 273;
@@ -7370,6 +10678,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DevDataText::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DevDataText::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DevDataBinary::DevDataBinary(void)
     {
       m_header.mgid = 274;
@@ -7426,16 +10752,34 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
-    Force::Force(void)
-    {
-      m_header.mgid = 275;
-      clear();
-    }
-
     void
-    Force::clear(void)
+    DevDataBinary::fieldsToJSON(JSONWriter& w__) const
     {
-      value = 0;
+      w__.write("value", value);
+    }
+
+    bool
+    DevDataBinary::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
+    Force::Force(void)
+    {
+      m_header.mgid = 275;
+      clear();
+    }
+
+    void
+    Force::clear(void)
+    {
+      value = 0;
     }
 
     bool
@@ -7455,25 +10799,30 @@ namespace DUNE
     uint8_t*
     Force::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Force::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Force::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -7494,6 +10843,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Force::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Force::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     SonarData::SonarData(void)
     {
       m_header.mgid = 276;
@@ -7593,6 +10960,73 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    SonarData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("frequency", frequency);
+      w__.write("min_range", min_range);
+      w__.write("max_range", max_range);
+      w__.write("bits_per_point", bits_per_point);
+      w__.write("scale_factor", scale_factor);
+      beam_config.toJSON(w__, "beam_config");
+      w__.write("data", data);
+    }
+
+    bool
+    SonarData::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "frequency")
+      {
+        r__.read(frequency);
+        return true;
+      }
+
+      if (name__ == "min_range")
+      {
+        r__.read(min_range);
+        return true;
+      }
+
+      if (name__ == "max_range")
+      {
+        r__.read(max_range);
+        return true;
+      }
+
+      if (name__ == "bits_per_point")
+      {
+        r__.read(bits_per_point);
+        return true;
+      }
+
+      if (name__ == "scale_factor")
+      {
+        r__.read(scale_factor);
+        return true;
+      }
+
+      if (name__ == "beam_config")
+      {
+        beam_config.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     SonarData::setTimeStampNested(double value__)
     {
@@ -7691,25 +11125,30 @@ namespace DUNE
     uint8_t*
     PulseDetectionControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PulseDetectionControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     PulseDetectionControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -7718,6 +11157,24 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    void
+    PulseDetectionControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+    }
+
+    bool
+    PulseDetectionControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      return false;
+    }
+
     FuelLevel::FuelLevel(void)
     {
       m_header.mgid = 279;
@@ -7800,6 +11257,38 @@ namespace DUNE
       IMC::toJSON(os__, "opmodes", opmodes, nindent__);
     }
 
+    void
+    FuelLevel::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("confidence", confidence);
+      w__.write("opmodes", opmodes);
+    }
+
+    bool
+    FuelLevel::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "confidence")
+      {
+        r__.read(confidence);
+        return true;
+      }
+
+      if (name__ == "opmodes")
+      {
+        r__.read(opmodes);
+        return true;
+      }
+
+      return false;
+    }
+
     GpsNavData::GpsNavData(void)
     {
       m_header.mgid = 280;
@@ -7857,67 +11346,61 @@ namespace DUNE
     uint8_t*
     GpsNavData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(itow, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height_ell, ptr__);
-      ptr__ += IMC::serialize(height_sea, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      ptr__ += IMC::serialize(vel_n, ptr__);
-      ptr__ += IMC::serialize(vel_e, ptr__);
-      ptr__ += IMC::serialize(vel_d, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(gspeed, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(sacc, ptr__);
-      ptr__ += IMC::serialize(cacc, ptr__);
-      return ptr__;
+      IMC::serialize(itow, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 4);
+      IMC::serialize(lon, bfr__ + 12);
+      IMC::serialize(height_ell, bfr__ + 20);
+      IMC::serialize(height_sea, bfr__ + 24);
+      IMC::serialize(hacc, bfr__ + 28);
+      IMC::serialize(vacc, bfr__ + 32);
+      IMC::serialize(vel_n, bfr__ + 36);
+      IMC::serialize(vel_e, bfr__ + 40);
+      IMC::serialize(vel_d, bfr__ + 44);
+      IMC::serialize(speed, bfr__ + 48);
+      IMC::serialize(gspeed, bfr__ + 52);
+      IMC::serialize(heading, bfr__ + 56);
+      IMC::serialize(sacc, bfr__ + 60);
+      IMC::serialize(cacc, bfr__ + 64);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GpsNavData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(itow, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::deserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(sacc, bfr__, size__);
-      bfr__ += IMC::deserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(itow, bfr__ + 0);
+      Utils::ByteCopy::copy(lat, bfr__ + 4);
+      Utils::ByteCopy::copy(lon, bfr__ + 12);
+      Utils::ByteCopy::copy(height_ell, bfr__ + 20);
+      Utils::ByteCopy::copy(height_sea, bfr__ + 24);
+      Utils::ByteCopy::copy(hacc, bfr__ + 28);
+      Utils::ByteCopy::copy(vacc, bfr__ + 32);
+      Utils::ByteCopy::copy(vel_n, bfr__ + 36);
+      Utils::ByteCopy::copy(vel_e, bfr__ + 40);
+      Utils::ByteCopy::copy(vel_d, bfr__ + 44);
+      Utils::ByteCopy::copy(speed, bfr__ + 48);
+      Utils::ByteCopy::copy(gspeed, bfr__ + 52);
+      Utils::ByteCopy::copy(heading, bfr__ + 56);
+      Utils::ByteCopy::copy(sacc, bfr__ + 60);
+      Utils::ByteCopy::copy(cacc, bfr__ + 64);
+      return c_fields_size;
     }
 
     uint16_t
     GpsNavData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(itow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy8b(swap__ + 4, bfr__ + 4, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 20, bfr__ + 20, 12);
+      return GpsNavData::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -7940,6 +11423,122 @@ namespace DUNE
       IMC::toJSON(os__, "cacc", cacc, nindent__);
     }
 
+    void
+    GpsNavData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("itow", itow);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height_ell", height_ell);
+      w__.write("height_sea", height_sea);
+      w__.write("hacc", hacc);
+      w__.write("vacc", vacc);
+      w__.write("vel_n", vel_n);
+      w__.write("vel_e", vel_e);
+      w__.write("vel_d", vel_d);
+      w__.write("speed", speed);
+      w__.write("gspeed", gspeed);
+      w__.write("heading", heading);
+      w__.write("sacc", sacc);
+      w__.write("cacc", cacc);
+    }
+
+    bool
+    GpsNavData::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "itow")
+      {
+        r__.read(itow);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height_ell")
+      {
+        r__.read(height_ell);
+        return true;
+      }
+
+      if (name__ == "height_sea")
+      {
+        r__.read(height_sea);
+        return true;
+      }
+
+      if (name__ == "hacc")
+      {
+        r__.read(hacc);
+        return true;
+      }
+
+      if (name__ == "vacc")
+      {
+        r__.read(vacc);
+        return true;
+      }
+
+      if (name__ == "vel_n")
+      {
+        r__.read(vel_n);
+        return true;
+      }
+
+      if (name__ == "vel_e")
+      {
+        r__.read(vel_e);
+        return true;
+      }
+
+      if (name__ == "vel_d")
+      {
+        r__.read(vel_d);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "gspeed")
+      {
+        r__.read(gspeed);
+        return true;
+      }
+
+      if (name__ == "heading")
+      {
+        r__.read(heading);
+        return true;
+      }
+
+      if (name__ == "sacc")
+      {
+        r__.read(sacc);
+        return true;
+      }
+
+      if (name__ == "cacc")
+      {
+        r__.read(cacc);
+        return true;
+      }
+
+      return false;
+    }
+
     ServoPosition::ServoPosition(void)
     {
       m_header.mgid = 281;
@@ -7972,28 +11571,33 @@ namespace DUNE
     uint8_t*
     ServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
     ServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
@@ -8027,6 +11631,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    ServoPosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("value", value);
+    }
+
+    bool
+    ServoPosition::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DataSanity::DataSanity(void)
     {
       m_header.mgid = 284;
@@ -8056,25 +11685,30 @@ namespace DUNE
     uint8_t*
     DataSanity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sane, ptr__);
-      return ptr__;
+      IMC::serialize(sane, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DataSanity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(sane, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DataSanity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(sane, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -8083,6 +11717,24 @@ namespace DUNE
       IMC::toJSON(os__, "sane", sane, nindent__);
     }
 
+    void
+    DataSanity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sane", sane);
+    }
+
+    bool
+    DataSanity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sane")
+      {
+        r__.read(sane);
+        return true;
+      }
+
+      return false;
+    }
+
     RhodamineDye::RhodamineDye(void)
     {
       m_header.mgid = 285;
@@ -8112,25 +11764,30 @@ namespace DUNE
     uint8_t*
     RhodamineDye::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     RhodamineDye::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     RhodamineDye::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8151,7 +11808,25 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
-    CrudeOil::CrudeOil(void)
+    void
+    RhodamineDye::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    RhodamineDye::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
+    CrudeOil::CrudeOil(void)
     {
       m_header.mgid = 286;
       clear();
@@ -8180,25 +11855,30 @@ namespace DUNE
     uint8_t*
     CrudeOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     CrudeOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     CrudeOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8219,6 +11899,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    CrudeOil::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    CrudeOil::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     FineOil::FineOil(void)
     {
       m_header.mgid = 287;
@@ -8248,25 +11946,30 @@ namespace DUNE
     uint8_t*
     FineOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FineOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     FineOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8287,6 +11990,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    FineOil::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    FineOil::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Turbidity::Turbidity(void)
     {
       m_header.mgid = 288;
@@ -8316,25 +12037,30 @@ namespace DUNE
     uint8_t*
     Turbidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Turbidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Turbidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8355,6 +12081,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Turbidity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Turbidity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Chlorophyll::Chlorophyll(void)
     {
       m_header.mgid = 289;
@@ -8384,25 +12128,30 @@ namespace DUNE
     uint8_t*
     Chlorophyll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Chlorophyll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Chlorophyll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8423,6 +12172,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Chlorophyll::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Chlorophyll::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Fluorescein::Fluorescein(void)
     {
       m_header.mgid = 290;
@@ -8452,25 +12219,30 @@ namespace DUNE
     uint8_t*
     Fluorescein::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Fluorescein::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Fluorescein::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8491,6 +12263,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Fluorescein::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Fluorescein::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Phycocyanin::Phycocyanin(void)
     {
       m_header.mgid = 291;
@@ -8520,25 +12310,30 @@ namespace DUNE
     uint8_t*
     Phycocyanin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Phycocyanin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Phycocyanin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8559,6 +12354,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Phycocyanin::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Phycocyanin::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Phycoerythrin::Phycoerythrin(void)
     {
       m_header.mgid = 292;
@@ -8588,25 +12401,30 @@ namespace DUNE
     uint8_t*
     Phycoerythrin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Phycoerythrin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Phycoerythrin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -8627,6 +12445,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Phycoerythrin::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Phycoerythrin::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     GpsFixRtk::GpsFixRtk(void)
     {
       m_header.mgid = 293;
@@ -8686,67 +12522,66 @@ namespace DUNE
     uint8_t*
     GpsFixRtk::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(tow, ptr__);
-      ptr__ += IMC::serialize(base_lat, ptr__);
-      ptr__ += IMC::serialize(base_lon, ptr__);
-      ptr__ += IMC::serialize(base_height, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(e, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(v_n, ptr__);
-      ptr__ += IMC::serialize(v_e, ptr__);
-      ptr__ += IMC::serialize(v_d, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(iar_hyp, ptr__);
-      ptr__ += IMC::serialize(iar_ratio, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 2);
+      IMC::serialize(tow, bfr__ + 3);
+      IMC::serialize(base_lat, bfr__ + 7);
+      IMC::serialize(base_lon, bfr__ + 15);
+      IMC::serialize(base_height, bfr__ + 23);
+      IMC::serialize(n, bfr__ + 27);
+      IMC::serialize(e, bfr__ + 31);
+      IMC::serialize(d, bfr__ + 35);
+      IMC::serialize(v_n, bfr__ + 39);
+      IMC::serialize(v_e, bfr__ + 43);
+      IMC::serialize(v_d, bfr__ + 47);
+      IMC::serialize(satellites, bfr__ + 51);
+      IMC::serialize(iar_hyp, bfr__ + 52);
+      IMC::serialize(iar_ratio, bfr__ + 54);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GpsFixRtk::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(tow, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(base_height, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(e, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(v_n, bfr__, size__);
-      bfr__ += IMC::deserialize(v_e, bfr__, size__);
-      bfr__ += IMC::deserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(validity, bfr__ + 0);
+      Utils::ByteCopy::copy(type, bfr__ + 2);
+      Utils::ByteCopy::copy(tow, bfr__ + 3);
+      Utils::ByteCopy::copy(base_lat, bfr__ + 7);
+      Utils::ByteCopy::copy(base_lon, bfr__ + 15);
+      Utils::ByteCopy::copy(base_height, bfr__ + 23);
+      Utils::ByteCopy::copy(n, bfr__ + 27);
+      Utils::ByteCopy::copy(e, bfr__ + 31);
+      Utils::ByteCopy::copy(d, bfr__ + 35);
+      Utils::ByteCopy::copy(v_n, bfr__ + 39);
+      Utils::ByteCopy::copy(v_e, bfr__ + 43);
+      Utils::ByteCopy::copy(v_d, bfr__ + 47);
+      Utils::ByteCopy::copy(satellites, bfr__ + 51);
+      Utils::ByteCopy::copy(iar_hyp, bfr__ + 52);
+      Utils::ByteCopy::copy(iar_ratio, bfr__ + 54);
+      return c_fields_size;
     }
 
     uint16_t
     GpsFixRtk::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy2b(swap__ + 0, bfr__ + 0, 1);
+      std::memcpy(swap__ + 2, bfr__ + 2, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 3, bfr__ + 3, 1);
+      Utils::ByteCopy::rcopy8b(swap__ + 7, bfr__ + 7, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 23, bfr__ + 23, 7);
+      std::memcpy(swap__ + 51, bfr__ + 51, 1);
+      Utils::ByteCopy::rcopy2b(swap__ + 52, bfr__ + 52, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 54, bfr__ + 54, 1);
+      return GpsFixRtk::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -8769,58 +12604,174 @@ namespace DUNE
       IMC::toJSON(os__, "iar_ratio", iar_ratio, nindent__);
     }
 
-    EstimatedState::EstimatedState(void)
-    {
-      m_header.mgid = 350;
-      clear();
-    }
-
     void
-    EstimatedState::clear(void)
+    GpsFixRtk::fieldsToJSON(JSONWriter& w__) const
     {
-      lat = 0;
-      lon = 0;
-      height = 0;
-      x = 0;
-      y = 0;
-      z = 0;
-      phi = 0;
-      theta = 0;
-      psi = 0;
-      u = 0;
-      v = 0;
-      w = 0;
-      vx = 0;
-      vy = 0;
-      vz = 0;
-      p = 0;
-      q = 0;
-      r = 0;
-      depth = 0;
-      alt = 0;
+      w__.write("validity", validity);
+      w__.write("type", type);
+      w__.write("tow", tow);
+      w__.write("base_lat", base_lat);
+      w__.write("base_lon", base_lon);
+      w__.write("base_height", base_height);
+      w__.write("n", n);
+      w__.write("e", e);
+      w__.write("d", d);
+      w__.write("v_n", v_n);
+      w__.write("v_e", v_e);
+      w__.write("v_d", v_d);
+      w__.write("satellites", satellites);
+      w__.write("iar_hyp", iar_hyp);
+      w__.write("iar_ratio", iar_ratio);
     }
 
     bool
-    EstimatedState::fieldsEqual(const Message& msg__) const
+    GpsFixRtk::fieldFromJSON(const std::string& name__, JSONReader& r__)
     {
-      const IMC::EstimatedState& other__ = static_cast<const EstimatedState&>(msg__);
-      if (lat != other__.lat) return false;
-      if (lon != other__.lon) return false;
-      if (height != other__.height) return false;
-      if (x != other__.x) return false;
-      if (y != other__.y) return false;
-      if (z != other__.z) return false;
-      if (phi != other__.phi) return false;
-      if (theta != other__.theta) return false;
-      if (psi != other__.psi) return false;
-      if (u != other__.u) return false;
-      if (v != other__.v) return false;
-      if (w != other__.w) return false;
-      if (vx != other__.vx) return false;
-      if (vy != other__.vy) return false;
-      if (vz != other__.vz) return false;
-      if (p != other__.p) return false;
-      if (q != other__.q) return false;
+      if (name__ == "validity")
+      {
+        r__.read(validity);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "tow")
+      {
+        r__.read(tow);
+        return true;
+      }
+
+      if (name__ == "base_lat")
+      {
+        r__.read(base_lat);
+        return true;
+      }
+
+      if (name__ == "base_lon")
+      {
+        r__.read(base_lon);
+        return true;
+      }
+
+      if (name__ == "base_height")
+      {
+        r__.read(base_height);
+        return true;
+      }
+
+      if (name__ == "n")
+      {
+        r__.read(n);
+        return true;
+      }
+
+      if (name__ == "e")
+      {
+        r__.read(e);
+        return true;
+      }
+
+      if (name__ == "d")
+      {
+        r__.read(d);
+        return true;
+      }
+
+      if (name__ == "v_n")
+      {
+        r__.read(v_n);
+        return true;
+      }
+
+      if (name__ == "v_e")
+      {
+        r__.read(v_e);
+        return true;
+      }
+
+      if (name__ == "v_d")
+      {
+        r__.read(v_d);
+        return true;
+      }
+
+      if (name__ == "satellites")
+      {
+        r__.read(satellites);
+        return true;
+      }
+
+      if (name__ == "iar_hyp")
+      {
+        r__.read(iar_hyp);
+        return true;
+      }
+
+      if (name__ == "iar_ratio")
+      {
+        r__.read(iar_ratio);
+        return true;
+      }
+
+      return false;
+    }
+
+    EstimatedState::EstimatedState(void)
+    {
+      m_header.mgid = 350;
+      clear();
+    }
+
+    void
+    EstimatedState::clear(void)
+    {
+      lat = 0;
+      lon = 0;
+      height = 0;
+      x = 0;
+      y = 0;
+      z = 0;
+      phi = 0;
+      theta = 0;
+      psi = 0;
+      u = 0;
+      v = 0;
+      w = 0;
+      vx = 0;
+      vy = 0;
+      vz = 0;
+      p = 0;
+      q = 0;
+      r = 0;
+      depth = 0;
+      alt = 0;
+    }
+
+    bool
+    EstimatedState::fieldsEqual(const Message& msg__) const
+    {
+      const IMC::EstimatedState& other__ = static_cast<const EstimatedState&>(msg__);
+      if (lat != other__.lat) return false;
+      if (lon != other__.lon) return false;
+      if (height != other__.height) return false;
+      if (x != other__.x) return false;
+      if (y != other__.y) return false;
+      if (z != other__.z) return false;
+      if (phi != other__.phi) return false;
+      if (theta != other__.theta) return false;
+      if (psi != other__.psi) return false;
+      if (u != other__.u) return false;
+      if (v != other__.v) return false;
+      if (w != other__.w) return false;
+      if (vx != other__.vx) return false;
+      if (vy != other__.vy) return false;
+      if (vz != other__.vz) return false;
+      if (p != other__.p) return false;
+      if (q != other__.q) return false;
       if (r != other__.r) return false;
       if (depth != other__.depth) return false;
       if (alt != other__.alt) return false;
@@ -8844,82 +12795,70 @@ namespace DUNE
     uint8_t*
     EstimatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(height, bfr__ + 16);
+      IMC::serialize(x, bfr__ + 20);
+      IMC::serialize(y, bfr__ + 24);
+      IMC::serialize(z, bfr__ + 28);
+      IMC::serialize(phi, bfr__ + 32);
+      IMC::serialize(theta, bfr__ + 36);
+      IMC::serialize(psi, bfr__ + 40);
+      IMC::serialize(u, bfr__ + 44);
+      IMC::serialize(v, bfr__ + 48);
+      IMC::serialize(w, bfr__ + 52);
+      IMC::serialize(vx, bfr__ + 56);
+      IMC::serialize(vy, bfr__ + 60);
+      IMC::serialize(vz, bfr__ + 64);
+      IMC::serialize(p, bfr__ + 68);
+      IMC::serialize(q, bfr__ + 72);
+      IMC::serialize(r, bfr__ + 76);
+      IMC::serialize(depth, bfr__ + 80);
+      IMC::serialize(alt, bfr__ + 84);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     EstimatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 8);
+      Utils::ByteCopy::copy(height, bfr__ + 16);
+      Utils::ByteCopy::copy(x, bfr__ + 20);
+      Utils::ByteCopy::copy(y, bfr__ + 24);
+      Utils::ByteCopy::copy(z, bfr__ + 28);
+      Utils::ByteCopy::copy(phi, bfr__ + 32);
+      Utils::ByteCopy::copy(theta, bfr__ + 36);
+      Utils::ByteCopy::copy(psi, bfr__ + 40);
+      Utils::ByteCopy::copy(u, bfr__ + 44);
+      Utils::ByteCopy::copy(v, bfr__ + 48);
+      Utils::ByteCopy::copy(w, bfr__ + 52);
+      Utils::ByteCopy::copy(vx, bfr__ + 56);
+      Utils::ByteCopy::copy(vy, bfr__ + 60);
+      Utils::ByteCopy::copy(vz, bfr__ + 64);
+      Utils::ByteCopy::copy(p, bfr__ + 68);
+      Utils::ByteCopy::copy(q, bfr__ + 72);
+      Utils::ByteCopy::copy(r, bfr__ + 76);
+      Utils::ByteCopy::copy(depth, bfr__ + 80);
+      Utils::ByteCopy::copy(alt, bfr__ + 84);
+      return c_fields_size;
     }
 
     uint16_t
     EstimatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 16, bfr__ + 16, 18);
+      return EstimatedState::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -8947,6 +12886,157 @@ namespace DUNE
       IMC::toJSON(os__, "alt", alt, nindent__);
     }
 
+    void
+    EstimatedState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height", height);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("u", u);
+      w__.write("v", v);
+      w__.write("w", w);
+      w__.write("vx", vx);
+      w__.write("vy", vy);
+      w__.write("vz", vz);
+      w__.write("p", p);
+      w__.write("q", q);
+      w__.write("r", r);
+      w__.write("depth", depth);
+      w__.write("alt", alt);
+    }
+
+    bool
+    EstimatedState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height")
+      {
+        r__.read(height);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "u")
+      {
+        r__.read(u);
+        return true;
+      }
+
+      if (name__ == "v")
+      {
+        r__.read(v);
+        return true;
+      }
+
+      if (name__ == "w")
+      {
+        r__.read(w);
+        return true;
+      }
+
+      if (name__ == "vx")
+      {
+        r__.read(vx);
+        return true;
+      }
+
+      if (name__ == "vy")
+      {
+        r__.read(vy);
+        return true;
+      }
+
+      if (name__ == "vz")
+      {
+        r__.read(vz);
+        return true;
+      }
+
+      if (name__ == "p")
+      {
+        r__.read(p);
+        return true;
+      }
+
+      if (name__ == "q")
+      {
+        r__.read(q);
+        return true;
+      }
+
+      if (name__ == "r")
+      {
+        r__.read(r);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "alt")
+      {
+        r__.read(alt);
+        return true;
+      }
+
+      return false;
+    }
+
     ExternalNavData::ExternalNavData(void)
     {
       m_header.mgid = 294;
@@ -9010,6 +13100,31 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    ExternalNavData::fieldsToJSON(JSONWriter& w__) const
+    {
+      state.toJSON(w__, "state");
+      w__.write("type", type);
+    }
+
+    bool
+    ExternalNavData::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        state.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     ExternalNavData::setTimeStampNested(double value__)
     {
@@ -9084,25 +13199,30 @@ namespace DUNE
     uint8_t*
     DissolvedOxygen::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DissolvedOxygen::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DissolvedOxygen::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -9123,6 +13243,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DissolvedOxygen::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DissolvedOxygen::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     AirSaturation::AirSaturation(void)
     {
       m_header.mgid = 296;
@@ -9152,25 +13290,30 @@ namespace DUNE
     uint8_t*
     AirSaturation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     AirSaturation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     AirSaturation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -9191,6 +13334,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    AirSaturation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    AirSaturation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Throttle::Throttle(void)
     {
       m_header.mgid = 297;
@@ -9220,25 +13381,30 @@ namespace DUNE
     uint8_t*
     Throttle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Throttle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Throttle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -9259,6 +13425,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Throttle::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Throttle::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     PH::PH(void)
     {
       m_header.mgid = 298;
@@ -9288,25 +13472,30 @@ namespace DUNE
     uint8_t*
     PH::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PH::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     PH::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -9327,6 +13516,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    PH::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    PH::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Redox::Redox(void)
     {
       m_header.mgid = 299;
@@ -9356,25 +13563,30 @@ namespace DUNE
     uint8_t*
     Redox::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Redox::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Redox::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -9395,6 +13607,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Redox::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    Redox::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     CameraZoom::CameraZoom(void)
     {
       m_header.mgid = 300;
@@ -9428,31 +13658,36 @@ namespace DUNE
     uint8_t*
     CameraZoom::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(zoom, ptr__);
-      ptr__ += IMC::serialize(action, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(zoom, bfr__ + 1);
+      IMC::serialize(action, bfr__ + 2);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     CameraZoom::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(zoom, bfr__ + 1);
+      Utils::ByteCopy::copy(action, bfr__ + 2);
+      return c_fields_size;
     }
 
     uint16_t
     CameraZoom::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(zoom, bfr__ + 1);
+      Utils::ByteCopy::rcopy(action, bfr__ + 2);
+      return c_fields_size;
     }
 
     uint16_t
@@ -9475,6 +13710,38 @@ namespace DUNE
       IMC::toJSON(os__, "action", action, nindent__);
     }
 
+    void
+    CameraZoom::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("zoom", zoom);
+      w__.write("action", action);
+    }
+
+    bool
+    CameraZoom::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "zoom")
+      {
+        r__.read(zoom);
+        return true;
+      }
+
+      if (name__ == "action")
+      {
+        r__.read(action);
+        return true;
+      }
+
+      return false;
+    }
+
     SetThrusterActuation::SetThrusterActuation(void)
     {
       m_header.mgid = 301;
@@ -9507,28 +13774,33 @@ namespace DUNE
     uint8_t*
     SetThrusterActuation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SetThrusterActuation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
     SetThrusterActuation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
@@ -9562,6 +13834,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SetThrusterActuation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("value", value);
+    }
+
+    bool
+    SetThrusterActuation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     SetServoPosition::SetServoPosition(void)
     {
       m_header.mgid = 302;
@@ -9594,28 +13891,33 @@ namespace DUNE
     uint8_t*
     SetServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SetServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
     SetServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
@@ -9649,6 +13951,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SetServoPosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("value", value);
+    }
+
+    bool
+    SetServoPosition::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     SetControlSurfaceDeflection::SetControlSurfaceDeflection(void)
     {
       m_header.mgid = 303;
@@ -9680,28 +14007,33 @@ namespace DUNE
     uint8_t*
     SetControlSurfaceDeflection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(angle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(angle, bfr__ + 1);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SetControlSurfaceDeflection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(angle, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
     SetControlSurfaceDeflection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(angle, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
@@ -9723,6 +14055,31 @@ namespace DUNE
       IMC::toJSON(os__, "angle", angle, nindent__);
     }
 
+    void
+    SetControlSurfaceDeflection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("angle", angle);
+    }
+
+    bool
+    SetControlSurfaceDeflection::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "angle")
+      {
+        r__.read(angle);
+        return true;
+      }
+
+      return false;
+    }
+
     RemoteActionsRequest::RemoteActionsRequest(void)
     {
       m_header.mgid = 304;
@@ -9785,6 +14142,31 @@ namespace DUNE
       IMC::toJSON(os__, "actions", actions, nindent__);
     }
 
+    void
+    RemoteActionsRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("actions", actions);
+    }
+
+    bool
+    RemoteActionsRequest::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "actions")
+      {
+        r__.read(actions);
+        return true;
+      }
+
+      return false;
+    }
+
     RemoteActions::RemoteActions(void)
     {
       m_header.mgid = 305;
@@ -9841,6 +14223,24 @@ namespace DUNE
       IMC::toJSON(os__, "actions", actions, nindent__);
     }
 
+    void
+    RemoteActions::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("actions", actions);
+    }
+
+    bool
+    RemoteActions::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "actions")
+      {
+        r__.read(actions);
+        return true;
+      }
+
+      return false;
+    }
+
     ButtonEvent::ButtonEvent(void)
     {
       m_header.mgid = 306;
@@ -9872,28 +14272,33 @@ namespace DUNE
     uint8_t*
     ButtonEvent::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(button, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(button, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ButtonEvent::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(button, bfr__ + 0);
+      Utils::ByteCopy::copy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     uint16_t
     ButtonEvent::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(button, bfr__ + 0);
+      Utils::ByteCopy::rcopy(value, bfr__ + 1);
+      return c_fields_size;
     }
 
     fp64_t
@@ -9915,6 +14320,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    ButtonEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("button", button);
+      w__.write("value", value);
+    }
+
+    bool
+    ButtonEvent::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "button")
+      {
+        r__.read(button);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     LcdControl::LcdControl(void)
     {
       m_header.mgid = 307;
@@ -9977,6 +14407,31 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    LcdControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("text", text);
+    }
+
+    bool
+    LcdControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "text")
+      {
+        r__.read(text);
+        return true;
+      }
+
+      return false;
+    }
+
     PowerOperation::PowerOperation(void)
     {
       m_header.mgid = 308;
@@ -10010,31 +14465,36 @@ namespace DUNE
     uint8_t*
     PowerOperation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(time_remain, ptr__);
-      ptr__ += IMC::serialize(sched_time, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(time_remain, bfr__ + 1);
+      IMC::serialize(sched_time, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PowerOperation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::deserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      Utils::ByteCopy::copy(time_remain, bfr__ + 1);
+      Utils::ByteCopy::copy(sched_time, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     PowerOperation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      Utils::ByteCopy::rcopy(time_remain, bfr__ + 1);
+      Utils::ByteCopy::rcopy(sched_time, bfr__ + 5);
+      return c_fields_size;
     }
 
     void
@@ -10045,6 +14505,38 @@ namespace DUNE
       IMC::toJSON(os__, "sched_time", sched_time, nindent__);
     }
 
+    void
+    PowerOperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("time_remain", time_remain);
+      w__.write("sched_time", sched_time);
+    }
+
+    bool
+    PowerOperation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "time_remain")
+      {
+        r__.read(time_remain);
+        return true;
+      }
+
+      if (name__ == "sched_time")
+      {
+        r__.read(sched_time);
+        return true;
+      }
+
+      return false;
+    }
+
     PowerChannelControl::PowerChannelControl(void)
     {
       m_header.mgid = 309;
@@ -10114,6 +14606,38 @@ namespace DUNE
       IMC::toJSON(os__, "sched_time", sched_time, nindent__);
     }
 
+    void
+    PowerChannelControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("op", op);
+      w__.write("sched_time", sched_time);
+    }
+
+    bool
+    PowerChannelControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "sched_time")
+      {
+        r__.read(sched_time);
+        return true;
+      }
+
+      return false;
+    }
+
     QueryPowerChannelState::QueryPowerChannelState(void)
     {
       m_header.mgid = 310;
@@ -10215,6 +14739,31 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    PowerChannelState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("state", state);
+    }
+
+    bool
+    PowerChannelState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      return false;
+    }
+
     LedBrightness::LedBrightness(void)
     {
       m_header.mgid = 312;
@@ -10289,6 +14838,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    LedBrightness::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("value", value);
+    }
+
+    bool
+    LedBrightness::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     QueryLedBrightness::QueryLedBrightness(void)
     {
       m_header.mgid = 313;
@@ -10345,6 +14919,24 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    QueryLedBrightness::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+    }
+
+    bool
+    QueryLedBrightness::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      return false;
+    }
+
     SetLedBrightness::SetLedBrightness(void)
     {
       m_header.mgid = 314;
@@ -10419,6 +15011,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SetLedBrightness::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("value", value);
+    }
+
+    bool
+    SetLedBrightness::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     SetPWM::SetPWM(void)
     {
       m_header.mgid = 315;
@@ -10452,31 +15069,36 @@ namespace DUNE
     uint8_t*
     SetPWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(period, bfr__ + 1);
+      IMC::serialize(duty_cycle, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SetPWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(period, bfr__ + 1);
+      Utils::ByteCopy::copy(duty_cycle, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     SetPWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(period, bfr__ + 1);
+      Utils::ByteCopy::rcopy(duty_cycle, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
@@ -10499,6 +15121,38 @@ namespace DUNE
       IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
     }
 
+    void
+    SetPWM::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("period", period);
+      w__.write("duty_cycle", duty_cycle);
+    }
+
+    bool
+    SetPWM::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "period")
+      {
+        r__.read(period);
+        return true;
+      }
+
+      if (name__ == "duty_cycle")
+      {
+        r__.read(duty_cycle);
+        return true;
+      }
+
+      return false;
+    }
+
     PWM::PWM(void)
     {
       m_header.mgid = 316;
@@ -10532,31 +15186,36 @@ namespace DUNE
     uint8_t*
     PWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(period, bfr__ + 1);
+      IMC::serialize(duty_cycle, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(period, bfr__ + 1);
+      Utils::ByteCopy::copy(duty_cycle, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     PWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(period, bfr__ + 1);
+      Utils::ByteCopy::rcopy(duty_cycle, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
@@ -10579,6 +15238,38 @@ namespace DUNE
       IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
     }
 
+    void
+    PWM::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("period", period);
+      w__.write("duty_cycle", duty_cycle);
+    }
+
+    bool
+    PWM::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "period")
+      {
+        r__.read(period);
+        return true;
+      }
+
+      if (name__ == "duty_cycle")
+      {
+        r__.read(duty_cycle);
+        return true;
+      }
+
+      return false;
+    }
+
     EstimatedStreamVelocity::EstimatedStreamVelocity(void)
     {
       m_header.mgid = 351;
@@ -10612,31 +15303,36 @@ namespace DUNE
     uint8_t*
     EstimatedStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     EstimatedStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 8);
+      Utils::ByteCopy::copy(z, bfr__ + 16);
+      return c_fields_size;
     }
 
     uint16_t
     EstimatedStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(x, bfr__ + 0);
+      Utils::ByteCopy::rcopy(y, bfr__ + 8);
+      Utils::ByteCopy::rcopy(z, bfr__ + 16);
+      return c_fields_size;
     }
 
     void
@@ -10647,6 +15343,38 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    EstimatedStreamVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    EstimatedStreamVelocity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     IndicatedSpeed::IndicatedSpeed(void)
     {
       m_header.mgid = 352;
@@ -10676,25 +15404,30 @@ namespace DUNE
     uint8_t*
     IndicatedSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     IndicatedSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     IndicatedSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -10709,10 +15442,28 @@ namespace DUNE
       value = static_cast<fp64_t>(val);
     }
 
-    void
-    IndicatedSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    void
+    IndicatedSpeed::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    {
+      IMC::toJSON(os__, "value", value, nindent__);
+    }
+
+    void
+    IndicatedSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    IndicatedSpeed::fieldFromJSON(const std::string& name__, JSONReader& r__)
     {
-      IMC::toJSON(os__, "value", value, nindent__);
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
     }
 
     TrueSpeed::TrueSpeed(void)
@@ -10744,25 +15495,30 @@ namespace DUNE
     uint8_t*
     TrueSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     TrueSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     TrueSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -10783,6 +15539,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    TrueSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    TrueSpeed::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     NavigationUncertainty::NavigationUncertainty(void)
     {
       m_header.mgid = 354;
@@ -10838,64 +15612,57 @@ namespace DUNE
     uint8_t*
     NavigationUncertainty::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(phi, bfr__ + 12);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 20);
+      IMC::serialize(p, bfr__ + 24);
+      IMC::serialize(q, bfr__ + 28);
+      IMC::serialize(r, bfr__ + 32);
+      IMC::serialize(u, bfr__ + 36);
+      IMC::serialize(v, bfr__ + 40);
+      IMC::serialize(w, bfr__ + 44);
+      IMC::serialize(bias_psi, bfr__ + 48);
+      IMC::serialize(bias_r, bfr__ + 52);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     NavigationUncertainty::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 4);
+      Utils::ByteCopy::copy(z, bfr__ + 8);
+      Utils::ByteCopy::copy(phi, bfr__ + 12);
+      Utils::ByteCopy::copy(theta, bfr__ + 16);
+      Utils::ByteCopy::copy(psi, bfr__ + 20);
+      Utils::ByteCopy::copy(p, bfr__ + 24);
+      Utils::ByteCopy::copy(q, bfr__ + 28);
+      Utils::ByteCopy::copy(r, bfr__ + 32);
+      Utils::ByteCopy::copy(u, bfr__ + 36);
+      Utils::ByteCopy::copy(v, bfr__ + 40);
+      Utils::ByteCopy::copy(w, bfr__ + 44);
+      Utils::ByteCopy::copy(bias_psi, bfr__ + 48);
+      Utils::ByteCopy::copy(bias_r, bfr__ + 52);
+      return c_fields_size;
     }
 
     uint16_t
     NavigationUncertainty::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 14);
+      return NavigationUncertainty::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -10917,6 +15684,115 @@ namespace DUNE
       IMC::toJSON(os__, "bias_r", bias_r, nindent__);
     }
 
+    void
+    NavigationUncertainty::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("p", p);
+      w__.write("q", q);
+      w__.write("r", r);
+      w__.write("u", u);
+      w__.write("v", v);
+      w__.write("w", w);
+      w__.write("bias_psi", bias_psi);
+      w__.write("bias_r", bias_r);
+    }
+
+    bool
+    NavigationUncertainty::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "p")
+      {
+        r__.read(p);
+        return true;
+      }
+
+      if (name__ == "q")
+      {
+        r__.read(q);
+        return true;
+      }
+
+      if (name__ == "r")
+      {
+        r__.read(r);
+        return true;
+      }
+
+      if (name__ == "u")
+      {
+        r__.read(u);
+        return true;
+      }
+
+      if (name__ == "v")
+      {
+        r__.read(v);
+        return true;
+      }
+
+      if (name__ == "w")
+      {
+        r__.read(w);
+        return true;
+      }
+
+      if (name__ == "bias_psi")
+      {
+        r__.read(bias_psi);
+        return true;
+      }
+
+      if (name__ == "bias_r")
+      {
+        r__.read(bias_r);
+        return true;
+      }
+
+      return false;
+    }
+
     NavigationData::NavigationData(void)
     {
       m_header.mgid = 355;
@@ -10962,49 +15838,47 @@ namespace DUNE
     uint8_t*
     NavigationData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(cyaw, ptr__);
-      ptr__ += IMC::serialize(lbl_rej_level, ptr__);
-      ptr__ += IMC::serialize(gps_rej_level, ptr__);
-      ptr__ += IMC::serialize(custom_x, ptr__);
-      ptr__ += IMC::serialize(custom_y, ptr__);
-      ptr__ += IMC::serialize(custom_z, ptr__);
-      return ptr__;
+      IMC::serialize(bias_psi, bfr__ + 0);
+      IMC::serialize(bias_r, bfr__ + 4);
+      IMC::serialize(cog, bfr__ + 8);
+      IMC::serialize(cyaw, bfr__ + 12);
+      IMC::serialize(lbl_rej_level, bfr__ + 16);
+      IMC::serialize(gps_rej_level, bfr__ + 20);
+      IMC::serialize(custom_x, bfr__ + 24);
+      IMC::serialize(custom_y, bfr__ + 28);
+      IMC::serialize(custom_z, bfr__ + 32);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     NavigationData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::deserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(bias_psi, bfr__ + 0);
+      Utils::ByteCopy::copy(bias_r, bfr__ + 4);
+      Utils::ByteCopy::copy(cog, bfr__ + 8);
+      Utils::ByteCopy::copy(cyaw, bfr__ + 12);
+      Utils::ByteCopy::copy(lbl_rej_level, bfr__ + 16);
+      Utils::ByteCopy::copy(gps_rej_level, bfr__ + 20);
+      Utils::ByteCopy::copy(custom_x, bfr__ + 24);
+      Utils::ByteCopy::copy(custom_y, bfr__ + 28);
+      Utils::ByteCopy::copy(custom_z, bfr__ + 32);
+      return c_fields_size;
     }
 
     uint16_t
     NavigationData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 9);
+      return NavigationData::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -11021,6 +15895,80 @@ namespace DUNE
       IMC::toJSON(os__, "custom_z", custom_z, nindent__);
     }
 
+    void
+    NavigationData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("bias_psi", bias_psi);
+      w__.write("bias_r", bias_r);
+      w__.write("cog", cog);
+      w__.write("cyaw", cyaw);
+      w__.write("lbl_rej_level", lbl_rej_level);
+      w__.write("gps_rej_level", gps_rej_level);
+      w__.write("custom_x", custom_x);
+      w__.write("custom_y", custom_y);
+      w__.write("custom_z", custom_z);
+    }
+
+    bool
+    NavigationData::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "bias_psi")
+      {
+        r__.read(bias_psi);
+        return true;
+      }
+
+      if (name__ == "bias_r")
+      {
+        r__.read(bias_r);
+        return true;
+      }
+
+      if (name__ == "cog")
+      {
+        r__.read(cog);
+        return true;
+      }
+
+      if (name__ == "cyaw")
+      {
+        r__.read(cyaw);
+        return true;
+      }
+
+      if (name__ == "lbl_rej_level")
+      {
+        r__.read(lbl_rej_level);
+        return true;
+      }
+
+      if (name__ == "gps_rej_level")
+      {
+        r__.read(gps_rej_level);
+        return true;
+      }
+
+      if (name__ == "custom_x")
+      {
+        r__.read(custom_x);
+        return true;
+      }
+
+      if (name__ == "custom_y")
+      {
+        r__.read(custom_y);
+        return true;
+      }
+
+      if (name__ == "custom_z")
+      {
+        r__.read(custom_z);
+        return true;
+      }
+
+      return false;
+    }
+
     GpsFixRejection::GpsFixRejection(void)
     {
       m_header.mgid = 356;
@@ -11052,28 +16000,33 @@ namespace DUNE
     uint8_t*
     GpsFixRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      return ptr__;
+      IMC::serialize(utc_time, bfr__ + 0);
+      IMC::serialize(reason, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GpsFixRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(utc_time, bfr__ + 0);
+      Utils::ByteCopy::copy(reason, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     GpsFixRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(utc_time, bfr__ + 0);
+      Utils::ByteCopy::rcopy(reason, bfr__ + 4);
+      return c_fields_size;
     }
 
     void
@@ -11083,6 +16036,31 @@ namespace DUNE
       IMC::toJSON(os__, "reason", reason, nindent__);
     }
 
+    void
+    GpsFixRejection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("utc_time", utc_time);
+      w__.write("reason", reason);
+    }
+
+    bool
+    GpsFixRejection::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "utc_time")
+      {
+        r__.read(utc_time);
+        return true;
+      }
+
+      if (name__ == "reason")
+      {
+        r__.read(reason);
+        return true;
+      }
+
+      return false;
+    }
+
     LblRangeAcceptance::LblRangeAcceptance(void)
     {
       m_header.mgid = 357;
@@ -11116,31 +16094,36 @@ namespace DUNE
     uint8_t*
     LblRangeAcceptance::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      ptr__ += IMC::serialize(acceptance, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(range, bfr__ + 1);
+      IMC::serialize(acceptance, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     LblRangeAcceptance::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(id, bfr__ + 0);
+      Utils::ByteCopy::copy(range, bfr__ + 1);
+      Utils::ByteCopy::copy(acceptance, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     LblRangeAcceptance::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(id, bfr__ + 0);
+      Utils::ByteCopy::rcopy(range, bfr__ + 1);
+      Utils::ByteCopy::rcopy(acceptance, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
@@ -11163,6 +16146,38 @@ namespace DUNE
       IMC::toJSON(os__, "acceptance", acceptance, nindent__);
     }
 
+    void
+    LblRangeAcceptance::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("range", range);
+      w__.write("acceptance", acceptance);
+    }
+
+    bool
+    LblRangeAcceptance::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      if (name__ == "acceptance")
+      {
+        r__.read(acceptance);
+        return true;
+      }
+
+      return false;
+    }
+
     DvlRejection::DvlRejection(void)
     {
       m_header.mgid = 358;
@@ -11198,34 +16213,39 @@ namespace DUNE
     uint8_t*
     DvlRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      IMC::serialize(reason, bfr__ + 1);
+      IMC::serialize(value, bfr__ + 2);
+      IMC::serialize(timestep, bfr__ + 6);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DvlRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(type, bfr__ + 0);
+      Utils::ByteCopy::copy(reason, bfr__ + 1);
+      Utils::ByteCopy::copy(value, bfr__ + 2);
+      Utils::ByteCopy::copy(timestep, bfr__ + 6);
+      return c_fields_size;
     }
 
     uint16_t
     DvlRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(type, bfr__ + 0);
+      Utils::ByteCopy::rcopy(reason, bfr__ + 1);
+      Utils::ByteCopy::rcopy(value, bfr__ + 2);
+      Utils::ByteCopy::rcopy(timestep, bfr__ + 6);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11249,6 +16269,45 @@ namespace DUNE
       IMC::toJSON(os__, "timestep", timestep, nindent__);
     }
 
+    void
+    DvlRejection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("reason", reason);
+      w__.write("value", value);
+      w__.write("timestep", timestep);
+    }
+
+    bool
+    DvlRejection::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "reason")
+      {
+        r__.read(reason);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "timestep")
+      {
+        r__.read(timestep);
+        return true;
+      }
+
+      return false;
+    }
+
     LblEstimate::LblEstimate(void)
     {
       m_header.mgid = 360;
@@ -11336,6 +16395,59 @@ namespace DUNE
       IMC::toJSON(os__, "distance", distance, nindent__);
     }
 
+    void
+    LblEstimate::fieldsToJSON(JSONWriter& w__) const
+    {
+      beacon.toJSON(w__, "beacon");
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("var_x", var_x);
+      w__.write("var_y", var_y);
+      w__.write("distance", distance);
+    }
+
+    bool
+    LblEstimate::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "beacon")
+      {
+        beacon.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "var_x")
+      {
+        r__.read(var_x);
+        return true;
+      }
+
+      if (name__ == "var_y")
+      {
+        r__.read(var_y);
+        return true;
+      }
+
+      if (name__ == "distance")
+      {
+        r__.read(distance);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     LblEstimate::setTimeStampNested(double value__)
     {
@@ -11410,25 +16522,30 @@ namespace DUNE
     uint8_t*
     AlignmentState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     AlignmentState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(state, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     AlignmentState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(state, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -11437,6 +16554,24 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    AlignmentState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+    }
+
+    bool
+    AlignmentState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      return false;
+    }
+
     GroupStreamVelocity::GroupStreamVelocity(void)
     {
       m_header.mgid = 362;
@@ -11470,31 +16605,36 @@ namespace DUNE
     uint8_t*
     GroupStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GroupStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 8);
+      Utils::ByteCopy::copy(z, bfr__ + 16);
+      return c_fields_size;
     }
 
     uint16_t
     GroupStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(x, bfr__ + 0);
+      Utils::ByteCopy::rcopy(y, bfr__ + 8);
+      Utils::ByteCopy::rcopy(z, bfr__ + 16);
+      return c_fields_size;
     }
 
     void
@@ -11505,6 +16645,38 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    GroupStreamVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    GroupStreamVelocity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     Airflow::Airflow(void)
     {
       m_header.mgid = 363;
@@ -11538,31 +16710,36 @@ namespace DUNE
     uint8_t*
     Airflow::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(va, ptr__);
-      ptr__ += IMC::serialize(aoa, ptr__);
-      ptr__ += IMC::serialize(ssa, ptr__);
-      return ptr__;
+      IMC::serialize(va, bfr__ + 0);
+      IMC::serialize(aoa, bfr__ + 4);
+      IMC::serialize(ssa, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Airflow::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(va, bfr__, size__);
-      bfr__ += IMC::deserialize(aoa, bfr__, size__);
-      bfr__ += IMC::deserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(va, bfr__ + 0);
+      Utils::ByteCopy::copy(aoa, bfr__ + 4);
+      Utils::ByteCopy::copy(ssa, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     Airflow::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(va, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(aoa, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(va, bfr__ + 0);
+      Utils::ByteCopy::rcopy(aoa, bfr__ + 4);
+      Utils::ByteCopy::rcopy(ssa, bfr__ + 8);
+      return c_fields_size;
     }
 
     void
@@ -11573,6 +16750,38 @@ namespace DUNE
       IMC::toJSON(os__, "ssa", ssa, nindent__);
     }
 
+    void
+    Airflow::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("va", va);
+      w__.write("aoa", aoa);
+      w__.write("ssa", ssa);
+    }
+
+    bool
+    Airflow::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "va")
+      {
+        r__.read(va);
+        return true;
+      }
+
+      if (name__ == "aoa")
+      {
+        r__.read(aoa);
+        return true;
+      }
+
+      if (name__ == "ssa")
+      {
+        r__.read(ssa);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredHeading::DesiredHeading(void)
     {
       m_header.mgid = 400;
@@ -11602,25 +16811,30 @@ namespace DUNE
     uint8_t*
     DesiredHeading::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredHeading::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredHeading::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11641,6 +16855,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredHeading::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DesiredHeading::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredZ::DesiredZ(void)
     {
       m_header.mgid = 401;
@@ -11672,28 +16904,33 @@ namespace DUNE
     uint8_t*
     DesiredZ::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(z_units, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredZ::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      Utils::ByteCopy::copy(z_units, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredZ::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      Utils::ByteCopy::rcopy(z_units, bfr__ + 4);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11715,6 +16952,31 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    void
+    DesiredZ::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("z_units", z_units);
+    }
+
+    bool
+    DesiredZ::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredSpeed::DesiredSpeed(void)
     {
       m_header.mgid = 402;
@@ -11746,28 +17008,33 @@ namespace DUNE
     uint8_t*
     DesiredSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(speed_units, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      Utils::ByteCopy::copy(speed_units, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      Utils::ByteCopy::rcopy(speed_units, bfr__ + 8);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11789,6 +17056,31 @@ namespace DUNE
       IMC::toJSON(os__, "speed_units", speed_units, nindent__);
     }
 
+    void
+    DesiredSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("speed_units", speed_units);
+    }
+
+    bool
+    DesiredSpeed::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredRoll::DesiredRoll(void)
     {
       m_header.mgid = 403;
@@ -11818,25 +17110,30 @@ namespace DUNE
     uint8_t*
     DesiredRoll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredRoll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredRoll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11857,6 +17154,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredRoll::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DesiredRoll::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredPitch::DesiredPitch(void)
     {
       m_header.mgid = 404;
@@ -11886,25 +17201,30 @@ namespace DUNE
     uint8_t*
     DesiredPitch::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredPitch::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredPitch::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11925,6 +17245,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredPitch::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DesiredPitch::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredVerticalRate::DesiredVerticalRate(void)
     {
       m_header.mgid = 405;
@@ -11954,25 +17292,30 @@ namespace DUNE
     uint8_t*
     DesiredVerticalRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
-    DesiredVerticalRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+    DesiredVerticalRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredVerticalRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -11993,6 +17336,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredVerticalRate::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DesiredVerticalRate::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredPath::DesiredPath(void)
     {
       m_header.mgid = 406;
@@ -12050,61 +17411,66 @@ namespace DUNE
     uint8_t*
     DesiredPath::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(path_ref, bfr__ + 0);
+      IMC::serialize(start_lat, bfr__ + 4);
+      IMC::serialize(start_lon, bfr__ + 12);
+      IMC::serialize(start_z, bfr__ + 20);
+      IMC::serialize(start_z_units, bfr__ + 24);
+      IMC::serialize(end_lat, bfr__ + 25);
+      IMC::serialize(end_lon, bfr__ + 33);
+      IMC::serialize(end_z, bfr__ + 41);
+      IMC::serialize(end_z_units, bfr__ + 45);
+      IMC::serialize(speed, bfr__ + 46);
+      IMC::serialize(speed_units, bfr__ + 50);
+      IMC::serialize(lradius, bfr__ + 51);
+      IMC::serialize(flags, bfr__ + 55);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredPath::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(path_ref, bfr__ + 0);
+      Utils::ByteCopy::copy(start_lat, bfr__ + 4);
+      Utils::ByteCopy::copy(start_lon, bfr__ + 12);
+      Utils::ByteCopy::copy(start_z, bfr__ + 20);
+      Utils::ByteCopy::copy(start_z_units, bfr__ + 24);
+      Utils::ByteCopy::copy(end_lat, bfr__ + 25);
+      Utils::ByteCopy::copy(end_lon, bfr__ + 33);
+      Utils::ByteCopy::copy(end_z, bfr__ + 41);
+      Utils::ByteCopy::copy(end_z_units, bfr__ + 45);
+      Utils::ByteCopy::copy(speed, bfr__ + 46);
+      Utils::ByteCopy::copy(speed_units, bfr__ + 50);
+      Utils::ByteCopy::copy(lradius, bfr__ + 51);
+      Utils::ByteCopy::copy(flags, bfr__ + 55);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredPath::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(path_ref, bfr__ + 0);
+      Utils::ByteCopy::rcopy(start_lat, bfr__ + 4);
+      Utils::ByteCopy::rcopy(start_lon, bfr__ + 12);
+      Utils::ByteCopy::rcopy(start_z, bfr__ + 20);
+      Utils::ByteCopy::rcopy(start_z_units, bfr__ + 24);
+      Utils::ByteCopy::rcopy(end_lat, bfr__ + 25);
+      Utils::ByteCopy::rcopy(end_lon, bfr__ + 33);
+      Utils::ByteCopy::rcopy(end_z, bfr__ + 41);
+      Utils::ByteCopy::rcopy(end_z_units, bfr__ + 45);
+      Utils::ByteCopy::rcopy(speed, bfr__ + 46);
+      Utils::ByteCopy::rcopy(speed_units, bfr__ + 50);
+      Utils::ByteCopy::rcopy(lradius, bfr__ + 51);
+      Utils::ByteCopy::rcopy(flags, bfr__ + 55);
+      return c_fields_size;
     }
 
     void
@@ -12125,6 +17491,108 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredPath::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("path_ref", path_ref);
+      w__.write("start_lat", start_lat);
+      w__.write("start_lon", start_lon);
+      w__.write("start_z", start_z);
+      w__.write("start_z_units", start_z_units);
+      w__.write("end_lat", end_lat);
+      w__.write("end_lon", end_lon);
+      w__.write("end_z", end_z);
+      w__.write("end_z_units", end_z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("lradius", lradius);
+      w__.write("flags", flags);
+    }
+
+    bool
+    DesiredPath::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "path_ref")
+      {
+        r__.read(path_ref);
+        return true;
+      }
+
+      if (name__ == "start_lat")
+      {
+        r__.read(start_lat);
+        return true;
+      }
+
+      if (name__ == "start_lon")
+      {
+        r__.read(start_lon);
+        return true;
+      }
+
+      if (name__ == "start_z")
+      {
+        r__.read(start_z);
+        return true;
+      }
+
+      if (name__ == "start_z_units")
+      {
+        r__.read(start_z_units);
+        return true;
+      }
+
+      if (name__ == "end_lat")
+      {
+        r__.read(end_lat);
+        return true;
+      }
+
+      if (name__ == "end_lon")
+      {
+        r__.read(end_lon);
+        return true;
+      }
+
+      if (name__ == "end_z")
+      {
+        r__.read(end_z);
+        return true;
+      }
+
+      if (name__ == "end_z_units")
+      {
+        r__.read(end_z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "lradius")
+      {
+        r__.read(lradius);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredControl::DesiredControl(void)
     {
       m_header.mgid = 407;
@@ -12166,43 +17634,44 @@ namespace DUNE
     uint8_t*
     DesiredControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      IMC::serialize(k, bfr__ + 24);
+      IMC::serialize(m, bfr__ + 32);
+      IMC::serialize(n, bfr__ + 40);
+      IMC::serialize(flags, bfr__ + 48);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 8);
+      Utils::ByteCopy::copy(z, bfr__ + 16);
+      Utils::ByteCopy::copy(k, bfr__ + 24);
+      Utils::ByteCopy::copy(m, bfr__ + 32);
+      Utils::ByteCopy::copy(n, bfr__ + 40);
+      Utils::ByteCopy::copy(flags, bfr__ + 48);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 6);
+      std::memcpy(swap__ + 48, bfr__ + 48, 1);
+      return DesiredControl::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -12217,6 +17686,66 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("k", k);
+      w__.write("m", m);
+      w__.write("n", n);
+      w__.write("flags", flags);
+    }
+
+    bool
+    DesiredControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "k")
+      {
+        r__.read(k);
+        return true;
+      }
+
+      if (name__ == "m")
+      {
+        r__.read(m);
+        return true;
+      }
+
+      if (name__ == "n")
+      {
+        r__.read(n);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredHeadingRate::DesiredHeadingRate(void)
     {
       m_header.mgid = 408;
@@ -12246,25 +17775,30 @@ namespace DUNE
     uint8_t*
     DesiredHeadingRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredHeadingRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredHeadingRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -12285,6 +17819,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredHeadingRate::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DesiredHeadingRate::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredVelocity::DesiredVelocity(void)
     {
       m_header.mgid = 409;
@@ -12326,43 +17878,44 @@ namespace DUNE
     uint8_t*
     DesiredVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(u, bfr__ + 0);
+      IMC::serialize(v, bfr__ + 8);
+      IMC::serialize(w, bfr__ + 16);
+      IMC::serialize(p, bfr__ + 24);
+      IMC::serialize(q, bfr__ + 32);
+      IMC::serialize(r, bfr__ + 40);
+      IMC::serialize(flags, bfr__ + 48);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(u, bfr__ + 0);
+      Utils::ByteCopy::copy(v, bfr__ + 8);
+      Utils::ByteCopy::copy(w, bfr__ + 16);
+      Utils::ByteCopy::copy(p, bfr__ + 24);
+      Utils::ByteCopy::copy(q, bfr__ + 32);
+      Utils::ByteCopy::copy(r, bfr__ + 40);
+      Utils::ByteCopy::copy(flags, bfr__ + 48);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 6);
+      std::memcpy(swap__ + 48, bfr__ + 48, 1);
+      return DesiredVelocity::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -12377,6 +17930,66 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("u", u);
+      w__.write("v", v);
+      w__.write("w", w);
+      w__.write("p", p);
+      w__.write("q", q);
+      w__.write("r", r);
+      w__.write("flags", flags);
+    }
+
+    bool
+    DesiredVelocity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "u")
+      {
+        r__.read(u);
+        return true;
+      }
+
+      if (name__ == "v")
+      {
+        r__.read(v);
+        return true;
+      }
+
+      if (name__ == "w")
+      {
+        r__.read(w);
+        return true;
+      }
+
+      if (name__ == "p")
+      {
+        r__.read(p);
+        return true;
+      }
+
+      if (name__ == "q")
+      {
+        r__.read(q);
+        return true;
+      }
+
+      if (name__ == "r")
+      {
+        r__.read(r);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      return false;
+    }
+
     PathControlState::PathControlState(void)
     {
       m_header.mgid = 410;
@@ -12446,79 +18059,77 @@ namespace DUNE
     uint8_t*
     PathControlState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(course_error, ptr__);
-      ptr__ += IMC::serialize(eta, ptr__);
-      return ptr__;
+      IMC::serialize(path_ref, bfr__ + 0);
+      IMC::serialize(start_lat, bfr__ + 4);
+      IMC::serialize(start_lon, bfr__ + 12);
+      IMC::serialize(start_z, bfr__ + 20);
+      IMC::serialize(start_z_units, bfr__ + 24);
+      IMC::serialize(end_lat, bfr__ + 25);
+      IMC::serialize(end_lon, bfr__ + 33);
+      IMC::serialize(end_z, bfr__ + 41);
+      IMC::serialize(end_z_units, bfr__ + 45);
+      IMC::serialize(lradius, bfr__ + 46);
+      IMC::serialize(flags, bfr__ + 50);
+      IMC::serialize(x, bfr__ + 51);
+      IMC::serialize(y, bfr__ + 55);
+      IMC::serialize(z, bfr__ + 59);
+      IMC::serialize(vx, bfr__ + 63);
+      IMC::serialize(vy, bfr__ + 67);
+      IMC::serialize(vz, bfr__ + 71);
+      IMC::serialize(course_error, bfr__ + 75);
+      IMC::serialize(eta, bfr__ + 79);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PathControlState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(course_error, bfr__, size__);
-      bfr__ += IMC::deserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+    {
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(path_ref, bfr__ + 0);
+      Utils::ByteCopy::copy(start_lat, bfr__ + 4);
+      Utils::ByteCopy::copy(start_lon, bfr__ + 12);
+      Utils::ByteCopy::copy(start_z, bfr__ + 20);
+      Utils::ByteCopy::copy(start_z_units, bfr__ + 24);
+      Utils::ByteCopy::copy(end_lat, bfr__ + 25);
+      Utils::ByteCopy::copy(end_lon, bfr__ + 33);
+      Utils::ByteCopy::copy(end_z, bfr__ + 41);
+      Utils::ByteCopy::copy(end_z_units, bfr__ + 45);
+      Utils::ByteCopy::copy(lradius, bfr__ + 46);
+      Utils::ByteCopy::copy(flags, bfr__ + 50);
+      Utils::ByteCopy::copy(x, bfr__ + 51);
+      Utils::ByteCopy::copy(y, bfr__ + 55);
+      Utils::ByteCopy::copy(z, bfr__ + 59);
+      Utils::ByteCopy::copy(vx, bfr__ + 63);
+      Utils::ByteCopy::copy(vy, bfr__ + 67);
+      Utils::ByteCopy::copy(vz, bfr__ + 71);
+      Utils::ByteCopy::copy(course_error, bfr__ + 75);
+      Utils::ByteCopy::copy(eta, bfr__ + 79);
+      return c_fields_size;
     }
 
     uint16_t
     PathControlState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(course_error, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy8b(swap__ + 4, bfr__ + 4, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 20, bfr__ + 20, 1);
+      std::memcpy(swap__ + 24, bfr__ + 24, 1);
+      Utils::ByteCopy::rcopy8b(swap__ + 25, bfr__ + 25, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 41, bfr__ + 41, 1);
+      std::memcpy(swap__ + 45, bfr__ + 45, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 46, bfr__ + 46, 1);
+      std::memcpy(swap__ + 50, bfr__ + 50, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 51, bfr__ + 51, 7);
+      Utils::ByteCopy::rcopy2b(swap__ + 79, bfr__ + 79, 1);
+      return PathControlState::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -12545,6 +18156,150 @@ namespace DUNE
       IMC::toJSON(os__, "eta", eta, nindent__);
     }
 
+    void
+    PathControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("path_ref", path_ref);
+      w__.write("start_lat", start_lat);
+      w__.write("start_lon", start_lon);
+      w__.write("start_z", start_z);
+      w__.write("start_z_units", start_z_units);
+      w__.write("end_lat", end_lat);
+      w__.write("end_lon", end_lon);
+      w__.write("end_z", end_z);
+      w__.write("end_z_units", end_z_units);
+      w__.write("lradius", lradius);
+      w__.write("flags", flags);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("vx", vx);
+      w__.write("vy", vy);
+      w__.write("vz", vz);
+      w__.write("course_error", course_error);
+      w__.write("eta", eta);
+    }
+
+    bool
+    PathControlState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "path_ref")
+      {
+        r__.read(path_ref);
+        return true;
+      }
+
+      if (name__ == "start_lat")
+      {
+        r__.read(start_lat);
+        return true;
+      }
+
+      if (name__ == "start_lon")
+      {
+        r__.read(start_lon);
+        return true;
+      }
+
+      if (name__ == "start_z")
+      {
+        r__.read(start_z);
+        return true;
+      }
+
+      if (name__ == "start_z_units")
+      {
+        r__.read(start_z_units);
+        return true;
+      }
+
+      if (name__ == "end_lat")
+      {
+        r__.read(end_lat);
+        return true;
+      }
+
+      if (name__ == "end_lon")
+      {
+        r__.read(end_lon);
+        return true;
+      }
+
+      if (name__ == "end_z")
+      {
+        r__.read(end_z);
+        return true;
+      }
+
+      if (name__ == "end_z_units")
+      {
+        r__.read(end_z_units);
+        return true;
+      }
+
+      if (name__ == "lradius")
+      {
+        r__.read(lradius);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "vx")
+      {
+        r__.read(vx);
+        return true;
+      }
+
+      if (name__ == "vy")
+      {
+        r__.read(vy);
+        return true;
+      }
+
+      if (name__ == "vz")
+      {
+        r__.read(vz);
+        return true;
+      }
+
+      if (name__ == "course_error")
+      {
+        r__.read(course_error);
+        return true;
+      }
+
+      if (name__ == "eta")
+      {
+        r__.read(eta);
+        return true;
+      }
+
+      return false;
+    }
+
     AllocatedControlTorques::AllocatedControlTorques(void)
     {
       m_header.mgid = 411;
@@ -12578,31 +18333,36 @@ namespace DUNE
     uint8_t*
     AllocatedControlTorques::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      return ptr__;
+      IMC::serialize(k, bfr__ + 0);
+      IMC::serialize(m, bfr__ + 8);
+      IMC::serialize(n, bfr__ + 16);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     AllocatedControlTorques::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(k, bfr__ + 0);
+      Utils::ByteCopy::copy(m, bfr__ + 8);
+      Utils::ByteCopy::copy(n, bfr__ + 16);
+      return c_fields_size;
     }
 
     uint16_t
     AllocatedControlTorques::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(k, bfr__ + 0);
+      Utils::ByteCopy::rcopy(m, bfr__ + 8);
+      Utils::ByteCopy::rcopy(n, bfr__ + 16);
+      return c_fields_size;
     }
 
     void
@@ -12613,6 +18373,38 @@ namespace DUNE
       IMC::toJSON(os__, "n", n, nindent__);
     }
 
+    void
+    AllocatedControlTorques::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("k", k);
+      w__.write("m", m);
+      w__.write("n", n);
+    }
+
+    bool
+    AllocatedControlTorques::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "k")
+      {
+        r__.read(k);
+        return true;
+      }
+
+      if (name__ == "m")
+      {
+        r__.read(m);
+        return true;
+      }
+
+      if (name__ == "n")
+      {
+        r__.read(n);
+        return true;
+      }
+
+      return false;
+    }
+
     ControlParcel::ControlParcel(void)
     {
       m_header.mgid = 412;
@@ -12648,34 +18440,37 @@ namespace DUNE
     uint8_t*
     ControlParcel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(i, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(a, ptr__);
-      return ptr__;
+      IMC::serialize(p, bfr__ + 0);
+      IMC::serialize(i, bfr__ + 4);
+      IMC::serialize(d, bfr__ + 8);
+      IMC::serialize(a, bfr__ + 12);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ControlParcel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(i, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(p, bfr__ + 0);
+      Utils::ByteCopy::copy(i, bfr__ + 4);
+      Utils::ByteCopy::copy(d, bfr__ + 8);
+      Utils::ByteCopy::copy(a, bfr__ + 12);
+      return c_fields_size;
     }
 
     uint16_t
     ControlParcel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(i, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 4);
+      return ControlParcel::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -12687,6 +18482,45 @@ namespace DUNE
       IMC::toJSON(os__, "a", a, nindent__);
     }
 
+    void
+    ControlParcel::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("p", p);
+      w__.write("i", i);
+      w__.write("d", d);
+      w__.write("a", a);
+    }
+
+    bool
+    ControlParcel::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "p")
+      {
+        r__.read(p);
+        return true;
+      }
+
+      if (name__ == "i")
+      {
+        r__.read(i);
+        return true;
+      }
+
+      if (name__ == "d")
+      {
+        r__.read(d);
+        return true;
+      }
+
+      if (name__ == "a")
+      {
+        r__.read(a);
+        return true;
+      }
+
+      return false;
+    }
+
     Brake::Brake(void)
     {
       m_header.mgid = 413;
@@ -12716,25 +18550,30 @@ namespace DUNE
     uint8_t*
     Brake::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Brake::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Brake::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -12743,6 +18582,24 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    void
+    Brake::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+    }
+
+    bool
+    Brake::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredLinearState::DesiredLinearState(void)
     {
       m_header.mgid = 414;
@@ -12790,52 +18647,50 @@ namespace DUNE
     uint8_t*
     DesiredLinearState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(ax, ptr__);
-      ptr__ += IMC::serialize(ay, ptr__);
-      ptr__ += IMC::serialize(az, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      IMC::serialize(vx, bfr__ + 24);
+      IMC::serialize(vy, bfr__ + 32);
+      IMC::serialize(vz, bfr__ + 40);
+      IMC::serialize(ax, bfr__ + 48);
+      IMC::serialize(ay, bfr__ + 56);
+      IMC::serialize(az, bfr__ + 64);
+      IMC::serialize(flags, bfr__ + 72);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredLinearState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(ax, bfr__, size__);
-      bfr__ += IMC::deserialize(ay, bfr__, size__);
-      bfr__ += IMC::deserialize(az, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 8);
+      Utils::ByteCopy::copy(z, bfr__ + 16);
+      Utils::ByteCopy::copy(vx, bfr__ + 24);
+      Utils::ByteCopy::copy(vy, bfr__ + 32);
+      Utils::ByteCopy::copy(vz, bfr__ + 40);
+      Utils::ByteCopy::copy(ax, bfr__ + 48);
+      Utils::ByteCopy::copy(ay, bfr__ + 56);
+      Utils::ByteCopy::copy(az, bfr__ + 64);
+      Utils::ByteCopy::copy(flags, bfr__ + 72);
+      return c_fields_size;
     }
 
     uint16_t
     DesiredLinearState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ax, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ay, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(az, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 9);
+      Utils::ByteCopy::rcopy2b(swap__ + 72, bfr__ + 72, 1);
+      return DesiredLinearState::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -12853,6 +18708,87 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredLinearState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("vx", vx);
+      w__.write("vy", vy);
+      w__.write("vz", vz);
+      w__.write("ax", ax);
+      w__.write("ay", ay);
+      w__.write("az", az);
+      w__.write("flags", flags);
+    }
+
+    bool
+    DesiredLinearState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "vx")
+      {
+        r__.read(vx);
+        return true;
+      }
+
+      if (name__ == "vy")
+      {
+        r__.read(vy);
+        return true;
+      }
+
+      if (name__ == "vz")
+      {
+        r__.read(vz);
+        return true;
+      }
+
+      if (name__ == "ax")
+      {
+        r__.read(ax);
+        return true;
+      }
+
+      if (name__ == "ay")
+      {
+        r__.read(ay);
+        return true;
+      }
+
+      if (name__ == "az")
+      {
+        r__.read(az);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      return false;
+    }
+
     DesiredThrottle::DesiredThrottle(void)
     {
       m_header.mgid = 415;
@@ -12882,25 +18818,30 @@ namespace DUNE
     uint8_t*
     DesiredThrottle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DesiredThrottle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
-    DesiredThrottle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+    DesiredThrottle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -12921,6 +18862,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredThrottle::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    DesiredThrottle::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Goto::Goto(void)
     {
       m_header.mgid = 450;
@@ -13042,6 +19001,94 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Goto::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("roll", roll);
+      w__.write("pitch", pitch);
+      w__.write("yaw", yaw);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Goto::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "roll")
+      {
+        r__.read(roll);
+        return true;
+      }
+
+      if (name__ == "pitch")
+      {
+        r__.read(pitch);
+        return true;
+      }
+
+      if (name__ == "yaw")
+      {
+        r__.read(yaw);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     PopUp::PopUp(void)
     {
       m_header.mgid = 451;
@@ -13161,6 +19208,94 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    PopUp::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("duration", duration);
+      w__.write("radius", radius);
+      w__.write("flags", flags);
+      w__.write("custom", custom);
+    }
+
+    bool
+    PopUp::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Teleoperation::Teleoperation(void)
     {
       m_header.mgid = 452;
@@ -13217,6 +19352,24 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Teleoperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("custom", custom);
+    }
+
+    bool
+    Teleoperation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Loiter::Loiter(void)
     {
       m_header.mgid = 453;
@@ -13358,6 +19511,115 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Loiter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("duration", duration);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("type", type);
+      w__.write("radius", radius);
+      w__.write("length", length);
+      w__.write("bearing", bearing);
+      w__.write("direction", direction);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Loiter::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      if (name__ == "length")
+      {
+        r__.read(length);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "direction")
+      {
+        r__.read(direction);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     IdleManeuver::IdleManeuver(void)
     {
       m_header.mgid = 454;
@@ -13420,6 +19682,31 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    IdleManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("duration", duration);
+      w__.write("custom", custom);
+    }
+
+    bool
+    IdleManeuver::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     LowLevelControl::LowLevelControl(void)
     {
       m_header.mgid = 455;
@@ -13489,6 +19776,38 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    LowLevelControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      control.toJSON(w__, "control");
+      w__.write("duration", duration);
+      w__.write("custom", custom);
+    }
+
+    bool
+    LowLevelControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "control")
+      {
+        control.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     LowLevelControl::setTimeStampNested(double value__)
     {
@@ -13688,6 +20007,129 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Rows::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("bearing", bearing);
+      w__.write("cross_angle", cross_angle);
+      w__.write("width", width);
+      w__.write("length", length);
+      w__.write("hstep", hstep);
+      w__.write("coff", coff);
+      w__.write("alternation", alternation);
+      w__.write("flags", flags);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Rows::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "cross_angle")
+      {
+        r__.read(cross_angle);
+        return true;
+      }
+
+      if (name__ == "width")
+      {
+        r__.read(width);
+        return true;
+      }
+
+      if (name__ == "length")
+      {
+        r__.read(length);
+        return true;
+      }
+
+      if (name__ == "hstep")
+      {
+        r__.read(hstep);
+        return true;
+      }
+
+      if (name__ == "coff")
+      {
+        r__.read(coff);
+        return true;
+      }
+
+      if (name__ == "alternation")
+      {
+        r__.read(alternation);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     PathPoint::PathPoint(void)
     {
       m_header.mgid = 458;
@@ -13721,31 +20163,36 @@ namespace DUNE
     uint8_t*
     PathPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PathPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+    {
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 4);
+      Utils::ByteCopy::copy(z, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     PathPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(x, bfr__ + 0);
+      Utils::ByteCopy::rcopy(y, bfr__ + 4);
+      Utils::ByteCopy::rcopy(z, bfr__ + 8);
+      return c_fields_size;
     }
 
     void
@@ -13756,6 +20203,38 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    PathPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    PathPoint::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     FollowPath::FollowPath(void)
     {
       m_header.mgid = 457;
@@ -13863,6 +20342,80 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FollowPath::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      points.toJSON(w__, "points");
+      w__.write("custom", custom);
+    }
+
+    bool
+    FollowPath::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "points")
+      {
+        points.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     FollowPath::setTimeStampNested(double value__)
     {
@@ -14006,6 +20559,87 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    YoYo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("amplitude", amplitude);
+      w__.write("pitch", pitch);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    YoYo::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "amplitude")
+      {
+        r__.read(amplitude);
+        return true;
+      }
+
+      if (name__ == "pitch")
+      {
+        r__.read(pitch);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     TeleoperationDone::TeleoperationDone(void)
     {
       m_header.mgid = 460;
@@ -14151,6 +20785,80 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    StationKeeping::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("radius", radius);
+      w__.write("duration", duration);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    StationKeeping::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Elevator::Elevator(void)
     {
       m_header.mgid = 462;
@@ -14276,6 +20984,101 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Elevator::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("flags", flags);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("start_z", start_z);
+      w__.write("start_z_units", start_z_units);
+      w__.write("end_z", end_z);
+      w__.write("end_z_units", end_z_units);
+      w__.write("radius", radius);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Elevator::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "start_z")
+      {
+        r__.read(start_z);
+        return true;
+      }
+
+      if (name__ == "start_z_units")
+      {
+        r__.read(start_z_units);
+        return true;
+      }
+
+      if (name__ == "end_z")
+      {
+        r__.read(end_z);
+        return true;
+      }
+
+      if (name__ == "end_z_units")
+      {
+        r__.read(end_z_units);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     TrajectoryPoint::TrajectoryPoint(void)
     {
       m_header.mgid = 464;
@@ -14311,34 +21114,37 @@ namespace DUNE
     uint8_t*
     TrajectoryPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(t, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(t, bfr__ + 12);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     TrajectoryPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(x, bfr__ + 0);
+      Utils::ByteCopy::copy(y, bfr__ + 4);
+      Utils::ByteCopy::copy(z, bfr__ + 8);
+      Utils::ByteCopy::copy(t, bfr__ + 12);
+      return c_fields_size;
     }
 
     uint16_t
     TrajectoryPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 4);
+      return TrajectoryPoint::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -14350,6 +21156,45 @@ namespace DUNE
       IMC::toJSON(os__, "t", t, nindent__);
     }
 
+    void
+    TrajectoryPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("t", t);
+    }
+
+    bool
+    TrajectoryPoint::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "t")
+      {
+        r__.read(t);
+        return true;
+      }
+
+      return false;
+    }
+
     FollowTrajectory::FollowTrajectory(void)
     {
       m_header.mgid = 463;
@@ -14457,6 +21302,80 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FollowTrajectory::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      points.toJSON(w__, "points");
+      w__.write("custom", custom);
+    }
+
+    bool
+    FollowTrajectory::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "points")
+      {
+        points.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     FollowTrajectory::setTimeStampNested(double value__)
     {
@@ -14555,6 +21474,38 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    CustomManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("name", name);
+      w__.write("custom", custom);
+    }
+
+    bool
+    CustomManeuver::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     VehicleFormationParticipant::VehicleFormationParticipant(void)
     {
       m_header.mgid = 467;
@@ -14590,34 +21541,39 @@ namespace DUNE
     uint8_t*
     VehicleFormationParticipant::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(vid, ptr__);
-      ptr__ += IMC::serialize(off_x, ptr__);
-      ptr__ += IMC::serialize(off_y, ptr__);
-      ptr__ += IMC::serialize(off_z, ptr__);
-      return ptr__;
+      IMC::serialize(vid, bfr__ + 0);
+      IMC::serialize(off_x, bfr__ + 2);
+      IMC::serialize(off_y, bfr__ + 6);
+      IMC::serialize(off_z, bfr__ + 10);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     VehicleFormationParticipant::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(vid, bfr__, size__);
-      bfr__ += IMC::deserialize(off_x, bfr__, size__);
-      bfr__ += IMC::deserialize(off_y, bfr__, size__);
-      bfr__ += IMC::deserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(vid, bfr__ + 0);
+      Utils::ByteCopy::copy(off_x, bfr__ + 2);
+      Utils::ByteCopy::copy(off_y, bfr__ + 6);
+      Utils::ByteCopy::copy(off_z, bfr__ + 10);
+      return c_fields_size;
     }
 
     uint16_t
     VehicleFormationParticipant::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(vid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(vid, bfr__ + 0);
+      Utils::ByteCopy::rcopy(off_x, bfr__ + 2);
+      Utils::ByteCopy::rcopy(off_y, bfr__ + 6);
+      Utils::ByteCopy::rcopy(off_z, bfr__ + 10);
+      return c_fields_size;
     }
 
     void
@@ -14629,6 +21585,45 @@ namespace DUNE
       IMC::toJSON(os__, "off_z", off_z, nindent__);
     }
 
+    void
+    VehicleFormationParticipant::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("vid", vid);
+      w__.write("off_x", off_x);
+      w__.write("off_y", off_y);
+      w__.write("off_z", off_z);
+    }
+
+    bool
+    VehicleFormationParticipant::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "vid")
+      {
+        r__.read(vid);
+        return true;
+      }
+
+      if (name__ == "off_x")
+      {
+        r__.read(off_x);
+        return true;
+      }
+
+      if (name__ == "off_y")
+      {
+        r__.read(off_y);
+        return true;
+      }
+
+      if (name__ == "off_z")
+      {
+        r__.read(off_z);
+        return true;
+      }
+
+      return false;
+    }
+
     VehicleFormation::VehicleFormation(void)
     {
       m_header.mgid = 466;
@@ -14743,6 +21738,87 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    VehicleFormation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      points.toJSON(w__, "points");
+      participants.toJSON(w__, "participants");
+      w__.write("start_time", start_time);
+      w__.write("custom", custom);
+    }
+
+    bool
+    VehicleFormation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "points")
+      {
+        points.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "participants")
+      {
+        participants.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "start_time")
+      {
+        r__.read(start_time);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     VehicleFormation::setTimeStampNested(double value__)
     {
@@ -14851,25 +21927,30 @@ namespace DUNE
     uint8_t*
     RegisterManeuver::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mid, ptr__);
-      return ptr__;
+      IMC::serialize(mid, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     RegisterManeuver::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(mid, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     RegisterManeuver::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(mid, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -14878,6 +21959,24 @@ namespace DUNE
       IMC::toJSON(os__, "mid", mid, nindent__);
     }
 
+    void
+    RegisterManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("mid", mid);
+    }
+
+    bool
+    RegisterManeuver::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "mid")
+      {
+        r__.read(mid);
+        return true;
+      }
+
+      return false;
+    }
+
     ManeuverControlState::ManeuverControlState(void)
     {
       m_header.mgid = 470;
@@ -14946,6 +22045,38 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    ManeuverControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+      w__.write("eta", eta);
+      w__.write("info", info);
+    }
+
+    bool
+    ManeuverControlState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "eta")
+      {
+        r__.read(eta);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     FollowSystem::FollowSystem(void)
     {
       m_header.mgid = 471;
@@ -14989,46 +22120,51 @@ namespace DUNE
     uint8_t*
     FollowSystem::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(system, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::serialize(system, bfr__ + 0);
+      IMC::serialize(duration, bfr__ + 2);
+      IMC::serialize(speed, bfr__ + 4);
+      IMC::serialize(speed_units, bfr__ + 8);
+      IMC::serialize(x, bfr__ + 9);
+      IMC::serialize(y, bfr__ + 13);
+      IMC::serialize(z, bfr__ + 17);
+      IMC::serialize(z_units, bfr__ + 21);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FollowSystem::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(system, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(system, bfr__ + 0);
+      Utils::ByteCopy::copy(duration, bfr__ + 2);
+      Utils::ByteCopy::copy(speed, bfr__ + 4);
+      Utils::ByteCopy::copy(speed_units, bfr__ + 8);
+      Utils::ByteCopy::copy(x, bfr__ + 9);
+      Utils::ByteCopy::copy(y, bfr__ + 13);
+      Utils::ByteCopy::copy(z, bfr__ + 17);
+      Utils::ByteCopy::copy(z_units, bfr__ + 21);
+      return c_fields_size;
     }
 
     uint16_t
     FollowSystem::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(system, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(system, bfr__ + 0);
+      Utils::ByteCopy::rcopy(duration, bfr__ + 2);
+      Utils::ByteCopy::rcopy(speed, bfr__ + 4);
+      Utils::ByteCopy::rcopy(speed_units, bfr__ + 8);
+      Utils::ByteCopy::rcopy(x, bfr__ + 9);
+      Utils::ByteCopy::rcopy(y, bfr__ + 13);
+      Utils::ByteCopy::rcopy(z, bfr__ + 17);
+      Utils::ByteCopy::rcopy(z_units, bfr__ + 21);
+      return c_fields_size;
     }
 
     void
@@ -15044,6 +22180,73 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    void
+    FollowSystem::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("system", system);
+      w__.write("duration", duration);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+    }
+
+    bool
+    FollowSystem::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "system")
+      {
+        r__.read(system);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      return false;
+    }
+
     CommsRelay::CommsRelay(void)
     {
       m_header.mgid = 472;
@@ -15089,59 +22292,131 @@ namespace DUNE
     uint8_t*
     CommsRelay::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(sys_a, ptr__);
-      ptr__ += IMC::serialize(sys_b, ptr__);
-      ptr__ += IMC::serialize(move_threshold, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 16);
+      IMC::serialize(speed_units, bfr__ + 20);
+      IMC::serialize(duration, bfr__ + 21);
+      IMC::serialize(sys_a, bfr__ + 23);
+      IMC::serialize(sys_b, bfr__ + 25);
+      IMC::serialize(move_threshold, bfr__ + 27);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     CommsRelay::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::deserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 8);
+      Utils::ByteCopy::copy(speed, bfr__ + 16);
+      Utils::ByteCopy::copy(speed_units, bfr__ + 20);
+      Utils::ByteCopy::copy(duration, bfr__ + 21);
+      Utils::ByteCopy::copy(sys_a, bfr__ + 23);
+      Utils::ByteCopy::copy(sys_b, bfr__ + 25);
+      Utils::ByteCopy::copy(move_threshold, bfr__ + 27);
+      return c_fields_size;
     }
 
     uint16_t
     CommsRelay::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(lat, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 8);
+      Utils::ByteCopy::rcopy(speed, bfr__ + 16);
+      Utils::ByteCopy::rcopy(speed_units, bfr__ + 20);
+      Utils::ByteCopy::rcopy(duration, bfr__ + 21);
+      Utils::ByteCopy::rcopy(sys_a, bfr__ + 23);
+      Utils::ByteCopy::rcopy(sys_b, bfr__ + 25);
+      Utils::ByteCopy::rcopy(move_threshold, bfr__ + 27);
+      return c_fields_size;
+    }
+
+    void
+    CommsRelay::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    {
+      IMC::toJSON(os__, "lat", lat, nindent__);
+      IMC::toJSON(os__, "lon", lon, nindent__);
+      IMC::toJSON(os__, "speed", speed, nindent__);
+      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
+      IMC::toJSON(os__, "duration", duration, nindent__);
+      IMC::toJSON(os__, "sys_a", sys_a, nindent__);
+      IMC::toJSON(os__, "sys_b", sys_b, nindent__);
+      IMC::toJSON(os__, "move_threshold", move_threshold, nindent__);
+    }
+
+    void
+    CommsRelay::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("duration", duration);
+      w__.write("sys_a", sys_a);
+      w__.write("sys_b", sys_b);
+      w__.write("move_threshold", move_threshold);
     }
 
-    void
-    CommsRelay::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
-    {
-      IMC::toJSON(os__, "lat", lat, nindent__);
-      IMC::toJSON(os__, "lon", lon, nindent__);
-      IMC::toJSON(os__, "speed", speed, nindent__);
-      IMC::toJSON(os__, "speed_units", speed_units, nindent__);
-      IMC::toJSON(os__, "duration", duration, nindent__);
-      IMC::toJSON(os__, "sys_a", sys_a, nindent__);
-      IMC::toJSON(os__, "sys_b", sys_b, nindent__);
-      IMC::toJSON(os__, "move_threshold", move_threshold, nindent__);
+    bool
+    CommsRelay::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "sys_a")
+      {
+        r__.read(sys_a);
+        return true;
+      }
+
+      if (name__ == "sys_b")
+      {
+        r__.read(sys_b);
+        return true;
+      }
+
+      if (name__ == "move_threshold")
+      {
+        r__.read(move_threshold);
+        return true;
+      }
+
+      return false;
     }
 
     PolygonVertex::PolygonVertex(void)
@@ -15177,28 +22452,33 @@ namespace DUNE
     uint8_t*
     PolygonVertex::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     PolygonVertex::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     PolygonVertex::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(lat, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 8);
+      return c_fields_size;
     }
 
     void
@@ -15208,6 +22488,31 @@ namespace DUNE
       IMC::toJSON(os__, "lon", lon, nindent__);
     }
 
+    void
+    PolygonVertex::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+    }
+
+    bool
+    PolygonVertex::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      return false;
+    }
+
     CoverArea::CoverArea(void)
     {
       m_header.mgid = 473;
@@ -15309,6 +22614,73 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    CoverArea::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      polygon.toJSON(w__, "polygon");
+      w__.write("custom", custom);
+    }
+
+    bool
+    CoverArea::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "polygon")
+      {
+        polygon.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     CoverArea::setTimeStampNested(double value__)
     {
@@ -15472,6 +22844,108 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    CompassCalibration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("pitch", pitch);
+      w__.write("amplitude", amplitude);
+      w__.write("duration", duration);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("radius", radius);
+      w__.write("direction", direction);
+      w__.write("custom", custom);
+    }
+
+    bool
+    CompassCalibration::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "pitch")
+      {
+        r__.read(pitch);
+        return true;
+      }
+
+      if (name__ == "amplitude")
+      {
+        r__.read(amplitude);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      if (name__ == "direction")
+      {
+        r__.read(direction);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     FormationParameters::FormationParameters(void)
     {
       m_header.mgid = 476;
@@ -15547,6 +23021,45 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FormationParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("formation_name", formation_name);
+      w__.write("reference_frame", reference_frame);
+      participants.toJSON(w__, "participants");
+      w__.write("custom", custom);
+    }
+
+    bool
+    FormationParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "formation_name")
+      {
+        r__.read(formation_name);
+        return true;
+      }
+
+      if (name__ == "reference_frame")
+      {
+        r__.read(reference_frame);
+        return true;
+      }
+
+      if (name__ == "participants")
+      {
+        participants.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     FormationParameters::setTimeStampNested(double value__)
     {
@@ -15711,6 +23224,115 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FormationPlanExecution::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("group_name", group_name);
+      w__.write("formation_name", formation_name);
+      w__.write("plan_id", plan_id);
+      w__.write("description", description);
+      w__.write("leader_speed", leader_speed);
+      w__.write("leader_bank_lim", leader_bank_lim);
+      w__.write("pos_sim_err_lim", pos_sim_err_lim);
+      w__.write("pos_sim_err_wrn", pos_sim_err_wrn);
+      w__.write("pos_sim_err_timeout", pos_sim_err_timeout);
+      w__.write("converg_max", converg_max);
+      w__.write("converg_timeout", converg_timeout);
+      w__.write("comms_timeout", comms_timeout);
+      w__.write("turb_lim", turb_lim);
+      w__.write("custom", custom);
+    }
+
+    bool
+    FormationPlanExecution::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "group_name")
+      {
+        r__.read(group_name);
+        return true;
+      }
+
+      if (name__ == "formation_name")
+      {
+        r__.read(formation_name);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "description")
+      {
+        r__.read(description);
+        return true;
+      }
+
+      if (name__ == "leader_speed")
+      {
+        r__.read(leader_speed);
+        return true;
+      }
+
+      if (name__ == "leader_bank_lim")
+      {
+        r__.read(leader_bank_lim);
+        return true;
+      }
+
+      if (name__ == "pos_sim_err_lim")
+      {
+        r__.read(pos_sim_err_lim);
+        return true;
+      }
+
+      if (name__ == "pos_sim_err_wrn")
+      {
+        r__.read(pos_sim_err_wrn);
+        return true;
+      }
+
+      if (name__ == "pos_sim_err_timeout")
+      {
+        r__.read(pos_sim_err_timeout);
+        return true;
+      }
+
+      if (name__ == "converg_max")
+      {
+        r__.read(converg_max);
+        return true;
+      }
+
+      if (name__ == "converg_timeout")
+      {
+        r__.read(converg_timeout);
+        return true;
+      }
+
+      if (name__ == "comms_timeout")
+      {
+        r__.read(comms_timeout);
+        return true;
+      }
+
+      if (name__ == "turb_lim")
+      {
+        r__.read(turb_lim);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     FollowReference::FollowReference(void)
     {
       m_header.mgid = 478;
@@ -15748,37 +23370,42 @@ namespace DUNE
     uint8_t*
     FollowReference::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(control_src, ptr__);
-      ptr__ += IMC::serialize(control_ent, ptr__);
-      ptr__ += IMC::serialize(timeout, ptr__);
-      ptr__ += IMC::serialize(loiter_radius, ptr__);
-      ptr__ += IMC::serialize(altitude_interval, ptr__);
-      return ptr__;
+      IMC::serialize(control_src, bfr__ + 0);
+      IMC::serialize(control_ent, bfr__ + 2);
+      IMC::serialize(timeout, bfr__ + 3);
+      IMC::serialize(loiter_radius, bfr__ + 7);
+      IMC::serialize(altitude_interval, bfr__ + 11);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FollowReference::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      bfr__ += IMC::deserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(control_src, bfr__ + 0);
+      Utils::ByteCopy::copy(control_ent, bfr__ + 2);
+      Utils::ByteCopy::copy(timeout, bfr__ + 3);
+      Utils::ByteCopy::copy(loiter_radius, bfr__ + 7);
+      Utils::ByteCopy::copy(altitude_interval, bfr__ + 11);
+      return c_fields_size;
     }
 
     uint16_t
     FollowReference::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(control_src, bfr__ + 0);
+      Utils::ByteCopy::rcopy(control_ent, bfr__ + 2);
+      Utils::ByteCopy::rcopy(timeout, bfr__ + 3);
+      Utils::ByteCopy::rcopy(loiter_radius, bfr__ + 7);
+      Utils::ByteCopy::rcopy(altitude_interval, bfr__ + 11);
+      return c_fields_size;
     }
 
     void
@@ -15791,6 +23418,52 @@ namespace DUNE
       IMC::toJSON(os__, "altitude_interval", altitude_interval, nindent__);
     }
 
+    void
+    FollowReference::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("control_src", control_src);
+      w__.write("control_ent", control_ent);
+      w__.write("timeout", timeout);
+      w__.write("loiter_radius", loiter_radius);
+      w__.write("altitude_interval", altitude_interval);
+    }
+
+    bool
+    FollowReference::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "control_src")
+      {
+        r__.read(control_src);
+        return true;
+      }
+
+      if (name__ == "control_ent")
+      {
+        r__.read(control_ent);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "loiter_radius")
+      {
+        r__.read(loiter_radius);
+        return true;
+      }
+
+      if (name__ == "altitude_interval")
+      {
+        r__.read(altitude_interval);
+        return true;
+      }
+
+      return false;
+    }
+
     Reference::Reference(void)
     {
       m_header.mgid = 479;
@@ -15879,6 +23552,59 @@ namespace DUNE
       IMC::toJSON(os__, "radius", radius, nindent__);
     }
 
+    void
+    Reference::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("flags", flags);
+      speed.toJSON(w__, "speed");
+      z.toJSON(w__, "z");
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("radius", radius);
+    }
+
+    bool
+    Reference::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        speed.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        z.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     Reference::setTimeStampNested(double value__)
     {
@@ -16030,6 +23756,52 @@ namespace DUNE
       IMC::toJSON(os__, "proximity", proximity, nindent__);
     }
 
+    void
+    FollowRefState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("control_src", control_src);
+      w__.write("control_ent", control_ent);
+      reference.toJSON(w__, "reference");
+      w__.write("state", state);
+      w__.write("proximity", proximity);
+    }
+
+    bool
+    FollowRefState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "control_src")
+      {
+        r__.read(control_src);
+        return true;
+      }
+
+      if (name__ == "control_ent")
+      {
+        r__.read(control_ent);
+        return true;
+      }
+
+      if (name__ == "reference")
+      {
+        reference.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "proximity")
+      {
+        r__.read(proximity);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     FollowRefState::setTimeStampNested(double value__)
     {
@@ -16257,6 +24029,171 @@ namespace DUNE
       IMC::toJSON(os__, "virt_err_z", virt_err_z, nindent__);
     }
 
+    void
+    RelativeState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("s_id", s_id);
+      w__.write("dist", dist);
+      w__.write("err", err);
+      w__.write("ctrl_imp", ctrl_imp);
+      w__.write("rel_dir_x", rel_dir_x);
+      w__.write("rel_dir_y", rel_dir_y);
+      w__.write("rel_dir_z", rel_dir_z);
+      w__.write("err_x", err_x);
+      w__.write("err_y", err_y);
+      w__.write("err_z", err_z);
+      w__.write("rf_err_x", rf_err_x);
+      w__.write("rf_err_y", rf_err_y);
+      w__.write("rf_err_z", rf_err_z);
+      w__.write("rf_err_vx", rf_err_vx);
+      w__.write("rf_err_vy", rf_err_vy);
+      w__.write("rf_err_vz", rf_err_vz);
+      w__.write("ss_x", ss_x);
+      w__.write("ss_y", ss_y);
+      w__.write("ss_z", ss_z);
+      w__.write("virt_err_x", virt_err_x);
+      w__.write("virt_err_y", virt_err_y);
+      w__.write("virt_err_z", virt_err_z);
+    }
+
+    bool
+    RelativeState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "s_id")
+      {
+        r__.read(s_id);
+        return true;
+      }
+
+      if (name__ == "dist")
+      {
+        r__.read(dist);
+        return true;
+      }
+
+      if (name__ == "err")
+      {
+        r__.read(err);
+        return true;
+      }
+
+      if (name__ == "ctrl_imp")
+      {
+        r__.read(ctrl_imp);
+        return true;
+      }
+
+      if (name__ == "rel_dir_x")
+      {
+        r__.read(rel_dir_x);
+        return true;
+      }
+
+      if (name__ == "rel_dir_y")
+      {
+        r__.read(rel_dir_y);
+        return true;
+      }
+
+      if (name__ == "rel_dir_z")
+      {
+        r__.read(rel_dir_z);
+        return true;
+      }
+
+      if (name__ == "err_x")
+      {
+        r__.read(err_x);
+        return true;
+      }
+
+      if (name__ == "err_y")
+      {
+        r__.read(err_y);
+        return true;
+      }
+
+      if (name__ == "err_z")
+      {
+        r__.read(err_z);
+        return true;
+      }
+
+      if (name__ == "rf_err_x")
+      {
+        r__.read(rf_err_x);
+        return true;
+      }
+
+      if (name__ == "rf_err_y")
+      {
+        r__.read(rf_err_y);
+        return true;
+      }
+
+      if (name__ == "rf_err_z")
+      {
+        r__.read(rf_err_z);
+        return true;
+      }
+
+      if (name__ == "rf_err_vx")
+      {
+        r__.read(rf_err_vx);
+        return true;
+      }
+
+      if (name__ == "rf_err_vy")
+      {
+        r__.read(rf_err_vy);
+        return true;
+      }
+
+      if (name__ == "rf_err_vz")
+      {
+        r__.read(rf_err_vz);
+        return true;
+      }
+
+      if (name__ == "ss_x")
+      {
+        r__.read(ss_x);
+        return true;
+      }
+
+      if (name__ == "ss_y")
+      {
+        r__.read(ss_y);
+        return true;
+      }
+
+      if (name__ == "ss_z")
+      {
+        r__.read(ss_z);
+        return true;
+      }
+
+      if (name__ == "virt_err_x")
+      {
+        r__.read(virt_err_x);
+        return true;
+      }
+
+      if (name__ == "virt_err_y")
+      {
+        r__.read(virt_err_y);
+        return true;
+      }
+
+      if (name__ == "virt_err_z")
+      {
+        r__.read(virt_err_z);
+        return true;
+      }
+
+      return false;
+    }
+
     FormationMonitor::FormationMonitor(void)
     {
       m_header.mgid = 481;
@@ -16422,6 +24359,150 @@ namespace DUNE
       rel_state.toJSON(os__, "rel_state", nindent__);
     }
 
+    void
+    FormationMonitor::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("ax_cmd", ax_cmd);
+      w__.write("ay_cmd", ay_cmd);
+      w__.write("az_cmd", az_cmd);
+      w__.write("ax_des", ax_des);
+      w__.write("ay_des", ay_des);
+      w__.write("az_des", az_des);
+      w__.write("virt_err_x", virt_err_x);
+      w__.write("virt_err_y", virt_err_y);
+      w__.write("virt_err_z", virt_err_z);
+      w__.write("surf_fdbk_x", surf_fdbk_x);
+      w__.write("surf_fdbk_y", surf_fdbk_y);
+      w__.write("surf_fdbk_z", surf_fdbk_z);
+      w__.write("surf_unkn_x", surf_unkn_x);
+      w__.write("surf_unkn_y", surf_unkn_y);
+      w__.write("surf_unkn_z", surf_unkn_z);
+      w__.write("ss_x", ss_x);
+      w__.write("ss_y", ss_y);
+      w__.write("ss_z", ss_z);
+      rel_state.toJSON(w__, "rel_state");
+    }
+
+    bool
+    FormationMonitor::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "ax_cmd")
+      {
+        r__.read(ax_cmd);
+        return true;
+      }
+
+      if (name__ == "ay_cmd")
+      {
+        r__.read(ay_cmd);
+        return true;
+      }
+
+      if (name__ == "az_cmd")
+      {
+        r__.read(az_cmd);
+        return true;
+      }
+
+      if (name__ == "ax_des")
+      {
+        r__.read(ax_des);
+        return true;
+      }
+
+      if (name__ == "ay_des")
+      {
+        r__.read(ay_des);
+        return true;
+      }
+
+      if (name__ == "az_des")
+      {
+        r__.read(az_des);
+        return true;
+      }
+
+      if (name__ == "virt_err_x")
+      {
+        r__.read(virt_err_x);
+        return true;
+      }
+
+      if (name__ == "virt_err_y")
+      {
+        r__.read(virt_err_y);
+        return true;
+      }
+
+      if (name__ == "virt_err_z")
+      {
+        r__.read(virt_err_z);
+        return true;
+      }
+
+      if (name__ == "surf_fdbk_x")
+      {
+        r__.read(surf_fdbk_x);
+        return true;
+      }
+
+      if (name__ == "surf_fdbk_y")
+      {
+        r__.read(surf_fdbk_y);
+        return true;
+      }
+
+      if (name__ == "surf_fdbk_z")
+      {
+        r__.read(surf_fdbk_z);
+        return true;
+      }
+
+      if (name__ == "surf_unkn_x")
+      {
+        r__.read(surf_unkn_x);
+        return true;
+      }
+
+      if (name__ == "surf_unkn_y")
+      {
+        r__.read(surf_unkn_y);
+        return true;
+      }
+
+      if (name__ == "surf_unkn_z")
+      {
+        r__.read(surf_unkn_z);
+        return true;
+      }
+
+      if (name__ == "ss_x")
+      {
+        r__.read(ss_x);
+        return true;
+      }
+
+      if (name__ == "ss_y")
+      {
+        r__.read(ss_y);
+        return true;
+      }
+
+      if (name__ == "ss_z")
+      {
+        r__.read(ss_z);
+        return true;
+      }
+
+      if (name__ == "rel_state")
+      {
+        rel_state.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     FormationMonitor::setTimeStampNested(double value__)
     {
@@ -16526,6 +24607,45 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Dislodge::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("rpm", rpm);
+      w__.write("direction", direction);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Dislodge::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "rpm")
+      {
+        r__.read(rpm);
+        return true;
+      }
+
+      if (name__ == "direction")
+      {
+        r__.read(direction);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Formation::Formation(void)
     {
       m_header.mgid = 484;
@@ -16677,30 +24797,188 @@ namespace DUNE
       return bfr__ - start__;
     }
 
-    void
-    Formation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
-    {
-      IMC::toJSON(os__, "formation_name", formation_name, nindent__);
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "op", op, nindent__);
-      IMC::toJSON(os__, "group_name", group_name, nindent__);
-      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
-      IMC::toJSON(os__, "description", description, nindent__);
-      IMC::toJSON(os__, "reference_frame", reference_frame, nindent__);
-      participants.toJSON(os__, "participants", nindent__);
-      IMC::toJSON(os__, "leader_bank_lim", leader_bank_lim, nindent__);
-      IMC::toJSON(os__, "leader_speed_min", leader_speed_min, nindent__);
-      IMC::toJSON(os__, "leader_speed_max", leader_speed_max, nindent__);
-      IMC::toJSON(os__, "leader_alt_min", leader_alt_min, nindent__);
-      IMC::toJSON(os__, "leader_alt_max", leader_alt_max, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_lim", pos_sim_err_lim, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_wrn", pos_sim_err_wrn, nindent__);
-      IMC::toJSON(os__, "pos_sim_err_timeout", pos_sim_err_timeout, nindent__);
-      IMC::toJSON(os__, "converg_max", converg_max, nindent__);
-      IMC::toJSON(os__, "converg_timeout", converg_timeout, nindent__);
-      IMC::toJSON(os__, "comms_timeout", comms_timeout, nindent__);
-      IMC::toJSON(os__, "turb_lim", turb_lim, nindent__);
-      IMC::toJSON(os__, "custom", custom, nindent__);
+    void
+    Formation::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    {
+      IMC::toJSON(os__, "formation_name", formation_name, nindent__);
+      IMC::toJSON(os__, "type", type, nindent__);
+      IMC::toJSON(os__, "op", op, nindent__);
+      IMC::toJSON(os__, "group_name", group_name, nindent__);
+      IMC::toJSON(os__, "plan_id", plan_id, nindent__);
+      IMC::toJSON(os__, "description", description, nindent__);
+      IMC::toJSON(os__, "reference_frame", reference_frame, nindent__);
+      participants.toJSON(os__, "participants", nindent__);
+      IMC::toJSON(os__, "leader_bank_lim", leader_bank_lim, nindent__);
+      IMC::toJSON(os__, "leader_speed_min", leader_speed_min, nindent__);
+      IMC::toJSON(os__, "leader_speed_max", leader_speed_max, nindent__);
+      IMC::toJSON(os__, "leader_alt_min", leader_alt_min, nindent__);
+      IMC::toJSON(os__, "leader_alt_max", leader_alt_max, nindent__);
+      IMC::toJSON(os__, "pos_sim_err_lim", pos_sim_err_lim, nindent__);
+      IMC::toJSON(os__, "pos_sim_err_wrn", pos_sim_err_wrn, nindent__);
+      IMC::toJSON(os__, "pos_sim_err_timeout", pos_sim_err_timeout, nindent__);
+      IMC::toJSON(os__, "converg_max", converg_max, nindent__);
+      IMC::toJSON(os__, "converg_timeout", converg_timeout, nindent__);
+      IMC::toJSON(os__, "comms_timeout", comms_timeout, nindent__);
+      IMC::toJSON(os__, "turb_lim", turb_lim, nindent__);
+      IMC::toJSON(os__, "custom", custom, nindent__);
+    }
+
+    void
+    Formation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("formation_name", formation_name);
+      w__.write("type", type);
+      w__.write("op", op);
+      w__.write("group_name", group_name);
+      w__.write("plan_id", plan_id);
+      w__.write("description", description);
+      w__.write("reference_frame", reference_frame);
+      participants.toJSON(w__, "participants");
+      w__.write("leader_bank_lim", leader_bank_lim);
+      w__.write("leader_speed_min", leader_speed_min);
+      w__.write("leader_speed_max", leader_speed_max);
+      w__.write("leader_alt_min", leader_alt_min);
+      w__.write("leader_alt_max", leader_alt_max);
+      w__.write("pos_sim_err_lim", pos_sim_err_lim);
+      w__.write("pos_sim_err_wrn", pos_sim_err_wrn);
+      w__.write("pos_sim_err_timeout", pos_sim_err_timeout);
+      w__.write("converg_max", converg_max);
+      w__.write("converg_timeout", converg_timeout);
+      w__.write("comms_timeout", comms_timeout);
+      w__.write("turb_lim", turb_lim);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Formation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "formation_name")
+      {
+        r__.read(formation_name);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "group_name")
+      {
+        r__.read(group_name);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "description")
+      {
+        r__.read(description);
+        return true;
+      }
+
+      if (name__ == "reference_frame")
+      {
+        r__.read(reference_frame);
+        return true;
+      }
+
+      if (name__ == "participants")
+      {
+        participants.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "leader_bank_lim")
+      {
+        r__.read(leader_bank_lim);
+        return true;
+      }
+
+      if (name__ == "leader_speed_min")
+      {
+        r__.read(leader_speed_min);
+        return true;
+      }
+
+      if (name__ == "leader_speed_max")
+      {
+        r__.read(leader_speed_max);
+        return true;
+      }
+
+      if (name__ == "leader_alt_min")
+      {
+        r__.read(leader_alt_min);
+        return true;
+      }
+
+      if (name__ == "leader_alt_max")
+      {
+        r__.read(leader_alt_max);
+        return true;
+      }
+
+      if (name__ == "pos_sim_err_lim")
+      {
+        r__.read(pos_sim_err_lim);
+        return true;
+      }
+
+      if (name__ == "pos_sim_err_wrn")
+      {
+        r__.read(pos_sim_err_wrn);
+        return true;
+      }
+
+      if (name__ == "pos_sim_err_timeout")
+      {
+        r__.read(pos_sim_err_timeout);
+        return true;
+      }
+
+      if (name__ == "converg_max")
+      {
+        r__.read(converg_max);
+        return true;
+      }
+
+      if (name__ == "converg_timeout")
+      {
+        r__.read(converg_timeout);
+        return true;
+      }
+
+      if (name__ == "comms_timeout")
+      {
+        r__.read(comms_timeout);
+        return true;
+      }
+
+      if (name__ == "turb_lim")
+      {
+        r__.read(turb_lim);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
     }
 
     void
@@ -16833,6 +25111,73 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Launch::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Launch::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Drop::Drop(void)
     {
       m_header.mgid = 486;
@@ -16933,6 +25278,73 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Drop::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Drop::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     ScheduledGoto::ScheduledGoto(void)
     {
       m_header.mgid = 487;
@@ -16978,46 +25390,51 @@ namespace DUNE
     uint8_t*
     ScheduledGoto::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(arrival_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(travel_z, ptr__);
-      ptr__ += IMC::serialize(travel_z_units, ptr__);
-      ptr__ += IMC::serialize(delayed, ptr__);
-      return ptr__;
+      IMC::serialize(arrival_time, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 8);
+      IMC::serialize(lon, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      IMC::serialize(z_units, bfr__ + 28);
+      IMC::serialize(travel_z, bfr__ + 29);
+      IMC::serialize(travel_z_units, bfr__ + 33);
+      IMC::serialize(delayed, bfr__ + 34);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ScheduledGoto::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(arrival_time, bfr__ + 0);
+      Utils::ByteCopy::copy(lat, bfr__ + 8);
+      Utils::ByteCopy::copy(lon, bfr__ + 16);
+      Utils::ByteCopy::copy(z, bfr__ + 24);
+      Utils::ByteCopy::copy(z_units, bfr__ + 28);
+      Utils::ByteCopy::copy(travel_z, bfr__ + 29);
+      Utils::ByteCopy::copy(travel_z_units, bfr__ + 33);
+      Utils::ByteCopy::copy(delayed, bfr__ + 34);
+      return c_fields_size;
     }
 
     uint16_t
     ScheduledGoto::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(arrival_time, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lat, bfr__ + 8);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 16);
+      Utils::ByteCopy::rcopy(z, bfr__ + 24);
+      Utils::ByteCopy::rcopy(z_units, bfr__ + 28);
+      Utils::ByteCopy::rcopy(travel_z, bfr__ + 29);
+      Utils::ByteCopy::rcopy(travel_z_units, bfr__ + 33);
+      Utils::ByteCopy::rcopy(delayed, bfr__ + 34);
+      return c_fields_size;
     }
 
     void
@@ -17033,6 +25450,73 @@ namespace DUNE
       IMC::toJSON(os__, "delayed", delayed, nindent__);
     }
 
+    void
+    ScheduledGoto::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("arrival_time", arrival_time);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("travel_z", travel_z);
+      w__.write("travel_z_units", travel_z_units);
+      w__.write("delayed", delayed);
+    }
+
+    bool
+    ScheduledGoto::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "arrival_time")
+      {
+        r__.read(arrival_time);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "travel_z")
+      {
+        r__.read(travel_z);
+        return true;
+      }
+
+      if (name__ == "travel_z_units")
+      {
+        r__.read(travel_z_units);
+        return true;
+      }
+
+      if (name__ == "delayed")
+      {
+        r__.read(delayed);
+        return true;
+      }
+
+      return false;
+    }
+
     RowsCoverage::RowsCoverage(void)
     {
       m_header.mgid = 488;
@@ -17187,6 +25671,129 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    RowsCoverage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("bearing", bearing);
+      w__.write("cross_angle", cross_angle);
+      w__.write("width", width);
+      w__.write("length", length);
+      w__.write("coff", coff);
+      w__.write("angaperture", angaperture);
+      w__.write("range", range);
+      w__.write("overlap", overlap);
+      w__.write("flags", flags);
+      w__.write("custom", custom);
+    }
+
+    bool
+    RowsCoverage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "cross_angle")
+      {
+        r__.read(cross_angle);
+        return true;
+      }
+
+      if (name__ == "width")
+      {
+        r__.read(width);
+        return true;
+      }
+
+      if (name__ == "length")
+      {
+        r__.read(length);
+        return true;
+      }
+
+      if (name__ == "coff")
+      {
+        r__.read(coff);
+        return true;
+      }
+
+      if (name__ == "angaperture")
+      {
+        r__.read(angaperture);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      if (name__ == "overlap")
+      {
+        r__.read(overlap);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Sample::Sample(void)
     {
       m_header.mgid = 489;
@@ -17305,6 +25912,94 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Sample::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("syringe0", syringe0);
+      w__.write("syringe1", syringe1);
+      w__.write("syringe2", syringe2);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Sample::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "syringe0")
+      {
+        r__.read(syringe0);
+        return true;
+      }
+
+      if (name__ == "syringe1")
+      {
+        r__.read(syringe1);
+        return true;
+      }
+
+      if (name__ == "syringe2")
+      {
+        r__.read(syringe2);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     ImageTracking::ImageTracking(void)
     {
       m_header.mgid = 490;
@@ -17445,6 +26140,73 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Takeoff::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("takeoff_pitch", takeoff_pitch);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Takeoff::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "takeoff_pitch")
+      {
+        r__.read(takeoff_pitch);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Land::Land(void)
     {
       m_header.mgid = 492;
@@ -17565,6 +26327,94 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Land::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("abort_z", abort_z);
+      w__.write("bearing", bearing);
+      w__.write("glide_slope", glide_slope);
+      w__.write("glide_slope_alt", glide_slope_alt);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Land::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "abort_z")
+      {
+        r__.read(abort_z);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "glide_slope")
+      {
+        r__.read(glide_slope);
+        return true;
+      }
+
+      if (name__ == "glide_slope_alt")
+      {
+        r__.read(glide_slope_alt);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     AutonomousSection::AutonomousSection(void)
     {
       m_header.mgid = 493;
@@ -17684,6 +26534,94 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    AutonomousSection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("limits", limits);
+      w__.write("max_depth", max_depth);
+      w__.write("min_alt", min_alt);
+      w__.write("time_limit", time_limit);
+      area_limits.toJSON(w__, "area_limits");
+      w__.write("controller", controller);
+      w__.write("custom", custom);
+    }
+
+    bool
+    AutonomousSection::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "limits")
+      {
+        r__.read(limits);
+        return true;
+      }
+
+      if (name__ == "max_depth")
+      {
+        r__.read(max_depth);
+        return true;
+      }
+
+      if (name__ == "min_alt")
+      {
+        r__.read(min_alt);
+        return true;
+      }
+
+      if (name__ == "time_limit")
+      {
+        r__.read(time_limit);
+        return true;
+      }
+
+      if (name__ == "area_limits")
+      {
+        area_limits.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "controller")
+      {
+        r__.read(controller);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     AutonomousSection::setTimeStampNested(double value__)
     {
@@ -17815,6 +26753,73 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FollowPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("max_speed", max_speed);
+      w__.write("speed_units", speed_units);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    FollowPoint::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "max_speed")
+      {
+        r__.read(max_speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     Alignment::Alignment(void)
     {
       m_header.mgid = 495;
@@ -17903,6 +26908,59 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Alignment::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Alignment::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     StationKeepingExtended::StationKeepingExtended(void)
     {
       m_header.mgid = 496;
@@ -18027,6 +27085,101 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    StationKeepingExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("radius", radius);
+      w__.write("duration", duration);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("popup_period", popup_period);
+      w__.write("popup_duration", popup_duration);
+      w__.write("flags", flags);
+      w__.write("custom", custom);
+    }
+
+    bool
+    StationKeepingExtended::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "radius")
+      {
+        r__.read(radius);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "popup_period")
+      {
+        r__.read(popup_period);
+        return true;
+      }
+
+      if (name__ == "popup_duration")
+      {
+        r__.read(popup_duration);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     ManeuverDone::ManeuverDone(void)
     {
       m_header.mgid = 497;
@@ -18187,6 +27340,94 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Magnetometer::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("speed", speed);
+      w__.write("speed_units", speed_units);
+      w__.write("bearing", bearing);
+      w__.write("width", width);
+      w__.write("direction", direction);
+      w__.write("custom", custom);
+    }
+
+    bool
+    Magnetometer::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "speed_units")
+      {
+        r__.read(speed_units);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "width")
+      {
+        r__.read(width);
+        return true;
+      }
+
+      if (name__ == "direction")
+      {
+        r__.read(direction);
+        return true;
+      }
+
+      if (name__ == "custom")
+      {
+        r__.read(custom);
+        return true;
+      }
+
+      return false;
+    }
+
     VehicleState::VehicleState(void)
     {
       m_header.mgid = 500;
@@ -18297,6 +27538,87 @@ namespace DUNE
       IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
     }
 
+    void
+    VehicleState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op_mode", op_mode);
+      w__.write("error_count", error_count);
+      w__.write("error_ents", error_ents);
+      w__.write("maneuver_type", maneuver_type);
+      w__.write("maneuver_stime", maneuver_stime);
+      w__.write("maneuver_eta", maneuver_eta);
+      w__.write("control_loops", control_loops);
+      w__.write("flags", flags);
+      w__.write("last_error", last_error);
+      w__.write("last_error_time", last_error_time);
+    }
+
+    bool
+    VehicleState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op_mode")
+      {
+        r__.read(op_mode);
+        return true;
+      }
+
+      if (name__ == "error_count")
+      {
+        r__.read(error_count);
+        return true;
+      }
+
+      if (name__ == "error_ents")
+      {
+        r__.read(error_ents);
+        return true;
+      }
+
+      if (name__ == "maneuver_type")
+      {
+        r__.read(maneuver_type);
+        return true;
+      }
+
+      if (name__ == "maneuver_stime")
+      {
+        r__.read(maneuver_stime);
+        return true;
+      }
+
+      if (name__ == "maneuver_eta")
+      {
+        r__.read(maneuver_eta);
+        return true;
+      }
+
+      if (name__ == "control_loops")
+      {
+        r__.read(control_loops);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "last_error")
+      {
+        r__.read(last_error);
+        return true;
+      }
+
+      if (name__ == "last_error_time")
+      {
+        r__.read(last_error_time);
+        return true;
+      }
+
+      return false;
+    }
+
     VehicleCommand::VehicleCommand(void)
     {
       m_header.mgid = 501;
@@ -18384,6 +27706,59 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    VehicleCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("request_id", request_id);
+      w__.write("command", command);
+      maneuver.toJSON(w__, "maneuver");
+      w__.write("calib_time", calib_time);
+      w__.write("info", info);
+    }
+
+    bool
+    VehicleCommand::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "request_id")
+      {
+        r__.read(request_id);
+        return true;
+      }
+
+      if (name__ == "command")
+      {
+        r__.read(command);
+        return true;
+      }
+
+      if (name__ == "maneuver")
+      {
+        maneuver.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "calib_time")
+      {
+        r__.read(calib_time);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     VehicleCommand::setTimeStampNested(double value__)
     {
@@ -18491,6 +27866,31 @@ namespace DUNE
       IMC::toJSON(os__, "entities", entities, nindent__);
     }
 
+    void
+    MonitorEntityState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("command", command);
+      w__.write("entities", entities);
+    }
+
+    bool
+    MonitorEntityState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "command")
+      {
+        r__.read(command);
+        return true;
+      }
+
+      if (name__ == "entities")
+      {
+        r__.read(entities);
+        return true;
+      }
+
+      return false;
+    }
+
     EntityMonitoringState::EntityMonitoringState(void)
     {
       m_header.mgid = 503;
@@ -18589,6 +27989,73 @@ namespace DUNE
       IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
     }
 
+    void
+    EntityMonitoringState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("mcount", mcount);
+      w__.write("mnames", mnames);
+      w__.write("ecount", ecount);
+      w__.write("enames", enames);
+      w__.write("ccount", ccount);
+      w__.write("cnames", cnames);
+      w__.write("last_error", last_error);
+      w__.write("last_error_time", last_error_time);
+    }
+
+    bool
+    EntityMonitoringState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "mcount")
+      {
+        r__.read(mcount);
+        return true;
+      }
+
+      if (name__ == "mnames")
+      {
+        r__.read(mnames);
+        return true;
+      }
+
+      if (name__ == "ecount")
+      {
+        r__.read(ecount);
+        return true;
+      }
+
+      if (name__ == "enames")
+      {
+        r__.read(enames);
+        return true;
+      }
+
+      if (name__ == "ccount")
+      {
+        r__.read(ccount);
+        return true;
+      }
+
+      if (name__ == "cnames")
+      {
+        r__.read(cnames);
+        return true;
+      }
+
+      if (name__ == "last_error")
+      {
+        r__.read(last_error);
+        return true;
+      }
+
+      if (name__ == "last_error_time")
+      {
+        r__.read(last_error_time);
+        return true;
+      }
+
+      return false;
+    }
+
     OperationalLimits::OperationalLimits(void)
     {
       m_header.mgid = 504;
@@ -18648,58 +28115,56 @@ namespace DUNE
     uint8_t*
     OperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(max_depth, ptr__);
-      ptr__ += IMC::serialize(min_altitude, ptr__);
-      ptr__ += IMC::serialize(max_altitude, ptr__);
-      ptr__ += IMC::serialize(min_speed, ptr__);
-      ptr__ += IMC::serialize(max_speed, ptr__);
-      ptr__ += IMC::serialize(max_vrate, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(orientation, ptr__);
-      ptr__ += IMC::serialize(width, ptr__);
-      ptr__ += IMC::serialize(length, ptr__);
-      return ptr__;
+      IMC::serialize(mask, bfr__ + 0);
+      IMC::serialize(max_depth, bfr__ + 1);
+      IMC::serialize(min_altitude, bfr__ + 5);
+      IMC::serialize(max_altitude, bfr__ + 9);
+      IMC::serialize(min_speed, bfr__ + 13);
+      IMC::serialize(max_speed, bfr__ + 17);
+      IMC::serialize(max_vrate, bfr__ + 21);
+      IMC::serialize(lat, bfr__ + 25);
+      IMC::serialize(lon, bfr__ + 33);
+      IMC::serialize(orientation, bfr__ + 41);
+      IMC::serialize(width, bfr__ + 45);
+      IMC::serialize(length, bfr__ + 49);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     OperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::deserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(orientation, bfr__, size__);
-      bfr__ += IMC::deserialize(width, bfr__, size__);
-      bfr__ += IMC::deserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(mask, bfr__ + 0);
+      Utils::ByteCopy::copy(max_depth, bfr__ + 1);
+      Utils::ByteCopy::copy(min_altitude, bfr__ + 5);
+      Utils::ByteCopy::copy(max_altitude, bfr__ + 9);
+      Utils::ByteCopy::copy(min_speed, bfr__ + 13);
+      Utils::ByteCopy::copy(max_speed, bfr__ + 17);
+      Utils::ByteCopy::copy(max_vrate, bfr__ + 21);
+      Utils::ByteCopy::copy(lat, bfr__ + 25);
+      Utils::ByteCopy::copy(lon, bfr__ + 33);
+      Utils::ByteCopy::copy(orientation, bfr__ + 41);
+      Utils::ByteCopy::copy(width, bfr__ + 45);
+      Utils::ByteCopy::copy(length, bfr__ + 49);
+      return c_fields_size;
     }
 
     uint16_t
     OperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(orientation, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      std::memcpy(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 1, bfr__ + 1, 6);
+      Utils::ByteCopy::rcopy8b(swap__ + 25, bfr__ + 25, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 41, bfr__ + 41, 3);
+      return OperationalLimits::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -18719,6 +28184,101 @@ namespace DUNE
       IMC::toJSON(os__, "length", length, nindent__);
     }
 
+    void
+    OperationalLimits::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("mask", mask);
+      w__.write("max_depth", max_depth);
+      w__.write("min_altitude", min_altitude);
+      w__.write("max_altitude", max_altitude);
+      w__.write("min_speed", min_speed);
+      w__.write("max_speed", max_speed);
+      w__.write("max_vrate", max_vrate);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("orientation", orientation);
+      w__.write("width", width);
+      w__.write("length", length);
+    }
+
+    bool
+    OperationalLimits::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "mask")
+      {
+        r__.read(mask);
+        return true;
+      }
+
+      if (name__ == "max_depth")
+      {
+        r__.read(max_depth);
+        return true;
+      }
+
+      if (name__ == "min_altitude")
+      {
+        r__.read(min_altitude);
+        return true;
+      }
+
+      if (name__ == "max_altitude")
+      {
+        r__.read(max_altitude);
+        return true;
+      }
+
+      if (name__ == "min_speed")
+      {
+        r__.read(min_speed);
+        return true;
+      }
+
+      if (name__ == "max_speed")
+      {
+        r__.read(max_speed);
+        return true;
+      }
+
+      if (name__ == "max_vrate")
+      {
+        r__.read(max_vrate);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "orientation")
+      {
+        r__.read(orientation);
+        return true;
+      }
+
+      if (name__ == "width")
+      {
+        r__.read(width);
+        return true;
+      }
+
+      if (name__ == "length")
+      {
+        r__.read(length);
+        return true;
+      }
+
+      return false;
+    }
+
     GetOperationalLimits::GetOperationalLimits(void)
     {
       m_header.mgid = 505;
@@ -18787,25 +28347,30 @@ namespace DUNE
     uint8_t*
     Calibration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(duration, ptr__);
-      return ptr__;
+      IMC::serialize(duration, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Calibration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(duration, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     Calibration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(duration, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -18814,6 +28379,24 @@ namespace DUNE
       IMC::toJSON(os__, "duration", duration, nindent__);
     }
 
+    void
+    Calibration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("duration", duration);
+    }
+
+    bool
+    Calibration::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      return false;
+    }
+
     ControlLoops::ControlLoops(void)
     {
       m_header.mgid = 507;
@@ -18847,31 +28430,36 @@ namespace DUNE
     uint8_t*
     ControlLoops::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(enable, ptr__);
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(scope_ref, ptr__);
-      return ptr__;
+      IMC::serialize(enable, bfr__ + 0);
+      IMC::serialize(mask, bfr__ + 1);
+      IMC::serialize(scope_ref, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ControlLoops::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(enable, bfr__ + 0);
+      Utils::ByteCopy::copy(mask, bfr__ + 1);
+      Utils::ByteCopy::copy(scope_ref, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     ControlLoops::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(enable, bfr__ + 0);
+      Utils::ByteCopy::rcopy(mask, bfr__ + 1);
+      Utils::ByteCopy::rcopy(scope_ref, bfr__ + 5);
+      return c_fields_size;
     }
 
     void
@@ -18882,6 +28470,38 @@ namespace DUNE
       IMC::toJSON(os__, "scope_ref", scope_ref, nindent__);
     }
 
+    void
+    ControlLoops::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("enable", enable);
+      w__.write("mask", mask);
+      w__.write("scope_ref", scope_ref);
+    }
+
+    bool
+    ControlLoops::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "enable")
+      {
+        r__.read(enable);
+        return true;
+      }
+
+      if (name__ == "mask")
+      {
+        r__.read(mask);
+        return true;
+      }
+
+      if (name__ == "scope_ref")
+      {
+        r__.read(scope_ref);
+        return true;
+      }
+
+      return false;
+    }
+
     VehicleMedium::VehicleMedium(void)
     {
       m_header.mgid = 508;
@@ -18911,31 +28531,54 @@ namespace DUNE
     uint8_t*
     VehicleMedium::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(medium, ptr__);
-      return ptr__;
+      IMC::serialize(medium, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     VehicleMedium::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(medium, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     VehicleMedium::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(medium, bfr__ + 0);
+      return c_fields_size;
+    }
+
+    void
+    VehicleMedium::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    {
+      IMC::toJSON(os__, "medium", medium, nindent__);
     }
 
     void
-    VehicleMedium::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    VehicleMedium::fieldsToJSON(JSONWriter& w__) const
     {
-      IMC::toJSON(os__, "medium", medium, nindent__);
+      w__.write("medium", medium);
+    }
+
+    bool
+    VehicleMedium::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "medium")
+      {
+        r__.read(medium);
+        return true;
+      }
+
+      return false;
     }
 
     Collision::Collision(void)
@@ -18969,28 +28612,33 @@ namespace DUNE
     uint8_t*
     Collision::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Collision::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      Utils::ByteCopy::copy(type, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     Collision::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      Utils::ByteCopy::rcopy(type, bfr__ + 4);
+      return c_fields_size;
     }
 
     fp64_t
@@ -19012,6 +28660,31 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    Collision::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("type", type);
+    }
+
+    bool
+    Collision::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      return false;
+    }
+
     FormState::FormState(void)
     {
       m_header.mgid = 510;
@@ -19051,40 +28724,45 @@ namespace DUNE
     uint8_t*
     FormState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::serialize(possimerr, bfr__ + 0);
+      IMC::serialize(converg, bfr__ + 4);
+      IMC::serialize(turbulence, bfr__ + 8);
+      IMC::serialize(possimmon, bfr__ + 12);
+      IMC::serialize(commmon, bfr__ + 13);
+      IMC::serialize(convergmon, bfr__ + 14);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FormState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(possimerr, bfr__ + 0);
+      Utils::ByteCopy::copy(converg, bfr__ + 4);
+      Utils::ByteCopy::copy(turbulence, bfr__ + 8);
+      Utils::ByteCopy::copy(possimmon, bfr__ + 12);
+      Utils::ByteCopy::copy(commmon, bfr__ + 13);
+      Utils::ByteCopy::copy(convergmon, bfr__ + 14);
+      return c_fields_size;
     }
 
     uint16_t
     FormState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(possimerr, bfr__ + 0);
+      Utils::ByteCopy::rcopy(converg, bfr__ + 4);
+      Utils::ByteCopy::rcopy(turbulence, bfr__ + 8);
+      Utils::ByteCopy::rcopy(possimmon, bfr__ + 12);
+      Utils::ByteCopy::rcopy(commmon, bfr__ + 13);
+      Utils::ByteCopy::rcopy(convergmon, bfr__ + 14);
+      return c_fields_size;
     }
 
     void
@@ -19098,6 +28776,59 @@ namespace DUNE
       IMC::toJSON(os__, "convergmon", convergmon, nindent__);
     }
 
+    void
+    FormState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("possimerr", possimerr);
+      w__.write("converg", converg);
+      w__.write("turbulence", turbulence);
+      w__.write("possimmon", possimmon);
+      w__.write("commmon", commmon);
+      w__.write("convergmon", convergmon);
+    }
+
+    bool
+    FormState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "possimerr")
+      {
+        r__.read(possimerr);
+        return true;
+      }
+
+      if (name__ == "converg")
+      {
+        r__.read(converg);
+        return true;
+      }
+
+      if (name__ == "turbulence")
+      {
+        r__.read(turbulence);
+        return true;
+      }
+
+      if (name__ == "possimmon")
+      {
+        r__.read(possimmon);
+        return true;
+      }
+
+      if (name__ == "commmon")
+      {
+        r__.read(commmon);
+        return true;
+      }
+
+      if (name__ == "convergmon")
+      {
+        r__.read(convergmon);
+        return true;
+      }
+
+      return false;
+    }
+
     AutopilotMode::AutopilotMode(void)
     {
       m_header.mgid = 511;
@@ -19160,6 +28891,31 @@ namespace DUNE
       IMC::toJSON(os__, "mode", mode, nindent__);
     }
 
+    void
+    AutopilotMode::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("autonomy", autonomy);
+      w__.write("mode", mode);
+    }
+
+    bool
+    AutopilotMode::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "autonomy")
+      {
+        r__.read(autonomy);
+        return true;
+      }
+
+      if (name__ == "mode")
+      {
+        r__.read(mode);
+        return true;
+      }
+
+      return false;
+    }
+
     FormationState::FormationState(void)
     {
       m_header.mgid = 512;
@@ -19203,46 +28959,51 @@ namespace DUNE
     uint8_t*
     FormationState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      IMC::serialize(op, bfr__ + 1);
+      IMC::serialize(possimerr, bfr__ + 2);
+      IMC::serialize(converg, bfr__ + 6);
+      IMC::serialize(turbulence, bfr__ + 10);
+      IMC::serialize(possimmon, bfr__ + 14);
+      IMC::serialize(commmon, bfr__ + 15);
+      IMC::serialize(convergmon, bfr__ + 16);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FormationState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(type, bfr__ + 0);
+      Utils::ByteCopy::copy(op, bfr__ + 1);
+      Utils::ByteCopy::copy(possimerr, bfr__ + 2);
+      Utils::ByteCopy::copy(converg, bfr__ + 6);
+      Utils::ByteCopy::copy(turbulence, bfr__ + 10);
+      Utils::ByteCopy::copy(possimmon, bfr__ + 14);
+      Utils::ByteCopy::copy(commmon, bfr__ + 15);
+      Utils::ByteCopy::copy(convergmon, bfr__ + 16);
+      return c_fields_size;
     }
 
     uint16_t
     FormationState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(type, bfr__ + 0);
+      Utils::ByteCopy::rcopy(op, bfr__ + 1);
+      Utils::ByteCopy::rcopy(possimerr, bfr__ + 2);
+      Utils::ByteCopy::rcopy(converg, bfr__ + 6);
+      Utils::ByteCopy::rcopy(turbulence, bfr__ + 10);
+      Utils::ByteCopy::rcopy(possimmon, bfr__ + 14);
+      Utils::ByteCopy::rcopy(commmon, bfr__ + 15);
+      Utils::ByteCopy::rcopy(convergmon, bfr__ + 16);
+      return c_fields_size;
     }
 
     void
@@ -19258,6 +29019,73 @@ namespace DUNE
       IMC::toJSON(os__, "convergmon", convergmon, nindent__);
     }
 
+    void
+    FormationState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("op", op);
+      w__.write("possimerr", possimerr);
+      w__.write("converg", converg);
+      w__.write("turbulence", turbulence);
+      w__.write("possimmon", possimmon);
+      w__.write("commmon", commmon);
+      w__.write("convergmon", convergmon);
+    }
+
+    bool
+    FormationState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "possimerr")
+      {
+        r__.read(possimerr);
+        return true;
+      }
+
+      if (name__ == "converg")
+      {
+        r__.read(converg);
+        return true;
+      }
+
+      if (name__ == "turbulence")
+      {
+        r__.read(turbulence);
+        return true;
+      }
+
+      if (name__ == "possimmon")
+      {
+        r__.read(possimmon);
+        return true;
+      }
+
+      if (name__ == "commmon")
+      {
+        r__.read(commmon);
+        return true;
+      }
+
+      if (name__ == "convergmon")
+      {
+        r__.read(convergmon);
+        return true;
+      }
+
+      return false;
+    }
+
     ReportControl::ReportControl(void)
     {
       m_header.mgid = 513;
@@ -19332,6 +29160,45 @@ namespace DUNE
       IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
     }
 
+    void
+    ReportControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("comm_interface", comm_interface);
+      w__.write("period", period);
+      w__.write("sys_dst", sys_dst);
+    }
+
+    bool
+    ReportControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "comm_interface")
+      {
+        r__.read(comm_interface);
+        return true;
+      }
+
+      if (name__ == "period")
+      {
+        r__.read(period);
+        return true;
+      }
+
+      if (name__ == "sys_dst")
+      {
+        r__.read(sys_dst);
+        return true;
+      }
+
+      return false;
+    }
+
     StateReport::StateReport(void)
     {
       m_header.mgid = 514;
@@ -19379,52 +29246,52 @@ namespace DUNE
     uint8_t*
     StateReport::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(stime, ptr__);
-      ptr__ += IMC::serialize(latitude, ptr__);
-      ptr__ += IMC::serialize(longitude, ptr__);
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(fuel, ptr__);
-      ptr__ += IMC::serialize(exec_state, ptr__);
-      ptr__ += IMC::serialize(plan_checksum, ptr__);
-      return ptr__;
+      IMC::serialize(stime, bfr__ + 0);
+      IMC::serialize(latitude, bfr__ + 4);
+      IMC::serialize(longitude, bfr__ + 8);
+      IMC::serialize(altitude, bfr__ + 12);
+      IMC::serialize(depth, bfr__ + 14);
+      IMC::serialize(heading, bfr__ + 16);
+      IMC::serialize(speed, bfr__ + 18);
+      IMC::serialize(fuel, bfr__ + 20);
+      IMC::serialize(exec_state, bfr__ + 21);
+      IMC::serialize(plan_checksum, bfr__ + 22);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     StateReport::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(stime, bfr__, size__);
-      bfr__ += IMC::deserialize(latitude, bfr__, size__);
-      bfr__ += IMC::deserialize(longitude, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(fuel, bfr__, size__);
-      bfr__ += IMC::deserialize(exec_state, bfr__, size__);
-      bfr__ += IMC::deserialize(plan_checksum, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(stime, bfr__ + 0);
+      Utils::ByteCopy::copy(latitude, bfr__ + 4);
+      Utils::ByteCopy::copy(longitude, bfr__ + 8);
+      Utils::ByteCopy::copy(altitude, bfr__ + 12);
+      Utils::ByteCopy::copy(depth, bfr__ + 14);
+      Utils::ByteCopy::copy(heading, bfr__ + 16);
+      Utils::ByteCopy::copy(speed, bfr__ + 18);
+      Utils::ByteCopy::copy(fuel, bfr__ + 20);
+      Utils::ByteCopy::copy(exec_state, bfr__ + 21);
+      Utils::ByteCopy::copy(plan_checksum, bfr__ + 22);
+      return c_fields_size;
     }
 
     uint16_t
     StateReport::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(stime, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(fuel, bfr__, size__);
-      bfr__ += IMC::deserialize(exec_state, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(plan_checksum, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 3);
+      Utils::ByteCopy::rcopy2b(swap__ + 12, bfr__ + 12, 4);
+      std::memcpy(swap__ + 20, bfr__ + 20, 2);
+      Utils::ByteCopy::rcopy2b(swap__ + 22, bfr__ + 22, 1);
+      return StateReport::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -19442,6 +29309,87 @@ namespace DUNE
       IMC::toJSON(os__, "plan_checksum", plan_checksum, nindent__);
     }
 
+    void
+    StateReport::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("stime", stime);
+      w__.write("latitude", latitude);
+      w__.write("longitude", longitude);
+      w__.write("altitude", altitude);
+      w__.write("depth", depth);
+      w__.write("heading", heading);
+      w__.write("speed", speed);
+      w__.write("fuel", fuel);
+      w__.write("exec_state", exec_state);
+      w__.write("plan_checksum", plan_checksum);
+    }
+
+    bool
+    StateReport::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "stime")
+      {
+        r__.read(stime);
+        return true;
+      }
+
+      if (name__ == "latitude")
+      {
+        r__.read(latitude);
+        return true;
+      }
+
+      if (name__ == "longitude")
+      {
+        r__.read(longitude);
+        return true;
+      }
+
+      if (name__ == "altitude")
+      {
+        r__.read(altitude);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "heading")
+      {
+        r__.read(heading);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "fuel")
+      {
+        r__.read(fuel);
+        return true;
+      }
+
+      if (name__ == "exec_state")
+      {
+        r__.read(exec_state);
+        return true;
+      }
+
+      if (name__ == "plan_checksum")
+      {
+        r__.read(plan_checksum);
+        return true;
+      }
+
+      return false;
+    }
+
     TransmissionRequest::TransmissionRequest(void)
     {
       m_header.mgid = 515;
@@ -19533,18 +29481,92 @@ namespace DUNE
       return bfr__ - start__;
     }
 
-    void
-    TransmissionRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
-    {
-      IMC::toJSON(os__, "req_id", req_id, nindent__);
-      IMC::toJSON(os__, "comm_mean", comm_mean, nindent__);
-      IMC::toJSON(os__, "destination", destination, nindent__);
-      IMC::toJSON(os__, "deadline", deadline, nindent__);
-      IMC::toJSON(os__, "range", range, nindent__);
-      IMC::toJSON(os__, "data_mode", data_mode, nindent__);
-      msg_data.toJSON(os__, "msg_data", nindent__);
-      IMC::toJSON(os__, "txt_data", txt_data, nindent__);
-      IMC::toJSON(os__, "raw_data", raw_data, nindent__);
+    void
+    TransmissionRequest::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
+    {
+      IMC::toJSON(os__, "req_id", req_id, nindent__);
+      IMC::toJSON(os__, "comm_mean", comm_mean, nindent__);
+      IMC::toJSON(os__, "destination", destination, nindent__);
+      IMC::toJSON(os__, "deadline", deadline, nindent__);
+      IMC::toJSON(os__, "range", range, nindent__);
+      IMC::toJSON(os__, "data_mode", data_mode, nindent__);
+      msg_data.toJSON(os__, "msg_data", nindent__);
+      IMC::toJSON(os__, "txt_data", txt_data, nindent__);
+      IMC::toJSON(os__, "raw_data", raw_data, nindent__);
+    }
+
+    void
+    TransmissionRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("comm_mean", comm_mean);
+      w__.write("destination", destination);
+      w__.write("deadline", deadline);
+      w__.write("range", range);
+      w__.write("data_mode", data_mode);
+      msg_data.toJSON(w__, "msg_data");
+      w__.write("txt_data", txt_data);
+      w__.write("raw_data", raw_data);
+    }
+
+    bool
+    TransmissionRequest::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "comm_mean")
+      {
+        r__.read(comm_mean);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "deadline")
+      {
+        r__.read(deadline);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      if (name__ == "data_mode")
+      {
+        r__.read(data_mode);
+        return true;
+      }
+
+      if (name__ == "msg_data")
+      {
+        msg_data.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "txt_data")
+      {
+        r__.read(txt_data);
+        return true;
+      }
+
+      if (name__ == "raw_data")
+      {
+        r__.read(raw_data);
+        return true;
+      }
+
+      return false;
     }
 
     void
@@ -19666,6 +29688,45 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    TransmissionStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("status", status);
+      w__.write("range", range);
+      w__.write("info", info);
+    }
+
+    bool
+    TransmissionStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      if (name__ == "range")
+      {
+        r__.read(range);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     SmsRequest::SmsRequest(void)
     {
       m_header.mgid = 517;
@@ -19740,6 +29801,45 @@ namespace DUNE
       IMC::toJSON(os__, "sms_text", sms_text, nindent__);
     }
 
+    void
+    SmsRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("destination", destination);
+      w__.write("timeout", timeout);
+      w__.write("sms_text", sms_text);
+    }
+
+    bool
+    SmsRequest::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "sms_text")
+      {
+        r__.read(sms_text);
+        return true;
+      }
+
+      return false;
+    }
+
     SmsStatus::SmsStatus(void)
     {
       m_header.mgid = 518;
@@ -19808,6 +29908,38 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    SmsStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("status", status);
+      w__.write("info", info);
+    }
+
+    bool
+    SmsStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     VtolState::VtolState(void)
     {
       m_header.mgid = 519;
@@ -19837,25 +29969,30 @@ namespace DUNE
     uint8_t*
     VtolState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     VtolState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(state, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     VtolState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(state, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -19864,6 +30001,24 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    VtolState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+    }
+
+    bool
+    VtolState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      return false;
+    }
+
     ArmingState::ArmingState(void)
     {
       m_header.mgid = 520;
@@ -19893,25 +30048,30 @@ namespace DUNE
     uint8_t*
     ArmingState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ArmingState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(state, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     ArmingState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(state, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -19920,6 +30080,24 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    ArmingState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+    }
+
+    bool
+    ArmingState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      return false;
+    }
+
     TCPRequest::TCPRequest(void)
     {
       m_header.mgid = 521;
@@ -19995,6 +30173,45 @@ namespace DUNE
       msg_data.toJSON(os__, "msg_data", nindent__);
     }
 
+    void
+    TCPRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("destination", destination);
+      w__.write("timeout", timeout);
+      msg_data.toJSON(w__, "msg_data");
+    }
+
+    bool
+    TCPRequest::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "destination")
+      {
+        r__.read(destination);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      if (name__ == "msg_data")
+      {
+        msg_data.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     TCPRequest::setTimeStampNested(double value__)
     {
@@ -20108,6 +30325,38 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    TCPStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("req_id", req_id);
+      w__.write("status", status);
+      w__.write("info", info);
+    }
+
+    bool
+    TCPStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "req_id")
+      {
+        r__.read(req_id);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     Abort::Abort(void)
     {
       m_header.mgid = 550;
@@ -20221,6 +30470,45 @@ namespace DUNE
       IMC::toJSON(os__, "access", access, nindent__);
     }
 
+    void
+    PlanVariable::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("value", value);
+      w__.write("type", type);
+      w__.write("access", access);
+    }
+
+    bool
+    PlanVariable::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "access")
+      {
+        r__.read(access);
+        return true;
+      }
+
+      return false;
+    }
+
     PlanManeuver::PlanManeuver(void)
     {
       m_header.mgid = 552;
@@ -20298,6 +30586,45 @@ namespace DUNE
       end_actions.toJSON(os__, "end_actions", nindent__);
     }
 
+    void
+    PlanManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("maneuver_id", maneuver_id);
+      data.toJSON(w__, "data");
+      start_actions.toJSON(w__, "start_actions");
+      end_actions.toJSON(w__, "end_actions");
+    }
+
+    bool
+    PlanManeuver::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "maneuver_id")
+      {
+        r__.read(maneuver_id);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        data.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "start_actions")
+      {
+        start_actions.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "end_actions")
+      {
+        end_actions.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     PlanManeuver::setTimeStampNested(double value__)
     {
@@ -20438,6 +30765,45 @@ namespace DUNE
       actions.toJSON(os__, "actions", nindent__);
     }
 
+    void
+    PlanTransition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("source_man", source_man);
+      w__.write("dest_man", dest_man);
+      w__.write("conditions", conditions);
+      actions.toJSON(w__, "actions");
+    }
+
+    bool
+    PlanTransition::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "source_man")
+      {
+        r__.read(source_man);
+        return true;
+      }
+
+      if (name__ == "dest_man")
+      {
+        r__.read(dest_man);
+        return true;
+      }
+
+      if (name__ == "conditions")
+      {
+        r__.read(conditions);
+        return true;
+      }
+
+      if (name__ == "actions")
+      {
+        actions.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     PlanTransition::setTimeStampNested(double value__)
     {
@@ -20577,6 +30943,80 @@ namespace DUNE
       end_actions.toJSON(os__, "end_actions", nindent__);
     }
 
+    void
+    PlanSpecification::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("plan_id", plan_id);
+      w__.write("description", description);
+      w__.write("vnamespace", vnamespace);
+      variables.toJSON(w__, "variables");
+      w__.write("start_man_id", start_man_id);
+      maneuvers.toJSON(w__, "maneuvers");
+      transitions.toJSON(w__, "transitions");
+      start_actions.toJSON(w__, "start_actions");
+      end_actions.toJSON(w__, "end_actions");
+    }
+
+    bool
+    PlanSpecification::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "description")
+      {
+        r__.read(description);
+        return true;
+      }
+
+      if (name__ == "vnamespace")
+      {
+        r__.read(vnamespace);
+        return true;
+      }
+
+      if (name__ == "variables")
+      {
+        variables.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "start_man_id")
+      {
+        r__.read(start_man_id);
+        return true;
+      }
+
+      if (name__ == "maneuvers")
+      {
+        maneuvers.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "transitions")
+      {
+        transitions.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "start_actions")
+      {
+        start_actions.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "end_actions")
+      {
+        end_actions.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     PlanSpecification::setTimeStampNested(double value__)
     {
@@ -20710,6 +31150,31 @@ namespace DUNE
       plan.toJSON(os__, "plan", nindent__);
     }
 
+    void
+    EmergencyControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("command", command);
+      plan.toJSON(w__, "plan");
+    }
+
+    bool
+    EmergencyControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "command")
+      {
+        r__.read(command);
+        return true;
+      }
+
+      if (name__ == "plan")
+      {
+        plan.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     EmergencyControl::setTimeStampNested(double value__)
     {
@@ -20824,6 +31289,38 @@ namespace DUNE
       IMC::toJSON(os__, "comm_level", comm_level, nindent__);
     }
 
+    void
+    EmergencyControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+      w__.write("plan_id", plan_id);
+      w__.write("comm_level", comm_level);
+    }
+
+    bool
+    EmergencyControlState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "comm_level")
+      {
+        r__.read(comm_level);
+        return true;
+      }
+
+      return false;
+    }
+
     PlanDB::PlanDB(void)
     {
       m_header.mgid = 556;
@@ -20911,6 +31408,59 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    PlanDB::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("op", op);
+      w__.write("request_id", request_id);
+      w__.write("plan_id", plan_id);
+      arg.toJSON(w__, "arg");
+      w__.write("info", info);
+    }
+
+    bool
+    PlanDB::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "request_id")
+      {
+        r__.read(request_id);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "arg")
+      {
+        arg.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     PlanDB::setTimeStampNested(double value__)
     {
@@ -21042,6 +31592,59 @@ namespace DUNE
       IMC::toJSON(os__, "md5", md5, nindent__);
     }
 
+    void
+    PlanDBInformation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("plan_id", plan_id);
+      w__.write("plan_size", plan_size);
+      w__.write("change_time", change_time);
+      w__.write("change_sid", change_sid);
+      w__.write("change_sname", change_sname);
+      w__.write("md5", md5);
+    }
+
+    bool
+    PlanDBInformation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "plan_size")
+      {
+        r__.read(plan_size);
+        return true;
+      }
+
+      if (name__ == "change_time")
+      {
+        r__.read(change_time);
+        return true;
+      }
+
+      if (name__ == "change_sid")
+      {
+        r__.read(change_sid);
+        return true;
+      }
+
+      if (name__ == "change_sname")
+      {
+        r__.read(change_sname);
+        return true;
+      }
+
+      if (name__ == "md5")
+      {
+        r__.read(md5);
+        return true;
+      }
+
+      return false;
+    }
+
     PlanDBState::PlanDBState(void)
     {
       m_header.mgid = 557;
@@ -21135,6 +31738,66 @@ namespace DUNE
       plans_info.toJSON(os__, "plans_info", nindent__);
     }
 
+    void
+    PlanDBState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("plan_count", plan_count);
+      w__.write("plan_size", plan_size);
+      w__.write("change_time", change_time);
+      w__.write("change_sid", change_sid);
+      w__.write("change_sname", change_sname);
+      w__.write("md5", md5);
+      plans_info.toJSON(w__, "plans_info");
+    }
+
+    bool
+    PlanDBState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "plan_count")
+      {
+        r__.read(plan_count);
+        return true;
+      }
+
+      if (name__ == "plan_size")
+      {
+        r__.read(plan_size);
+        return true;
+      }
+
+      if (name__ == "change_time")
+      {
+        r__.read(change_time);
+        return true;
+      }
+
+      if (name__ == "change_sid")
+      {
+        r__.read(change_sid);
+        return true;
+      }
+
+      if (name__ == "change_sname")
+      {
+        r__.read(change_sname);
+        return true;
+      }
+
+      if (name__ == "md5")
+      {
+        r__.read(md5);
+        return true;
+      }
+
+      if (name__ == "plans_info")
+      {
+        plans_info.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     PlanDBState::setTimeStampNested(double value__)
     {
@@ -21258,6 +31921,66 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    PlanControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("op", op);
+      w__.write("request_id", request_id);
+      w__.write("plan_id", plan_id);
+      w__.write("flags", flags);
+      arg.toJSON(w__, "arg");
+      w__.write("info", info);
+    }
+
+    bool
+    PlanControl::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "request_id")
+      {
+        r__.read(request_id);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "arg")
+      {
+        arg.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     PlanControl::setTimeStampNested(double value__)
     {
@@ -21401,6 +32124,73 @@ namespace DUNE
       IMC::toJSON(os__, "last_outcome", last_outcome, nindent__);
     }
 
+    void
+    PlanControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+      w__.write("plan_id", plan_id);
+      w__.write("plan_eta", plan_eta);
+      w__.write("plan_progress", plan_progress);
+      w__.write("man_id", man_id);
+      w__.write("man_type", man_type);
+      w__.write("man_eta", man_eta);
+      w__.write("last_outcome", last_outcome);
+    }
+
+    bool
+    PlanControlState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "plan_eta")
+      {
+        r__.read(plan_eta);
+        return true;
+      }
+
+      if (name__ == "plan_progress")
+      {
+        r__.read(plan_progress);
+        return true;
+      }
+
+      if (name__ == "man_id")
+      {
+        r__.read(man_id);
+        return true;
+      }
+
+      if (name__ == "man_type")
+      {
+        r__.read(man_type);
+        return true;
+      }
+
+      if (name__ == "man_eta")
+      {
+        r__.read(man_eta);
+        return true;
+      }
+
+      if (name__ == "last_outcome")
+      {
+        r__.read(last_outcome);
+        return true;
+      }
+
+      return false;
+    }
+
     PlanGeneration::PlanGeneration(void)
     {
       m_header.mgid = 562;
@@ -21475,6 +32265,45 @@ namespace DUNE
       IMC::toJSON(os__, "params", params, nindent__);
     }
 
+    void
+    PlanGeneration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("cmd", cmd);
+      w__.write("op", op);
+      w__.write("plan_id", plan_id);
+      w__.write("params", params);
+    }
+
+    bool
+    PlanGeneration::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "cmd")
+      {
+        r__.read(cmd);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "params")
+      {
+        r__.read(params);
+        return true;
+      }
+
+      return false;
+    }
+
     LeaderState::LeaderState(void)
     {
       m_header.mgid = 563;
@@ -21653,6 +32482,157 @@ namespace DUNE
       IMC::toJSON(os__, "svz", svz, nindent__);
     }
 
+    void
+    LeaderState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("group_name", group_name);
+      w__.write("op", op);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height", height);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("vx", vx);
+      w__.write("vy", vy);
+      w__.write("vz", vz);
+      w__.write("p", p);
+      w__.write("q", q);
+      w__.write("r", r);
+      w__.write("svx", svx);
+      w__.write("svy", svy);
+      w__.write("svz", svz);
+    }
+
+    bool
+    LeaderState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "group_name")
+      {
+        r__.read(group_name);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height")
+      {
+        r__.read(height);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "vx")
+      {
+        r__.read(vx);
+        return true;
+      }
+
+      if (name__ == "vy")
+      {
+        r__.read(vy);
+        return true;
+      }
+
+      if (name__ == "vz")
+      {
+        r__.read(vz);
+        return true;
+      }
+
+      if (name__ == "p")
+      {
+        r__.read(p);
+        return true;
+      }
+
+      if (name__ == "q")
+      {
+        r__.read(q);
+        return true;
+      }
+
+      if (name__ == "r")
+      {
+        r__.read(r);
+        return true;
+      }
+
+      if (name__ == "svx")
+      {
+        r__.read(svx);
+        return true;
+      }
+
+      if (name__ == "svy")
+      {
+        r__.read(svy);
+        return true;
+      }
+
+      if (name__ == "svz")
+      {
+        r__.read(svz);
+        return true;
+      }
+
+      return false;
+    }
+
     PlanStatistics::PlanStatistics(void)
     {
       m_header.mgid = 564;
@@ -21745,6 +32725,66 @@ namespace DUNE
       IMC::toJSON(os__, "fuel", fuel, nindent__);
     }
 
+    void
+    PlanStatistics::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("plan_id", plan_id);
+      w__.write("type", type);
+      w__.write("properties", properties);
+      w__.write("durations", durations);
+      w__.write("distances", distances);
+      w__.write("actions", actions);
+      w__.write("fuel", fuel);
+    }
+
+    bool
+    PlanStatistics::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "properties")
+      {
+        r__.read(properties);
+        return true;
+      }
+
+      if (name__ == "durations")
+      {
+        r__.read(durations);
+        return true;
+      }
+
+      if (name__ == "distances")
+      {
+        r__.read(distances);
+        return true;
+      }
+
+      if (name__ == "actions")
+      {
+        r__.read(actions);
+        return true;
+      }
+
+      if (name__ == "fuel")
+      {
+        r__.read(fuel);
+        return true;
+      }
+
+      return false;
+    }
+
     ReportedState::ReportedState(void)
     {
       m_header.mgid = 600;
@@ -21849,6 +32889,80 @@ namespace DUNE
       IMC::toJSON(os__, "s_type", s_type, nindent__);
     }
 
+    void
+    ReportedState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("depth", depth);
+      w__.write("roll", roll);
+      w__.write("pitch", pitch);
+      w__.write("yaw", yaw);
+      w__.write("rcp_time", rcp_time);
+      w__.write("sid", sid);
+      w__.write("s_type", s_type);
+    }
+
+    bool
+    ReportedState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "roll")
+      {
+        r__.read(roll);
+        return true;
+      }
+
+      if (name__ == "pitch")
+      {
+        r__.read(pitch);
+        return true;
+      }
+
+      if (name__ == "yaw")
+      {
+        r__.read(yaw);
+        return true;
+      }
+
+      if (name__ == "rcp_time")
+      {
+        r__.read(rcp_time);
+        return true;
+      }
+
+      if (name__ == "sid")
+      {
+        r__.read(sid);
+        return true;
+      }
+
+      if (name__ == "s_type")
+      {
+        r__.read(s_type);
+        return true;
+      }
+
+      return false;
+    }
+
     RemoteSensorInfo::RemoteSensorInfo(void)
     {
       m_header.mgid = 601;
@@ -21941,6 +33055,66 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    RemoteSensorInfo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("sensor_class", sensor_class);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("alt", alt);
+      w__.write("heading", heading);
+      w__.write("data", data);
+    }
+
+    bool
+    RemoteSensorInfo::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "sensor_class")
+      {
+        r__.read(sensor_class);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "alt")
+      {
+        r__.read(alt);
+        return true;
+      }
+
+      if (name__ == "heading")
+      {
+        r__.read(heading);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     MapPoint::MapPoint(void)
     {
       m_header.mgid = 604;
@@ -21974,31 +33148,36 @@ namespace DUNE
     uint8_t*
     MapPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(alt, bfr__ + 16);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     MapPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 8);
+      Utils::ByteCopy::copy(alt, bfr__ + 16);
+      return c_fields_size;
     }
 
     uint16_t
     MapPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(lat, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 8);
+      Utils::ByteCopy::rcopy(alt, bfr__ + 16);
+      return c_fields_size;
     }
 
     void
@@ -22009,6 +33188,38 @@ namespace DUNE
       IMC::toJSON(os__, "alt", alt, nindent__);
     }
 
+    void
+    MapPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("alt", alt);
+    }
+
+    bool
+    MapPoint::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "alt")
+      {
+        r__.read(alt);
+        return true;
+      }
+
+      return false;
+    }
+
     MapFeature::MapFeature(void)
     {
       m_header.mgid = 603;
@@ -22096,6 +33307,59 @@ namespace DUNE
       feature.toJSON(os__, "feature", nindent__);
     }
 
+    void
+    MapFeature::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      w__.write("feature_type", feature_type);
+      w__.write("rgb_red", rgb_red);
+      w__.write("rgb_green", rgb_green);
+      w__.write("rgb_blue", rgb_blue);
+      feature.toJSON(w__, "feature");
+    }
+
+    bool
+    MapFeature::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "feature_type")
+      {
+        r__.read(feature_type);
+        return true;
+      }
+
+      if (name__ == "rgb_red")
+      {
+        r__.read(rgb_red);
+        return true;
+      }
+
+      if (name__ == "rgb_green")
+      {
+        r__.read(rgb_green);
+        return true;
+      }
+
+      if (name__ == "rgb_blue")
+      {
+        r__.read(rgb_blue);
+        return true;
+      }
+
+      if (name__ == "feature")
+      {
+        feature.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     MapFeature::setTimeStampNested(double value__)
     {
@@ -22189,6 +33453,31 @@ namespace DUNE
       features.toJSON(os__, "features", nindent__);
     }
 
+    void
+    Map::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("id", id);
+      features.toJSON(w__, "features");
+    }
+
+    bool
+    Map::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "features")
+      {
+        features.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     Map::setTimeStampNested(double value__)
     {
@@ -22288,6 +33577,38 @@ namespace DUNE
       arg.toJSON(os__, "arg", nindent__);
     }
 
+    void
+    CcuEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("id", id);
+      arg.toJSON(w__, "arg");
+    }
+
+    bool
+    CcuEvent::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "id")
+      {
+        r__.read(id);
+        return true;
+      }
+
+      if (name__ == "arg")
+      {
+        arg.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     CcuEvent::setTimeStampNested(double value__)
     {
@@ -22396,6 +33717,31 @@ namespace DUNE
       links.toJSON(os__, "links", nindent__);
     }
 
+    void
+    VehicleLinks::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("localname", localname);
+      links.toJSON(w__, "links");
+    }
+
+    bool
+    VehicleLinks::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "localname")
+      {
+        r__.read(localname);
+        return true;
+      }
+
+      if (name__ == "links")
+      {
+        links.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     VehicleLinks::setTimeStampNested(double value__)
     {
@@ -22494,6 +33840,38 @@ namespace DUNE
       IMC::toJSON(os__, "attributes", attributes, nindent__);
     }
 
+    void
+    TrexObservation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeline", timeline);
+      w__.write("predicate", predicate);
+      w__.write("attributes", attributes);
+    }
+
+    bool
+    TrexObservation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeline")
+      {
+        r__.read(timeline);
+        return true;
+      }
+
+      if (name__ == "predicate")
+      {
+        r__.read(predicate);
+        return true;
+      }
+
+      if (name__ == "attributes")
+      {
+        r__.read(attributes);
+        return true;
+      }
+
+      return false;
+    }
+
     TrexCommand::TrexCommand(void)
     {
       m_header.mgid = 652;
@@ -22562,6 +33940,38 @@ namespace DUNE
       IMC::toJSON(os__, "goal_xml", goal_xml, nindent__);
     }
 
+    void
+    TrexCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("command", command);
+      w__.write("goal_id", goal_id);
+      w__.write("goal_xml", goal_xml);
+    }
+
+    bool
+    TrexCommand::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "command")
+      {
+        r__.read(command);
+        return true;
+      }
+
+      if (name__ == "goal_id")
+      {
+        r__.read(goal_id);
+        return true;
+      }
+
+      if (name__ == "goal_xml")
+      {
+        r__.read(goal_xml);
+        return true;
+      }
+
+      return false;
+    }
+
     TrexAttribute::TrexAttribute(void)
     {
       m_header.mgid = 656;
@@ -22630,10 +34040,49 @@ namespace DUNE
     void
     TrexAttribute::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
     {
-      IMC::toJSON(os__, "name", name, nindent__);
-      IMC::toJSON(os__, "attr_type", attr_type, nindent__);
-      IMC::toJSON(os__, "min", min, nindent__);
-      IMC::toJSON(os__, "max", max, nindent__);
+      IMC::toJSON(os__, "name", name, nindent__);
+      IMC::toJSON(os__, "attr_type", attr_type, nindent__);
+      IMC::toJSON(os__, "min", min, nindent__);
+      IMC::toJSON(os__, "max", max, nindent__);
+    }
+
+    void
+    TrexAttribute::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("attr_type", attr_type);
+      w__.write("min", min);
+      w__.write("max", max);
+    }
+
+    bool
+    TrexAttribute::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "attr_type")
+      {
+        r__.read(attr_type);
+        return true;
+      }
+
+      if (name__ == "min")
+      {
+        r__.read(min);
+        return true;
+      }
+
+      if (name__ == "max")
+      {
+        r__.read(max);
+        return true;
+      }
+
+      return false;
     }
 
     TrexToken::TrexToken(void)
@@ -22705,6 +34154,38 @@ namespace DUNE
       attributes.toJSON(os__, "attributes", nindent__);
     }
 
+    void
+    TrexToken::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeline", timeline);
+      w__.write("predicate", predicate);
+      attributes.toJSON(w__, "attributes");
+    }
+
+    bool
+    TrexToken::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeline")
+      {
+        r__.read(timeline);
+        return true;
+      }
+
+      if (name__ == "predicate")
+      {
+        r__.read(predicate);
+        return true;
+      }
+
+      if (name__ == "attributes")
+      {
+        attributes.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     TrexToken::setTimeStampNested(double value__)
     {
@@ -22804,6 +34285,38 @@ namespace DUNE
       token.toJSON(os__, "token", nindent__);
     }
 
+    void
+    TrexOperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("goal_id", goal_id);
+      token.toJSON(w__, "token");
+    }
+
+    bool
+    TrexOperation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "goal_id")
+      {
+        r__.read(goal_id);
+        return true;
+      }
+
+      if (name__ == "token")
+      {
+        token.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     TrexOperation::setTimeStampNested(double value__)
     {
@@ -22912,6 +34425,31 @@ namespace DUNE
       tokens.toJSON(os__, "tokens", nindent__);
     }
 
+    void
+    TrexPlan::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("reactor", reactor);
+      tokens.toJSON(w__, "tokens");
+    }
+
+    bool
+    TrexPlan::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "reactor")
+      {
+        r__.read(reactor);
+        return true;
+      }
+
+      if (name__ == "tokens")
+      {
+        tokens.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     TrexPlan::setTimeStampNested(double value__)
     {
@@ -23004,6 +34542,31 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    Event::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("topic", topic);
+      w__.write("data", data);
+    }
+
+    bool
+    Event::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "topic")
+      {
+        r__.read(topic);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     CompressedImage::CompressedImage(void)
     {
       m_header.mgid = 702;
@@ -23066,6 +34629,31 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    CompressedImage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("frameid", frameid);
+      w__.write("data", data);
+    }
+
+    bool
+    CompressedImage::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "frameid")
+      {
+        r__.read(frameid);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     ImageTxSettings::ImageTxSettings(void)
     {
       m_header.mgid = 703;
@@ -23101,34 +34689,39 @@ namespace DUNE
     uint8_t*
     ImageTxSettings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(fps, ptr__);
-      ptr__ += IMC::serialize(quality, ptr__);
-      ptr__ += IMC::serialize(reps, ptr__);
-      ptr__ += IMC::serialize(tsize, ptr__);
-      return ptr__;
+      IMC::serialize(fps, bfr__ + 0);
+      IMC::serialize(quality, bfr__ + 1);
+      IMC::serialize(reps, bfr__ + 2);
+      IMC::serialize(tsize, bfr__ + 3);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     ImageTxSettings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(fps, bfr__ + 0);
+      Utils::ByteCopy::copy(quality, bfr__ + 1);
+      Utils::ByteCopy::copy(reps, bfr__ + 2);
+      Utils::ByteCopy::copy(tsize, bfr__ + 3);
+      return c_fields_size;
     }
 
     uint16_t
     ImageTxSettings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(fps, bfr__ + 0);
+      Utils::ByteCopy::rcopy(quality, bfr__ + 1);
+      Utils::ByteCopy::rcopy(reps, bfr__ + 2);
+      Utils::ByteCopy::rcopy(tsize, bfr__ + 3);
+      return c_fields_size;
     }
 
     void
@@ -23140,6 +34733,45 @@ namespace DUNE
       IMC::toJSON(os__, "tsize", tsize, nindent__);
     }
 
+    void
+    ImageTxSettings::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("fps", fps);
+      w__.write("quality", quality);
+      w__.write("reps", reps);
+      w__.write("tsize", tsize);
+    }
+
+    bool
+    ImageTxSettings::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "fps")
+      {
+        r__.read(fps);
+        return true;
+      }
+
+      if (name__ == "quality")
+      {
+        r__.read(quality);
+        return true;
+      }
+
+      if (name__ == "reps")
+      {
+        r__.read(reps);
+        return true;
+      }
+
+      if (name__ == "tsize")
+      {
+        r__.read(tsize);
+        return true;
+      }
+
+      return false;
+    }
+
     RemoteState::RemoteState(void)
     {
       m_header.mgid = 750;
@@ -23179,37 +34811,42 @@ namespace DUNE
     uint8_t*
     RemoteState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 4);
+      IMC::serialize(depth, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 9);
+      IMC::serialize(psi, bfr__ + 13);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     RemoteState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 4);
+      Utils::ByteCopy::copy(depth, bfr__ + 8);
+      Utils::ByteCopy::copy(speed, bfr__ + 9);
+      Utils::ByteCopy::copy(psi, bfr__ + 13);
+      return c_fields_size;
     }
 
     uint16_t
     RemoteState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(lat, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 4);
+      Utils::ByteCopy::rcopy(depth, bfr__ + 8);
+      Utils::ByteCopy::rcopy(speed, bfr__ + 9);
+      Utils::ByteCopy::rcopy(psi, bfr__ + 13);
+      return c_fields_size;
     }
 
     void
@@ -23222,6 +34859,52 @@ namespace DUNE
       IMC::toJSON(os__, "psi", psi, nindent__);
     }
 
+    void
+    RemoteState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("depth", depth);
+      w__.write("speed", speed);
+      w__.write("psi", psi);
+    }
+
+    bool
+    RemoteState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "speed")
+      {
+        r__.read(speed);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      return false;
+    }
+
     Target::Target(void)
     {
       m_header.mgid = 800;
@@ -23316,6 +34999,66 @@ namespace DUNE
       IMC::toJSON(os__, "sog", sog, nindent__);
     }
 
+    void
+    Target::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("label", label);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+      w__.write("cog", cog);
+      w__.write("sog", sog);
+    }
+
+    bool
+    Target::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "label")
+      {
+        r__.read(label);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "cog")
+      {
+        r__.read(cog);
+        return true;
+      }
+
+      if (name__ == "sog")
+      {
+        r__.read(sog);
+        return true;
+      }
+
+      return false;
+    }
+
     EntityParameter::EntityParameter(void)
     {
       m_header.mgid = 801;
@@ -23378,6 +35121,31 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    EntityParameter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("value", value);
+    }
+
+    bool
+    EntityParameter::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     EntityParameters::EntityParameters(void)
     {
       m_header.mgid = 802;
@@ -23441,6 +35209,31 @@ namespace DUNE
       params.toJSON(os__, "params", nindent__);
     }
 
+    void
+    EntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      params.toJSON(w__, "params");
+    }
+
+    bool
+    EntityParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "params")
+      {
+        params.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     EntityParameters::setTimeStampNested(double value__)
     {
@@ -23539,6 +35332,38 @@ namespace DUNE
       IMC::toJSON(os__, "scope", scope, nindent__);
     }
 
+    void
+    QueryEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("visibility", visibility);
+      w__.write("scope", scope);
+    }
+
+    bool
+    QueryEntityParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "visibility")
+      {
+        r__.read(visibility);
+        return true;
+      }
+
+      if (name__ == "scope")
+      {
+        r__.read(scope);
+        return true;
+      }
+
+      return false;
+    }
+
     SetEntityParameters::SetEntityParameters(void)
     {
       m_header.mgid = 804;
@@ -23602,6 +35427,31 @@ namespace DUNE
       params.toJSON(os__, "params", nindent__);
     }
 
+    void
+    SetEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      params.toJSON(w__, "params");
+    }
+
+    bool
+    SetEntityParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "params")
+      {
+        params.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     SetEntityParameters::setTimeStampNested(double value__)
     {
@@ -23688,6 +35538,24 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    SaveEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+    }
+
+    bool
+    SaveEntityParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      return false;
+    }
+
     CreateSession::CreateSession(void)
     {
       m_header.mgid = 806;
@@ -23717,25 +35585,30 @@ namespace DUNE
     uint8_t*
     CreateSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timeout, ptr__);
-      return ptr__;
+      IMC::serialize(timeout, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     CreateSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(timeout, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     CreateSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(timeout, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -23744,6 +35617,24 @@ namespace DUNE
       IMC::toJSON(os__, "timeout", timeout, nindent__);
     }
 
+    void
+    CreateSession::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timeout", timeout);
+    }
+
+    bool
+    CreateSession::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      return false;
+    }
+
     CloseSession::CloseSession(void)
     {
       m_header.mgid = 807;
@@ -23773,25 +35664,30 @@ namespace DUNE
     uint8_t*
     CloseSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     CloseSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(sessid, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     CloseSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(sessid, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -23800,6 +35696,24 @@ namespace DUNE
       IMC::toJSON(os__, "sessid", sessid, nindent__);
     }
 
+    void
+    CloseSession::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sessid", sessid);
+    }
+
+    bool
+    CloseSession::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sessid")
+      {
+        r__.read(sessid);
+        return true;
+      }
+
+      return false;
+    }
+
     SessionSubscription::SessionSubscription(void)
     {
       m_header.mgid = 808;
@@ -23862,6 +35776,31 @@ namespace DUNE
       IMC::toJSON(os__, "messages", messages, nindent__);
     }
 
+    void
+    SessionSubscription::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sessid", sessid);
+      w__.write("messages", messages);
+    }
+
+    bool
+    SessionSubscription::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sessid")
+      {
+        r__.read(sessid);
+        return true;
+      }
+
+      if (name__ == "messages")
+      {
+        r__.read(messages);
+        return true;
+      }
+
+      return false;
+    }
+
     SessionKeepAlive::SessionKeepAlive(void)
     {
       m_header.mgid = 809;
@@ -23891,25 +35830,30 @@ namespace DUNE
     uint8_t*
     SessionKeepAlive::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SessionKeepAlive::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(sessid, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     SessionKeepAlive::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(sessid, bfr__ + 0);
+      return c_fields_size;
     }
 
     void
@@ -23918,6 +35862,24 @@ namespace DUNE
       IMC::toJSON(os__, "sessid", sessid, nindent__);
     }
 
+    void
+    SessionKeepAlive::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sessid", sessid);
+    }
+
+    bool
+    SessionKeepAlive::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sessid")
+      {
+        r__.read(sessid);
+        return true;
+      }
+
+      return false;
+    }
+
     SessionStatus::SessionStatus(void)
     {
       m_header.mgid = 810;
@@ -23949,28 +35911,33 @@ namespace DUNE
     uint8_t*
     SessionStatus::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      ptr__ += IMC::serialize(status, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      IMC::serialize(status, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SessionStatus::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(sessid, bfr__ + 0);
+      Utils::ByteCopy::copy(status, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     SessionStatus::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(sessid, bfr__ + 0);
+      Utils::ByteCopy::rcopy(status, bfr__ + 4);
+      return c_fields_size;
     }
 
     void
@@ -23980,6 +35947,31 @@ namespace DUNE
       IMC::toJSON(os__, "status", status, nindent__);
     }
 
+    void
+    SessionStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sessid", sessid);
+      w__.write("status", status);
+    }
+
+    bool
+    SessionStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sessid")
+      {
+        r__.read(sessid);
+        return true;
+      }
+
+      if (name__ == "status")
+      {
+        r__.read(status);
+        return true;
+      }
+
+      return false;
+    }
+
     PushEntityParameters::PushEntityParameters(void)
     {
       m_header.mgid = 811;
@@ -24036,6 +36028,24 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    PushEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+    }
+
+    bool
+    PushEntityParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      return false;
+    }
+
     PopEntityParameters::PopEntityParameters(void)
     {
       m_header.mgid = 812;
@@ -24092,6 +36102,24 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    PopEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+    }
+
+    bool
+    PopEntityParameters::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      return false;
+    }
+
     IoEvent::IoEvent(void)
     {
       m_header.mgid = 813;
@@ -24154,6 +36182,31 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    IoEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("error", error);
+    }
+
+    bool
+    IoEvent::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "error")
+      {
+        r__.read(error);
+        return true;
+      }
+
+      return false;
+    }
+
     UamTxFrame::UamTxFrame(void)
     {
       m_header.mgid = 814;
@@ -24228,6 +36281,45 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    UamTxFrame::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("seq", seq);
+      w__.write("sys_dst", sys_dst);
+      w__.write("flags", flags);
+      w__.write("data", data);
+    }
+
+    bool
+    UamTxFrame::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "sys_dst")
+      {
+        r__.read(sys_dst);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     UamRxFrame::UamRxFrame(void)
     {
       m_header.mgid = 815;
@@ -24302,6 +36394,45 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    UamRxFrame::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("sys_src", sys_src);
+      w__.write("sys_dst", sys_dst);
+      w__.write("flags", flags);
+      w__.write("data", data);
+    }
+
+    bool
+    UamRxFrame::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "sys_src")
+      {
+        r__.read(sys_src);
+        return true;
+      }
+
+      if (name__ == "sys_dst")
+      {
+        r__.read(sys_dst);
+        return true;
+      }
+
+      if (name__ == "flags")
+      {
+        r__.read(flags);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     UamTxStatus::UamTxStatus(void)
     {
       m_header.mgid = 816;
@@ -24382,6 +36513,38 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    UamTxStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("seq", seq);
+      w__.write("value", value);
+      w__.write("error", error);
+    }
+
+    bool
+    UamTxStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "error")
+      {
+        r__.read(error);
+        return true;
+      }
+
+      return false;
+    }
+
     UamRxRange::UamRxRange(void)
     {
       m_header.mgid = 817;
@@ -24462,6 +36625,38 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    UamRxRange::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("seq", seq);
+      w__.write("sys", sys);
+      w__.write("value", value);
+    }
+
+    bool
+    UamRxRange::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "sys")
+      {
+        r__.read(sys);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     UamTxRange::UamTxRange(void)
     {
       m_header.mgid = 818;
@@ -24530,6 +36725,38 @@ namespace DUNE
       IMC::toJSON(os__, "timeout", timeout, nindent__);
     }
 
+    void
+    UamTxRange::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("seq", seq);
+      w__.write("sys_dst", sys_dst);
+      w__.write("timeout", timeout);
+    }
+
+    bool
+    UamTxRange::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "seq")
+      {
+        r__.read(seq);
+        return true;
+      }
+
+      if (name__ == "sys_dst")
+      {
+        r__.read(sys_dst);
+        return true;
+      }
+
+      if (name__ == "timeout")
+      {
+        r__.read(timeout);
+        return true;
+      }
+
+      return false;
+    }
+
     FormCtrlParam::FormCtrlParam(void)
     {
       m_header.mgid = 820;
@@ -24569,40 +36796,42 @@ namespace DUNE
     uint8_t*
     FormCtrlParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(longain, ptr__);
-      ptr__ += IMC::serialize(latgain, ptr__);
-      ptr__ += IMC::serialize(bondthick, ptr__);
-      ptr__ += IMC::serialize(leadgain, ptr__);
-      ptr__ += IMC::serialize(deconflgain, ptr__);
-      return ptr__;
+      IMC::serialize(action, bfr__ + 0);
+      IMC::serialize(longain, bfr__ + 1);
+      IMC::serialize(latgain, bfr__ + 5);
+      IMC::serialize(bondthick, bfr__ + 9);
+      IMC::serialize(leadgain, bfr__ + 13);
+      IMC::serialize(deconflgain, bfr__ + 17);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FormCtrlParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(longain, bfr__, size__);
-      bfr__ += IMC::deserialize(latgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::deserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(action, bfr__ + 0);
+      Utils::ByteCopy::copy(longain, bfr__ + 1);
+      Utils::ByteCopy::copy(latgain, bfr__ + 5);
+      Utils::ByteCopy::copy(bondthick, bfr__ + 9);
+      Utils::ByteCopy::copy(leadgain, bfr__ + 13);
+      Utils::ByteCopy::copy(deconflgain, bfr__ + 17);
+      return c_fields_size;
     }
 
     uint16_t
     FormCtrlParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      std::memcpy(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 1, bfr__ + 1, 5);
+      return FormCtrlParam::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -24616,6 +36845,59 @@ namespace DUNE
       IMC::toJSON(os__, "deconflgain", deconflgain, nindent__);
     }
 
+    void
+    FormCtrlParam::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("action", action);
+      w__.write("longain", longain);
+      w__.write("latgain", latgain);
+      w__.write("bondthick", bondthick);
+      w__.write("leadgain", leadgain);
+      w__.write("deconflgain", deconflgain);
+    }
+
+    bool
+    FormCtrlParam::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "action")
+      {
+        r__.read(action);
+        return true;
+      }
+
+      if (name__ == "longain")
+      {
+        r__.read(longain);
+        return true;
+      }
+
+      if (name__ == "latgain")
+      {
+        r__.read(latgain);
+        return true;
+      }
+
+      if (name__ == "bondthick")
+      {
+        r__.read(bondthick);
+        return true;
+      }
+
+      if (name__ == "leadgain")
+      {
+        r__.read(leadgain);
+        return true;
+      }
+
+      if (name__ == "deconflgain")
+      {
+        r__.read(deconflgain);
+        return true;
+      }
+
+      return false;
+    }
+
     FormationEval::FormationEval(void)
     {
       m_header.mgid = 821;
@@ -24649,31 +36931,36 @@ namespace DUNE
     uint8_t*
     FormationEval::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(err_mean, ptr__);
-      ptr__ += IMC::serialize(dist_min_abs, ptr__);
-      ptr__ += IMC::serialize(dist_min_mean, ptr__);
-      return ptr__;
+      IMC::serialize(err_mean, bfr__ + 0);
+      IMC::serialize(dist_min_abs, bfr__ + 4);
+      IMC::serialize(dist_min_mean, bfr__ + 8);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FormationEval::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(err_mean, bfr__ + 0);
+      Utils::ByteCopy::copy(dist_min_abs, bfr__ + 4);
+      Utils::ByteCopy::copy(dist_min_mean, bfr__ + 8);
+      return c_fields_size;
     }
 
     uint16_t
     FormationEval::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(err_mean, bfr__ + 0);
+      Utils::ByteCopy::rcopy(dist_min_abs, bfr__ + 4);
+      Utils::ByteCopy::rcopy(dist_min_mean, bfr__ + 8);
+      return c_fields_size;
     }
 
     void
@@ -24684,6 +36971,38 @@ namespace DUNE
       IMC::toJSON(os__, "dist_min_mean", dist_min_mean, nindent__);
     }
 
+    void
+    FormationEval::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("err_mean", err_mean);
+      w__.write("dist_min_abs", dist_min_abs);
+      w__.write("dist_min_mean", dist_min_mean);
+    }
+
+    bool
+    FormationEval::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "err_mean")
+      {
+        r__.read(err_mean);
+        return true;
+      }
+
+      if (name__ == "dist_min_abs")
+      {
+        r__.read(dist_min_abs);
+        return true;
+      }
+
+      if (name__ == "dist_min_mean")
+      {
+        r__.read(dist_min_mean);
+        return true;
+      }
+
+      return false;
+    }
+
     FormationControlParams::FormationControlParams(void)
     {
       m_header.mgid = 822;
@@ -24733,55 +37052,52 @@ namespace DUNE
     uint8_t*
     FormationControlParams::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(lon_gain, ptr__);
-      ptr__ += IMC::serialize(lat_gain, ptr__);
-      ptr__ += IMC::serialize(bond_thick, ptr__);
-      ptr__ += IMC::serialize(lead_gain, ptr__);
-      ptr__ += IMC::serialize(deconfl_gain, ptr__);
-      ptr__ += IMC::serialize(accel_switch_gain, ptr__);
-      ptr__ += IMC::serialize(safe_dist, ptr__);
-      ptr__ += IMC::serialize(deconflict_offset, ptr__);
-      ptr__ += IMC::serialize(accel_safe_margin, ptr__);
-      ptr__ += IMC::serialize(accel_lim_x, ptr__);
-      return ptr__;
+      IMC::serialize(action, bfr__ + 0);
+      IMC::serialize(lon_gain, bfr__ + 1);
+      IMC::serialize(lat_gain, bfr__ + 5);
+      IMC::serialize(bond_thick, bfr__ + 9);
+      IMC::serialize(lead_gain, bfr__ + 13);
+      IMC::serialize(deconfl_gain, bfr__ + 17);
+      IMC::serialize(accel_switch_gain, bfr__ + 21);
+      IMC::serialize(safe_dist, bfr__ + 25);
+      IMC::serialize(deconflict_offset, bfr__ + 29);
+      IMC::serialize(accel_safe_margin, bfr__ + 33);
+      IMC::serialize(accel_lim_x, bfr__ + 37);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     FormationControlParams::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::deserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(action, bfr__ + 0);
+      Utils::ByteCopy::copy(lon_gain, bfr__ + 1);
+      Utils::ByteCopy::copy(lat_gain, bfr__ + 5);
+      Utils::ByteCopy::copy(bond_thick, bfr__ + 9);
+      Utils::ByteCopy::copy(lead_gain, bfr__ + 13);
+      Utils::ByteCopy::copy(deconfl_gain, bfr__ + 17);
+      Utils::ByteCopy::copy(accel_switch_gain, bfr__ + 21);
+      Utils::ByteCopy::copy(safe_dist, bfr__ + 25);
+      Utils::ByteCopy::copy(deconflict_offset, bfr__ + 29);
+      Utils::ByteCopy::copy(accel_safe_margin, bfr__ + 33);
+      Utils::ByteCopy::copy(accel_lim_x, bfr__ + 37);
+      return c_fields_size;
     }
 
     uint16_t
     FormationControlParams::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      std::memcpy(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 1, bfr__ + 1, 10);
+      return FormationControlParams::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -24800,6 +37116,94 @@ namespace DUNE
       IMC::toJSON(os__, "accel_lim_x", accel_lim_x, nindent__);
     }
 
+    void
+    FormationControlParams::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("action", action);
+      w__.write("lon_gain", lon_gain);
+      w__.write("lat_gain", lat_gain);
+      w__.write("bond_thick", bond_thick);
+      w__.write("lead_gain", lead_gain);
+      w__.write("deconfl_gain", deconfl_gain);
+      w__.write("accel_switch_gain", accel_switch_gain);
+      w__.write("safe_dist", safe_dist);
+      w__.write("deconflict_offset", deconflict_offset);
+      w__.write("accel_safe_margin", accel_safe_margin);
+      w__.write("accel_lim_x", accel_lim_x);
+    }
+
+    bool
+    FormationControlParams::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "action")
+      {
+        r__.read(action);
+        return true;
+      }
+
+      if (name__ == "lon_gain")
+      {
+        r__.read(lon_gain);
+        return true;
+      }
+
+      if (name__ == "lat_gain")
+      {
+        r__.read(lat_gain);
+        return true;
+      }
+
+      if (name__ == "bond_thick")
+      {
+        r__.read(bond_thick);
+        return true;
+      }
+
+      if (name__ == "lead_gain")
+      {
+        r__.read(lead_gain);
+        return true;
+      }
+
+      if (name__ == "deconfl_gain")
+      {
+        r__.read(deconfl_gain);
+        return true;
+      }
+
+      if (name__ == "accel_switch_gain")
+      {
+        r__.read(accel_switch_gain);
+        return true;
+      }
+
+      if (name__ == "safe_dist")
+      {
+        r__.read(safe_dist);
+        return true;
+      }
+
+      if (name__ == "deconflict_offset")
+      {
+        r__.read(deconflict_offset);
+        return true;
+      }
+
+      if (name__ == "accel_safe_margin")
+      {
+        r__.read(accel_safe_margin);
+        return true;
+      }
+
+      if (name__ == "accel_lim_x")
+      {
+        r__.read(accel_lim_x);
+        return true;
+      }
+
+      return false;
+    }
+
     FormationEvaluation::FormationEvaluation(void)
     {
       m_header.mgid = 823;
@@ -24899,6 +37303,73 @@ namespace DUNE
       controlparams.toJSON(os__, "controlparams", nindent__);
     }
 
+    void
+    FormationEvaluation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("op", op);
+      w__.write("err_mean", err_mean);
+      w__.write("dist_min_abs", dist_min_abs);
+      w__.write("dist_min_mean", dist_min_mean);
+      w__.write("roll_rate_mean", roll_rate_mean);
+      w__.write("time", time);
+      controlparams.toJSON(w__, "controlparams");
+    }
+
+    bool
+    FormationEvaluation::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "err_mean")
+      {
+        r__.read(err_mean);
+        return true;
+      }
+
+      if (name__ == "dist_min_abs")
+      {
+        r__.read(dist_min_abs);
+        return true;
+      }
+
+      if (name__ == "dist_min_mean")
+      {
+        r__.read(dist_min_mean);
+        return true;
+      }
+
+      if (name__ == "roll_rate_mean")
+      {
+        r__.read(roll_rate_mean);
+        return true;
+      }
+
+      if (name__ == "time")
+      {
+        r__.read(time);
+        return true;
+      }
+
+      if (name__ == "controlparams")
+      {
+        controlparams.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     FormationEvaluation::setTimeStampNested(double value__)
     {
@@ -24979,34 +37450,39 @@ namespace DUNE
     uint8_t*
     SoiWaypoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(eta, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 4);
+      IMC::serialize(eta, bfr__ + 8);
+      IMC::serialize(duration, bfr__ + 12);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SoiWaypoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(eta, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(lat, bfr__ + 0);
+      Utils::ByteCopy::copy(lon, bfr__ + 4);
+      Utils::ByteCopy::copy(eta, bfr__ + 8);
+      Utils::ByteCopy::copy(duration, bfr__ + 12);
+      return c_fields_size;
     }
 
     uint16_t
     SoiWaypoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(eta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(lat, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 4);
+      Utils::ByteCopy::rcopy(eta, bfr__ + 8);
+      Utils::ByteCopy::rcopy(duration, bfr__ + 12);
+      return c_fields_size;
     }
 
     void
@@ -25018,6 +37494,45 @@ namespace DUNE
       IMC::toJSON(os__, "duration", duration, nindent__);
     }
 
+    void
+    SoiWaypoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("eta", eta);
+      w__.write("duration", duration);
+    }
+
+    bool
+    SoiWaypoint::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "eta")
+      {
+        r__.read(eta);
+        return true;
+      }
+
+      if (name__ == "duration")
+      {
+        r__.read(duration);
+        return true;
+      }
+
+      return false;
+    }
+
     SoiPlan::SoiPlan(void)
     {
       m_header.mgid = 851;
@@ -25081,6 +37596,31 @@ namespace DUNE
       waypoints.toJSON(os__, "waypoints", nindent__);
     }
 
+    void
+    SoiPlan::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("plan_id", plan_id);
+      waypoints.toJSON(w__, "waypoints");
+    }
+
+    bool
+    SoiPlan::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "waypoints")
+      {
+        waypoints.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     SoiPlan::setTimeStampNested(double value__)
     {
@@ -25192,6 +37732,52 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    SoiCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("type", type);
+      w__.write("command", command);
+      w__.write("settings", settings);
+      plan.toJSON(w__, "plan");
+      w__.write("info", info);
+    }
+
+    bool
+    SoiCommand::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      if (name__ == "command")
+      {
+        r__.read(command);
+        return true;
+      }
+
+      if (name__ == "settings")
+      {
+        r__.read(settings);
+        return true;
+      }
+
+      if (name__ == "plan")
+      {
+        plan.fromJSON(r__);
+        return true;
+      }
+
+      if (name__ == "info")
+      {
+        r__.read(info);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     SoiCommand::setTimeStampNested(double value__)
     {
@@ -25272,34 +37858,39 @@ namespace DUNE
     uint8_t*
     SoiState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      ptr__ += IMC::serialize(plan_id, ptr__);
-      ptr__ += IMC::serialize(wpt_id, ptr__);
-      ptr__ += IMC::serialize(settings_chk, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      IMC::serialize(plan_id, bfr__ + 1);
+      IMC::serialize(wpt_id, bfr__ + 3);
+      IMC::serialize(settings_chk, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SoiState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      bfr__ += IMC::deserialize(plan_id, bfr__, size__);
-      bfr__ += IMC::deserialize(wpt_id, bfr__, size__);
-      bfr__ += IMC::deserialize(settings_chk, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(state, bfr__ + 0);
+      Utils::ByteCopy::copy(plan_id, bfr__ + 1);
+      Utils::ByteCopy::copy(wpt_id, bfr__ + 3);
+      Utils::ByteCopy::copy(settings_chk, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
-    SoiState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(plan_id, bfr__, size__);
-      bfr__ += IMC::deserialize(wpt_id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(settings_chk, bfr__, size__);
-      return bfr__ - start__;
+    SoiState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(state, bfr__ + 0);
+      Utils::ByteCopy::rcopy(plan_id, bfr__ + 1);
+      Utils::ByteCopy::rcopy(wpt_id, bfr__ + 3);
+      Utils::ByteCopy::rcopy(settings_chk, bfr__ + 4);
+      return c_fields_size;
     }
 
     void
@@ -25311,6 +37902,45 @@ namespace DUNE
       IMC::toJSON(os__, "settings_chk", settings_chk, nindent__);
     }
 
+    void
+    SoiState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("state", state);
+      w__.write("plan_id", plan_id);
+      w__.write("wpt_id", wpt_id);
+      w__.write("settings_chk", settings_chk);
+    }
+
+    bool
+    SoiState::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "state")
+      {
+        r__.read(state);
+        return true;
+      }
+
+      if (name__ == "plan_id")
+      {
+        r__.read(plan_id);
+        return true;
+      }
+
+      if (name__ == "wpt_id")
+      {
+        r__.read(wpt_id);
+        return true;
+      }
+
+      if (name__ == "settings_chk")
+      {
+        r__.read(settings_chk);
+        return true;
+      }
+
+      return false;
+    }
+
     MessagePart::MessagePart(void)
     {
       m_header.mgid = 877;
@@ -25385,6 +38015,45 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    MessagePart::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("uid", uid);
+      w__.write("frag_number", frag_number);
+      w__.write("num_frags", num_frags);
+      w__.write("data", data);
+    }
+
+    bool
+    MessagePart::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "uid")
+      {
+        r__.read(uid);
+        return true;
+      }
+
+      if (name__ == "frag_number")
+      {
+        r__.read(frag_number);
+        return true;
+      }
+
+      if (name__ == "num_frags")
+      {
+        r__.read(num_frags);
+        return true;
+      }
+
+      if (name__ == "data")
+      {
+        r__.read(data);
+        return true;
+      }
+
+      return false;
+    }
+
     NeptusBlob::NeptusBlob(void)
     {
       m_header.mgid = 888;
@@ -25447,6 +38116,31 @@ namespace DUNE
       IMC::toJSON(os__, "content", content, nindent__);
     }
 
+    void
+    NeptusBlob::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("content_type", content_type);
+      w__.write("content", content);
+    }
+
+    bool
+    NeptusBlob::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "content_type")
+      {
+        r__.read(content_type);
+        return true;
+      }
+
+      if (name__ == "content")
+      {
+        r__.read(content);
+        return true;
+      }
+
+      return false;
+    }
+
     Aborted::Aborted(void)
     {
       m_header.mgid = 889;
@@ -25519,31 +38213,36 @@ namespace DUNE
     uint8_t*
     UsblAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(bearing, ptr__);
-      ptr__ += IMC::serialize(elevation, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(bearing, bfr__ + 2);
+      IMC::serialize(elevation, bfr__ + 6);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     UsblAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(bearing, bfr__, size__);
-      bfr__ += IMC::deserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(target, bfr__ + 0);
+      Utils::ByteCopy::copy(bearing, bfr__ + 2);
+      Utils::ByteCopy::copy(elevation, bfr__ + 6);
+      return c_fields_size;
     }
 
     uint16_t
     UsblAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bearing, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(target, bfr__ + 0);
+      Utils::ByteCopy::rcopy(bearing, bfr__ + 2);
+      Utils::ByteCopy::rcopy(elevation, bfr__ + 6);
+      return c_fields_size;
     }
 
     void
@@ -25554,6 +38253,38 @@ namespace DUNE
       IMC::toJSON(os__, "elevation", elevation, nindent__);
     }
 
+    void
+    UsblAngles::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("bearing", bearing);
+      w__.write("elevation", elevation);
+    }
+
+    bool
+    UsblAngles::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "elevation")
+      {
+        r__.read(elevation);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblPosition::UsblPosition(void)
     {
       m_header.mgid = 891;
@@ -25589,34 +38320,39 @@ namespace DUNE
     uint8_t*
     UsblPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 2);
+      IMC::serialize(y, bfr__ + 6);
+      IMC::serialize(z, bfr__ + 10);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     UsblPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(target, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 2);
+      Utils::ByteCopy::copy(y, bfr__ + 6);
+      Utils::ByteCopy::copy(z, bfr__ + 10);
+      return c_fields_size;
     }
 
     uint16_t
     UsblPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(target, bfr__ + 0);
+      Utils::ByteCopy::rcopy(x, bfr__ + 2);
+      Utils::ByteCopy::rcopy(y, bfr__ + 6);
+      Utils::ByteCopy::rcopy(z, bfr__ + 10);
+      return c_fields_size;
     }
 
     void
@@ -25628,6 +38364,45 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    UsblPosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    UsblPosition::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblFix::UsblFix(void)
     {
       m_header.mgid = 892;
@@ -25667,37 +38442,42 @@ namespace DUNE
     uint8_t*
     UsblFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 2);
+      IMC::serialize(lon, bfr__ + 10);
+      IMC::serialize(z_units, bfr__ + 18);
+      IMC::serialize(z, bfr__ + 19);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     UsblFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(target, bfr__ + 0);
+      Utils::ByteCopy::copy(lat, bfr__ + 2);
+      Utils::ByteCopy::copy(lon, bfr__ + 10);
+      Utils::ByteCopy::copy(z_units, bfr__ + 18);
+      Utils::ByteCopy::copy(z, bfr__ + 19);
+      return c_fields_size;
     }
 
     uint16_t
     UsblFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(target, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lat, bfr__ + 2);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 10);
+      Utils::ByteCopy::rcopy(z_units, bfr__ + 18);
+      Utils::ByteCopy::rcopy(z, bfr__ + 19);
+      return c_fields_size;
     }
 
     void
@@ -25710,6 +38490,52 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    UsblFix::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z_units", z_units);
+      w__.write("z", z);
+    }
+
+    bool
+    UsblFix::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     ParametersXml::ParametersXml(void)
     {
       m_header.mgid = 893;
@@ -25772,6 +38598,31 @@ namespace DUNE
       IMC::toJSON(os__, "config", config, nindent__);
     }
 
+    void
+    ParametersXml::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("locale", locale);
+      w__.write("config", config);
+    }
+
+    bool
+    ParametersXml::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "locale")
+      {
+        r__.read(locale);
+        return true;
+      }
+
+      if (name__ == "config")
+      {
+        r__.read(config);
+        return true;
+      }
+
+      return false;
+    }
+
     GetParametersXml::GetParametersXml(void)
     {
       m_header.mgid = 894;
@@ -25844,31 +38695,36 @@ namespace DUNE
     uint8_t*
     SetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::serialize(camid, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 3);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(camid, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 1);
+      Utils::ByteCopy::copy(y, bfr__ + 3);
+      return c_fields_size;
     }
 
     uint16_t
     SetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(camid, bfr__ + 0);
+      Utils::ByteCopy::rcopy(x, bfr__ + 1);
+      Utils::ByteCopy::rcopy(y, bfr__ + 3);
+      return c_fields_size;
     }
 
     void
@@ -25879,6 +38735,38 @@ namespace DUNE
       IMC::toJSON(os__, "y", y, nindent__);
     }
 
+    void
+    SetImageCoords::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("camid", camid);
+      w__.write("x", x);
+      w__.write("y", y);
+    }
+
+    bool
+    SetImageCoords::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "camid")
+      {
+        r__.read(camid);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      return false;
+    }
+
     GetImageCoords::GetImageCoords(void)
     {
       m_header.mgid = 896;
@@ -25912,39 +38800,76 @@ namespace DUNE
     uint8_t*
     GetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::serialize(camid, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 3);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(camid, bfr__ + 0);
+      Utils::ByteCopy::copy(x, bfr__ + 1);
+      Utils::ByteCopy::copy(y, bfr__ + 3);
+      return c_fields_size;
     }
 
     uint16_t
     GetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(camid, bfr__ + 0);
+      Utils::ByteCopy::rcopy(x, bfr__ + 1);
+      Utils::ByteCopy::rcopy(y, bfr__ + 3);
+      return c_fields_size;
     }
 
     void
     GetImageCoords::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
     {
-      IMC::toJSON(os__, "camid", camid, nindent__);
-      IMC::toJSON(os__, "x", x, nindent__);
-      IMC::toJSON(os__, "y", y, nindent__);
+      IMC::toJSON(os__, "camid", camid, nindent__);
+      IMC::toJSON(os__, "x", x, nindent__);
+      IMC::toJSON(os__, "y", y, nindent__);
+    }
+
+    void
+    GetImageCoords::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("camid", camid);
+      w__.write("x", x);
+      w__.write("y", y);
+    }
+
+    bool
+    GetImageCoords::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "camid")
+      {
+        r__.read(camid);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      return false;
     }
 
     GetWorldCoordinates::GetWorldCoordinates(void)
@@ -25986,40 +38911,45 @@ namespace DUNE
     uint8_t*
     GetWorldCoordinates::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(tracking, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(tracking, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 1);
+      IMC::serialize(lon, bfr__ + 9);
+      IMC::serialize(x, bfr__ + 17);
+      IMC::serialize(y, bfr__ + 21);
+      IMC::serialize(z, bfr__ + 25);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     GetWorldCoordinates::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(tracking, bfr__ + 0);
+      Utils::ByteCopy::copy(lat, bfr__ + 1);
+      Utils::ByteCopy::copy(lon, bfr__ + 9);
+      Utils::ByteCopy::copy(x, bfr__ + 17);
+      Utils::ByteCopy::copy(y, bfr__ + 21);
+      Utils::ByteCopy::copy(z, bfr__ + 25);
+      return c_fields_size;
     }
 
     uint16_t
     GetWorldCoordinates::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(tracking, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lat, bfr__ + 1);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 9);
+      Utils::ByteCopy::rcopy(x, bfr__ + 17);
+      Utils::ByteCopy::rcopy(y, bfr__ + 21);
+      Utils::ByteCopy::rcopy(z, bfr__ + 25);
+      return c_fields_size;
     }
 
     void
@@ -26033,6 +38963,59 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    GetWorldCoordinates::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("tracking", tracking);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+    }
+
+    bool
+    GetWorldCoordinates::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "tracking")
+      {
+        r__.read(tracking);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblAnglesExtended::UsblAnglesExtended(void)
     {
       m_header.mgid = 898;
@@ -26141,6 +39124,80 @@ namespace DUNE
       IMC::toJSON(os__, "accuracy", accuracy, nindent__);
     }
 
+    void
+    UsblAnglesExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("lbearing", lbearing);
+      w__.write("lelevation", lelevation);
+      w__.write("bearing", bearing);
+      w__.write("elevation", elevation);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("accuracy", accuracy);
+    }
+
+    bool
+    UsblAnglesExtended::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "lbearing")
+      {
+        r__.read(lbearing);
+        return true;
+      }
+
+      if (name__ == "lelevation")
+      {
+        r__.read(lelevation);
+        return true;
+      }
+
+      if (name__ == "bearing")
+      {
+        r__.read(bearing);
+        return true;
+      }
+
+      if (name__ == "elevation")
+      {
+        r__.read(elevation);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "accuracy")
+      {
+        r__.read(accuracy);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblPositionExtended::UsblPositionExtended(void)
     {
       m_header.mgid = 899;
@@ -26261,6 +39318,94 @@ namespace DUNE
       IMC::toJSON(os__, "accuracy", accuracy, nindent__);
     }
 
+    void
+    UsblPositionExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("x", x);
+      w__.write("y", y);
+      w__.write("z", z);
+      w__.write("n", n);
+      w__.write("e", e);
+      w__.write("d", d);
+      w__.write("phi", phi);
+      w__.write("theta", theta);
+      w__.write("psi", psi);
+      w__.write("accuracy", accuracy);
+    }
+
+    bool
+    UsblPositionExtended::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "x")
+      {
+        r__.read(x);
+        return true;
+      }
+
+      if (name__ == "y")
+      {
+        r__.read(y);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "n")
+      {
+        r__.read(n);
+        return true;
+      }
+
+      if (name__ == "e")
+      {
+        r__.read(e);
+        return true;
+      }
+
+      if (name__ == "d")
+      {
+        r__.read(d);
+        return true;
+      }
+
+      if (name__ == "phi")
+      {
+        r__.read(phi);
+        return true;
+      }
+
+      if (name__ == "theta")
+      {
+        r__.read(theta);
+        return true;
+      }
+
+      if (name__ == "psi")
+      {
+        r__.read(psi);
+        return true;
+      }
+
+      if (name__ == "accuracy")
+      {
+        r__.read(accuracy);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblFixExtended::UsblFixExtended(void)
     {
       m_header.mgid = 900;
@@ -26350,6 +39495,59 @@ namespace DUNE
       IMC::toJSON(os__, "accuracy", accuracy, nindent__);
     }
 
+    void
+    UsblFixExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("target", target);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z_units", z_units);
+      w__.write("z", z);
+      w__.write("accuracy", accuracy);
+    }
+
+    bool
+    UsblFixExtended::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "target")
+      {
+        r__.read(target);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "accuracy")
+      {
+        r__.read(accuracy);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblModem::UsblModem(void)
     {
       m_header.mgid = 901;
@@ -26432,6 +39630,52 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    void
+    UsblModem::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("name", name);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("z", z);
+      w__.write("z_units", z_units);
+    }
+
+    bool
+    UsblModem::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "name")
+      {
+        r__.read(name);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "z")
+      {
+        r__.read(z);
+        return true;
+      }
+
+      if (name__ == "z_units")
+      {
+        r__.read(z_units);
+        return true;
+      }
+
+      return false;
+    }
+
     UsblConfig::UsblConfig(void)
     {
       m_header.mgid = 902;
@@ -26495,6 +39739,31 @@ namespace DUNE
       modems.toJSON(os__, "modems", nindent__);
     }
 
+    void
+    UsblConfig::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      modems.toJSON(w__, "modems");
+    }
+
+    bool
+    UsblConfig::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "modems")
+      {
+        modems.fromJSON(r__);
+        return true;
+      }
+
+      return false;
+    }
+
     void
     UsblConfig::setTimeStampNested(double value__)
     {
@@ -26556,28 +39825,33 @@ namespace DUNE
     uint8_t*
     DissolvedOrganicMatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 4);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DissolvedOrganicMatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      Utils::ByteCopy::copy(type, bfr__ + 4);
+      return c_fields_size;
     }
 
     uint16_t
     DissolvedOrganicMatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      Utils::ByteCopy::rcopy(type, bfr__ + 4);
+      return c_fields_size;
     }
 
     fp64_t
@@ -26599,6 +39873,31 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    DissolvedOrganicMatter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+      w__.write("type", type);
+    }
+
+    bool
+    DissolvedOrganicMatter::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "type")
+      {
+        r__.read(type);
+        return true;
+      }
+
+      return false;
+    }
+
     OpticalBackscatter::OpticalBackscatter(void)
     {
       m_header.mgid = 904;
@@ -26628,25 +39927,30 @@ namespace DUNE
     uint8_t*
     OpticalBackscatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     OpticalBackscatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     OpticalBackscatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -26667,6 +39971,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    OpticalBackscatter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    OpticalBackscatter::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
+
     Tachograph::Tachograph(void)
     {
       m_header.mgid = 905;
@@ -26726,70 +40048,64 @@ namespace DUNE
     uint8_t*
     Tachograph::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timestamp_last_service, ptr__);
-      ptr__ += IMC::serialize(time_next_service, ptr__);
-      ptr__ += IMC::serialize(time_motor_next_service, ptr__);
-      ptr__ += IMC::serialize(time_idle_ground, ptr__);
-      ptr__ += IMC::serialize(time_idle_air, ptr__);
-      ptr__ += IMC::serialize(time_idle_water, ptr__);
-      ptr__ += IMC::serialize(time_idle_underwater, ptr__);
-      ptr__ += IMC::serialize(time_idle_unknown, ptr__);
-      ptr__ += IMC::serialize(time_motor_ground, ptr__);
-      ptr__ += IMC::serialize(time_motor_air, ptr__);
-      ptr__ += IMC::serialize(time_motor_water, ptr__);
-      ptr__ += IMC::serialize(time_motor_underwater, ptr__);
-      ptr__ += IMC::serialize(time_motor_unknown, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(depth_max, ptr__);
-      return ptr__;
+      IMC::serialize(timestamp_last_service, bfr__ + 0);
+      IMC::serialize(time_next_service, bfr__ + 8);
+      IMC::serialize(time_motor_next_service, bfr__ + 12);
+      IMC::serialize(time_idle_ground, bfr__ + 16);
+      IMC::serialize(time_idle_air, bfr__ + 20);
+      IMC::serialize(time_idle_water, bfr__ + 24);
+      IMC::serialize(time_idle_underwater, bfr__ + 28);
+      IMC::serialize(time_idle_unknown, bfr__ + 32);
+      IMC::serialize(time_motor_ground, bfr__ + 36);
+      IMC::serialize(time_motor_air, bfr__ + 40);
+      IMC::serialize(time_motor_water, bfr__ + 44);
+      IMC::serialize(time_motor_underwater, bfr__ + 48);
+      IMC::serialize(time_motor_unknown, bfr__ + 52);
+      IMC::serialize(rpm_min, bfr__ + 56);
+      IMC::serialize(rpm_max, bfr__ + 58);
+      IMC::serialize(depth_max, bfr__ + 60);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     Tachograph::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(timestamp_last_service, bfr__ + 0);
+      Utils::ByteCopy::copy(time_next_service, bfr__ + 8);
+      Utils::ByteCopy::copy(time_motor_next_service, bfr__ + 12);
+      Utils::ByteCopy::copy(time_idle_ground, bfr__ + 16);
+      Utils::ByteCopy::copy(time_idle_air, bfr__ + 20);
+      Utils::ByteCopy::copy(time_idle_water, bfr__ + 24);
+      Utils::ByteCopy::copy(time_idle_underwater, bfr__ + 28);
+      Utils::ByteCopy::copy(time_idle_unknown, bfr__ + 32);
+      Utils::ByteCopy::copy(time_motor_ground, bfr__ + 36);
+      Utils::ByteCopy::copy(time_motor_air, bfr__ + 40);
+      Utils::ByteCopy::copy(time_motor_water, bfr__ + 44);
+      Utils::ByteCopy::copy(time_motor_underwater, bfr__ + 48);
+      Utils::ByteCopy::copy(time_motor_unknown, bfr__ + 52);
+      Utils::ByteCopy::copy(rpm_min, bfr__ + 56);
+      Utils::ByteCopy::copy(rpm_max, bfr__ + 58);
+      Utils::ByteCopy::copy(depth_max, bfr__ + 60);
+      return c_fields_size;
     }
 
     uint16_t
     Tachograph::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy8b(swap__ + 0, bfr__ + 0, 1);
+      Utils::ByteCopy::rcopy4b(swap__ + 8, bfr__ + 8, 12);
+      Utils::ByteCopy::rcopy2b(swap__ + 56, bfr__ + 56, 2);
+      Utils::ByteCopy::rcopy4b(swap__ + 60, bfr__ + 60, 1);
+      return Tachograph::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -26813,6 +40129,129 @@ namespace DUNE
       IMC::toJSON(os__, "depth_max", depth_max, nindent__);
     }
 
+    void
+    Tachograph::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("timestamp_last_service", timestamp_last_service);
+      w__.write("time_next_service", time_next_service);
+      w__.write("time_motor_next_service", time_motor_next_service);
+      w__.write("time_idle_ground", time_idle_ground);
+      w__.write("time_idle_air", time_idle_air);
+      w__.write("time_idle_water", time_idle_water);
+      w__.write("time_idle_underwater", time_idle_underwater);
+      w__.write("time_idle_unknown", time_idle_unknown);
+      w__.write("time_motor_ground", time_motor_ground);
+      w__.write("time_motor_air", time_motor_air);
+      w__.write("time_motor_water", time_motor_water);
+      w__.write("time_motor_underwater", time_motor_underwater);
+      w__.write("time_motor_unknown", time_motor_unknown);
+      w__.write("rpm_min", rpm_min);
+      w__.write("rpm_max", rpm_max);
+      w__.write("depth_max", depth_max);
+    }
+
+    bool
+    Tachograph::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "timestamp_last_service")
+      {
+        r__.read(timestamp_last_service);
+        return true;
+      }
+
+      if (name__ == "time_next_service")
+      {
+        r__.read(time_next_service);
+        return true;
+      }
+
+      if (name__ == "time_motor_next_service")
+      {
+        r__.read(time_motor_next_service);
+        return true;
+      }
+
+      if (name__ == "time_idle_ground")
+      {
+        r__.read(time_idle_ground);
+        return true;
+      }
+
+      if (name__ == "time_idle_air")
+      {
+        r__.read(time_idle_air);
+        return true;
+      }
+
+      if (name__ == "time_idle_water")
+      {
+        r__.read(time_idle_water);
+        return true;
+      }
+
+      if (name__ == "time_idle_underwater")
+      {
+        r__.read(time_idle_underwater);
+        return true;
+      }
+
+      if (name__ == "time_idle_unknown")
+      {
+        r__.read(time_idle_unknown);
+        return true;
+      }
+
+      if (name__ == "time_motor_ground")
+      {
+        r__.read(time_motor_ground);
+        return true;
+      }
+
+      if (name__ == "time_motor_air")
+      {
+        r__.read(time_motor_air);
+        return true;
+      }
+
+      if (name__ == "time_motor_water")
+      {
+        r__.read(time_motor_water);
+        return true;
+      }
+
+      if (name__ == "time_motor_underwater")
+      {
+        r__.read(time_motor_underwater);
+        return true;
+      }
+
+      if (name__ == "time_motor_unknown")
+      {
+        r__.read(time_motor_unknown);
+        return true;
+      }
+
+      if (name__ == "rpm_min")
+      {
+        r__.read(rpm_min);
+        return true;
+      }
+
+      if (name__ == "rpm_max")
+      {
+        r__.read(rpm_max);
+        return true;
+      }
+
+      if (name__ == "depth_max")
+      {
+        r__.read(depth_max);
+        return true;
+      }
+
+      return false;
+    }
+
     ApmStatus::ApmStatus(void)
     {
       m_header.mgid = 906;
@@ -26875,6 +40314,31 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    ApmStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("severity", severity);
+      w__.write("text", text);
+    }
+
+    bool
+    ApmStatus::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "severity")
+      {
+        r__.read(severity);
+        return true;
+      }
+
+      if (name__ == "text")
+      {
+        r__.read(text);
+        return true;
+      }
+
+      return false;
+    }
+
     SadcReadings::SadcReadings(void)
     {
       m_header.mgid = 907;
@@ -26909,31 +40373,36 @@ namespace DUNE
     uint8_t*
     SadcReadings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(channel, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(gain, ptr__);
-      return ptr__;
+      IMC::serialize(channel, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      IMC::serialize(gain, bfr__ + 5);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     SadcReadings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(channel, bfr__ + 0);
+      Utils::ByteCopy::copy(value, bfr__ + 1);
+      Utils::ByteCopy::copy(gain, bfr__ + 5);
+      return c_fields_size;
     }
 
     uint16_t
     SadcReadings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(channel, bfr__ + 0);
+      Utils::ByteCopy::rcopy(value, bfr__ + 1);
+      Utils::ByteCopy::rcopy(gain, bfr__ + 5);
+      return c_fields_size;
     }
 
     fp64_t
@@ -26956,6 +40425,38 @@ namespace DUNE
       IMC::toJSON(os__, "gain", gain, nindent__);
     }
 
+    void
+    SadcReadings::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("channel", channel);
+      w__.write("value", value);
+      w__.write("gain", gain);
+    }
+
+    bool
+    SadcReadings::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "channel")
+      {
+        r__.read(channel);
+        return true;
+      }
+
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      if (name__ == "gain")
+      {
+        r__.read(gain);
+        return true;
+      }
+
+      return false;
+    }
+
     DmsDetection::DmsDetection(void)
     {
       m_header.mgid = 908;
@@ -27015,70 +40516,61 @@ namespace DUNE
     uint8_t*
     DmsDetection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(ch01, ptr__);
-      ptr__ += IMC::serialize(ch02, ptr__);
-      ptr__ += IMC::serialize(ch03, ptr__);
-      ptr__ += IMC::serialize(ch04, ptr__);
-      ptr__ += IMC::serialize(ch05, ptr__);
-      ptr__ += IMC::serialize(ch06, ptr__);
-      ptr__ += IMC::serialize(ch07, ptr__);
-      ptr__ += IMC::serialize(ch08, ptr__);
-      ptr__ += IMC::serialize(ch09, ptr__);
-      ptr__ += IMC::serialize(ch10, ptr__);
-      ptr__ += IMC::serialize(ch11, ptr__);
-      ptr__ += IMC::serialize(ch12, ptr__);
-      ptr__ += IMC::serialize(ch13, ptr__);
-      ptr__ += IMC::serialize(ch14, ptr__);
-      ptr__ += IMC::serialize(ch15, ptr__);
-      ptr__ += IMC::serialize(ch16, ptr__);
-      return ptr__;
+      IMC::serialize(ch01, bfr__ + 0);
+      IMC::serialize(ch02, bfr__ + 4);
+      IMC::serialize(ch03, bfr__ + 8);
+      IMC::serialize(ch04, bfr__ + 12);
+      IMC::serialize(ch05, bfr__ + 16);
+      IMC::serialize(ch06, bfr__ + 20);
+      IMC::serialize(ch07, bfr__ + 24);
+      IMC::serialize(ch08, bfr__ + 28);
+      IMC::serialize(ch09, bfr__ + 32);
+      IMC::serialize(ch10, bfr__ + 36);
+      IMC::serialize(ch11, bfr__ + 40);
+      IMC::serialize(ch12, bfr__ + 44);
+      IMC::serialize(ch13, bfr__ + 48);
+      IMC::serialize(ch14, bfr__ + 52);
+      IMC::serialize(ch15, bfr__ + 56);
+      IMC::serialize(ch16, bfr__ + 60);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     DmsDetection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(ch01, bfr__, size__);
-      bfr__ += IMC::deserialize(ch02, bfr__, size__);
-      bfr__ += IMC::deserialize(ch03, bfr__, size__);
-      bfr__ += IMC::deserialize(ch04, bfr__, size__);
-      bfr__ += IMC::deserialize(ch05, bfr__, size__);
-      bfr__ += IMC::deserialize(ch06, bfr__, size__);
-      bfr__ += IMC::deserialize(ch07, bfr__, size__);
-      bfr__ += IMC::deserialize(ch08, bfr__, size__);
-      bfr__ += IMC::deserialize(ch09, bfr__, size__);
-      bfr__ += IMC::deserialize(ch10, bfr__, size__);
-      bfr__ += IMC::deserialize(ch11, bfr__, size__);
-      bfr__ += IMC::deserialize(ch12, bfr__, size__);
-      bfr__ += IMC::deserialize(ch13, bfr__, size__);
-      bfr__ += IMC::deserialize(ch14, bfr__, size__);
-      bfr__ += IMC::deserialize(ch15, bfr__, size__);
-      bfr__ += IMC::deserialize(ch16, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(ch01, bfr__ + 0);
+      Utils::ByteCopy::copy(ch02, bfr__ + 4);
+      Utils::ByteCopy::copy(ch03, bfr__ + 8);
+      Utils::ByteCopy::copy(ch04, bfr__ + 12);
+      Utils::ByteCopy::copy(ch05, bfr__ + 16);
+      Utils::ByteCopy::copy(ch06, bfr__ + 20);
+      Utils::ByteCopy::copy(ch07, bfr__ + 24);
+      Utils::ByteCopy::copy(ch08, bfr__ + 28);
+      Utils::ByteCopy::copy(ch09, bfr__ + 32);
+      Utils::ByteCopy::copy(ch10, bfr__ + 36);
+      Utils::ByteCopy::copy(ch11, bfr__ + 40);
+      Utils::ByteCopy::copy(ch12, bfr__ + 44);
+      Utils::ByteCopy::copy(ch13, bfr__ + 48);
+      Utils::ByteCopy::copy(ch14, bfr__ + 52);
+      Utils::ByteCopy::copy(ch15, bfr__ + 56);
+      Utils::ByteCopy::copy(ch16, bfr__ + 60);
+      return c_fields_size;
     }
 
     uint16_t
     DmsDetection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(ch01, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch02, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch03, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch04, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch05, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch06, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch07, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch08, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch09, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch10, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch11, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch12, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch13, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch14, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch15, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch16, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      uint8_t swap__[c_fields_size];
+      Utils::ByteCopy::rcopy4b(swap__ + 0, bfr__ + 0, 16);
+      return DmsDetection::deserializeFields(swap__, c_fields_size);
     }
 
     void
@@ -27102,6 +40594,129 @@ namespace DUNE
       IMC::toJSON(os__, "ch16", ch16, nindent__);
     }
 
+    void
+    DmsDetection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("ch01", ch01);
+      w__.write("ch02", ch02);
+      w__.write("ch03", ch03);
+      w__.write("ch04", ch04);
+      w__.write("ch05", ch05);
+      w__.write("ch06", ch06);
+      w__.write("ch07", ch07);
+      w__.write("ch08", ch08);
+      w__.write("ch09", ch09);
+      w__.write("ch10", ch10);
+      w__.write("ch11", ch11);
+      w__.write("ch12", ch12);
+      w__.write("ch13", ch13);
+      w__.write("ch14", ch14);
+      w__.write("ch15", ch15);
+      w__.write("ch16", ch16);
+    }
+
+    bool
+    DmsDetection::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "ch01")
+      {
+        r__.read(ch01);
+        return true;
+      }
+
+      if (name__ == "ch02")
+      {
+        r__.read(ch02);
+        return true;
+      }
+
+      if (name__ == "ch03")
+      {
+        r__.read(ch03);
+        return true;
+      }
+
+      if (name__ == "ch04")
+      {
+        r__.read(ch04);
+        return true;
+      }
+
+      if (name__ == "ch05")
+      {
+        r__.read(ch05);
+        return true;
+      }
+
+      if (name__ == "ch06")
+      {
+        r__.read(ch06);
+        return true;
+      }
+
+      if (name__ == "ch07")
+      {
+        r__.read(ch07);
+        return true;
+      }
+
+      if (name__ == "ch08")
+      {
+        r__.read(ch08);
+        return true;
+      }
+
+      if (name__ == "ch09")
+      {
+        r__.read(ch09);
+        return true;
+      }
+
+      if (name__ == "ch10")
+      {
+        r__.read(ch10);
+        return true;
+      }
+
+      if (name__ == "ch11")
+      {
+        r__.read(ch11);
+        return true;
+      }
+
+      if (name__ == "ch12")
+      {
+        r__.read(ch12);
+        return true;
+      }
+
+      if (name__ == "ch13")
+      {
+        r__.read(ch13);
+        return true;
+      }
+
+      if (name__ == "ch14")
+      {
+        r__.read(ch14);
+        return true;
+      }
+
+      if (name__ == "ch15")
+      {
+        r__.read(ch15);
+        return true;
+      }
+
+      if (name__ == "ch16")
+      {
+        r__.read(ch16);
+        return true;
+      }
+
+      return false;
+    }
+
     HomePosition::HomePosition(void)
     {
       m_header.mgid = 909;
@@ -27143,40 +40758,45 @@ namespace DUNE
     uint8_t*
     HomePosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 1);
+      IMC::serialize(lon, bfr__ + 9);
+      IMC::serialize(height, bfr__ + 17);
+      IMC::serialize(depth, bfr__ + 21);
+      IMC::serialize(alt, bfr__ + 25);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     HomePosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(op, bfr__ + 0);
+      Utils::ByteCopy::copy(lat, bfr__ + 1);
+      Utils::ByteCopy::copy(lon, bfr__ + 9);
+      Utils::ByteCopy::copy(height, bfr__ + 17);
+      Utils::ByteCopy::copy(depth, bfr__ + 21);
+      Utils::ByteCopy::copy(alt, bfr__ + 25);
+      return c_fields_size;
     }
 
     uint16_t
     HomePosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(op, bfr__ + 0);
+      Utils::ByteCopy::rcopy(lat, bfr__ + 1);
+      Utils::ByteCopy::rcopy(lon, bfr__ + 9);
+      Utils::ByteCopy::rcopy(height, bfr__ + 17);
+      Utils::ByteCopy::rcopy(depth, bfr__ + 21);
+      Utils::ByteCopy::rcopy(alt, bfr__ + 25);
+      return c_fields_size;
     }
 
     void
@@ -27190,6 +40810,59 @@ namespace DUNE
       IMC::toJSON(os__, "alt", alt, nindent__);
     }
 
+    void
+    HomePosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("op", op);
+      w__.write("lat", lat);
+      w__.write("lon", lon);
+      w__.write("height", height);
+      w__.write("depth", depth);
+      w__.write("alt", alt);
+    }
+
+    bool
+    HomePosition::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "op")
+      {
+        r__.read(op);
+        return true;
+      }
+
+      if (name__ == "lat")
+      {
+        r__.read(lat);
+        return true;
+      }
+
+      if (name__ == "lon")
+      {
+        r__.read(lon);
+        return true;
+      }
+
+      if (name__ == "height")
+      {
+        r__.read(height);
+        return true;
+      }
+
+      if (name__ == "depth")
+      {
+        r__.read(depth);
+        return true;
+      }
+
+      if (name__ == "alt")
+      {
+        r__.read(alt);
+        return true;
+      }
+
+      return false;
+    }
+
     TotalMagIntensity::TotalMagIntensity(void)
     {
       m_header.mgid = 2006;
@@ -27219,25 +40892,30 @@ namespace DUNE
     uint8_t*
     TotalMagIntensity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + c_fields_size;
     }
 
     uint16_t
     TotalMagIntensity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::copy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     uint16_t
     TotalMagIntensity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < c_fields_size)
+      {
+        throw BufferTooShort();
+      }
+      Utils::ByteCopy::rcopy(value, bfr__ + 0);
+      return c_fields_size;
     }
 
     fp64_t
@@ -27257,5 +40935,23 @@ namespace DUNE
     {
       IMC::toJSON(os__, "value", value, nindent__);
     }
+
+    void
+    TotalMagIntensity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.write("value", value);
+    }
+
+    bool
+    TotalMagIntensity::fieldFromJSON(const std::string& name__, JSONReader& r__)
+    {
+      if (name__ == "value")
+      {
+        r__.read(value);
+        return true;
+      }
+
+      return false;
+    }
   }
 }
@@ -48,6 +48,8 @@
 #include <DUNE/IMC/Bitfields.hpp>
 #include <DUNE/IMC/SuperTypes.hpp>
 #include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/JSONReader.hpp>
 
 namespace DUNE
 {
@@ -144,6 +146,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Query Entity State.
@@ -278,6 +286,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Query Entity Information.
@@ -287,6 +301,9 @@ namespace DUNE
       //! Entity Identifier.
       uint8_t id;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -345,6 +362,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Entity List.
@@ -423,6 +446,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! CPU Usage.
@@ -432,6 +461,9 @@ namespace DUNE
       //! Usage percentage.
       uint8_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -490,6 +522,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Transport Bindings.
@@ -559,6 +597,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Restart System.
@@ -577,6 +621,9 @@ namespace DUNE
       //! Restart Type.
       uint8_t type;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -629,6 +676,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Device Calibration Control.
@@ -651,6 +704,9 @@ namespace DUNE
       //! Operation.
       uint8_t op;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -703,6 +759,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Device Calibration State.
@@ -791,6 +853,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Entity Activation State.
@@ -881,6 +949,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Query Entity Activation State.
@@ -988,6 +1062,9 @@ namespace DUNE
       //! Maximum RPM rate.
       fp32_t rpm_rate_max;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 69;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -1040,6 +1117,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Message List.
@@ -1108,6 +1191,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -1166,6 +1255,9 @@ namespace DUNE
       //! Stream Velocity Z (Down).
       fp32_t svz;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 80;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -1218,6 +1310,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Leak Simulation.
@@ -1296,6 +1394,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Underwater Acoustics Simulation.
@@ -1378,6 +1482,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Dynamics Simulation Parameters.
@@ -1402,6 +1512,9 @@ namespace DUNE
       //! Bank to Bank Rate Gain.
       fp32_t bank2p_pgain;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 9;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -1454,6 +1567,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Storage Usage.
@@ -1465,6 +1584,9 @@ namespace DUNE
       //! Usage.
       uint8_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -1523,6 +1645,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Cache Control.
@@ -1610,6 +1738,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -1711,6 +1845,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Log Book Entry.
@@ -1799,6 +1939,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Log Book Control.
@@ -1884,6 +2030,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -1981,6 +2133,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Clock Control.
@@ -2011,6 +2169,9 @@ namespace DUNE
       //! Timezone.
       int8_t tz;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 10;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2063,6 +2224,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Historic CTD.
@@ -2076,6 +2243,9 @@ namespace DUNE
       //! Depth.
       fp32_t depth;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 12;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2128,6 +2298,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Historic Telemetry.
@@ -2145,6 +2321,9 @@ namespace DUNE
       //! Speed.
       int16_t speed;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 12;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2197,6 +2376,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Historic Sonar Data.
@@ -2287,6 +2472,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Historic Event.
@@ -2365,6 +2556,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Profile Sample.
@@ -2376,6 +2573,9 @@ namespace DUNE
       //! Average.
       fp32_t avg;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 6;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2428,6 +2628,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Vertical Profile.
@@ -2523,6 +2729,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -2670,6 +2882,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Announce Service.
@@ -2748,6 +2966,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Receive Signal Strength Information.
@@ -2757,6 +2981,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2815,6 +3042,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Voltage Standing Wave Ratio.
@@ -2824,6 +3057,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2882,6 +3118,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Link Level.
@@ -2891,6 +3133,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -2949,6 +3194,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SMS.
@@ -3020,6 +3271,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SMS Transmit.
@@ -3093,6 +3350,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SMS Receive.
@@ -3162,6 +3425,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SMS State.
@@ -3252,6 +3521,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Text Message.
@@ -3321,6 +3596,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Received Iridium Message.
@@ -3396,6 +3677,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Transmit Iridium Message.
@@ -3469,6 +3756,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Iridium Transmission Status.
@@ -3557,6 +3850,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Group Membership State.
@@ -3626,6 +3925,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! System Group.
@@ -3714,6 +4019,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Link Latency.
@@ -3725,6 +4036,9 @@ namespace DUNE
       //! Communications Source System ID.
       uint16_t sys_src;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 6;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -3783,6 +4097,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Extended Receive Signal Strength Information.
@@ -3794,6 +4114,9 @@ namespace DUNE
       //! RSSI Units.
       uint8_t units;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -3852,6 +4175,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Historic Data Series.
@@ -3926,6 +4255,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4014,6 +4349,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Historic Data Sample.
@@ -4094,6 +4435,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4194,6 +4541,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4283,6 +4636,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4406,6 +4765,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Telemetry Message.
@@ -4545,6 +4910,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LBL Range.
@@ -4556,6 +4927,9 @@ namespace DUNE
       //! Range.
       fp32_t range;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -4614,6 +4988,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LBL Beacon Configuration.
@@ -4693,6 +5073,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LBL Configuration.
@@ -4774,6 +5160,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4857,6 +5249,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4970,6 +5368,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Acoustic Operation.
@@ -5087,6 +5491,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -5222,9 +5632,15 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
-    };
 
-    //! Acoustic Link Quality.
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+    };
+
+    //! Acoustic Link Quality.
     class AcousticLink: public Message
     {
     public:
@@ -5293,6 +5709,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Acoustic Transmission Request.
@@ -5386,6 +5808,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -5514,6 +5942,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Revolutions Per Minute.
@@ -5523,6 +5957,9 @@ namespace DUNE
       //! Value.
       int16_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 2;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -5581,6 +6018,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Voltage.
@@ -5590,6 +6033,9 @@ namespace DUNE
       //! Measured Voltage Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -5648,6 +6094,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Current.
@@ -5657,6 +6109,9 @@ namespace DUNE
       //! Measured Current Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -5715,6 +6170,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! GPS Fix.
@@ -5792,6 +6253,9 @@ namespace DUNE
       //! Vertical Accuracy Estimate.
       fp32_t vacc;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 56;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -5844,6 +6308,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Euler Angles.
@@ -5861,6 +6331,9 @@ namespace DUNE
       //! Yaw Angle (Magnetic).
       fp64_t psi_magnetic;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 40;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -5913,6 +6386,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Euler Angles Delta.
@@ -5930,6 +6409,9 @@ namespace DUNE
       //! Timestep.
       fp32_t timestep;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 36;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -5982,6 +6464,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Angular Velocity.
@@ -5997,6 +6485,9 @@ namespace DUNE
       //! Z.
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 32;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6049,6 +6540,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Acceleration.
@@ -6064,6 +6561,9 @@ namespace DUNE
       //! Z.
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 32;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6116,6 +6616,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Magnetic Field.
@@ -6131,6 +6637,9 @@ namespace DUNE
       //! Z.
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 32;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6183,6 +6692,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Ground Velocity.
@@ -6209,6 +6724,9 @@ namespace DUNE
       //! Z.
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 25;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6261,6 +6779,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Water Velocity.
@@ -6287,6 +6811,9 @@ namespace DUNE
       //! Z.
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 25;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6339,6 +6866,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Velocity Delta.
@@ -6354,6 +6887,9 @@ namespace DUNE
       //! Z.
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 32;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6406,6 +6942,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Device State.
@@ -6425,6 +6967,9 @@ namespace DUNE
       //! Device Rotation - Z.
       fp32_t psi;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 24;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6477,6 +7022,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Beam Configuration.
@@ -6488,6 +7039,9 @@ namespace DUNE
       //! Beam Height.
       fp32_t beam_height;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6540,6 +7094,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Distance.
@@ -6629,6 +7189,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -6653,6 +7219,9 @@ namespace DUNE
       //! Measured Temperature.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6711,6 +7280,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Pressure.
@@ -6720,6 +7295,9 @@ namespace DUNE
       //! Measured Pressure.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6778,6 +7356,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Depth.
@@ -6787,6 +7371,9 @@ namespace DUNE
       //! Measured Depth.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6845,6 +7432,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Depth Offset.
@@ -6854,6 +7447,9 @@ namespace DUNE
       //! Measured Offset.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6912,6 +7508,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Sound Speed.
@@ -6921,6 +7523,9 @@ namespace DUNE
       //! Computed Sound Speed.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -6979,6 +7584,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Water Density.
@@ -6988,6 +7599,9 @@ namespace DUNE
       //! Computed Water Density.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7046,6 +7660,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Conductivity.
@@ -7055,6 +7675,9 @@ namespace DUNE
       //! Measured Conductivity.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7113,6 +7736,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Salinity.
@@ -7122,6 +7751,9 @@ namespace DUNE
       //! Measured Salinity.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7180,6 +7812,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Wind Speed.
@@ -7193,6 +7831,9 @@ namespace DUNE
       //! Turbulence.
       fp32_t turbulence;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 12;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7245,6 +7886,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Relative Humidity.
@@ -7254,6 +7901,9 @@ namespace DUNE
       //! Relative Humidity Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7312,6 +7962,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Device Data (Text).
@@ -7379,6 +8035,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Device Data (Binary).
@@ -7446,6 +8108,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Force.
@@ -7455,6 +8123,9 @@ namespace DUNE
       //! Measured Force.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7513,6 +8184,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Sonar Data.
@@ -7606,6 +8283,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -7692,6 +8375,9 @@ namespace DUNE
       //! Operation.
       uint8_t op;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7744,6 +8430,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Fuel Level.
@@ -7821,6 +8513,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! GPS Navigation Data.
@@ -7858,6 +8556,9 @@ namespace DUNE
       //! Course / Heading Accuracy Estimate.
       fp32_t cacc;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 68;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7910,6 +8611,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Servo Position.
@@ -7921,6 +8628,9 @@ namespace DUNE
       //! Position.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -7985,6 +8695,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Data Sanity.
@@ -8003,6 +8719,9 @@ namespace DUNE
       //! Sanity.
       uint8_t sane;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8055,6 +8774,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Rhodamine Dye.
@@ -8064,6 +8789,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8122,6 +8850,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Crude Oil.
@@ -8131,6 +8865,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8189,6 +8926,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Fine Oil.
@@ -8198,6 +8941,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8256,6 +9002,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Turbidity.
@@ -8265,6 +9017,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8323,6 +9078,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Chlorophyll.
@@ -8332,6 +9093,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8390,6 +9154,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Fluorescein.
@@ -8399,6 +9169,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8457,6 +9230,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Phycocyanin.
@@ -8466,6 +9245,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8524,6 +9306,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Phycoerythrin.
@@ -8533,6 +9321,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8591,6 +9382,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! GPS Fix RTK.
@@ -8654,6 +9451,9 @@ namespace DUNE
       //! IAR Ratio.
       fp32_t iar_ratio;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 58;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8706,6 +9506,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Estimated State.
@@ -8753,6 +9559,9 @@ namespace DUNE
       //! Altitude.
       fp32_t alt;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 88;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8805,6 +9614,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! External Navigation Data.
@@ -8886,6 +9701,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -8910,6 +9731,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -8968,6 +9792,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Air Saturation.
@@ -8977,6 +9807,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9035,6 +9868,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Throttle.
@@ -9044,6 +9883,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9102,6 +9944,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! pH.
@@ -9111,6 +9959,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9169,6 +10020,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Redox Potential.
@@ -9178,6 +10035,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9236,6 +10096,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Camera Zoom.
@@ -9262,6 +10128,9 @@ namespace DUNE
       //! Action.
       uint8_t action;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 3;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9320,6 +10189,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Set Thruster Actuation.
@@ -9331,6 +10206,9 @@ namespace DUNE
       //! Actuation Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9395,6 +10273,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Set Servo Position.
@@ -9406,6 +10290,9 @@ namespace DUNE
       //! Position.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9470,6 +10357,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Set Control Surface Deflection.
@@ -9481,6 +10374,9 @@ namespace DUNE
       //! Angle.
       fp32_t angle;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9539,6 +10435,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Remote Actions Request.
@@ -9617,6 +10519,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Remote Actions.
@@ -9684,6 +10592,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Button Event.
@@ -9695,6 +10609,9 @@ namespace DUNE
       //! Value.
       uint8_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 2;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9753,6 +10670,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LCD Control.
@@ -9837,6 +10760,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Power Operation.
@@ -9869,6 +10798,9 @@ namespace DUNE
       //! Scheduled Time.
       fp64_t sched_time;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 13;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -9921,6 +10853,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Power Channel Control.
@@ -10013,6 +10951,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Query Power Channel State.
@@ -10144,6 +11088,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LED Brightness.
@@ -10219,6 +11169,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Query LED Brightness.
@@ -10286,6 +11242,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Set LED Brightness.
@@ -10361,6 +11323,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Set PWM.
@@ -10374,6 +11342,9 @@ namespace DUNE
       //! Duty Cycle.
       uint32_t duty_cycle;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 9;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10432,6 +11403,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! PWM.
@@ -10445,6 +11422,9 @@ namespace DUNE
       //! Duty Cycle.
       uint32_t duty_cycle;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 9;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10503,6 +11483,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Estimated Stream Velocity.
@@ -10516,6 +11502,9 @@ namespace DUNE
       //! Z component (Down).
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 24;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10568,6 +11557,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Indicated Speed.
@@ -10577,6 +11572,9 @@ namespace DUNE
       //! Measured speed.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10635,6 +11633,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! True Speed.
@@ -10644,6 +11648,9 @@ namespace DUNE
       //! Estimated value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10702,6 +11709,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Navigation Uncertainty.
@@ -10737,6 +11750,9 @@ namespace DUNE
       //! Variance - Gyro. Yaw Rate Bias.
       fp32_t bias_r;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 56;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10789,6 +11805,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Navigation Data.
@@ -10814,6 +11836,9 @@ namespace DUNE
       //! Variance - Custom Variable Z.
       fp32_t custom_z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 36;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10866,6 +11891,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! GPS Fix Rejection.
@@ -10892,6 +11923,9 @@ namespace DUNE
       //! Reason.
       uint8_t reason;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -10944,6 +11978,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LBL Range Acceptance.
@@ -10972,6 +12012,9 @@ namespace DUNE
       //! Acceptance.
       uint8_t acceptance;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 6;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11030,6 +12073,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! DVL Rejection.
@@ -11067,6 +12116,9 @@ namespace DUNE
       //! Timestep.
       fp32_t timestep;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 10;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11125,6 +12177,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! LBL Beacon Position Estimate.
@@ -11203,6 +12261,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -11248,6 +12312,9 @@ namespace DUNE
       //! State.
       uint8_t state;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11300,6 +12367,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! GroupStreamVelocity.
@@ -11313,6 +12386,9 @@ namespace DUNE
       //! Z component (Down).
       fp64_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 24;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11365,6 +12441,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Airflow.
@@ -11378,6 +12460,9 @@ namespace DUNE
       //! Sideslip angle.
       fp32_t ssa;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 12;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11430,6 +12515,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Heading.
@@ -11439,6 +12530,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11497,6 +12591,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Z.
@@ -11508,6 +12608,9 @@ namespace DUNE
       //! Z Units.
       uint8_t z_units;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11566,6 +12669,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Speed.
@@ -11577,6 +12686,9 @@ namespace DUNE
       //! Speed Units.
       uint8_t speed_units;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 9;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11635,6 +12747,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Roll.
@@ -11644,6 +12762,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11702,6 +12823,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Pitch.
@@ -11711,6 +12838,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11769,6 +12899,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Vertical Rate.
@@ -11778,6 +12914,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11836,6 +12975,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Path.
@@ -11890,6 +13035,9 @@ namespace DUNE
       //! Flags.
       uint8_t flags;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 56;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -11942,6 +13090,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Control.
@@ -11980,6 +13134,9 @@ namespace DUNE
       //! Flags.
       uint8_t flags;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 49;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12032,6 +13189,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Heading Rate.
@@ -12041,6 +13204,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12099,6 +13265,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Velocity.
@@ -12137,6 +13309,9 @@ namespace DUNE
       //! Flags.
       uint8_t flags;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 49;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12189,6 +13364,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Path Control State.
@@ -12249,6 +13430,9 @@ namespace DUNE
       //! Estimated Time to Arrival (ETA).
       uint16_t eta;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 81;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12301,6 +13485,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Allocated Control Torques.
@@ -12314,6 +13504,9 @@ namespace DUNE
       //! Torque about the x axis.
       fp64_t n;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 24;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12366,6 +13559,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Control Parcel.
@@ -12381,6 +13580,9 @@ namespace DUNE
       //! Anti-Windup Parcel.
       fp32_t a;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 16;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12433,6 +13635,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Brake.
@@ -12453,6 +13661,9 @@ namespace DUNE
       //! Operation.
       uint8_t op;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12505,6 +13716,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Linear State.
@@ -12555,6 +13772,9 @@ namespace DUNE
       //! Flags.
       uint16_t flags;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 74;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12607,6 +13827,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Desired Throttle.
@@ -12616,6 +13842,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -12674,6 +13903,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Goto Maneuver.
@@ -12761,6 +13996,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! PopUp Maneuver.
@@ -12859,6 +14100,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Teleoperation Maneuver.
@@ -12926,6 +14173,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Loiter Maneuver.
@@ -13047,6 +14300,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Idle Maneuver.
@@ -13116,6 +14375,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Low Level Control Maneuver.
@@ -13188,6 +14453,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -13309,6 +14580,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Path Point.
@@ -13322,6 +14599,9 @@ namespace DUNE
       //! Down Offset (m).
       fp32_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 12;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -13374,6 +14654,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Follow Path Maneuver.
@@ -13458,6 +14744,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -13558,6 +14850,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Teleoperation Done.
@@ -13694,6 +14992,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Elevator Maneuver.
@@ -13790,6 +15094,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Trajectory Point.
@@ -13805,6 +15115,9 @@ namespace DUNE
       //! Time Offset (s).
       fp32_t t;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 16;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -13857,6 +15170,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Follow Trajectory.
@@ -13941,6 +15260,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -14027,6 +15352,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Vehicle Formation Participant.
@@ -14042,6 +15373,9 @@ namespace DUNE
       //! Formation offset -- Depth/Altitude.
       fp32_t off_z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 14;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -14094,6 +15428,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Vehicle Formation.
@@ -14180,6 +15520,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -14257,6 +15603,9 @@ namespace DUNE
       //! Maneuver ID.
       uint16_t mid;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 2;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -14309,6 +15658,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Maneuver Control State.
@@ -14393,6 +15748,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Follow System.
@@ -14416,6 +15777,9 @@ namespace DUNE
       //! Z Units.
       uint8_t z_units;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 22;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -14468,6 +15832,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Communications Relay.
@@ -14491,6 +15861,9 @@ namespace DUNE
       //! Move threshold.
       fp32_t move_threshold;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 31;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -14543,6 +15916,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Polygon Vertex.
@@ -14554,6 +15933,9 @@ namespace DUNE
       //! Longitude WGS-84.
       fp64_t lon;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 16;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -14606,6 +15988,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Cover Area.
@@ -14688,6 +16076,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -14807,6 +16201,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Parameters.
@@ -14892,6 +16292,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15000,6 +16406,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Follow Reference Maneuver.
@@ -15017,6 +16429,9 @@ namespace DUNE
       //! Altitude Interval.
       fp32_t altitude_interval;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 15;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -15069,6 +16484,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Reference To Follow.
@@ -15166,6 +16587,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15289,6 +16716,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15413,6 +16846,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Monitoring Data.
@@ -15517,6 +16956,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15616,6 +17061,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation.
@@ -15759,6 +17210,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15855,6 +17312,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Drop Maneuver.
@@ -15936,6 +17399,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Scheduled Goto.
@@ -15970,6 +17439,9 @@ namespace DUNE
       //! Delayed Behavior.
       uint8_t delayed;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 35;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -16022,6 +17494,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Rows Coverage.
@@ -16128,6 +17606,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Sample Maneuver.
@@ -16215,6 +17699,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Image Tracking.
@@ -16349,6 +17839,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Land Maneuver.
@@ -16436,6 +17932,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Autonomous Section.
@@ -16537,6 +18039,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -16633,6 +18141,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Alignment Maneuver.
@@ -16710,6 +18224,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Station Keeping Extended.
@@ -16806,6 +18326,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Maneuver Done.
@@ -16955,6 +18481,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Vehicle State.
@@ -17064,6 +18596,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Vehicle Command.
@@ -17168,6 +18706,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -17267,6 +18811,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Entity Monitoring State.
@@ -17348,6 +18898,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Operational Limits.
@@ -17379,6 +18935,9 @@ namespace DUNE
       //! Area -- Length.
       fp32_t length;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 53;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -17431,6 +18990,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Get Operational Limits.
@@ -17493,6 +19058,9 @@ namespace DUNE
       //! Duration.
       uint16_t duration;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 2;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -17545,6 +19113,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Control Loops.
@@ -17567,6 +19141,9 @@ namespace DUNE
       //! Scope Time Reference.
       uint32_t scope_ref;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 9;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -17619,6 +19196,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Vehicle Medium.
@@ -17643,6 +19226,9 @@ namespace DUNE
       //! Medium.
       uint8_t medium;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -17695,6 +19281,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Collision.
@@ -17719,6 +19311,9 @@ namespace DUNE
       //! Type.
       uint8_t type;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -17777,6 +19372,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Tracking State.
@@ -17825,6 +19426,9 @@ namespace DUNE
       //! Convergence.
       uint8_t convergmon;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 15;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -17877,6 +19481,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Autopilot Mode.
@@ -17957,6 +19567,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Tracking State.
@@ -18027,6 +19643,9 @@ namespace DUNE
       //! Convergence.
       uint8_t convergmon;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 17;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -18079,6 +19698,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Report Control.
@@ -18184,6 +19809,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! State Report.
@@ -18211,6 +19842,9 @@ namespace DUNE
       //! Plan Checksum.
       uint16_t plan_checksum;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 24;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -18263,6 +19897,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Transmission Request.
@@ -18381,6 +20021,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -18490,6 +20136,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SMS Transmission Request.
@@ -18563,6 +20215,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SMS Transmission Status.
@@ -18647,6 +20305,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! VTOL State.
@@ -18671,6 +20335,9 @@ namespace DUNE
       //! State.
       uint8_t state;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -18723,6 +20390,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Arming State.
@@ -18741,6 +20414,9 @@ namespace DUNE
       //! State.
       uint8_t state;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 1;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -18793,6 +20469,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! TCP Transmission Request.
@@ -18867,6 +20549,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -18970,6 +20658,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Abort.
@@ -19120,6 +20814,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Plan Maneuver.
@@ -19194,6 +20894,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19283,6 +20989,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19382,6 +21094,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19484,6 +21202,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19587,6 +21311,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Plan DB.
@@ -19699,6 +21429,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19791,6 +21527,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Plan DB State.
@@ -19871,6 +21613,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20001,6 +21749,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20121,6 +21875,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Plan Generation.
@@ -20214,6 +21974,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Leader State.
@@ -20330,6 +22096,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Plan Statistics.
@@ -20435,6 +22207,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Reported State.
@@ -20533,6 +22311,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Remote Sensor Info.
@@ -20612,6 +22396,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! MapPoint.
@@ -20625,6 +22415,9 @@ namespace DUNE
       //! Altitude.
       fp32_t alt;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 20;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -20677,6 +22470,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Map Feature.
@@ -20774,6 +22573,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20859,6 +22664,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20969,6 +22780,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21054,6 +22871,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21140,6 +22963,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! TREX Command.
@@ -21228,6 +23057,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! TREX Attribute.
@@ -21316,6 +23151,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! TREX Token.
@@ -21388,6 +23229,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21490,6 +23337,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21575,6 +23428,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21659,6 +23518,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Compressed Image.
@@ -21728,6 +23593,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Image Transmission Settings.
@@ -21743,6 +23614,9 @@ namespace DUNE
       //! Target Size.
       uint8_t tsize;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -21795,6 +23669,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Remote State.
@@ -21812,6 +23692,9 @@ namespace DUNE
       //! Heading.
       fp32_t psi;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 17;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -21864,6 +23747,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Target.
@@ -21943,6 +23832,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! EntityParameter.
@@ -22012,6 +23907,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! EntityParameters.
@@ -22082,6 +23983,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -22168,6 +24075,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SetEntityParameters.
@@ -22238,6 +24151,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -22320,6 +24239,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Create Session.
@@ -22329,6 +24254,9 @@ namespace DUNE
       //! Session Timeout.
       uint32_t timeout;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -22381,6 +24309,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Close Session.
@@ -22390,6 +24324,9 @@ namespace DUNE
       //! Session Identifier.
       uint32_t sessid;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -22442,6 +24379,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Session Subscription.
@@ -22511,6 +24454,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Session Keep-Alive.
@@ -22520,6 +24469,9 @@ namespace DUNE
       //! Session Identifier.
       uint32_t sessid;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -22572,6 +24524,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Session Status.
@@ -22592,6 +24550,9 @@ namespace DUNE
       //! Status.
       uint8_t status;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -22644,6 +24605,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Push Entity Parameters.
@@ -22711,6 +24678,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Pop Entity Parameters.
@@ -22778,6 +24751,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! I/O Event.
@@ -22856,6 +24835,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! UamTxFrame.
@@ -22940,6 +24925,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! UamRxFrame.
@@ -23022,6 +25013,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! UamTxStatus.
@@ -23124,6 +25121,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! UamRxRange.
@@ -23201,6 +25204,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! UamTxRange.
@@ -23272,6 +25281,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Control Parameters.
@@ -23302,6 +25317,9 @@ namespace DUNE
       //! Deconfliction Gain.
       fp32_t deconflgain;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 21;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -23354,6 +25372,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Evaluation Data.
@@ -23367,6 +25391,9 @@ namespace DUNE
       //! Mean minimum distance.
       fp32_t dist_min_mean;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 12;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -23419,6 +25446,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Control Parameters.
@@ -23459,6 +25492,9 @@ namespace DUNE
       //! Maximum Longitudinal Acceleration.
       fp32_t accel_lim_x;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 41;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -23511,6 +25547,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Formation Evaluation Data.
@@ -23617,6 +25659,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -23647,6 +25695,9 @@ namespace DUNE
       //! Duration.
       uint16_t duration;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 14;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -23699,6 +25750,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SOI Plan.
@@ -23769,6 +25826,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -23888,6 +25951,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -23929,6 +25998,9 @@ namespace DUNE
       //! Settings Checksum.
       uint16_t settings_chk;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 6;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -23981,6 +26053,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Message Fragment.
@@ -24054,6 +26132,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Neptus Blob.
@@ -24123,6 +26207,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Aborted.
@@ -24189,6 +26279,9 @@ namespace DUNE
       //! Elevation.
       fp32_t elevation;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 10;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -24241,6 +26334,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Position.
@@ -24256,6 +26355,9 @@ namespace DUNE
       //! Z.
       fp32_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 14;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -24308,6 +26410,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Fix.
@@ -24325,6 +26433,9 @@ namespace DUNE
       //! Z Reference.
       fp32_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 23;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -24377,6 +26488,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Parameters XML.
@@ -24446,6 +26563,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Get Parameters XML.
@@ -24512,6 +26635,9 @@ namespace DUNE
       //! Y.
       uint16_t y;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -24564,6 +26690,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Get Image Coordinates.
@@ -24577,6 +26709,9 @@ namespace DUNE
       //! Y.
       uint16_t y;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -24629,6 +26764,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Get World Coordinates.
@@ -24648,6 +26789,9 @@ namespace DUNE
       //! Z.
       fp32_t z;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 29;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -24700,6 +26844,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Angles Extended.
@@ -24783,6 +26933,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Position Extended.
@@ -24870,6 +27026,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Fix Extended.
@@ -24947,6 +27109,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Modem Configuration.
@@ -25022,6 +27190,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! USBL Configuration.
@@ -25103,6 +27277,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -25138,6 +27318,9 @@ namespace DUNE
       //! Type of measurement.
       uint8_t type;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 5;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25196,6 +27379,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Optical Backscattering Coefficient.
@@ -25205,6 +27394,9 @@ namespace DUNE
       //! Value.
       fp32_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 4;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25263,6 +27455,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Tachograph.
@@ -25302,6 +27500,9 @@ namespace DUNE
       //! Recorded Depth - Maximum.
       fp32_t depth_max;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 64;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25354,6 +27555,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! APM Status.
@@ -25444,6 +27651,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! SADC Readings.
@@ -25468,6 +27681,9 @@ namespace DUNE
       //! Gain.
       uint8_t gain;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 6;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25526,6 +27742,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! DMS Detection.
@@ -25565,6 +27787,9 @@ namespace DUNE
       //! Channel 16.
       fp32_t ch16;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 64;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25617,6 +27842,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Home Position.
@@ -25645,6 +27876,9 @@ namespace DUNE
       //! Altitude.
       fp32_t alt;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 29;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25697,6 +27931,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
 
     //! Total Magnetic Field Intensity.
@@ -25706,6 +27946,9 @@ namespace DUNE
       //! Value.
       fp64_t value;
 
+      //! Serialization size of the fields.
+      static const uint16_t c_fields_size = 8;
+
       static uint16_t
       getIdStatic(void)
       {
@@ -25764,6 +28007,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const std::string& name__, JSONReader& r__);
     };
   }
 }
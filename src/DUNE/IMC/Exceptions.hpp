@@ -120,6 +120,15 @@ namespace DUNE
       { }
     };
 
+    //! Malformed JSON document.
+    class InvalidJSON: public std::runtime_error
+    {
+    public:
+      InvalidJSON(const std::string& error, size_t offset):
+        std::runtime_error("invalid JSON at offset " + DUNE::Utils::String::str((unsigned)offset) + ": " + error)
+      { }
+    };
+
     class InvalidMessageSize: public std::runtime_error
     {
     public:
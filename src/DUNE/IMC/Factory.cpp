@@ -33,6 +33,7 @@
 #include <string>
 #include <cstdio>
 #include <map>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Streams/Terminal.hpp>
@@ -76,15 +77,51 @@ namespace DUNE
 #include <DUNE/IMC/Factory.def>
     };
 
-    DUNE_DECLARE_STATIC_MAP(creators_by_id, int, Creator, creator_pairs_id);
     DUNE_DECLARE_STATIC_MAP(map_id_abbrev, uint32_t, std::string, pairs_id_abbrev);
     DUNE_DECLARE_STATIC_MAP(map_abbrev_id, std::string, uint32_t, pairs_abbrev_id);
 
+    //! Table of creators indexed by message identification number.
+    class CreatorTable
+    {
+    public:
+      CreatorTable(void)
+      {
+        size_t count = sizeof(creator_pairs_id) / sizeof(creator_pairs_id[0]);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+          uint32_t id = creator_pairs_id[i].first;
+          if (id >= m_creators.size())
+            m_creators.resize(id + 1, NULL);
+
+          m_creators[id] = creator_pairs_id[i].second;
+        }
+      }
+
+      //! Retrieve the creator of a message.
+      //! @param[in] id message identification number.
+      //! @return creator or NULL if the message is unknown.
+      Creator
+      get(uint32_t id) const
+      {
+        if (id >= m_creators.size())
+          return NULL;
+
+        return m_creators[id];
+      }
+
+    private:
+      std::vector<Creator> m_creators;
+    };
+
+    static const CreatorTable creators_by_id;
+
     Message*
     Factory::produce(uint32_t id)
     {
-      if (creators_by_id[id])
-        return creators_by_id[id]();
+      Creator creator = creators_by_id.get(id);
+      if (creator != NULL)
+        return creator();
 
       DUNE_DBG("IMC Message Factory", "unknown message " << id);
       return 0;
@@ -40,6 +40,8 @@
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Serialization.hpp>
 #include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/JSONReader.hpp>
 
 namespace DUNE
 {
@@ -275,6 +277,43 @@ namespace DUNE
         }
       }
 
+      void
+      toJSON(JSONWriter& writer, const char* label) const
+      {
+        if (m_msg == NULL)
+        {
+          writer.writeNull(label);
+          return;
+        }
+
+        writer.beginObject(label);
+        writer.write("abbrev", m_msg->getName());
+        m_msg->fieldsToJSON(writer);
+        writer.endObject();
+      }
+
+      void
+      fromJSON(JSONReader& reader)
+      {
+        if (reader.readNull())
+        {
+          clear();
+          return;
+        }
+
+        Message* msg = reader.readObject();
+        Type* m = dynamic_cast<Type*>(msg);
+        if (m == NULL)
+        {
+          // With Type = Message the cast only fails for a NULL message.
+          uint16_t id = (msg == NULL) ? 0 : msg->getId();
+          delete msg;
+          throw InvalidMessageId(id);
+        }
+
+        replace(m);
+      }
+
     private:
       //! Parent message.
       const Message* m_parent;
@@ -0,0 +1,534 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/IMC/JSONReader.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Container has no entries yet.
+    static const uint8_t c_scope_first = 0x01;
+    //! Container is an object.
+    static const uint8_t c_scope_object = 0x02;
+    //! Maximum nesting depth.
+    static const size_t c_max_depth = 64;
+
+    //! Convert an hexadecimal digit to its value.
+    //! @param[in] c digit.
+    //! @return value of the digit or -1 if c is not an hexadecimal digit.
+    static int
+    hexValue(char c)
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return -1;
+    }
+
+    JSONReader::JSONReader(const char* data, size_t size):
+      m_begin(data),
+      m_ptr(data),
+      m_end(data + size),
+      m_array(false)
+    { }
+
+    Message*
+    JSONReader::readMessage(void)
+    {
+      if (!m_array)
+      {
+        skipSpace();
+        if (m_ptr == m_end)
+          return NULL;
+
+        if (*m_ptr != '[')
+          return readObject();
+
+        beginArray();
+        m_array = true;
+      }
+
+      if (nextElement())
+        return readObject();
+
+      m_array = false;
+      return readMessage();
+    }
+
+    Message*
+    JSONReader::readObject(void)
+    {
+      beginObject();
+
+      if (!nextMember(m_name) || m_name != "abbrev")
+        error("expected \"abbrev\" as first member");
+
+      std::string abbrev;
+      read(abbrev);
+
+      Message* msg = Factory::produce(abbrev);
+
+      try
+      {
+        while (nextMember(m_name))
+        {
+          if (m_name == "timestamp")
+          {
+            double value;
+            read(value);
+            msg->setTimeStamp(value);
+          }
+          else if (m_name == "src")
+          {
+            uint16_t value;
+            read(value);
+            msg->setSource(value);
+          }
+          else if (m_name == "src_ent")
+          {
+            uint8_t value;
+            read(value);
+            msg->setSourceEntity(value);
+          }
+          else if (m_name == "dst")
+          {
+            uint16_t value;
+            read(value);
+            msg->setDestination(value);
+          }
+          else if (m_name == "dst_ent")
+          {
+            uint8_t value;
+            read(value);
+            msg->setDestinationEntity(value);
+          }
+          else if (!msg->fieldFromJSON(m_name, *this))
+          {
+            skipValue();
+          }
+        }
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      return msg;
+    }
+
+    void
+    JSONReader::beginObject(void)
+    {
+      enter('{', c_scope_first | c_scope_object);
+    }
+
+    bool
+    JSONReader::nextMember(std::string& name)
+    {
+      if (!next('}'))
+        return false;
+
+      skipSpace();
+      if (m_ptr == m_end || *m_ptr != '"')
+        error("expected member name");
+
+      readString(name);
+      expect(':');
+      return true;
+    }
+
+    void
+    JSONReader::beginArray(void)
+    {
+      enter('[', c_scope_first);
+    }
+
+    bool
+    JSONReader::nextElement(void)
+    {
+      return next(']');
+    }
+
+    bool
+    JSONReader::readNull(void)
+    {
+      skipSpace();
+
+      size_t left = m_end - m_ptr;
+      if (left >= 4 && std::memcmp(m_ptr, "null", 4) == 0)
+      {
+        m_ptr += 4;
+        return true;
+      }
+
+      if (left >= 6 && std::memcmp(m_ptr, "\"null\"", 6) == 0)
+      {
+        m_ptr += 6;
+        return true;
+      }
+
+      return false;
+    }
+
+    void
+    JSONReader::skipValue(void)
+    {
+      size_t depth = m_scopes.size();
+
+      do
+      {
+        skipSpace();
+        if (m_ptr != m_end && *m_ptr == '{')
+          beginObject();
+        else if (m_ptr != m_end && *m_ptr == '[')
+          beginArray();
+        else
+          readToken();
+
+        // Find the next value to skip, closing finished containers.
+        while (m_scopes.size() > depth)
+        {
+          if (m_scopes.back() & c_scope_object)
+          {
+            if (nextMember(m_name))
+              break;
+          }
+          else if (nextElement())
+          {
+            break;
+          }
+        }
+      }
+      while (m_scopes.size() > depth);
+    }
+
+    void
+    JSONReader::read(std::string& value)
+    {
+      skipSpace();
+      if (m_ptr == m_end || *m_ptr != '"')
+        error("expected string");
+
+      readString(value);
+    }
+
+    void
+    JSONReader::read(std::vector<char>& value)
+    {
+      readToken();
+
+      if (m_token.size() % 2 != 0)
+        error("odd number of hexadecimal digits");
+
+      value.resize(m_token.size() / 2);
+      for (size_t i = 0; i < value.size(); ++i)
+      {
+        int hi = hexValue(m_token[i * 2]);
+        int lo = hexValue(m_token[i * 2 + 1]);
+        if (hi < 0 || lo < 0)
+          error("invalid hexadecimal digit");
+
+        value[i] = (char)((hi << 4) | lo);
+      }
+    }
+
+    void
+    JSONReader::error(const char* what) const
+    {
+      throw InvalidJSON(what, getOffset());
+    }
+
+    void
+    JSONReader::skipSpace(void)
+    {
+      while (m_ptr != m_end && (*m_ptr == ' ' || *m_ptr == '\n' || *m_ptr == '\r' || *m_ptr == '\t'))
+        ++m_ptr;
+    }
+
+    void
+    JSONReader::expect(char c)
+    {
+      skipSpace();
+      if (m_ptr == m_end || *m_ptr != c)
+      {
+        char what[] = "expected ' '";
+        what[10] = c;
+        error(what);
+      }
+
+      ++m_ptr;
+    }
+
+    void
+    JSONReader::enter(char open, uint8_t flags)
+    {
+      if (m_scopes.size() >= c_max_depth)
+        error("maximum nesting depth exceeded");
+
+      expect(open);
+      m_scopes.push_back(flags);
+    }
+
+    bool
+    JSONReader::next(char close)
+    {
+      skipSpace();
+      if (m_ptr == m_end)
+        error("unexpected end of input");
+
+      if (*m_ptr == close)
+      {
+        ++m_ptr;
+        m_scopes.pop_back();
+        return false;
+      }
+
+      if (m_scopes.back() & c_scope_first)
+        m_scopes.back() &= ~c_scope_first;
+      else
+        expect(',');
+
+      return true;
+    }
+
+    void
+    JSONReader::readToken(void)
+    {
+      skipSpace();
+      if (m_ptr == m_end)
+        error("unexpected end of input");
+
+      if (*m_ptr == '"')
+      {
+        readString(m_token);
+        return;
+      }
+
+      const char* start = m_ptr;
+      while (m_ptr != m_end && std::strchr(",]} \n\r\t{[:\"", *m_ptr) == NULL)
+        ++m_ptr;
+
+      if (m_ptr == start)
+        error("expected value");
+
+      m_token.assign(start, m_ptr - start);
+    }
+
+    void
+    JSONReader::readString(std::string& value)
+    {
+      // Skip opening quote.
+      ++m_ptr;
+      value.clear();
+
+      while (true)
+      {
+        const char* run = m_ptr;
+        while (m_ptr != m_end && *m_ptr != '"' && *m_ptr != '\\')
+          ++m_ptr;
+
+        value.append(run, m_ptr - run);
+
+        if (m_ptr == m_end)
+          error("unterminated string");
+
+        if (*m_ptr++ == '"')
+          return;
+
+        if (m_ptr == m_end)
+          error("unterminated string");
+
+        switch (*m_ptr++)
+        {
+          case '"':
+            value.push_back('"');
+            break;
+          case '\\':
+            value.push_back('\\');
+            break;
+          case '/':
+            value.push_back('/');
+            break;
+          case 'n':
+            value.push_back('\n');
+            break;
+          case 'r':
+            value.push_back('\r');
+            break;
+          case 't':
+            value.push_back('\t');
+            break;
+          case 'b':
+            value.push_back('\b');
+            break;
+          case 'f':
+            value.push_back('\f');
+            break;
+          case 'u':
+            readUnicode(value);
+            break;
+          default:
+            --m_ptr;
+            error("invalid escape sequence");
+        }
+      }
+    }
+
+    void
+    JSONReader::readUnicode(std::string& value)
+    {
+      unsigned cp = readHex4();
+
+      // Combine surrogate pairs.
+      if (cp >= 0xd800 && cp <= 0xdbff)
+      {
+        if (m_end - m_ptr < 6 || m_ptr[0] != '\\' || m_ptr[1] != 'u')
+          error("unpaired surrogate");
+
+        m_ptr += 2;
+        unsigned lo = readHex4();
+        if (lo < 0xdc00 || lo > 0xdfff)
+          error("invalid surrogate pair");
+
+        cp = 0x10000 + ((cp - 0xd800) << 10) + (lo - 0xdc00);
+      }
+      else if (cp >= 0xdc00 && cp <= 0xdfff)
+      {
+        error("unpaired surrogate");
+      }
+
+      if (cp < 0x80)
+      {
+        value.push_back((char)cp);
+      }
+      else if (cp < 0x800)
+      {
+        value.push_back((char)(0xc0 | (cp >> 6)));
+        value.push_back((char)(0x80 | (cp & 0x3f)));
+      }
+      else if (cp < 0x10000)
+      {
+        value.push_back((char)(0xe0 | (cp >> 12)));
+        value.push_back((char)(0x80 | ((cp >> 6) & 0x3f)));
+        value.push_back((char)(0x80 | (cp & 0x3f)));
+      }
+      else
+      {
+        value.push_back((char)(0xf0 | (cp >> 18)));
+        value.push_back((char)(0x80 | ((cp >> 12) & 0x3f)));
+        value.push_back((char)(0x80 | ((cp >> 6) & 0x3f)));
+        value.push_back((char)(0x80 | (cp & 0x3f)));
+      }
+    }
+
+    unsigned
+    JSONReader::readHex4(void)
+    {
+      if (m_end - m_ptr < 4)
+        error("truncated unicode escape");
+
+      unsigned cp = 0;
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        int digit = hexValue(*m_ptr);
+        if (digit < 0)
+          error("invalid unicode escape");
+
+        cp = (cp << 4) | (unsigned)digit;
+        ++m_ptr;
+      }
+
+      return cp;
+    }
+
+    int64_t
+    JSONReader::readSigned(int64_t min, int64_t max)
+    {
+      readToken();
+
+      char* end = NULL;
+      errno = 0;
+      long long value = std::strtoll(m_token.c_str(), &end, 10);
+      if (end != m_token.c_str() + m_token.size() || m_token.empty())
+        error("expected integer");
+
+      if (errno == ERANGE || value < min || value > max)
+        error("integer out of range");
+
+      return value;
+    }
+
+    uint64_t
+    JSONReader::readUnsigned(uint64_t max)
+    {
+      readToken();
+
+      if (m_token.empty() || m_token[0] == '-')
+        error("expected unsigned integer");
+
+      char* end = NULL;
+      errno = 0;
+      unsigned long long value = std::strtoull(m_token.c_str(), &end, 10);
+      if (end != m_token.c_str() + m_token.size())
+        error("expected unsigned integer");
+
+      if (errno == ERANGE || value > max)
+        error("integer out of range");
+
+      return value;
+    }
+
+    double
+    JSONReader::readReal(void)
+    {
+      readToken();
+
+      char* end = NULL;
+      double value = std::strtod(m_token.c_str(), &end);
+      if (end != m_token.c_str() + m_token.size() || m_token.empty())
+        error("expected number");
+
+      return value;
+    }
+  }
+}
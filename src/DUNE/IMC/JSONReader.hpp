@@ -0,0 +1,248 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IMC_JSON_READER_HPP_INCLUDED_
+#define DUNE_IMC_JSON_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Forward declarations.
+    class Message;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM JSONReader;
+
+    //! Streaming JSON decoder producing IMC messages without building
+    //! an intermediate document tree. The input may hold a single
+    //! message object, a sequence of message objects (JSON lines) or
+    //! an array of message objects. The first member of every message
+    //! object must be "abbrev". Scalar values may be given either as
+    //! JSON numbers or as quoted strings. Malformed input raises
+    //! InvalidJSON.
+    class JSONReader
+    {
+    public:
+      //! Constructor. The input is not copied and must outlive the reader.
+      //! @param[in] data input data.
+      //! @param[in] size size of input data.
+      JSONReader(const char* data, size_t size);
+
+      //! Read the next message of the input.
+      //! @return message (ownership is transferred to the caller)
+      //! or NULL if the end of input was reached.
+      Message*
+      readMessage(void);
+
+      //! Read a message object at the current position.
+      //! @return message (ownership is transferred to the caller).
+      Message*
+      readObject(void);
+
+      //! Get current offset in the input.
+      //! @return offset in bytes.
+      size_t
+      getOffset(void) const
+      {
+        return m_ptr - m_begin;
+      }
+
+      //! Begin reading an object.
+      void
+      beginObject(void);
+
+      //! Advance to the next member of the current object.
+      //! @param[out] name member name.
+      //! @return true if a member was found, false if the object ended.
+      bool
+      nextMember(std::string& name);
+
+      //! Begin reading an array.
+      void
+      beginArray(void);
+
+      //! Advance to the next element of the current array.
+      //! @return true if an element was found, false if the array ended.
+      bool
+      nextElement(void);
+
+      //! Consume a null value, if present. Both null and "null" are
+      //! accepted.
+      //! @return true if a null value was consumed, false otherwise.
+      bool
+      readNull(void);
+
+      //! Skip the value at the current position.
+      void
+      skipValue(void);
+
+      void
+      read(int8_t& value)
+      {
+        value = (int8_t)readSigned(-128, 127);
+      }
+
+      void
+      read(int16_t& value)
+      {
+        value = (int16_t)readSigned(-32768, 32767);
+      }
+
+      void
+      read(int32_t& value)
+      {
+        value = (int32_t)readSigned(-2147483647 - 1, 2147483647);
+      }
+
+      void
+      read(int64_t& value)
+      {
+        value = readSigned(INT64_MIN, INT64_MAX);
+      }
+
+      void
+      read(uint8_t& value)
+      {
+        value = (uint8_t)readUnsigned(0xff);
+      }
+
+      void
+      read(uint16_t& value)
+      {
+        value = (uint16_t)readUnsigned(0xffff);
+      }
+
+      void
+      read(uint32_t& value)
+      {
+        value = (uint32_t)readUnsigned(0xffffffff);
+      }
+
+      void
+      read(uint64_t& value)
+      {
+        value = readUnsigned(UINT64_MAX);
+      }
+
+      void
+      read(float& value)
+      {
+        value = (float)readReal();
+      }
+
+      void
+      read(double& value)
+      {
+        value = readReal();
+      }
+
+      void
+      read(std::string& value);
+
+      //! Read a byte array from an hexadecimal string.
+      void
+      read(std::vector<char>& value);
+
+    private:
+      //! Start of input.
+      const char* m_begin;
+      //! Current position.
+      const char* m_ptr;
+      //! End of input.
+      const char* m_end;
+      //! True while reading a top-level array of messages.
+      bool m_array;
+      //! Flags of each open container (see c_scope_* in the source).
+      std::vector<uint8_t> m_scopes;
+      //! Scratch buffer for scalar tokens.
+      std::string m_token;
+      //! Scratch buffer for member names.
+      std::string m_name;
+
+      //! Raise InvalidJSON at the current position.
+      void
+      error(const char* what) const;
+
+      //! Skip white space.
+      void
+      skipSpace(void);
+
+      //! Consume a given character, skipping leading white space.
+      void
+      expect(char c);
+
+      //! Open a container.
+      void
+      enter(char open, uint8_t flags);
+
+      //! Advance to the next entry of the innermost container.
+      //! @param[in] close closing character of the container.
+      //! @return true if an entry was found, false if the container ended.
+      bool
+      next(char close);
+
+      //! Read a string or bare scalar token into m_token.
+      void
+      readToken(void);
+
+      //! Read a quoted string.
+      void
+      readString(std::string& value);
+
+      //! Read a \\u escape sequence (without the leading \\u) and
+      //! append it as UTF-8.
+      void
+      readUnicode(std::string& value);
+
+      //! Read four hexadecimal digits.
+      unsigned
+      readHex4(void);
+
+      int64_t
+      readSigned(int64_t min, int64_t max);
+
+      uint64_t
+      readUnsigned(uint64_t max);
+
+      double
+      readReal(void);
+    };
+  }
+}
+
+#endif
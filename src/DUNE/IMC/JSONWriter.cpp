@@ -0,0 +1,290 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/IMC/JSONWriter.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Hexadecimal digits.
+    static const char c_hex[] = "0123456789abcdef";
+
+    JSONWriter::JSONWriter(size_t capacity)
+    {
+      m_data.reserve(capacity);
+    }
+
+    void
+    JSONWriter::beginObject(void)
+    {
+      writeLabel(NULL);
+      m_data.push_back('{');
+      m_first.push_back(true);
+    }
+
+    void
+    JSONWriter::beginObject(const char* label)
+    {
+      writeLabel(label);
+      m_data.push_back('{');
+      m_first.push_back(true);
+    }
+
+    void
+    JSONWriter::endObject(void)
+    {
+      m_data.push_back('}');
+      m_first.pop_back();
+    }
+
+    void
+    JSONWriter::beginArray(void)
+    {
+      writeLabel(NULL);
+      m_data.push_back('[');
+      m_first.push_back(true);
+    }
+
+    void
+    JSONWriter::beginArray(const char* label)
+    {
+      writeLabel(label);
+      m_data.push_back('[');
+      m_first.push_back(true);
+    }
+
+    void
+    JSONWriter::endArray(void)
+    {
+      m_data.push_back(']');
+      m_first.pop_back();
+    }
+
+    void
+    JSONWriter::writeNull(void)
+    {
+      writeLabel(NULL);
+      m_data.append("null", 4);
+    }
+
+    void
+    JSONWriter::writeNull(const char* label)
+    {
+      writeLabel(label);
+      m_data.append("null", 4);
+    }
+
+    void
+    JSONWriter::writeRaw(const char* data, size_t size)
+    {
+      writeLabel(NULL);
+      m_data.append(data, size);
+    }
+
+    void
+    JSONWriter::write(const char* label, float value)
+    {
+      char bfr[32];
+      // Use the shortest representation that survives a round trip.
+      int len = std::snprintf(bfr, sizeof(bfr), "%.7g", value);
+      if (std::strtof(bfr, NULL) != value)
+        len = std::snprintf(bfr, sizeof(bfr), "%.9g", value);
+
+      beginValue(label);
+      m_data.append(bfr, len);
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::write(const char* label, double value)
+    {
+      char bfr[32];
+      // Use the shortest representation that survives a round trip.
+      int len = std::snprintf(bfr, sizeof(bfr), "%.15g", value);
+      if (std::strtod(bfr, NULL) != value)
+        len = std::snprintf(bfr, sizeof(bfr), "%.17g", value);
+
+      beginValue(label);
+      m_data.append(bfr, len);
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::write(const char* label, const char* value)
+    {
+      beginValue(label);
+      writeEscaped(value, std::strlen(value));
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::write(const char* label, const std::string& value)
+    {
+      beginValue(label);
+      writeEscaped(value.data(), value.size());
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::write(const char* label, const std::vector<char>& value)
+    {
+      beginValue(label);
+
+      size_t offset = m_data.size();
+      m_data.resize(offset + value.size() * 2);
+      for (size_t i = 0; i < value.size(); ++i)
+      {
+        uint8_t byte = (uint8_t)value[i];
+        m_data[offset++] = c_hex[byte >> 4];
+        m_data[offset++] = c_hex[byte & 0x0f];
+      }
+
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::beginValue(const char* label)
+    {
+      writeLabel(label);
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::writeLabel(const char* label)
+    {
+      if (!m_first.empty())
+      {
+        if (m_first.back())
+          m_first.back() = false;
+        else
+          m_data.push_back(',');
+      }
+
+      if (label == NULL)
+        return;
+
+      m_data.push_back('"');
+      m_data.append(label);
+      m_data.append("\":", 2);
+    }
+
+    void
+    JSONWriter::writeEscaped(const char* str, size_t size)
+    {
+      const char* run = str;
+      const char* end = str + size;
+
+      for (const char* itr = str; itr != end; ++itr)
+      {
+        uint8_t c = (uint8_t)*itr;
+        if (c >= 0x20 && c != '"' && c != '\\')
+          continue;
+
+        m_data.append(run, itr - run);
+        run = itr + 1;
+
+        switch (c)
+        {
+          case '"':
+            m_data.append("\\\"", 2);
+            break;
+          case '\\':
+            m_data.append("\\\\", 2);
+            break;
+          case '\n':
+            m_data.append("\\n", 2);
+            break;
+          case '\r':
+            m_data.append("\\r", 2);
+            break;
+          case '\t':
+            m_data.append("\\t", 2);
+            break;
+          case '\b':
+            m_data.append("\\b", 2);
+            break;
+          case '\f':
+            m_data.append("\\f", 2);
+            break;
+          default:
+            {
+              char esc[6] = {'\\', 'u', '0', '0', c_hex[c >> 4], c_hex[c & 0x0f]};
+              m_data.append(esc, sizeof(esc));
+            }
+            break;
+        }
+      }
+
+      m_data.append(run, end - run);
+    }
+
+    void
+    JSONWriter::writeSigned(const char* label, int64_t value)
+    {
+      uint64_t mag = (value < 0) ? (~(uint64_t)value + 1) : (uint64_t)value;
+
+      beginValue(label);
+      if (value < 0)
+        m_data.push_back('-');
+      writeUnsignedDigits(mag);
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::writeUnsigned(const char* label, uint64_t value)
+    {
+      beginValue(label);
+      writeUnsignedDigits(value);
+      m_data.push_back('"');
+    }
+
+    void
+    JSONWriter::writeUnsignedDigits(uint64_t value)
+    {
+      char bfr[20];
+      char* ptr = bfr + sizeof(bfr);
+
+      do
+      {
+        *--ptr = (char)('0' + (value % 10));
+        value /= 10;
+      }
+      while (value != 0);
+
+      m_data.append(ptr, bfr + sizeof(bfr) - ptr);
+    }
+  }
+}
@@ -0,0 +1,233 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IMC_JSON_WRITER_HPP_INCLUDED_
+#define DUNE_IMC_JSON_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM JSONWriter;
+
+    //! Compact JSON encoder writing directly into a contiguous
+    //! buffer. Scalar values are written as quoted strings to remain
+    //! compatible with the output of Message::toJSON(std::ostream&).
+    class JSONWriter
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity initial buffer capacity.
+      JSONWriter(size_t capacity = 1024);
+
+      //! Discard all written data.
+      void
+      clear(void)
+      {
+        m_data.clear();
+        m_first.clear();
+      }
+
+      //! Get written data.
+      //! @return pointer to the first character.
+      const char*
+      getData(void) const
+      {
+        return m_data.data();
+      }
+
+      //! Get number of written characters.
+      //! @return number of characters.
+      size_t
+      getSize(void) const
+      {
+        return m_data.size();
+      }
+
+      //! Get written data as a string.
+      //! @return written data.
+      const std::string&
+      str(void) const
+      {
+        return m_data;
+      }
+
+      //! Begin an anonymous object (top-level or array element).
+      void
+      beginObject(void);
+
+      //! Begin a labelled object member.
+      //! @param[in] label member name.
+      void
+      beginObject(const char* label);
+
+      //! End current object.
+      void
+      endObject(void);
+
+      //! Begin an anonymous array (top-level or array element).
+      void
+      beginArray(void);
+
+      //! Begin a labelled array member.
+      //! @param[in] label member name.
+      void
+      beginArray(const char* label);
+
+      //! End current array.
+      void
+      endArray(void);
+
+      //! Write a null array element.
+      void
+      writeNull(void);
+
+      //! Write a null object member.
+      //! @param[in] label member name.
+      void
+      writeNull(const char* label);
+
+      //! Write a pre-encoded JSON value as an array element.
+      //! @param[in] data encoded value.
+      //! @param[in] size size of encoded value.
+      void
+      writeRaw(const char* data, size_t size);
+
+      //! Terminate a top-level value with a line feed (JSON lines).
+      void
+      newLine(void)
+      {
+        m_data.push_back('\n');
+      }
+
+      void
+      write(const char* label, int8_t value)
+      {
+        writeSigned(label, value);
+      }
+
+      void
+      write(const char* label, int16_t value)
+      {
+        writeSigned(label, value);
+      }
+
+      void
+      write(const char* label, int32_t value)
+      {
+        writeSigned(label, value);
+      }
+
+      void
+      write(const char* label, int64_t value)
+      {
+        writeSigned(label, value);
+      }
+
+      void
+      write(const char* label, uint8_t value)
+      {
+        writeUnsigned(label, value);
+      }
+
+      void
+      write(const char* label, uint16_t value)
+      {
+        writeUnsigned(label, value);
+      }
+
+      void
+      write(const char* label, uint32_t value)
+      {
+        writeUnsigned(label, value);
+      }
+
+      void
+      write(const char* label, uint64_t value)
+      {
+        writeUnsigned(label, value);
+      }
+
+      void
+      write(const char* label, float value);
+
+      void
+      write(const char* label, double value);
+
+      void
+      write(const char* label, const char* value);
+
+      void
+      write(const char* label, const std::string& value);
+
+      //! Write a byte array as an hexadecimal string.
+      void
+      write(const char* label, const std::vector<char>& value);
+
+    private:
+      //! Output buffer.
+      std::string m_data;
+      //! True for each open container that has no elements yet.
+      std::vector<bool> m_first;
+
+      //! Write separator, label and opening quote of a value.
+      void
+      beginValue(const char* label);
+
+      //! Write separator and label of a member.
+      void
+      writeLabel(const char* label);
+
+      //! Write string contents with JSON escaping.
+      void
+      writeEscaped(const char* str, size_t size);
+
+      void
+      writeSigned(const char* label, int64_t value);
+
+      void
+      writeUnsigned(const char* label, uint64_t value);
+
+      //! Write the decimal digits of an unsigned integer.
+      void
+      writeUnsignedDigits(uint64_t value);
+    };
+  }
+}
+
+#endif
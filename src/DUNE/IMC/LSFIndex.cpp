@@ -0,0 +1,248 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/IMC/LSFIndex.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Index file signature.
+    static const char c_signature[] = {'L', 'S', 'F', 'I'};
+    //! Size of the index file header.
+    static const size_t c_header_size = 8;
+    //! Size of the fixed part of a block.
+    static const size_t c_block_header_size = 34;
+    //! Size of a serialized key.
+    static const size_t c_key_size = 5;
+
+    bool
+    LSFIndex::Key::operator<(const Key& other) const
+    {
+      if (id != other.id)
+        return id < other.id;
+
+      if (src != other.src)
+        return src < other.src;
+
+      return src_ent < other.src_ent;
+    }
+
+    bool
+    LSFIndex::Key::operator==(const Key& other) const
+    {
+      return id == other.id && src == other.src && src_ent == other.src_ent;
+    }
+
+    bool
+    LSFIndex::Block::hasMessage(uint16_t id) const
+    {
+      Key key;
+      key.id = id;
+      key.src = 0;
+      key.src_ent = 0;
+
+      std::vector<Key>::const_iterator itr = std::lower_bound(keys.begin(), keys.end(), key);
+      return itr != keys.end() && itr->id == id;
+    }
+
+    std::string
+    LSFIndex::getPath(const std::string& lsf_path)
+    {
+      return lsf_path + ".idx";
+    }
+
+    LSFIndex::LSFIndex(void)
+    {
+      clear();
+    }
+
+    void
+    LSFIndex::clear(void)
+    {
+      m_blocks.clear();
+      m_block.begin = 0;
+      m_block.end = 0;
+      m_block.offset = 0;
+      m_block.size = 0;
+      m_block.count = 0;
+      m_block.keys.clear();
+    }
+
+    bool
+    LSFIndex::load(const std::string& path)
+    {
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        return false;
+
+      m_blocks.clear();
+
+      uint8_t bfr[c_block_header_size];
+      ifs.read((char*)bfr, c_header_size);
+      if (ifs.gcount() != (std::streamsize)c_header_size
+          || std::memcmp(bfr, c_signature, sizeof(c_signature)) != 0)
+        throw std::runtime_error("invalid LSF index: " + path);
+
+      uint16_t version;
+      Utils::ByteCopy::fromLE(version, bfr + 4);
+      if (version != c_version)
+        throw std::runtime_error("unsupported LSF index version: " + path);
+
+      while (true)
+      {
+        ifs.read((char*)bfr, c_block_header_size);
+
+        // A truncated block means the log was not closed properly:
+        // keep what was indexed so far.
+        if (ifs.gcount() != (std::streamsize)c_block_header_size)
+          break;
+
+        Block block;
+        uint16_t key_count;
+        Utils::ByteCopy::fromLE(block.begin, bfr);
+        Utils::ByteCopy::fromLE(block.end, bfr + 8);
+        Utils::ByteCopy::fromLE(block.offset, bfr + 16);
+        Utils::ByteCopy::fromLE(block.size, bfr + 24);
+        Utils::ByteCopy::fromLE(block.count, bfr + 28);
+        Utils::ByteCopy::fromLE(key_count, bfr + 32);
+
+        block.keys.resize(key_count);
+        bool truncated = false;
+        for (unsigned i = 0; i < key_count; ++i)
+        {
+          ifs.read((char*)bfr, c_key_size);
+          if (ifs.gcount() != (std::streamsize)c_key_size)
+          {
+            truncated = true;
+            break;
+          }
+
+          Utils::ByteCopy::fromLE(block.keys[i].id, bfr);
+          Utils::ByteCopy::fromLE(block.keys[i].src, bfr + 2);
+          block.keys[i].src_ent = bfr[4];
+        }
+
+        if (truncated)
+          break;
+
+        m_blocks.push_back(block);
+      }
+
+      return true;
+    }
+
+    size_t
+    LSFIndex::find(fp64_t time) const
+    {
+      for (size_t i = 0; i < m_blocks.size(); ++i)
+      {
+        if (m_blocks[i].end >= time)
+          return i;
+      }
+
+      return m_blocks.size();
+    }
+
+    void
+    LSFIndex::writeHeader(std::vector<char>& data)
+    {
+      uint8_t bfr[c_header_size];
+      std::memcpy(bfr, c_signature, sizeof(c_signature));
+      Utils::ByteCopy::toLE(c_version, bfr + 4);
+      Utils::ByteCopy::toLE((uint16_t)0, bfr + 6);
+      data.insert(data.end(), bfr, bfr + c_header_size);
+    }
+
+    void
+    LSFIndex::add(const Header& hdr, uint64_t offset, uint32_t size)
+    {
+      if (m_block.count == 0)
+      {
+        m_block.begin = hdr.timestamp;
+        m_block.end = hdr.timestamp;
+        m_block.offset = offset;
+      }
+      else
+      {
+        m_block.begin = std::min(m_block.begin, hdr.timestamp);
+        m_block.end = std::max(m_block.end, hdr.timestamp);
+      }
+
+      m_block.size += size;
+      ++m_block.count;
+
+      Key key;
+      key.id = hdr.mgid;
+      key.src = hdr.src;
+      key.src_ent = hdr.src_ent;
+
+      std::vector<Key>::iterator itr = std::lower_bound(m_block.keys.begin(), m_block.keys.end(), key);
+      if (itr == m_block.keys.end() || !(*itr == key))
+        m_block.keys.insert(itr, key);
+    }
+
+    void
+    LSFIndex::writeBlock(std::vector<char>& data)
+    {
+      if (m_block.count == 0)
+        return;
+
+      size_t base = data.size();
+      data.resize(base + c_block_header_size + m_block.keys.size() * c_key_size);
+      uint8_t* ptr = (uint8_t*)&data[base];
+
+      ptr += Utils::ByteCopy::toLE(m_block.begin, ptr);
+      ptr += Utils::ByteCopy::toLE(m_block.end, ptr);
+      ptr += Utils::ByteCopy::toLE(m_block.offset, ptr);
+      ptr += Utils::ByteCopy::toLE(m_block.size, ptr);
+      ptr += Utils::ByteCopy::toLE(m_block.count, ptr);
+      ptr += Utils::ByteCopy::toLE((uint16_t)m_block.keys.size(), ptr);
+
+      for (size_t i = 0; i < m_block.keys.size(); ++i)
+      {
+        ptr += Utils::ByteCopy::toLE(m_block.keys[i].id, ptr);
+        ptr += Utils::ByteCopy::toLE(m_block.keys[i].src, ptr);
+        ptr += Utils::ByteCopy::toLE(m_block.keys[i].src_ent, ptr);
+      }
+
+      m_block.size = 0;
+      m_block.count = 0;
+      m_block.keys.clear();
+    }
+  }
+}
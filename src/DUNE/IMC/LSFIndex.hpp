@@ -0,0 +1,183 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_INDEX_HPP_INCLUDED_
+#define DUNE_IMC_LSF_INDEX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Header.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LSFIndex;
+
+    //! Sidecar index of an LSF file. The LSF stream is divided in
+    //! consecutive blocks of packets and, for each block, the index
+    //! records the time span, the byte range in the (uncompressed)
+    //! LSF stream and the distinct message id/source/source entity
+    //! triplets it contains. This allows readers to seek by time and
+    //! skip blocks without messages of interest without decoding the
+    //! LSF file.
+    //!
+    //! The index file starts with a four byte signature ("LSFI")
+    //! followed by the format version (uint16_t) and a reserved
+    //! uint16_t. Each block is then stored as: begin and end time
+    //! (fp64_t), byte offset (uint64_t), size in bytes (uint32_t),
+    //! number of packets (uint32_t), number of keys (uint16_t) and
+    //! the keys themselves (uint16_t id, uint16_t source, uint8_t
+    //! source entity). All values are little-endian.
+    class LSFIndex
+    {
+    public:
+      //! Index file format version.
+      static const uint16_t c_version = 1;
+      //! Nominal number of LSF bytes per block.
+      static const uint32_t c_block_size = 65536;
+
+      //! Message key.
+      struct Key
+      {
+        //! Message identification number.
+        uint16_t id;
+        //! Source address.
+        uint16_t src;
+        //! Source entity.
+        uint8_t src_ent;
+
+        bool
+        operator<(const Key& other) const;
+
+        bool
+        operator==(const Key& other) const;
+      };
+
+      //! Block of packets.
+      struct Block
+      {
+        //! Lowest packet timestamp.
+        fp64_t begin;
+        //! Highest packet timestamp.
+        fp64_t end;
+        //! Offset of the first packet in the LSF stream.
+        uint64_t offset;
+        //! Number of bytes.
+        uint32_t size;
+        //! Number of packets.
+        uint32_t count;
+        //! Sorted list of distinct keys.
+        std::vector<Key> keys;
+
+        //! Test if the block contains messages with a given id.
+        //! @param[in] id message identification number.
+        //! @return true if the block contains the message, false otherwise.
+        bool
+        hasMessage(uint16_t id) const;
+      };
+
+      //! Retrieve the path of the index file of a given LSF file.
+      //! @param[in] lsf_path path to the LSF file (possibly compressed).
+      //! @return path to the index file.
+      static std::string
+      getPath(const std::string& lsf_path);
+
+      //! Default constructor.
+      LSFIndex(void);
+
+      //! Clear all blocks.
+      void
+      clear(void);
+
+      //! Load an index file.
+      //! @param[in] path path to the index file.
+      //! @return true if the index was loaded, false if the file does
+      //! not exist.
+      //! @throw std::runtime_error if the index file is not valid.
+      bool
+      load(const std::string& path);
+
+      //! Retrieve the list of blocks.
+      //! @return list of blocks.
+      const std::vector<Block>&
+      getBlocks(void) const
+      {
+        return m_blocks;
+      }
+
+      //! Find the first block with messages at or after a given time.
+      //! @param[in] time timestamp.
+      //! @return index of the block or the number of blocks if there
+      //! is no such block.
+      size_t
+      find(fp64_t time) const;
+
+      //! Write the index file header.
+      //! @param[out] data destination buffer (data is appended).
+      static void
+      writeHeader(std::vector<char>& data);
+
+      //! Account a packet in the block being built. Blocks are not
+      //! retained in memory: they must be written with writeBlock().
+      //! @param[in] hdr packet header.
+      //! @param[in] offset offset of the packet in the LSF stream.
+      //! @param[in] size packet size.
+      void
+      add(const Header& hdr, uint64_t offset, uint32_t size);
+
+      //! Test if the block being built has reached its nominal size.
+      //! @return true if the block is full, false otherwise.
+      bool
+      isBlockFull(void) const
+      {
+        return m_block.size >= c_block_size;
+      }
+
+      //! Serialize the block being built and start a new one. Does
+      //! nothing if the block being built is empty.
+      //! @param[out] data destination buffer (data is appended).
+      void
+      writeBlock(std::vector<char>& data);
+
+    private:
+      //! Loaded blocks.
+      std::vector<Block> m_blocks;
+      //! Block being built.
+      Block m_block;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,393 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/LSFReader.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Packet.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    LSFReader::LSFReader(const std::string& path):
+      m_path(path),
+      m_compressed(false),
+      m_is(NULL),
+      m_map(NULL),
+      m_map_size(0),
+      m_offset(0),
+      m_has_index(false),
+      m_block(0),
+      m_end_time(std::numeric_limits<fp64_t>::infinity()),
+      m_seeking(false),
+      m_seek_time(0)
+    {
+      if (!FileSystem::Path(path).isFile())
+        throw std::runtime_error("no such file: " + path);
+
+      m_compressed = Compression::Factory::detect(path.c_str()) != Compression::METHOD_UNKNOWN;
+      m_has_index = m_index.load(LSFIndex::getPath(path));
+      m_bfr.resize(DUNE_IMC_CONST_HEADER_SIZE + 65535 + DUNE_IMC_CONST_FOOTER_SIZE);
+
+      if (!m_compressed)
+        map();
+
+      if (m_map == NULL)
+        open();
+    }
+
+    LSFReader::~LSFReader(void)
+    {
+      delete m_is;
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_map != NULL)
+        munmap((void*)m_map, m_map_size);
+#endif
+    }
+
+    void
+    LSFReader::addFilter(uint16_t id)
+    {
+      if (m_filter.empty())
+        m_filter.resize(65536, false);
+
+      m_filter[id] = true;
+    }
+
+    void
+    LSFReader::addSourceFilter(uint16_t src)
+    {
+      if (m_src_filter.empty())
+        m_src_filter.resize(65536, false);
+
+      m_src_filter[src] = true;
+    }
+
+    void
+    LSFReader::clearFilter(void)
+    {
+      m_filter.clear();
+      m_src_filter.clear();
+    }
+
+    void
+    LSFReader::seek(fp64_t time)
+    {
+      uint64_t target = 0;
+
+      if (m_has_index)
+      {
+        const std::vector<LSFIndex::Block>& blocks = m_index.getBlocks();
+        size_t block = m_index.find(time);
+
+        if (block < blocks.size())
+          target = blocks[block].offset;
+        else if (!blocks.empty())
+          target = blocks.back().offset + blocks.back().size;
+      }
+
+      if (target < m_offset)
+        rewind();
+
+      skip(target - m_offset);
+
+      m_seeking = true;
+      m_seek_time = time;
+    }
+
+    void
+    LSFReader::rewind(void)
+    {
+      if (m_compressed)
+      {
+        open();
+      }
+      else if (m_map == NULL)
+      {
+        m_is->clear();
+        m_is->seekg(0, std::ios::beg);
+      }
+
+      m_offset = 0;
+      m_block = 0;
+      m_seeking = false;
+    }
+
+    Message*
+    LSFReader::next(void)
+    {
+      Header hdr;
+      const uint8_t* data = NULL;
+      uint32_t size = 0;
+
+      if (!readPacket(hdr, data, size, NULL))
+        return NULL;
+
+      return Packet::deserializePayload(hdr, data, size, NULL);
+    }
+
+    bool
+    LSFReader::next(Message& msg)
+    {
+      Header hdr;
+      const uint8_t* data = NULL;
+      uint32_t size = 0;
+
+      if (!readPacket(hdr, data, size, &msg))
+        return false;
+
+      Packet::deserializePayload(hdr, data, size, &msg);
+      return true;
+    }
+
+    bool
+    LSFReader::nextPacket(Header& hdr, const uint8_t*& data, uint32_t& size)
+    {
+      return readPacket(hdr, data, size, NULL);
+    }
+
+    bool
+    LSFReader::readPacket(Header& hdr, const uint8_t*& data, uint32_t& size, const Message* msg)
+    {
+      const std::vector<LSFIndex::Block>& blocks = m_index.getBlocks();
+
+      while (true)
+      {
+        while (m_block < blocks.size() && m_offset >= blocks[m_block].offset + blocks[m_block].size)
+          ++m_block;
+
+        if (m_block < blocks.size() && m_offset == blocks[m_block].offset)
+        {
+          const LSFIndex::Block& block = blocks[m_block];
+          if (!m_seeking && block.begin > m_end_time)
+            return false;
+
+          if (!accept(block) || (msg != NULL && !block.hasMessage(msg->getId())))
+          {
+            // Reading would have stopped inside this block.
+            if (!m_seeking && block.end > m_end_time)
+              return false;
+
+            // Seeking would have stopped inside this block.
+            if (m_seeking && block.end >= m_seek_time)
+              m_seeking = false;
+
+            skip(block.size);
+            continue;
+          }
+        }
+
+        if (!readHeader(hdr, data))
+          return false;
+
+        uint32_t remaining = hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+
+        if (m_seeking)
+        {
+          if (hdr.timestamp < m_seek_time)
+          {
+            skip(remaining);
+            continue;
+          }
+
+          m_seeking = false;
+        }
+
+        if (hdr.timestamp > m_end_time)
+          return false;
+
+        if (!accept(hdr.mgid, hdr.src) || (msg != NULL && hdr.mgid != msg->getId()))
+        {
+          skip(remaining);
+          continue;
+        }
+
+        if (m_map != NULL)
+        {
+          if (m_offset + remaining > m_map_size)
+            throw BufferTooShort();
+        }
+        else
+        {
+          m_is->read((char*)&m_bfr[DUNE_IMC_CONST_HEADER_SIZE], remaining);
+          if ((uint32_t)m_is->gcount() < remaining)
+            throw BufferTooShort();
+        }
+
+        m_offset += remaining;
+        size = DUNE_IMC_CONST_HEADER_SIZE + remaining;
+        return true;
+      }
+    }
+
+    void
+    LSFReader::open(void)
+    {
+      delete m_is;
+
+      Compression::Methods method = Compression::Factory::detect(m_path.c_str());
+      if (method == Compression::METHOD_UNKNOWN)
+        m_is = new std::ifstream(m_path.c_str(), std::ios::binary);
+      else
+        m_is = new Compression::FileInput(m_path.c_str(), method);
+    }
+
+    void
+    LSFReader::map(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      int fd = ::open(m_path.c_str(), O_RDONLY);
+      if (fd < 0)
+        return;
+
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0 && (uint64_t)st.st_size <= (size_t)-1)
+      {
+        void* ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED)
+        {
+          m_map = (const uint8_t*)ptr;
+          m_map_size = st.st_size;
+#  if defined(MADV_SEQUENTIAL)
+          madvise(ptr, m_map_size, MADV_SEQUENTIAL);
+#  endif
+        }
+      }
+
+      // The mapping remains valid after the descriptor is closed.
+      ::close(fd);
+#endif
+    }
+
+    bool
+    LSFReader::accept(const LSFIndex::Block& block) const
+    {
+      if (m_seeking && block.end < m_seek_time)
+        return false;
+
+      if (m_filter.empty() && m_src_filter.empty())
+        return true;
+
+      for (size_t i = 0; i < block.keys.size(); ++i)
+      {
+        if (accept(block.keys[i].id, block.keys[i].src))
+          return true;
+      }
+
+      return false;
+    }
+
+    void
+    LSFReader::skip(uint64_t size)
+    {
+      if (size == 0)
+        return;
+
+      m_offset += size;
+
+      // Mapped files need no I/O.
+      if (m_map != NULL)
+        return;
+
+      if (!m_compressed)
+      {
+        m_is->seekg(size, std::ios::cur);
+        return;
+      }
+
+      // Decompressing streams only support reads.
+      while (size > 0 && !m_is->eof())
+      {
+        size_t count = std::min(size, (uint64_t)m_bfr.size());
+        m_is->read((char*)&m_bfr[0], count);
+        size -= count;
+      }
+    }
+
+    bool
+    LSFReader::readHeader(Header& hdr, const uint8_t*& data)
+    {
+      if (m_map != NULL)
+      {
+        // Like streams, ignore an incomplete header at the end.
+        if (m_offset + DUNE_IMC_CONST_HEADER_SIZE > m_map_size)
+          return false;
+
+        data = m_map + m_offset;
+        Packet::deserializeHeader(hdr, data, DUNE_IMC_CONST_HEADER_SIZE);
+        m_offset += DUNE_IMC_CONST_HEADER_SIZE;
+        return true;
+      }
+
+      m_is->read((char*)&m_bfr[0], DUNE_IMC_CONST_HEADER_SIZE);
+
+      // If we're at the EOF there's nothing more to do.
+      if (m_is->eof())
+        return false;
+
+      if (m_is->gcount() < DUNE_IMC_CONST_HEADER_SIZE)
+        throw BufferTooShort();
+
+      data = &m_bfr[0];
+      Packet::deserializeHeader(hdr, data, DUNE_IMC_CONST_HEADER_SIZE);
+      m_offset += DUNE_IMC_CONST_HEADER_SIZE;
+      return true;
+    }
+  }
+}
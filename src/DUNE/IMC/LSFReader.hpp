@@ -0,0 +1,233 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_READER_HPP_INCLUDED_
+#define DUNE_IMC_LSF_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <istream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/LSFIndex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LSFReader;
+
+    // Forward declarations.
+    class Message;
+
+    //! Reader of LSF files (plain or compressed). Uncompressed files
+    //! are memory-mapped when the system supports it, so packets are
+    //! accessed in place without copies. When the sidecar
+    //! index written by the logger is available, the reader uses it
+    //! to seek by time and to skip blocks without messages of
+    //! interest. Packets that do not match the message, source or
+    //! time filters are skipped by looking only at their headers, and
+    //! matching packets can be retrieved either as raw bytes or as
+    //! message objects.
+    class LSFReader
+    {
+    public:
+      //! Open an LSF file.
+      //! @param[in] path path to the LSF file.
+      //! @throw std::runtime_error if the file cannot be opened.
+      LSFReader(const std::string& path);
+
+      //! Destructor.
+      ~LSFReader(void);
+
+      //! Test if the LSF file has an index.
+      //! @return true if the index is available, false otherwise.
+      bool
+      hasIndex(void) const
+      {
+        return m_has_index;
+      }
+
+      //! Retrieve the index of the LSF file.
+      //! @return index.
+      const LSFIndex&
+      getIndex(void) const
+      {
+        return m_index;
+      }
+
+      //! Only return messages with a given id. Can be called several
+      //! times to accept several messages.
+      //! @param[in] id message identification number.
+      void
+      addFilter(uint16_t id);
+
+      //! Only return messages from a given source address. Can be
+      //! called several times to accept several sources.
+      //! @param[in] src source address.
+      void
+      addSourceFilter(uint16_t src);
+
+      //! Stop reading when a message with a timestamp greater than a
+      //! given time is found.
+      //! @param[in] time timestamp.
+      void
+      setEndTime(fp64_t time)
+      {
+        m_end_time = time;
+      }
+
+      //! Return all messages, regardless of their ids and sources.
+      void
+      clearFilter(void);
+
+      //! Position the reader at the first message (in file order)
+      //! whose timestamp is equal to or greater than a given time.
+      //! Messages after that one are returned regardless of their
+      //! timestamps.
+      //! @param[in] time timestamp.
+      void
+      seek(fp64_t time);
+
+      //! Position the reader at the beginning of the file.
+      void
+      rewind(void);
+
+      //! Read the next message that matches the filter.
+      //! @return message object (owned by the caller) or NULL at the
+      //! end of the file.
+      Message*
+      next(void);
+
+      //! Read the next message that matches the filter and has the
+      //! same id as a caller-provided message object. Messages with
+      //! other ids are skipped.
+      //! @param[out] msg message object where to deserialize the message.
+      //! @return true if a message was read, false at the end of the file.
+      bool
+      next(Message& msg);
+
+      //! Read the next packet that matches the filter, without
+      //! decoding it. The packet is not validated.
+      //! @param[out] hdr packet header.
+      //! @param[out] data packet data (header, payload and footer),
+      //! valid until the next call to this reader (or, for mapped
+      //! files, until the reader is destroyed).
+      //! @param[out] size packet size.
+      //! @return true if a packet was read, false at the end of the file.
+      bool
+      nextPacket(Header& hdr, const uint8_t*& data, uint32_t& size);
+
+    private:
+      //! Path to the LSF file.
+      std::string m_path;
+      //! True if the LSF file is compressed.
+      bool m_compressed;
+      //! Input stream (NULL if the file is mapped).
+      std::istream* m_is;
+      //! Mapped file contents.
+      const uint8_t* m_map;
+      //! Size of the mapped file.
+      uint64_t m_map_size;
+      //! Offset of the next packet in the (uncompressed) LSF stream.
+      uint64_t m_offset;
+      //! LSF index.
+      LSFIndex m_index;
+      //! True if the index is available.
+      bool m_has_index;
+      //! Block containing the next packet.
+      size_t m_block;
+      //! Accepted message ids (empty to accept all).
+      std::vector<bool> m_filter;
+      //! Accepted source addresses (empty to accept all).
+      std::vector<bool> m_src_filter;
+      //! Time after which reading stops.
+      fp64_t m_end_time;
+      //! True if messages older than m_seek_time must be skipped.
+      bool m_seeking;
+      //! Seek target time.
+      fp64_t m_seek_time;
+      //! Packet buffer.
+      std::vector<uint8_t> m_bfr;
+
+      //! Open the input stream.
+      void
+      open(void);
+
+      //! Map the file in memory, if possible.
+      void
+      map(void);
+
+      //! Read the next packet that matches the filter.
+      //! @param[out] hdr packet header.
+      //! @param[out] data packet data.
+      //! @param[out] size packet size.
+      //! @param[in] msg if not NULL, only packets with the same id as
+      //! this message are accepted.
+      //! @return true if a packet was read, false at the end of the file.
+      bool
+      readPacket(Header& hdr, const uint8_t*& data, uint32_t& size, const Message* msg);
+
+      //! Test if a message passes the message and source filters.
+      //! @param[in] id message identification number.
+      //! @param[in] src source address.
+      //! @return true if the message is accepted, false otherwise.
+      bool
+      accept(uint16_t id, uint16_t src) const
+      {
+        return (m_filter.empty() || m_filter[id])
+        && (m_src_filter.empty() || m_src_filter[src]);
+      }
+
+      //! Test if a block may contain messages to return.
+      //! @param[in] block block.
+      //! @return true if the block may contain messages, false otherwise.
+      bool
+      accept(const LSFIndex::Block& block) const;
+
+      //! Skip data of the LSF stream.
+      //! @param[in] size number of bytes to skip.
+      void
+      skip(uint64_t size);
+
+      //! Read the header of the next packet.
+      //! @param[out] hdr packet header.
+      //! @param[out] data start of the packet data.
+      //! @return true if a header was read, false at the end of the file.
+      bool
+      readHeader(Header& hdr, const uint8_t*& data);
+    };
+  }
+}
+
+#endif
@@ -81,5 +81,19 @@ namespace DUNE
       fieldsToJSON(os, c_nindent);
       os << "\n}\n";
     }
+
+    void
+    Message::toJSON(JSONWriter& writer) const
+    {
+      writer.beginObject();
+      writer.write("abbrev", getName());
+      writer.write("timestamp", getTimeStamp());
+      writer.write("src", getSource());
+      writer.write("src_ent", getSourceEntity());
+      writer.write("dst", getDestination());
+      writer.write("dst_ent", getDestinationEntity());
+      fieldsToJSON(writer);
+      writer.endObject();
+    }
   }
 }
@@ -30,6 +30,13 @@
 #ifndef DUNE_IMC_MESSAGE_HPP_INCLUDED_
 #define DUNE_IMC_MESSAGE_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// ISO C++ 11 headers.
+#include <atomic>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Time/Clock.hpp>
@@ -37,6 +44,9 @@
 #include <DUNE/IMC/Header.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/JSONReader.hpp>
 
 namespace DUNE
 {
@@ -51,7 +61,9 @@ namespace DUNE
     {
     public:
       //! Default constructor.
-      Message(void)
+      Message(void):
+        m_cache(NULL),
+        m_cache_enabled(false)
       {
         m_header.src = AddressResolver::invalid();
         m_header.src_ent = DUNE_IMC_CONST_UNK_EID;
@@ -60,10 +72,90 @@ namespace DUNE
         m_header.timestamp = -1.0;
       }
 
+      //! Copy constructor. The serialization cache is not copied.
+      //! @param[in] other message to copy.
+      Message(const Message& other):
+        m_header(other.m_header),
+        m_cache(NULL),
+        m_cache_enabled(false)
+      { }
+
       //! Default destructor.
       virtual
       ~Message(void)
-      { }
+      {
+        delete m_cache.load(std::memory_order_relaxed);
+      }
+
+      //! Allocate storage for a message from the message pool.
+      //! @param[in] size message size.
+      //! @return message storage.
+      static void*
+      operator new(size_t size)
+      {
+        return MessagePool::allocate(size);
+      }
+
+      //! Return the storage of a message to the message pool.
+      //! @param[in] ptr message storage.
+      //! @param[in] size message size.
+      static void
+      operator delete(void* ptr, size_t size)
+      {
+        MessagePool::release(ptr, size);
+      }
+
+      //! Assignment operator. The serialization cache is not copied.
+      //! @param[in] other message to copy.
+      //! @return this message.
+      Message&
+      operator=(const Message& other)
+      {
+        m_header = other.m_header;
+        invalidateSerializationCache();
+        return *this;
+      }
+
+      //! Allow the serialized packet of this message to be computed
+      //! once and reused by every subsequent serialization. Must only
+      //! be called for messages that will not be modified anymore,
+      //! such as messages shared by several bus recipients.
+      void
+      enableSerializationCache(void)
+      {
+        m_cache_enabled = true;
+      }
+
+      //! Test if the serialized packet of this message can be cached.
+      //! @return true if caching is enabled, false otherwise.
+      bool
+      isSerializationCacheEnabled(void) const
+      {
+        return m_cache_enabled;
+      }
+
+      //! Retrieve the cached serialized packet.
+      //! @return serialized packet or NULL if not available.
+      const std::vector<uint8_t>*
+      getSerializationCache(void) const
+      {
+        return m_cache.load(std::memory_order_acquire);
+      }
+
+      //! Store the serialized packet of this message. Several threads
+      //! may race to store it, in which case the first one wins.
+      //! @param[in] data serialized packet (ownership is taken).
+      //! @return cached serialized packet.
+      const std::vector<uint8_t>*
+      setSerializationCache(std::vector<uint8_t>* data) const
+      {
+        std::vector<uint8_t>* expected = NULL;
+        if (m_cache.compare_exchange_strong(expected, data, std::memory_order_acq_rel))
+          return data;
+
+        delete data;
+        return expected;
+      }
 
       //! Retrieve a copy of the message.
       //! @return message copy.
@@ -97,6 +189,7 @@ namespace DUNE
       double
       setTimeStamp(double ts)
       {
+        invalidateSerializationCache();
         m_header.timestamp = ts;
         setTimeStampNested(ts);
         return m_header.timestamp;
@@ -131,6 +224,7 @@ namespace DUNE
       void
       setSource(uint16_t src)
       {
+        invalidateSerializationCache();
         m_header.src = src;
         setSourceNested(src);
       }
@@ -148,6 +242,7 @@ namespace DUNE
       void
       setSourceEntity(uint8_t src_ent)
       {
+        invalidateSerializationCache();
         m_header.src_ent = src_ent;
         setSourceEntityNested(src_ent);
       }
@@ -165,6 +260,7 @@ namespace DUNE
       void
       setDestination(uint16_t dst)
       {
+        invalidateSerializationCache();
         m_header.dst = dst;
         setDestinationNested(dst);
       }
@@ -182,6 +278,7 @@ namespace DUNE
       void
       setDestinationEntity(uint8_t dst_ent)
       {
+        invalidateSerializationCache();
         m_header.dst_ent = dst_ent;
         setDestinationEntityNested(dst_ent);
       }
@@ -263,6 +360,11 @@ namespace DUNE
       void
       toJSON(std::ostream& os) const;
 
+      //! Output the message as a compact JSON object.
+      //! @param writer JSON writer.
+      void
+      toJSON(JSONWriter& writer) const;
+
       //! Output the message in human readable text.
       //! @param os output stream.
       void
@@ -298,6 +400,26 @@ namespace DUNE
         (void)indent_level;
       }
 
+      //! Output the message fields (excluding header) to a JSON writer.
+      //! @param writer JSON writer.
+      virtual void
+      fieldsToJSON(JSONWriter& writer) const
+      {
+        (void)writer;
+      }
+
+      //! Read the value of a message field from a JSON reader.
+      //! @param name field name.
+      //! @param reader JSON reader positioned at the field value.
+      //! @return true if the field exists, false otherwise.
+      virtual bool
+      fieldFromJSON(const std::string& name, JSONReader& reader)
+      {
+        (void)name;
+        (void)reader;
+        return false;
+      }
+
       //! Compare messages for equality.
       //! @param[in] other message to compare.
       //! @return true if messages are equal, false otherwise.
@@ -317,6 +439,13 @@ namespace DUNE
       //! Message header.
       Header m_header;
 
+      //! Discard the cached serialized packet.
+      void
+      invalidateSerializationCache(void)
+      {
+        delete m_cache.exchange(NULL, std::memory_order_acq_rel);
+      }
+
       //! Set the timestamp of nested messages.
       //! @param[in] value timestamp.
       virtual void
@@ -366,6 +495,12 @@ namespace DUNE
         (void)other;
         return true;
       }
+
+    private:
+      //! Cached serialized packet.
+      mutable std::atomic<std::vector<uint8_t>*> m_cache;
+      //! True if the serialized packet can be cached.
+      bool m_cache_enabled;
     };
   }
 }
@@ -40,6 +40,8 @@
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Serialization.hpp>
 #include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/JSONWriter.hpp>
+#include <DUNE/IMC/JSONReader.hpp>
 
 namespace DUNE
 {
@@ -364,6 +366,57 @@ namespace DUNE
         os << "]";
       }
 
+      void
+      toJSON(JSONWriter& writer, const char* label) const
+      {
+        writer.beginArray(label);
+
+        for (unsigned i = 0; i < m_list.size(); ++i)
+        {
+          if (m_list[i] == NULL)
+          {
+            writer.writeNull();
+          }
+          else
+          {
+            writer.beginObject();
+            writer.write("abbrev", m_list[i]->getName());
+            m_list[i]->fieldsToJSON(writer);
+            writer.endObject();
+          }
+        }
+
+        writer.endArray();
+      }
+
+      void
+      fromJSON(JSONReader& reader)
+      {
+        clear();
+        reader.beginArray();
+
+        while (reader.nextElement())
+        {
+          if (reader.readNull())
+          {
+            m_list.push_back(NULL);
+            continue;
+          }
+
+          Message* msg = reader.readObject();
+          Type* m = dynamic_cast<Type*>(msg);
+          if (m == NULL)
+          {
+            // With Type = Message the cast only fails for a NULL message.
+            uint16_t id = (msg == NULL) ? 0 : msg->getId();
+            delete msg;
+            throw InvalidMessageId(id);
+          }
+
+          m_list.push_back(m);
+        }
+      }
+
       void
       setTimeStamp(double value)
       {
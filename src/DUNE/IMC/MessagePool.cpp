@@ -0,0 +1,305 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <new>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Granularity of size classes.
+    static const size_t c_granularity = 16;
+    //! Number of size classes.
+    static const size_t c_classes = MessagePool::c_max_size / c_granularity;
+    //! Size of the chunks requested from the heap.
+    static const size_t c_chunk_size = 16384;
+    //! Number of bytes moved at once between a thread cache and the
+    //! shared free lists.
+    static const size_t c_batch_size = 4096;
+
+    //! Unused block.
+    struct FreeBlock
+    {
+      //! Next unused block of the same size class.
+      FreeBlock* next;
+    };
+
+    //! Blocks of a given size.
+    struct SizeClass
+    {
+      //! Free list lock.
+      Concurrency::Mutex lock;
+      //! First unused block.
+      FreeBlock* free;
+      //! Bytes requested from the heap.
+      size_t reserved;
+
+      SizeClass(void):
+        free(NULL),
+        reserved(0)
+      { }
+    };
+
+    //! Retrieve the table of size classes. The table is created on
+    //! first use and never destroyed, since messages with static
+    //! storage duration may be released after static destructors
+    //! have run.
+    //! @return size classes.
+    static SizeClass*
+    getClasses(void)
+    {
+      static SizeClass* classes = new SizeClass[c_classes];
+      return classes;
+    }
+
+    //! Carve a new chunk into blocks of a size class. Must be called
+    //! with the size class lock held.
+    //! @param[in] sc size class.
+    //! @param[in] block_size block size.
+    static void
+    refill(SizeClass& sc, size_t block_size)
+    {
+      uint8_t* chunk = static_cast<uint8_t*>(::operator new(c_chunk_size));
+      size_t count = c_chunk_size / block_size;
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + i * block_size);
+        block->next = sc.free;
+        sc.free = block;
+      }
+
+      sc.reserved += c_chunk_size;
+    }
+
+    //! Retrieve the size class index of an object size.
+    //! @param[in] size object size.
+    //! @return size class index.
+    static inline size_t
+    getIndex(size_t size)
+    {
+      return (size == 0) ? 0 : (size - 1) / c_granularity;
+    }
+
+    //! Retrieve the number of blocks moved at once between a thread
+    //! cache and the shared free list of a size class.
+    //! @param[in] index size class index.
+    //! @return number of blocks.
+    static inline size_t
+    getBatchSize(size_t index)
+    {
+      size_t count = c_batch_size / ((index + 1) * c_granularity);
+      return (count == 0) ? 1 : count;
+    }
+
+    //! Move blocks from the shared free list of a size class to a
+    //! list, carving new chunks if needed.
+    //! @param[in] index size class index.
+    //! @param[in] count number of blocks.
+    //! @return first block of a list of count blocks.
+    static FreeBlock*
+    takeBlocks(size_t index, size_t count)
+    {
+      SizeClass& sc = getClasses()[index];
+      FreeBlock* head = NULL;
+
+      Concurrency::ScopedMutex l(sc.lock);
+      for (size_t i = 0; i < count; ++i)
+      {
+        if (sc.free == NULL)
+          refill(sc, (index + 1) * c_granularity);
+
+        FreeBlock* block = sc.free;
+        sc.free = block->next;
+        block->next = head;
+        head = block;
+      }
+
+      return head;
+    }
+
+    //! Move a list of blocks to the shared free list of a size class.
+    //! @param[in] index size class index.
+    //! @param[in] head first block of the list.
+    //! @param[in] tail last block of the list.
+    static void
+    giveBlocks(size_t index, FreeBlock* head, FreeBlock* tail)
+    {
+      SizeClass& sc = getClasses()[index];
+
+      Concurrency::ScopedMutex l(sc.lock);
+      tail->next = sc.free;
+      sc.free = head;
+    }
+
+    struct ThreadCache;
+
+    //! Cache of the calling thread, NULL if not created yet or
+    //! already destroyed.
+    static thread_local ThreadCache* t_cache = NULL;
+    //! True if the cache of the calling thread was destroyed.
+    static thread_local bool t_cache_destroyed = false;
+
+    //! Blocks cached by a thread, so that most allocations and
+    //! releases do not touch the shared free lists. Each size class
+    //! holds at most two batches; the cache is emptied into the
+    //! shared free lists when the thread exits.
+    struct ThreadCache
+    {
+      //! First cached block, by size class.
+      FreeBlock* free[c_classes];
+      //! Number of cached blocks, by size class.
+      size_t count[c_classes];
+
+      ThreadCache(void)
+      {
+        for (size_t i = 0; i < c_classes; ++i)
+        {
+          free[i] = NULL;
+          count[i] = 0;
+        }
+      }
+
+      ~ThreadCache(void)
+      {
+        for (size_t i = 0; i < c_classes; ++i)
+        {
+          if (free[i] == NULL)
+            continue;
+
+          FreeBlock* tail = free[i];
+          while (tail->next != NULL)
+            tail = tail->next;
+
+          giveBlocks(i, free[i], tail);
+        }
+
+        t_cache = NULL;
+        t_cache_destroyed = true;
+      }
+    };
+
+    //! Retrieve the cache of the calling thread.
+    //! @return thread cache or NULL if the thread is exiting and its
+    //! cache was already destroyed.
+    static inline ThreadCache*
+    getThreadCache(void)
+    {
+      if (t_cache != NULL || t_cache_destroyed)
+        return t_cache;
+
+      static thread_local ThreadCache cache;
+      t_cache = &cache;
+      return t_cache;
+    }
+
+    void*
+    MessagePool::allocate(size_t size)
+    {
+      if (size > c_max_size)
+        return ::operator new(size);
+
+      size_t index = getIndex(size);
+      ThreadCache* cache = getThreadCache();
+      if (cache == NULL)
+        return takeBlocks(index, 1);
+
+      if (cache->free[index] == NULL)
+      {
+        cache->count[index] = getBatchSize(index);
+        cache->free[index] = takeBlocks(index, cache->count[index]);
+      }
+
+      FreeBlock* block = cache->free[index];
+      cache->free[index] = block->next;
+      --cache->count[index];
+      return block;
+    }
+
+    void
+    MessagePool::release(void* ptr, size_t size)
+    {
+      if (ptr == NULL)
+        return;
+
+      if (size > c_max_size)
+      {
+        ::operator delete(ptr);
+        return;
+      }
+
+      size_t index = getIndex(size);
+      FreeBlock* block = static_cast<FreeBlock*>(ptr);
+      ThreadCache* cache = getThreadCache();
+      if (cache == NULL)
+      {
+        giveBlocks(index, block, block);
+        return;
+      }
+
+      block->next = cache->free[index];
+      cache->free[index] = block;
+
+      // Messages released by a thread other than the one that
+      // produced them would pile up here: hand a batch back.
+      size_t batch = getBatchSize(index);
+      if (++cache->count[index] < 2 * batch)
+        return;
+
+      FreeBlock* tail = block;
+      for (size_t i = 1; i < batch; ++i)
+        tail = tail->next;
+
+      cache->free[index] = tail->next;
+      cache->count[index] -= batch;
+      giveBlocks(index, block, tail);
+    }
+
+    size_t
+    MessagePool::getReservedSize(void)
+    {
+      SizeClass* classes = getClasses();
+      size_t total = 0;
+
+      for (size_t i = 0; i < c_classes; ++i)
+      {
+        Concurrency::ScopedMutex l(classes[i].lock);
+        total += classes[i].reserved;
+      }
+
+      return total;
+    }
+  }
+}
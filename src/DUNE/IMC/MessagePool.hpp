@@ -0,0 +1,83 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IMC_MESSAGE_POOL_HPP_INCLUDED_
+#define DUNE_IMC_MESSAGE_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MessagePool;
+
+    //! Storage of message objects. Blocks are grouped by size class,
+    //! carved from large chunks and recycled through per-class free
+    //! lists, so that producing, cloning and deleting messages does
+    //! not go through the heap once the pool has warmed up. Each
+    //! thread keeps a small cache of blocks per size class, moved in
+    //! batches to and from the shared free lists, so that only one in
+    //! many allocations takes a lock. Chunks are never returned to
+    //! the heap: the pool keeps the memory needed by the peak number
+    //! of live messages.
+    class MessagePool
+    {
+    public:
+      //! Largest object size served by the pool. Bigger objects are
+      //! allocated on the heap.
+      static const size_t c_max_size = 1024;
+
+      //! Allocate storage for an object.
+      //! @param[in] size object size.
+      //! @return pointer to storage suitably aligned for any message.
+      static void*
+      allocate(size_t size);
+
+      //! Release storage obtained with allocate().
+      //! @param[in] ptr storage pointer (may be NULL).
+      //! @param[in] size object size given to allocate().
+      static void
+      release(void* ptr, size_t size);
+
+      //! Retrieve the number of bytes requested from the heap by the
+      //! pool.
+      //! @return number of bytes.
+      static size_t
+      getReservedSize(void);
+    };
+  }
+}
+
+#endif
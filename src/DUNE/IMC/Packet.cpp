@@ -29,6 +29,8 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
+#include <cstring>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Utils/ByteCopy.hpp>
@@ -43,8 +45,13 @@ namespace DUNE
 {
   namespace IMC
   {
-    uint16_t
-    Packet::serialize(const Message* msg, uint8_t* bfr, uint16_t size)
+    //! Serialize a message object, ignoring its serialization cache.
+    //! @param[in] msg message object.
+    //! @param[out] bfr destination buffer.
+    //! @param[in] size destination buffer size.
+    //! @return number of bytes written to the destination buffer.
+    static uint16_t
+    serializeMessage(const Message* msg, uint8_t* bfr, uint16_t size)
     {
       unsigned total = msg->getSerializationSize();
       if (total > DUNE_IMC_CONST_MAX_SIZE)
@@ -56,7 +63,7 @@ namespace DUNE
       if (size < n)
         throw BufferTooShort();
 
-      ptr += serializeHeader(msg, bfr, size);
+      ptr += Packet::serializeHeader(msg, bfr, size);
       msg->serializeFields(ptr);
 
       uint16_t crc = Algorithms::CRC16::compute(bfr, n - DUNE_IMC_CONST_FOOTER_SIZE);
@@ -65,10 +72,69 @@ namespace DUNE
       return n;
     }
 
+    //! Check the CRC of a packet.
+    //! @param[in] hdr packet header.
+    //! @param[in] bfr buffer holding the packet.
+    static void
+    checkCrc(const Header& hdr, const uint8_t* bfr)
+    {
+      // Retrieve CRC
+      uint16_t rcrc = 0;
+
+      if (hdr.sync == DUNE_IMC_CONST_SYNC_REV)
+        Utils::ByteCopy::rcopy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+      else
+        Utils::ByteCopy::copy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+
+      // Validate CRC.
+      uint16_t crc = Algorithms::CRC16::compute(bfr, DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+
+      if (crc != rcrc)
+        throw InvalidCrc();
+    }
+
+    //! Retrieve the cached serialized packet of a message, computing
+    //! it if needed.
+    //! @param[in] msg message object.
+    //! @return serialized packet or NULL if caching is not enabled.
+    static const std::vector<uint8_t>*
+    getCachedPacket(const Message* msg)
+    {
+      if (!msg->isSerializationCacheEnabled())
+        return NULL;
+
+      const std::vector<uint8_t>* cache = msg->getSerializationCache();
+      if (cache != NULL)
+        return cache;
+
+      unsigned total = msg->getSerializationSize();
+      if (total > DUNE_IMC_CONST_MAX_SIZE)
+        throw InvalidMessageSize(total);
+
+      std::vector<uint8_t>* data = new std::vector<uint8_t>(total);
+      serializeMessage(msg, &(*data)[0], total);
+      return msg->setSerializationCache(data);
+    }
+
+    uint16_t
+    Packet::serialize(const Message* msg, uint8_t* bfr, uint16_t size)
+    {
+      const std::vector<uint8_t>* cache = getCachedPacket(msg);
+      if (cache == NULL)
+        return serializeMessage(msg, bfr, size);
+
+      if (size < cache->size())
+        throw BufferTooShort();
+
+      std::memcpy(bfr, &(*cache)[0], cache->size());
+      return cache->size();
+    }
+
     uint16_t
     Packet::serialize(const Message* msg, Utils::ByteBuffer& bfr)
     {
-      unsigned size = msg->getSerializationSize();
+      const std::vector<uint8_t>* cache = getCachedPacket(msg);
+      unsigned size = (cache == NULL) ? msg->getSerializationSize() : cache->size();
       if (size > 65535)
         throw InvalidMessageSize(size);
 
@@ -79,6 +145,13 @@ namespace DUNE
     uint16_t
     Packet::serialize(const Message* msg, std::ostream& ofs)
     {
+      const std::vector<uint8_t>* cache = getCachedPacket(msg);
+      if (cache != NULL)
+      {
+        ofs.write((const char*)&(*cache)[0], cache->size());
+        return cache->size();
+      }
+
       unsigned total = msg->getSerializationSize();
       if (total > DUNE_IMC_CONST_MAX_SIZE)
         throw InvalidMessageSize(total);
@@ -219,27 +292,29 @@ namespace DUNE
       }
     }
 
+    void
+    Packet::validate(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len)
+    {
+      if (bfr_len < DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE
+          || hdr.size > bfr_len - (DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE))
+        throw BufferTooShort();
+
+      checkCrc(hdr, bfr);
+    }
+
     Message*
     Packet::deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg)
     {
       (void)bfr_len;
 
-      // Retrieve CRC
-      uint16_t rcrc = 0;
-
-      if (hdr.sync == DUNE_IMC_CONST_SYNC_REV)
-        Utils::ByteCopy::rcopy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
-      else
-        Utils::ByteCopy::copy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
-
-      // Validate CRC.
-      uint16_t crc = Algorithms::CRC16::compute(bfr, DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+      checkCrc(hdr, bfr);
 
-      if (crc != rcrc)
-        throw InvalidCrc();
+      // Only messages produced here are deleted on failure: the
+      // caller owns the message it passes in.
+      bool owned = (msg == NULL);
 
       // Produce a message of the given type.
-      if (msg == NULL)
+      if (owned)
       {
         msg = Factory::produce(hdr.mgid);
         if (msg == 0)
@@ -261,7 +336,8 @@ namespace DUNE
       }
       catch (...)
       {
-        delete msg;
+        if (owned)
+          delete msg;
         throw;
       }
 
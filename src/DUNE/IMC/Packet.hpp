@@ -91,6 +91,24 @@ namespace DUNE
       static void
       deserializeHeader(Header& hdr, const uint8_t* bfr, uint16_t bfr_len);
 
+      //! Check that a buffer holds the complete packet described by
+      //! a previously deserialized header and that its CRC is valid,
+      //! without decoding the message fields.
+      //! @param[in] hdr packet header.
+      //! @param[in] bfr buffer holding the packet.
+      //! @param[in] bfr_len buffer size.
+      static void
+      validate(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len);
+
+      //! Decode the payload of a packet whose header was already
+      //! deserialized.
+      //! @param[in] hdr packet header.
+      //! @param[in] bfr buffer holding the packet.
+      //! @param[in] bfr_len buffer size.
+      //! @param[in] msg message to decode into or NULL to produce a
+      //! new one. A message given by the caller is never deleted,
+      //! even if decoding fails.
+      //! @return decoded message.
       static Message*
       deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg);
     };
@@ -27,6 +27,10 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/IMC/Parser.hpp>
 #include <DUNE/IMC/Packet.hpp>
@@ -35,7 +39,21 @@ namespace DUNE
 {
   namespace IMC
   {
-    Parser::Parser(void)
+    //! Total size of header and footer.
+    static const size_t c_overhead = DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE;
+
+    //! Test if a byte belongs to a synchronization number (both byte
+    //! orders share the same two bytes).
+    //! @param[in] byte byte.
+    //! @return true if the byte may be part of a synchronization number.
+    static inline bool
+    isSyncByte(uint8_t byte)
+    {
+      return byte == (DUNE_IMC_CONST_SYNC >> 8) || byte == (DUNE_IMC_CONST_SYNC & 0xff);
+    }
+
+    Parser::Parser(void):
+      m_filter(NULL)
     {
       reset();
     }
@@ -46,91 +64,217 @@ namespace DUNE
     void
     Parser::reset(void)
     {
-      m_stage = c_sync;
-      m_pos = 0;
       m_buf.clear();
     }
 
     Message*
     Parser::parse(uint8_t byte)
     {
-      Message* m = 0;
-      m_buf.push_back(byte);
+      const uint8_t* data = &byte;
+      size_t size = 1;
+      return parse(data, size);
+    }
 
-      while (true)
+    Message*
+    Parser::parse(const uint8_t*& data, size_t& size)
+    {
+      if (!m_buf.empty())
       {
-        int n = m_buf.size() - m_pos;
+        Message* m = parsePending(data, size);
+        if (m != 0 || !m_buf.empty())
+          return m;
+      }
 
-        if (!n)
-        {
-          reset(); // discard unneeded data
+      while (size > 0)
+      {
+        size_t sync = findSync(data, size);
+        data += sync;
+        size -= sync;
+
+        if (size < DUNE_IMC_CONST_HEADER_SIZE)
           break;
+
+        Header hdr;
+        if (!parseHeader(data, hdr))
+        {
+          ++data;
+          --size;
+          continue;
         }
 
-        if (m_stage == c_sync)
+        size_t total = hdr.size + c_overhead;
+        if (size < total)
+          break;
+
+        if (filtered(hdr, data, total))
         {
-          // This would not be stricly necessary but is more efficient
-          // than  handling recurrent exceptions from Packet::deserializeHeader
-          if (n == 1)
-          {
-            break; // need more data
-          }
-
-          uint16_t sync = (m_buf[m_pos] << 8) | m_buf[m_pos + 1];
-
-          if (sync != DUNE_IMC_CONST_SYNC && sync != DUNE_IMC_CONST_SYNC_REV)
-          {
-            m_pos++; // invalid sync, advance
-            continue;
-          }
-          m_stage = c_header; // sync is ok, get rest of header
+          data += total;
+          size -= total;
+          continue;
         }
 
-        if (m_stage == c_header)
+        Message* m = decode(hdr, data, total);
+        if (m == 0)
         {
-          if (n < DUNE_IMC_CONST_HEADER_SIZE)
-            break;  // need more data
-
-          try
-          {
-            Packet::deserializeHeader(m_header, &m_buf[m_pos], n);
-          }
-          catch (...)
-          {
-            m_stage = c_sync;
-            ++m_pos; // try to find sync again from current position
-            continue;
-          }
-          m_stage = c_payload; // done with header
+          ++data;
+          --size;
+          continue;
         }
 
-        // on to c_payload stage
+        data += total;
+        size -= total;
+        return m;
+      }
+
+      // Keep the incomplete packet.
+      m_buf.assign(data, data + size);
+      data += size;
+      size = 0;
+      return 0;
+    }
+
+    size_t
+    Parser::findSync(const uint8_t* data, size_t size)
+    {
+      // Both synchronization numbers contain this byte.
+      const uint8_t c_anchor = DUNE_IMC_CONST_SYNC & 0xff;
+      const uint8_t c_other = DUNE_IMC_CONST_SYNC >> 8;
+
+      const uint8_t* ptr = data;
+      const uint8_t* end = data + size;
+
+      while (ptr < end)
+      {
+        const uint8_t* anchor = (const uint8_t*)std::memchr(ptr, c_anchor, end - ptr);
+        if (anchor == 0)
+          break;
+
+        if (anchor > data && anchor[-1] == c_other)
+          return anchor - 1 - data;
+
+        if (anchor + 1 == end || anchor[1] == c_other)
+          return anchor - data;
+
+        ptr = anchor + 1;
+      }
+
+      // The last byte may be the first half of a synchronization number.
+      if (size > 0 && isSyncByte(data[size - 1]))
+        return size - 1;
+
+      return size;
+    }
+
+    bool
+    Parser::parseHeader(const uint8_t* data, Header& hdr)
+    {
+      uint16_t sync = (data[0] << 8) | data[1];
+      if (sync != DUNE_IMC_CONST_SYNC && sync != DUNE_IMC_CONST_SYNC_REV)
+        return false;
+
+      try
+      {
+        Packet::deserializeHeader(hdr, data, DUNE_IMC_CONST_HEADER_SIZE);
+      }
+      catch (...)
+      {
+        return false;
+      }
+
+      return true;
+    }
+
+    Message*
+    Parser::decode(const Header& hdr, const uint8_t* data, size_t size)
+    {
+      try
+      {
+        return Packet::deserializePayload(hdr, data, size, 0);
+      }
+      catch (...)
+      {
+        return 0;
+      }
+    }
+
+    bool
+    Parser::filtered(const Header& hdr, const uint8_t* data, size_t size) const
+    {
+      if (m_filter == NULL || m_filter->accept(hdr))
+        return false;
 
-        if (n < (int)(m_header.size + DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE))
-          break;  // need more data
+      try
+      {
+        Packet::validate(hdr, data, size);
+      }
+      catch (...)
+      {
+        return false;
+      }
 
-        // all payload data available
-        m_stage = c_sync; // the next stage in any case
+      return true;
+    }
 
-        try
+    void
+    Parser::discard(void)
+    {
+      size_t sync = findSync(&m_buf[1], m_buf.size() - 1);
+      m_buf.erase(m_buf.begin(), m_buf.begin() + 1 + sync);
+    }
+
+    Message*
+    Parser::parsePending(const uint8_t*& data, size_t& size)
+    {
+      while (!m_buf.empty())
+      {
+        if (m_buf.size() < DUNE_IMC_CONST_HEADER_SIZE)
         {
-          m = Packet::deserializePayload(m_header, &m_buf[m_pos], n, 0);
+          size_t count = std::min(DUNE_IMC_CONST_HEADER_SIZE - m_buf.size(), size);
+          m_buf.insert(m_buf.end(), data, data + count);
+          data += count;
+          size -= count;
+
+          if (m_buf.size() < DUNE_IMC_CONST_HEADER_SIZE)
+            return 0;
         }
-        catch (...)
+
+        Header hdr;
+        if (!parseHeader(&m_buf[0], hdr))
         {
-          ++m_pos; // try to find sync again from current position
+          discard();
           continue;
         }
 
-        m_pos += n;
+        size_t total = hdr.size + c_overhead;
+        if (m_buf.size() < total)
+        {
+          size_t count = std::min(total - m_buf.size(), size);
+          m_buf.insert(m_buf.end(), data, data + count);
+          data += count;
+          size -= count;
 
-        if (m_pos == m_buf.size())
-          reset();  // discard unneeded data
+          if (m_buf.size() < total)
+            return 0;
+        }
+
+        if (filtered(hdr, &m_buf[0], total))
+        {
+          m_buf.erase(m_buf.begin(), m_buf.begin() + total);
+          continue;
+        }
+
+        Message* m = decode(hdr, &m_buf[0], total);
+        if (m == 0)
+        {
+          discard();
+          continue;
+        }
 
-        break;
+        m_buf.erase(m_buf.begin(), m_buf.begin() + total);
+        return m;
       }
 
-      return m;
+      return 0;
     }
   }
 }
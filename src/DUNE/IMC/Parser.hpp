@@ -44,9 +44,28 @@ namespace DUNE
     class DUNE_DLL_SYM Parser;
 
     //! Parser class.
+    //! Packets are decoded in place from the caller's buffer whenever
+    //! they are complete; only data belonging to an incomplete packet
+    //! at the end of a buffer is copied and kept until more data
+    //! arrives.
     class Parser
     {
     public:
+      //! Decides, from the header alone, which packets are decoded.
+      class Filter
+      {
+      public:
+        virtual
+        ~Filter(void)
+        { }
+
+        //! Test if a packet should be decoded.
+        //! @param[in] hdr packet header.
+        //! @return true to decode the packet, false to skip it.
+        virtual bool
+        accept(const Header& hdr) = 0;
+      };
+
       //! Default constructor.
       Parser(void);
 
@@ -63,19 +82,75 @@ namespace DUNE
       Message*
       parse(uint8_t byte);
 
-    private:
-      //! Parser stage constants.
-      enum ParserStage
+      //! Parse a buffer until a message is decoded or the buffer is
+      //! exhausted. The buffer pointer and size are updated to point
+      //! to the first byte not consumed, so the function must be
+      //! called until it returns 0 to process a whole buffer.
+      //! @param[in,out] data data buffer.
+      //! @param[in,out] size data buffer size.
+      //! @return decoded message (owned by the caller) or 0.
+      Message*
+      parse(const uint8_t*& data, size_t& size);
+
+      //! Set the packet filter. Valid packets rejected by the filter
+      //! are consumed without being decoded.
+      //! @param[in] filter packet filter or NULL to decode all packets.
+      void
+      setFilter(Filter* filter)
       {
-        c_sync,
-        c_header,
-        c_payload
-      };
+        m_filter = filter;
+      }
 
-      ParserStage m_stage; //!< Parser stage.
-      std::vector<uint8_t> m_buf; //!< Internal buffer.
-      unsigned int m_pos; //!< Buffer position.
-      Header m_header; //!< Holds parsed header (c_payload stage).
+    private:
+      //! Pending data (incomplete packet or unparsed data).
+      std::vector<uint8_t> m_buf;
+      //! Packet filter.
+      Filter* m_filter;
+
+      //! Find the first possible synchronization number.
+      //! @param[in] data data buffer.
+      //! @param[in] size data buffer size.
+      //! @return offset of the synchronization number or size if not
+      //! found. A last byte that may start a synchronization number
+      //! is considered a match.
+      static size_t
+      findSync(const uint8_t* data, size_t size);
+
+      //! Parse and validate a packet header.
+      //! @param[in] data packet data (at least one header).
+      //! @param[out] hdr packet header.
+      //! @return true if the header is valid, false otherwise.
+      static bool
+      parseHeader(const uint8_t* data, Header& hdr);
+
+      //! Decode a complete packet.
+      //! @param[in] hdr packet header.
+      //! @param[in] data packet data.
+      //! @param[in] size packet size.
+      //! @return decoded message or 0 if the packet is invalid.
+      static Message*
+      decode(const Header& hdr, const uint8_t* data, size_t size);
+
+      //! Test if a complete packet is valid and rejected by the
+      //! packet filter. Invalid packets are never reported as
+      //! filtered so that the parser resynchronizes on them.
+      //! @param[in] hdr packet header.
+      //! @param[in] data packet data.
+      //! @param[in] size packet size.
+      //! @return true if the packet must be skipped, false otherwise.
+      bool
+      filtered(const Header& hdr, const uint8_t* data, size_t size) const;
+
+      //! Discard the first byte of pending data and resynchronize.
+      void
+      discard(void);
+
+      //! Try to complete and decode the pending packet.
+      //! @param[in,out] data data buffer.
+      //! @param[in,out] size data buffer size.
+      //! @return decoded message or 0.
+      Message*
+      parsePending(const uint8_t*& data, size_t& size);
     };
   }
 }
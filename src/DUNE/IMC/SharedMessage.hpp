@@ -0,0 +1,181 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+#define DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM SharedMessage;
+
+    //! Reference counted handle to an immutable message. Copies of
+    //! a handle share the same message object, which is destroyed
+    //! when the last handle goes away. This allows a single message
+    //! instance to be delivered to several consumers.
+    class SharedMessage
+    {
+    public:
+      //! Create an empty handle.
+      SharedMessage(void):
+        m_data(NULL)
+      { }
+
+      //! Create a handle that takes ownership of a message. The
+      //! message must not be modified afterwards, so its serialized
+      //! packet is cached and shared by all consumers.
+      //! @param[in] msg message object (can be NULL).
+      explicit
+      SharedMessage(Message* msg):
+        m_data(NULL)
+      {
+        if (msg != NULL)
+        {
+          msg->enableSerializationCache();
+          m_data = new Data(msg);
+        }
+      }
+
+      //! Copy constructor.
+      //! @param[in] other handle to share.
+      SharedMessage(const SharedMessage& other):
+        m_data(other.m_data)
+      {
+        acquire();
+      }
+
+      //! Destructor.
+      ~SharedMessage(void)
+      {
+        release();
+      }
+
+      //! Assignment operator.
+      //! @param[in] other handle to share.
+      //! @return this handle.
+      SharedMessage&
+      operator=(const SharedMessage& other)
+      {
+        if (m_data != other.m_data)
+        {
+          release();
+          m_data = other.m_data;
+          acquire();
+        }
+
+        return *this;
+      }
+
+      //! Retrieve the shared message.
+      //! @return message object or NULL if the handle is empty.
+      const Message*
+      get(void) const
+      {
+        return (m_data == NULL) ? NULL : m_data->message;
+      }
+
+      const Message*
+      operator->(void) const
+      {
+        return get();
+      }
+
+      const Message&
+      operator*(void) const
+      {
+        return *get();
+      }
+
+      //! Test if the handle is empty.
+      //! @return true if the handle holds no message, false otherwise.
+      bool
+      isNull(void) const
+      {
+        return m_data == NULL;
+      }
+
+      //! Drop the reference held by this handle.
+      void
+      reset(void)
+      {
+        release();
+        m_data = NULL;
+      }
+
+    private:
+      //! Shared state.
+      struct Data
+      {
+        Data(Message* msg):
+          message(msg),
+          references(1)
+        { }
+
+        ~Data(void)
+        {
+          delete message;
+        }
+
+        //! Message object.
+        Message* message;
+        //! Number of handles referencing this message.
+        Concurrency::AtomicCounter references;
+      };
+
+      //! Shared state.
+      Data* m_data;
+
+      void
+      acquire(void)
+      {
+        if (m_data != NULL)
+          m_data->references.add(1);
+      }
+
+      void
+      release(void)
+      {
+        if (m_data != NULL && m_data->references.sub(1) == 0)
+          delete m_data;
+      }
+    };
+  }
+}
+
+#endif
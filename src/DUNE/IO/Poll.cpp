@@ -29,6 +29,7 @@
 
 // ISO C++ 98 headers.
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
 
 // DUNE headers.
@@ -38,6 +39,15 @@
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/IO/Poll.hpp>
 
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_POLL_H)
+#  include <poll.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
 namespace DUNE
 {
   namespace IO
@@ -45,15 +55,73 @@ namespace DUNE
     using std::memset;
     using System::Error;
 
+    //! Convert a timeout in seconds to milliseconds as expected by
+    //! epoll_wait() and poll().
+    //! @param[in] timeout timeout in seconds (negative to block).
+    //! @return timeout in milliseconds.
+    static inline int
+    toMilliseconds(double timeout)
+    {
+      if (timeout < 0.0)
+        return -1;
+
+      return (int)(timeout * 1000.0 + 0.5);
+    }
+
+    Poll::Poll(void)
+    {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      m_triggered = 0;
+      m_epoll = epoll_create1(EPOLL_CLOEXEC);
+      if (m_epoll == -1)
+        throw Error("creating epoll instance", Error::getLastMessage());
+#elif defined(DUNE_OS_POSIX)
+      FD_ZERO(&m_rfd);
+#endif
+    }
+
+    Poll::~Poll(void)
+    {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      ::close(m_epoll);
+#endif
+    }
+
     void
     Poll::add(const NativeHandle& handle)
     {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      ev.data.fd = handle;
+
+      if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, handle, &ev) == -1)
+      {
+        // Descriptor number was reused after a close without remove().
+        if (errno != EEXIST || epoll_ctl(m_epoll, EPOLL_CTL_MOD, handle, &ev) == -1)
+          throw Error("adding handle to epoll instance", Error::getLastMessage());
+      }
+#endif
+
       m_handles.push_back(handle);
     }
 
     void
     Poll::remove(const NativeHandle& handle)
     {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      // Closed descriptors are removed automatically, errors are harmless.
+      epoll_event ev;
+      epoll_ctl(m_epoll, EPOLL_CTL_DEL, handle, &ev);
+
+      for (int i = 0; i < m_triggered; ++i)
+      {
+        if (m_events[i].data.fd == handle)
+          m_events[i].events = 0;
+      }
+#endif
+
       std::vector<NativeHandle>::iterator itr;
       itr = std::find(m_handles.begin(), m_handles.end(), handle);
       if (itr != m_handles.end())
@@ -63,7 +131,14 @@ namespace DUNE
     bool
     Poll::wasTriggered(const NativeHandle& handle)
     {
-#if defined(DUNE_OS_POSIX)
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      for (int i = 0; i < m_triggered; ++i)
+      {
+        if (m_events[i].data.fd == handle)
+          return m_events[i].events != 0;
+      }
+
+#elif defined(DUNE_OS_POSIX)
       // Only the triggered fd's remain in the set after select() exits.
       return FD_ISSET(handle, &m_rfd) != 0;
 
@@ -101,6 +176,23 @@ namespace DUNE
 
       return false;
 
+#elif defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      m_events.resize(std::max(m_handles.size(), (size_t)1));
+      m_triggered = epoll_wait(m_epoll, &m_events[0], m_events.size(), toMilliseconds(timeout));
+
+      if (m_triggered == -1)
+      {
+        m_triggered = 0;
+
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      return m_triggered > 0;
+
 #elif defined(DUNE_OS_POSIX)
       int rv = 0;
       NativeHandle max = 0;
@@ -143,6 +235,26 @@ namespace DUNE
       DWORD rv = WaitForSingleObjectEx(handle, timeout * 1000, FALSE);
       return rv == WAIT_OBJECT_0;
 
+#elif defined(DUNE_SYS_HAS_POLL_H)
+      // Unlike select(), poll() is not limited to FD_SETSIZE.
+      pollfd pfd;
+      pfd.fd = handle;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+
+      int rv = ::poll(&pfd, 1, toMilliseconds(timeout));
+
+      if (rv == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      return rv > 0;
+
 #elif defined(DUNE_OS_POSIX)
       fd_set rfd;
       FD_ZERO(&rfd);
@@ -38,7 +38,9 @@
 #include <DUNE/IO/Handle.hpp>
 
 // POSIX headers.
-#if defined(DUNE_OS_POSIX)
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+#  include <sys/epoll.h>
+#elif defined(DUNE_OS_POSIX)
 #  include <sys/select.h>
 #endif
 
@@ -49,9 +51,20 @@ namespace DUNE
     // Export symbol.
     class DUNE_DLL_SYM Poll;
 
+    //! Wait for one or more I/O handles to become readable. On
+    //! systems with epoll the pool is kept by the kernel, so adding
+    //! and removing handles costs one system call and polling does not
+    //! depend on the number of registered handles. Elsewhere select()
+    //! is used.
     class Poll
     {
     public:
+      //! Constructor.
+      Poll(void);
+
+      //! Destructor.
+      ~Poll(void);
+
       static bool
       poll(const NativeHandle& handle, double timeout);
 
@@ -102,11 +115,25 @@ namespace DUNE
     private:
       //! List of native I/O handles.
       std::vector<NativeHandle> m_handles;
-#if defined(DUNE_OS_POSIX)
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      //! epoll instance.
+      int m_epoll;
+      //! Events returned by the last call to poll().
+      std::vector<epoll_event> m_events;
+      //! Number of valid entries in m_events.
+      int m_triggered;
+#elif defined(DUNE_OS_POSIX)
       fd_set m_rfd;
 #elif defined(DUNE_OS_WINDOWS)
       DWORD m_rv;
 #endif
+
+      //! Non-copyable.
+      Poll(const Poll&);
+
+      //! Non-assignable.
+      Poll&
+      operator=(const Poll&);
     };
   }
 }
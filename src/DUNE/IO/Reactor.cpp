@@ -0,0 +1,567 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/Time/Utils.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/IO/Reactor.hpp>
+
+// POSIX headers.
+#if defined(DUNE_IO_REACTOR_EPOLL)
+#  include <sys/epoll.h>
+#  include <sys/timerfd.h>
+#  include <sys/eventfd.h>
+#  include <unistd.h>
+#elif defined(DUNE_OS_POSIX)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace IO
+  {
+    using System::Error;
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+    //! Maximum number of events retrieved per epoll_wait() call.
+    static const int c_max_events = 64;
+#else
+    //! Maximum time spent polling when the wait cannot be interrupted
+    //! or writability must be tested by trying.
+    static const double c_max_wait = 0.1;
+#endif
+
+    class Reactor::Guard
+    {
+    public:
+      Guard(Reactor& reactor):
+        m_reactor(reactor),
+        m_locked(reactor.m_dispatcher.get() != &reactor)
+      {
+        if (m_locked)
+        {
+#if !defined(DUNE_IO_REACTOR_EPOLL)
+          // Make run() poll the updated set of handles.
+          m_reactor.wakeUp();
+#endif
+          m_reactor.m_dispatch.lock();
+        }
+      }
+
+      ~Guard(void)
+      {
+        if (m_locked)
+          m_reactor.m_dispatch.unlock();
+      }
+
+    private:
+      //! Reactor.
+      Reactor& m_reactor;
+      //! True if the dispatch lock was acquired.
+      bool m_locked;
+    };
+
+    Reactor::Reactor(void):
+      m_timer_id(0)
+    {
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      m_epoll = epoll_create1(EPOLL_CLOEXEC);
+      if (m_epoll == -1)
+        throw Error("creating epoll instance", Error::getLastMessage());
+
+      m_wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (m_wake == -1)
+      {
+        ::close(m_epoll);
+        throw Error("creating event file descriptor", Error::getLastMessage());
+      }
+
+      epoll_event ev;
+      std::memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      ev.data.ptr = NULL;
+      epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wake, &ev);
+
+#elif defined(DUNE_OS_POSIX)
+      if (pipe(m_wake) == -1)
+        throw Error("creating pipe", Error::getLastMessage());
+
+      for (unsigned i = 0; i < 2; ++i)
+      {
+        fcntl(m_wake[i], F_SETFL, fcntl(m_wake[i], F_GETFL, 0) | O_NONBLOCK);
+        fcntl(m_wake[i], F_SETFD, FD_CLOEXEC);
+      }
+#endif
+    }
+
+    Reactor::~Reactor(void)
+    {
+      std::map<NativeHandle, Entry*>::iterator hitr = m_handles.begin();
+      for (; hitr != m_handles.end(); ++hitr)
+        retire(hitr->second);
+
+      std::map<unsigned, Entry*>::iterator titr = m_timers.begin();
+      for (; titr != m_timers.end(); ++titr)
+        retire(titr->second);
+
+      collect();
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      ::close(m_wake);
+      ::close(m_epoll);
+#elif defined(DUNE_OS_POSIX)
+      ::close(m_wake[0]);
+      ::close(m_wake[1]);
+#endif
+    }
+
+    void
+    Reactor::add(const NativeHandle& handle, Listener* listener, Trigger trigger)
+    {
+      Guard guard(*this);
+
+      std::map<NativeHandle, Entry*>::iterator itr = m_handles.find(handle);
+      if (itr != m_handles.end())
+      {
+        retire(itr->second);
+        m_handles.erase(itr);
+      }
+
+      Entry* entry = new Entry;
+      entry->handle = handle;
+      entry->listener = listener;
+      entry->trigger = trigger;
+      entry->writable = false;
+      entry->timer = 0;
+      entry->period = 0;
+      entry->deadline = 0;
+      entry->removed = false;
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      epoll_event ev;
+      std::memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      if (trigger == TRIGGER_EDGE)
+        ev.events |= EPOLLET;
+      ev.data.ptr = entry;
+
+      if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, handle, &ev) == -1)
+      {
+        if (errno != EEXIST || epoll_ctl(m_epoll, EPOLL_CTL_MOD, handle, &ev) == -1)
+        {
+          delete entry;
+          throw Error("adding handle to reactor", Error::getLastMessage());
+        }
+      }
+#else
+      (void)trigger;
+#endif
+
+      m_handles[handle] = entry;
+    }
+
+    void
+    Reactor::remove(const NativeHandle& handle)
+    {
+      Guard guard(*this);
+
+      std::map<NativeHandle, Entry*>::iterator itr = m_handles.find(handle);
+      if (itr == m_handles.end())
+        return;
+
+      retire(itr->second);
+      m_handles.erase(itr);
+    }
+
+    void
+    Reactor::setWritable(const NativeHandle& handle, bool enabled)
+    {
+      Guard guard(*this);
+
+      std::map<NativeHandle, Entry*>::iterator itr = m_handles.find(handle);
+      if (itr == m_handles.end() || itr->second->writable == enabled)
+        return;
+
+      Entry* entry = itr->second;
+      entry->writable = enabled;
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      epoll_event ev;
+      std::memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      if (entry->writable)
+        ev.events |= EPOLLOUT;
+      if (entry->trigger == TRIGGER_EDGE)
+        ev.events |= EPOLLET;
+      ev.data.ptr = entry;
+
+      if (epoll_ctl(m_epoll, EPOLL_CTL_MOD, handle, &ev) == -1)
+        throw Error("modifying reactor handle", Error::getLastMessage());
+#endif
+    }
+
+    void
+    Reactor::remove(Listener* listener)
+    {
+      Guard guard(*this);
+
+      std::map<NativeHandle, Entry*>::iterator hitr = m_handles.begin();
+      while (hitr != m_handles.end())
+      {
+        if (hitr->second->listener == listener)
+        {
+          retire(hitr->second);
+          m_handles.erase(hitr++);
+        }
+        else
+        {
+          ++hitr;
+        }
+      }
+
+      std::map<unsigned, Entry*>::iterator titr = m_timers.begin();
+      while (titr != m_timers.end())
+      {
+        if (titr->second->listener == listener)
+        {
+          retire(titr->second);
+          m_timers.erase(titr++);
+        }
+        else
+        {
+          ++titr;
+        }
+      }
+    }
+
+    unsigned
+    Reactor::addTimer(double period, Listener* listener)
+    {
+      Guard guard(*this);
+
+      Entry* entry = new Entry;
+      entry->handle = NativeHandle();
+      entry->listener = listener;
+      entry->trigger = TRIGGER_LEVEL;
+      entry->writable = false;
+      entry->timer = ++m_timer_id;
+      entry->period = period;
+      entry->deadline = Time::Clock::get() + period;
+      entry->removed = false;
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      entry->handle = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+      if (entry->handle == -1)
+      {
+        delete entry;
+        throw Error("creating timer", Error::getLastMessage());
+      }
+
+      itimerspec spec;
+      spec.it_interval = DUNE_TIMESPEC_INIT_SEC_FP(period);
+      spec.it_value = spec.it_interval;
+
+      epoll_event ev;
+      std::memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      ev.data.ptr = entry;
+
+      if (timerfd_settime(entry->handle, 0, &spec, NULL) == -1
+          || epoll_ctl(m_epoll, EPOLL_CTL_ADD, entry->handle, &ev) == -1)
+      {
+        std::string msg = Error::getLastMessage();
+        ::close(entry->handle);
+        delete entry;
+        throw Error("adding timer to reactor", msg);
+      }
+#endif
+
+      m_timers[entry->timer] = entry;
+      return entry->timer;
+    }
+
+    void
+    Reactor::removeTimer(unsigned timer)
+    {
+      Guard guard(*this);
+
+      std::map<unsigned, Entry*>::iterator itr = m_timers.find(timer);
+      if (itr == m_timers.end())
+        return;
+
+      retire(itr->second);
+      m_timers.erase(itr);
+    }
+
+    void
+    Reactor::wakeUp(void)
+    {
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      uint64_t value = 1;
+      if (::write(m_wake, &value, sizeof(value)) < 0)
+        return;
+#elif defined(DUNE_OS_POSIX)
+      // A full pipe already has a pending wake up.
+      uint8_t value = 1;
+      if (::write(m_wake[1], &value, sizeof(value)) < 0)
+        return;
+#endif
+    }
+
+    void
+    Reactor::collect(void)
+    {
+      for (size_t i = 0; i < m_garbage.size(); ++i)
+        delete m_garbage[i];
+
+      m_garbage.clear();
+    }
+
+    void
+    Reactor::retire(Entry* entry)
+    {
+      entry->removed = true;
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      // Closed descriptors are removed automatically, errors are harmless.
+      epoll_event ev;
+      epoll_ctl(m_epoll, EPOLL_CTL_DEL, entry->handle, &ev);
+
+      if (entry->timer != 0)
+        ::close(entry->handle);
+#endif
+
+      // Events for this entry may still be pending, the entry is
+      // released before the next wait.
+      m_garbage.push_back(entry);
+    }
+
+    bool
+    Reactor::notify(Entry* entry)
+    {
+      if (entry->removed)
+        return false;
+
+      if (entry->timer == 0)
+      {
+        entry->listener->onReadable(entry->handle);
+        return true;
+      }
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      uint64_t expirations = 0;
+      if (::read(entry->handle, &expirations, sizeof(expirations)) != sizeof(expirations))
+        return false;
+#else
+      double now = Time::Clock::get();
+      if (now < entry->deadline)
+        return false;
+
+      entry->deadline += entry->period;
+      if (entry->deadline < now)
+        entry->deadline = now + entry->period;
+#endif
+
+      entry->listener->onTimer(entry->timer);
+      return true;
+    }
+
+    bool
+    Reactor::notifyWritable(Entry* entry)
+    {
+      if (entry->removed || !entry->writable)
+        return false;
+
+      entry->listener->onWritable(entry->handle);
+      return true;
+    }
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+    unsigned
+    Reactor::run(double timeout)
+    {
+      {
+        Concurrency::ScopedMutex l(m_dispatch);
+        collect();
+      }
+
+      int wait = -1;
+      if (timeout >= 0.0)
+        wait = (int)(timeout * 1000.0 + 0.5);
+
+      epoll_event events[c_max_events];
+      int count = epoll_wait(m_epoll, events, c_max_events, wait);
+      if (count == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return 0;
+        else
+          throw Error("waiting for events", Error::getLastMessage());
+      }
+
+      Concurrency::ScopedMutex l(m_dispatch);
+      unsigned dispatched = 0;
+
+      m_dispatcher.set(this);
+
+      try
+      {
+        for (int i = 0; i < count; ++i)
+        {
+          Entry* entry = static_cast<Entry*>(events[i].data.ptr);
+
+          if (entry == NULL)
+          {
+            uint64_t value = 0;
+            if (::read(m_wake, &value, sizeof(value)) < 0)
+              continue;
+          }
+          else
+          {
+            if ((events[i].events & ~EPOLLOUT) && notify(entry))
+              ++dispatched;
+
+            if ((events[i].events & EPOLLOUT) && notifyWritable(entry))
+              ++dispatched;
+          }
+        }
+      }
+      catch (...)
+      {
+        m_dispatcher.set(NULL);
+        throw;
+      }
+
+      m_dispatcher.set(NULL);
+      return dispatched;
+    }
+
+#else
+    unsigned
+    Reactor::run(double timeout)
+    {
+      std::vector<Entry*> ready;
+      std::vector<Entry*> writable;
+      std::vector<Entry*> timers;
+      Poll poll;
+      double wait = timeout;
+
+      {
+        Concurrency::ScopedMutex l(m_dispatch);
+        collect();
+
+        std::map<NativeHandle, Entry*>::iterator hitr = m_handles.begin();
+        for (; hitr != m_handles.end(); ++hitr)
+        {
+          ready.push_back(hitr->second);
+          poll.add(hitr->first);
+          if (hitr->second->writable)
+            writable.push_back(hitr->second);
+        }
+
+        std::map<unsigned, Entry*>::iterator titr = m_timers.begin();
+        for (; titr != m_timers.end(); ++titr)
+        {
+          timers.push_back(titr->second);
+          double left = std::max(0.0, titr->second->deadline - Time::Clock::get());
+          wait = (wait < 0.0) ? left : std::min(wait, left);
+        }
+      }
+
+#if defined(DUNE_OS_POSIX)
+      if (!writable.empty())
+#endif
+        wait = (wait < 0.0) ? c_max_wait : std::min(wait, c_max_wait);
+
+#if defined(DUNE_OS_POSIX)
+      poll.add(m_wake[0]);
+      bool triggered = poll.poll(wait);
+      if (triggered && poll.wasTriggered(m_wake[0]))
+      {
+        uint8_t bfr[64];
+        while (::read(m_wake[0], bfr, sizeof(bfr)) > 0)
+        { }
+      }
+#else
+      bool triggered = false;
+      if (ready.empty())
+        Time::Delay::wait(wait);
+      else
+        triggered = poll.poll(wait);
+#endif
+
+      // Entries removed meanwhile are skipped but not released yet.
+      Concurrency::ScopedMutex l(m_dispatch);
+      unsigned dispatched = 0;
+
+      m_dispatcher.set(this);
+
+      try
+      {
+        for (size_t i = 0; triggered && i < ready.size(); ++i)
+        {
+          if (poll.wasTriggered(ready[i]->handle) && notify(ready[i]))
+            ++dispatched;
+        }
+
+        for (size_t i = 0; i < writable.size(); ++i)
+        {
+          if (notifyWritable(writable[i]))
+            ++dispatched;
+        }
+
+        for (size_t i = 0; i < timers.size(); ++i)
+        {
+          if (notify(timers[i]))
+            ++dispatched;
+        }
+      }
+      catch (...)
+      {
+        m_dispatcher.set(NULL);
+        throw;
+      }
+
+      m_dispatcher.set(NULL);
+      return dispatched;
+    }
+#endif
+  }
+}
@@ -0,0 +1,274 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IO_REACTOR_HPP_INCLUDED_
+#define DUNE_IO_REACTOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Poll.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/RawTLS.hpp>
+
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H) && defined(DUNE_SYS_HAS_SYS_TIMERFD_H) && defined(DUNE_SYS_HAS_SYS_EVENTFD_H)
+#  define DUNE_IO_REACTOR_EPOLL
+#endif
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export symbol.
+    class DUNE_DLL_SYM Reactor;
+
+    //! Event reactor. I/O handles and periodic timers are registered
+    //! together with a listener that is called from run() when they
+    //! become ready. On Linux the reactor is built on epoll with timer
+    //! file descriptors, so one thread can serve any number of
+    //! handles. Elsewhere it falls back to IO::Poll.
+    //!
+    //! Handles and timers can be added and removed from any thread or
+    //! from within listeners. A listener is never called after the
+    //! corresponding remove() returns. Only one thread may call run().
+    class Reactor
+    {
+    public:
+      //! Reactor event listener.
+      class Listener
+      {
+      public:
+        virtual
+        ~Listener(void)
+        { }
+
+        //! Called when a handle has data to read or an error
+        //! condition.
+        //! @param[in] handle native I/O handle.
+        virtual void
+        onReadable(const NativeHandle& handle) = 0;
+
+        //! Called when a handle registered for output notifications
+        //! can be written without blocking.
+        //! @param[in] handle native I/O handle.
+        virtual void
+        onWritable(const NativeHandle& handle)
+        {
+          (void)handle;
+        }
+
+        //! Called when a timer expires.
+        //! @param[in] timer timer identifier.
+        virtual void
+        onTimer(unsigned timer)
+        {
+          (void)timer;
+        }
+      };
+
+      //! Notification modes.
+      enum Trigger
+      {
+        //! Notify while the handle has data to read.
+        TRIGGER_LEVEL,
+        //! Notify when new data arrives. The listener must read until
+        //! the handle would block, which requires non-blocking handles.
+        //! Only supported with epoll, level triggering is used
+        //! otherwise.
+        TRIGGER_EDGE
+      };
+
+      //! Constructor.
+      Reactor(void);
+
+      //! Destructor.
+      ~Reactor(void);
+
+      //! Add native I/O handle. Adding a handle that is already
+      //! registered replaces its listener.
+      //! @param[in] handle native I/O handle.
+      //! @param[in] listener event listener.
+      //! @param[in] trigger notification mode.
+      void
+      add(const NativeHandle& handle, Listener* listener, Trigger trigger = TRIGGER_LEVEL);
+
+      //! Add I/O handle.
+      //! @param[in] handle I/O handle.
+      //! @param[in] listener event listener.
+      //! @param[in] trigger notification mode.
+      void
+      add(const Handle& handle, Listener* listener, Trigger trigger = TRIGGER_LEVEL)
+      {
+        add(handle.getNative(), listener, trigger);
+      }
+
+      //! Remove native I/O handle.
+      //! @param[in] handle native I/O handle.
+      void
+      remove(const NativeHandle& handle);
+
+      //! Remove I/O handle.
+      //! @param[in] handle I/O handle.
+      void
+      remove(const Handle& handle)
+      {
+        remove(handle.getNative());
+      }
+
+      //! Enable/disable output notifications for a registered handle.
+      //! Without epoll writability cannot be tested and the listener
+      //! is notified after every wait, so writes must not block.
+      //! @param[in] handle native I/O handle.
+      //! @param[in] enabled true to enable notifications, false to
+      //! disable.
+      void
+      setWritable(const NativeHandle& handle, bool enabled);
+
+      //! Enable/disable output notifications for a registered handle.
+      //! @param[in] handle I/O handle.
+      //! @param[in] enabled true to enable notifications, false to
+      //! disable.
+      void
+      setWritable(const Handle& handle, bool enabled)
+      {
+        setWritable(handle.getNative(), enabled);
+      }
+
+      //! Remove all handles and timers of a listener.
+      //! @param[in] listener event listener.
+      void
+      remove(Listener* listener);
+
+      //! Add a periodic timer.
+      //! @param[in] period timer period in seconds.
+      //! @param[in] listener event listener.
+      //! @return timer identifier.
+      unsigned
+      addTimer(double period, Listener* listener);
+
+      //! Remove a timer.
+      //! @param[in] timer timer identifier.
+      void
+      removeTimer(unsigned timer);
+
+      //! Wait for events and call the corresponding listeners.
+      //! @param[in] timeout maximum amount of time to wait in seconds
+      //! (negative to wait forever).
+      //! @return number of events dispatched.
+      unsigned
+      run(double timeout);
+
+      //! Interrupt a thread waiting in run(). On Microsoft Windows the
+      //! thread only notices it after a short delay.
+      void
+      wakeUp(void);
+
+    private:
+      //! Registered handle or timer.
+      struct Entry
+      {
+        //! Native handle (timer file descriptor for timers).
+        NativeHandle handle;
+        //! Event listener.
+        Listener* listener;
+        //! Notification mode.
+        Trigger trigger;
+        //! True if output notifications are enabled.
+        bool writable;
+        //! Timer identifier (0 for I/O handles).
+        unsigned timer;
+        //! Timer period.
+        double period;
+        //! Timer deadline (used without epoll).
+        double deadline;
+        //! True if the entry was removed.
+        bool removed;
+      };
+
+      //! Acquires the dispatch lock, unless called from a listener.
+      class Guard;
+
+      //! Registered I/O handles.
+      std::map<NativeHandle, Entry*> m_handles;
+      //! Registered timers.
+      std::map<unsigned, Entry*> m_timers;
+      //! Removed entries waiting to be released.
+      std::vector<Entry*> m_garbage;
+      //! Last timer identifier.
+      unsigned m_timer_id;
+      //! Lock held while registering or dispatching.
+      Concurrency::Mutex m_dispatch;
+      //! Set in the dispatching thread while listeners are called.
+      Concurrency::RawTLS m_dispatcher;
+#if defined(DUNE_IO_REACTOR_EPOLL)
+      //! epoll instance.
+      int m_epoll;
+      //! Event file descriptor used to wake up run().
+      int m_wake;
+#elif defined(DUNE_OS_POSIX)
+      //! Pipe used to wake up run().
+      int m_wake[2];
+#endif
+
+      //! Release removed entries.
+      void
+      collect(void);
+
+      //! Mark entry as removed and stop polling it.
+      //! @param[in] entry entry.
+      void
+      retire(Entry* entry);
+
+      //! Call the listener of a ready entry.
+      //! @param[in] entry entry.
+      //! @return true if the listener was called, false otherwise.
+      bool
+      notify(Entry* entry);
+
+      //! Call the listener of a writable entry.
+      //! @param[in] entry entry.
+      //! @return true if the listener was called, false otherwise.
+      bool
+      notifyWritable(Entry* entry);
+
+      //! Non-copyable.
+      Reactor(const Reactor&);
+
+      //! Non-assignable.
+      Reactor&
+      operator=(const Reactor&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,90 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Streams/Terminal.hpp>
+#include <DUNE/IO/ReactorService.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    //! Maximum amount of time waiting for events.
+    static const double c_timeout = 1.0;
+
+    ReactorService::ReactorService(void):
+      m_active(false)
+    { }
+
+    ReactorService::~ReactorService(void)
+    {
+      Concurrency::ScopedMutex l(m_active_lock);
+      if (m_active)
+        stopAndJoin();
+    }
+
+    void
+    ReactorService::activate(void)
+    {
+      Concurrency::ScopedMutex l(m_active_lock);
+      if (m_active)
+        return;
+
+      start();
+      m_active = true;
+    }
+
+    void
+    ReactorService::stopImpl(void)
+    {
+      Concurrency::Thread::stopImpl();
+      m_reactor.wakeUp();
+    }
+
+    void
+    ReactorService::run(void)
+    {
+      while (!isStopping())
+      {
+        try
+        {
+          m_reactor.run(c_timeout);
+        }
+        catch (std::exception& e)
+        {
+          DUNE_ERR("IO::ReactorService", e.what());
+        }
+      }
+    }
+  }
+}
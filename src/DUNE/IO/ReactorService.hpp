@@ -0,0 +1,147 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_IO_REACTOR_SERVICE_HPP_INCLUDED_
+#define DUNE_IO_REACTOR_SERVICE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Reactor.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export symbol.
+    class DUNE_DLL_SYM ReactorService;
+
+    //! Reactor running in its own thread, shared by several clients
+    //! (e.g., tasks). The thread is started when the first handle or
+    //! timer is added. Listeners are called from the service thread.
+    class ReactorService: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      ReactorService(void);
+
+      //! Destructor.
+      ~ReactorService(void);
+
+      //! Add native I/O handle.
+      //! @param[in] handle native I/O handle.
+      //! @param[in] listener event listener.
+      //! @param[in] trigger notification mode.
+      void
+      add(const NativeHandle& handle, Reactor::Listener* listener,
+          Reactor::Trigger trigger = Reactor::TRIGGER_LEVEL)
+      {
+        m_reactor.add(handle, listener, trigger);
+        activate();
+      }
+
+      //! Add I/O handle.
+      //! @param[in] handle I/O handle.
+      //! @param[in] listener event listener.
+      //! @param[in] trigger notification mode.
+      void
+      add(const Handle& handle, Reactor::Listener* listener,
+          Reactor::Trigger trigger = Reactor::TRIGGER_LEVEL)
+      {
+        add(handle.getNative(), listener, trigger);
+      }
+
+      //! Remove native I/O handle.
+      //! @param[in] handle native I/O handle.
+      void
+      remove(const NativeHandle& handle)
+      {
+        m_reactor.remove(handle);
+      }
+
+      //! Remove I/O handle.
+      //! @param[in] handle I/O handle.
+      void
+      remove(const Handle& handle)
+      {
+        m_reactor.remove(handle.getNative());
+      }
+
+      //! Remove all handles and timers of a listener.
+      //! @param[in] listener event listener.
+      void
+      remove(Reactor::Listener* listener)
+      {
+        m_reactor.remove(listener);
+      }
+
+      //! Add a periodic timer.
+      //! @param[in] period timer period in seconds.
+      //! @param[in] listener event listener.
+      //! @return timer identifier.
+      unsigned
+      addTimer(double period, Reactor::Listener* listener)
+      {
+        unsigned timer = m_reactor.addTimer(period, listener);
+        activate();
+        return timer;
+      }
+
+      //! Remove a timer.
+      //! @param[in] timer timer identifier.
+      void
+      removeTimer(unsigned timer)
+      {
+        m_reactor.removeTimer(timer);
+      }
+
+    protected:
+      void
+      run(void);
+
+      void
+      stopImpl(void);
+
+    private:
+      //! Reactor.
+      Reactor m_reactor;
+      //! True if the thread was started.
+      bool m_active;
+      //! Lock to protect m_active.
+      Concurrency::Mutex m_active_lock;
+
+      //! Start the thread if needed.
+      void
+      activate(void);
+    };
+  }
+}
+
+#endif
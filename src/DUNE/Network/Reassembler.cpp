@@ -0,0 +1,224 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/I18N.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/Network/Reassembler.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    Reassembler::Reassembler(unsigned max_transfers, double timeout):
+      m_transfers(max_transfers > 0 ? max_transfers : 1),
+      m_timeout(timeout)
+    {
+      for (unsigned i = 0; i < m_transfers.size(); ++i)
+        release(m_transfers[i]);
+    }
+
+    IMC::Message*
+    Reassembler::add(const IMC::MessagePart* part)
+    {
+      unsigned frag = part->frag_number;
+      unsigned size = part->data.size();
+
+      if (frag >= part->num_frags)
+        throw std::runtime_error(DTR("invalid fragment number"));
+
+      Transfer* t = lookup(part->getSource(), part->uid, part->num_frags);
+      t->updated = Time::Clock::get();
+
+      uint64_t mask = (uint64_t)1 << (frag % 64);
+      if (t->bitmap[frag / 64] & mask)
+        return NULL;
+
+      if (frag == t->num_frags - 1)
+      {
+        if (size > c_max_size || (t->stride != 0 && (size > t->stride || frag * t->stride + size > c_max_size)))
+          throw std::runtime_error(DTR("invalid fragment size"));
+
+        // Keep the last fragment at the end of the buffer until the
+        // size of the other fragments is known.
+        unsigned offset = (t->stride != 0 || frag == 0) ? frag * t->stride : c_max_size - size;
+        std::memcpy(&t->data[offset], part->data.data(), size);
+        t->last_size = size;
+      }
+      else
+      {
+        if (t->stride == 0)
+        {
+          if (size == 0 || (t->num_frags - 1) * size + t->last_size > c_max_size)
+            throw std::runtime_error(DTR("invalid fragment size"));
+
+          t->stride = size;
+
+          if (t->last_size != 0)
+            std::memmove(&t->data[(t->num_frags - 1) * size],
+                         &t->data[c_max_size - t->last_size], t->last_size);
+        }
+        else if (size != t->stride)
+        {
+          throw std::runtime_error(DTR("invalid fragment size"));
+        }
+
+        std::memcpy(&t->data[frag * size], part->data.data(), size);
+      }
+
+      t->bitmap[frag / 64] |= mask;
+
+      if (++t->received < t->num_frags)
+        return NULL;
+
+      unsigned total = (t->num_frags - 1) * t->stride + t->last_size;
+      IMC::Message* msg = NULL;
+
+      try
+      {
+        msg = IMC::Packet::deserialize(&t->data[0], total);
+      }
+      catch (...)
+      {
+        release(*t);
+        throw;
+      }
+
+      release(*t);
+      return msg;
+    }
+
+    int
+    Reassembler::getFragmentsMissing(unsigned src, unsigned uid) const
+    {
+      for (unsigned i = 0; i < m_transfers.size(); ++i)
+      {
+        const Transfer& t = m_transfers[i];
+        if (t.active && t.src == src && t.uid == uid)
+          return t.num_frags - t.received;
+      }
+
+      return -1;
+    }
+
+    bool
+    Reassembler::expire(unsigned& missing)
+    {
+      double now = Time::Clock::get();
+
+      for (unsigned i = 0; i < m_transfers.size(); ++i)
+      {
+        Transfer& t = m_transfers[i];
+        if (t.active && now - t.updated > m_timeout)
+        {
+          missing = t.num_frags - t.received;
+          release(t);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    void
+    Reassembler::clear(void)
+    {
+      for (unsigned i = 0; i < m_transfers.size(); ++i)
+        release(m_transfers[i]);
+    }
+
+    unsigned
+    Reassembler::size(void) const
+    {
+      unsigned count = 0;
+      for (unsigned i = 0; i < m_transfers.size(); ++i)
+      {
+        if (m_transfers[i].active)
+          ++count;
+      }
+
+      return count;
+    }
+
+    Reassembler::Transfer*
+    Reassembler::lookup(unsigned src, unsigned uid, unsigned num_frags)
+    {
+      Transfer* slot = NULL;
+
+      for (unsigned i = 0; i < m_transfers.size(); ++i)
+      {
+        Transfer& t = m_transfers[i];
+
+        if (t.active && t.src == src && t.uid == uid)
+        {
+          // Same identifier, different message: start over.
+          if (t.num_frags != num_frags)
+          {
+            slot = &t;
+            break;
+          }
+
+          return &t;
+        }
+
+        // Prefer free slots, then the least recently updated one.
+        if (slot == NULL || (slot->active && (!t.active || t.updated < slot->updated)))
+          slot = &t;
+      }
+
+      release(*slot);
+      slot->active = true;
+      slot->src = src;
+      slot->uid = uid;
+      slot->num_frags = num_frags;
+
+      if (slot->data.empty())
+        slot->data.resize(c_max_size);
+
+      return slot;
+    }
+
+    void
+    Reassembler::release(Transfer& transfer)
+    {
+      transfer.active = false;
+      transfer.num_frags = 0;
+      transfer.received = 0;
+      transfer.stride = 0;
+      transfer.last_size = 0;
+      transfer.updated = 0;
+      std::memset(transfer.bitmap, 0, sizeof(transfer.bitmap));
+    }
+  }
+}
@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef DUNE_NETWORK_REASSEMBLER_HPP_INCLUDED_
+#define DUNE_NETWORK_REASSEMBLER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Reassembler;
+
+    //! Reassembler of messages split in IMC::MessagePart fragments.
+    //!
+    //! Fragment payloads are copied directly to their final position
+    //! in a per-transfer buffer and a bitmap records which fragments
+    //! were received, so a message is only deserialized once, when
+    //! its last fragment arrives. Transfers are kept in a fixed table
+    //! whose buffers are allocated once and reused; when the table is
+    //! full the least recently updated transfer is discarded.
+    class Reassembler
+    {
+    public:
+      //! Constructor.
+      //! @param[in] max_transfers maximum number of concurrent
+      //! transfers.
+      //! @param[in] timeout time in seconds after which an idle
+      //! transfer is considered expired.
+      Reassembler(unsigned max_transfers = 16, double timeout = 1800.0);
+
+      //! Set the maximum amount of time a transfer may be idle.
+      //! @param[in] timeout timeout in seconds.
+      void
+      setTimeout(double timeout)
+      {
+        m_timeout = timeout;
+      }
+
+      //! Add a fragment.
+      //! @param[in] part fragment.
+      //! @return reassembled message (to be deleted by the caller) if
+      //! this was the last missing fragment, NULL otherwise.
+      IMC::Message*
+      add(const IMC::MessagePart* part);
+
+      //! Get the number of fragments still missing in a transfer.
+      //! @param[in] src source system.
+      //! @param[in] uid transfer identifier.
+      //! @return number of missing fragments, or -1 if the transfer
+      //! is unknown.
+      int
+      getFragmentsMissing(unsigned src, unsigned uid) const;
+
+      //! Discard one transfer that has been idle for longer than the
+      //! timeout.
+      //! @param[out] missing number of fragments the transfer was
+      //! still missing.
+      //! @return true if a transfer was discarded, false otherwise.
+      bool
+      expire(unsigned& missing);
+
+      //! Discard all transfers.
+      void
+      clear(void);
+
+      //! Get the number of transfers in progress.
+      //! @return number of transfers.
+      unsigned
+      size(void) const;
+
+    private:
+      //! Maximum number of fragments of a transfer.
+      static const unsigned c_max_frags = 256;
+      //! Maximum size of a serialized message.
+      static const unsigned c_max_size = 65535;
+
+      //! Transfer in progress.
+      struct Transfer
+      {
+        //! True if the slot is in use.
+        bool active;
+        //! Source system.
+        unsigned src;
+        //! Transfer identifier.
+        unsigned uid;
+        //! Total number of fragments.
+        unsigned num_frags;
+        //! Number of fragments received.
+        unsigned received;
+        //! Size of every fragment but the last, zero if unknown.
+        unsigned stride;
+        //! Size of the last fragment, zero if not received.
+        unsigned last_size;
+        //! Time of the last update.
+        double updated;
+        //! Received fragments.
+        uint64_t bitmap[c_max_frags / 64];
+        //! Message data.
+        std::vector<uint8_t> data;
+      };
+
+      //! Transfer table.
+      std::vector<Transfer> m_transfers;
+      //! Idle timeout.
+      double m_timeout;
+
+      //! Find a transfer or allocate a slot for it.
+      Transfer*
+      lookup(unsigned src, unsigned uid, unsigned num_frags);
+
+      //! Release a transfer slot.
+      static void
+      release(Transfer& transfer);
+    };
+  }
+}
+
+#endif
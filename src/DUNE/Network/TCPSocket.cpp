@@ -117,12 +117,24 @@ getLastErrorMessage(void)
 #endif
 }
 
+//! Test if the last socket operation failed because it would block.
+static inline bool
+wouldBlock(void)
+{
+#if defined(DUNE_OS_WINDOWS)
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
 namespace DUNE
 {
   namespace Network
   {
     TCPSocket::TCPSocket(bool create):
-      m_handle(INVALID_SOCKET)
+      m_handle(INVALID_SOCKET),
+      m_blocking(true)
     {
       if (create)
       {
@@ -225,6 +237,8 @@ namespace DUNE
       {
         if (errno == ECONNRESET)
           throw ConnectionClosed();
+        if (!m_blocking && wouldBlock())
+          return 0;
         throw NetworkError(DTR("error receiving data"), getLastErrorMessage());
       }
 
@@ -246,6 +260,8 @@ namespace DUNE
       {
         if (errno == EPIPE)
           throw ConnectionClosed();
+        if (!m_blocking && wouldBlock())
+          return 0;
         throw NetworkError(DTR("error sending data"), getLastErrorMessage());
       }
 
@@ -356,6 +372,30 @@ namespace DUNE
         throw NetworkError(DTR("unable to set send timeout"), getLastErrorMessage());
     }
 
+    void
+    TCPSocket::setBlocking(bool enabled)
+    {
+#if defined(DUNE_OS_WINDOWS)
+      u_long mode = enabled ? 0 : 1;
+      if (ioctlsocket(m_handle, FIONBIO, &mode) != 0)
+        throw NetworkError(DTR("unable to set blocking mode"), getLastErrorMessage());
+#else
+      int flags = fcntl(m_handle, F_GETFL, 0);
+      if (flags == -1)
+        throw NetworkError(DTR("unable to set blocking mode"), getLastErrorMessage());
+
+      if (enabled)
+        flags &= ~O_NONBLOCK;
+      else
+        flags |= O_NONBLOCK;
+
+      if (fcntl(m_handle, F_SETFL, flags) == -1)
+        throw NetworkError(DTR("unable to set blocking mode"), getLastErrorMessage());
+#endif
+
+      m_blocking = enabled;
+    }
+
     Address
     TCPSocket::getBoundAddress(void)
     {
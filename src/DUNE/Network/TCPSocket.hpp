@@ -103,6 +103,14 @@ namespace DUNE
       void
       setSendTimeout(double timeout);
 
+      //! Enable/disable blocking mode. In non-blocking mode input and
+      //! output functions return 0 instead of waiting when no data is
+      //! available or flow control prevents data from being sent.
+      //! @param[in] enabled true to enable blocking mode, false to
+      //! disable.
+      void
+      setBlocking(bool enabled);
+
       Address
       getBoundAddress(void);
 
@@ -117,6 +125,8 @@ namespace DUNE
 #else
       int m_handle;
 #endif
+      //! True if the socket is in blocking mode.
+      bool m_blocking;
 
       IO::NativeHandle
       doGetNative(void) const;
@@ -29,6 +29,8 @@
 
 // ISO C++ 98 headers.
 #include <cerrno>
+#include <cstring>
+#include <algorithm>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -93,6 +95,30 @@ namespace DUNE
 {
   namespace Network
   {
+#if defined(DUNE_SYS_HAS_SENDMMSG) || defined(DUNE_SYS_HAS_RECVMMSG)
+    //! Maximum number of datagrams per system call.
+    static const size_t c_max_batch = 64;
+
+    //! Prepare a message header for sendmmsg()/recvmmsg().
+    static void
+    setupMessage(const UDPSocket::Datagram& dgram, mmsghdr& msg, iovec& iov, sockaddr_in& host)
+    {
+      std::memset(&host, 0, sizeof(host));
+      host.sin_family = AF_INET;
+      host.sin_port = Utils::ByteCopy::toBE(dgram.port);
+      host.sin_addr.s_addr = dgram.address.toInteger();
+
+      iov.iov_base = dgram.data;
+      iov.iov_len = dgram.size;
+
+      std::memset(&msg, 0, sizeof(msg));
+      msg.msg_hdr.msg_name = &host;
+      msg.msg_hdr.msg_namelen = sizeof(host);
+      msg.msg_hdr.msg_iov = &iov;
+      msg.msg_hdr.msg_iovlen = 1;
+    }
+#endif
+
     UDPSocket::UDPSocket(void):
       m_con_port(0)
     {
@@ -232,6 +258,84 @@ namespace DUNE
       return rv;
     }
 
+    size_t
+    UDPSocket::write(const Datagram* dgrams, size_t count)
+    {
+      size_t sent = 0;
+
+#if defined(DUNE_SYS_HAS_SENDMMSG)
+      mmsghdr msgs[c_max_batch];
+      iovec iovs[c_max_batch];
+      sockaddr_in hosts[c_max_batch];
+
+      size_t i = 0;
+      while (i < count)
+      {
+        unsigned n = (unsigned)std::min(count - i, c_max_batch);
+        for (unsigned j = 0; j < n; ++j)
+          setupMessage(dgrams[i + j], msgs[j], iovs[j], hosts[j]);
+
+        int rv = sendmmsg(m_handle, msgs, n, 0);
+        if (rv < 0)
+        {
+          // The first datagram of this batch failed, skip it.
+          if (errno != EINTR)
+            ++i;
+          continue;
+        }
+
+        sent += rv;
+        i += rv;
+      }
+#else
+      for (size_t i = 0; i < count; ++i)
+      {
+        try
+        {
+          write(dgrams[i].data, dgrams[i].size, dgrams[i].address, dgrams[i].port);
+          ++sent;
+        }
+        catch (std::runtime_error&)
+        { }
+      }
+#endif
+
+      return sent;
+    }
+
+    size_t
+    UDPSocket::read(Datagram* dgrams, size_t count)
+    {
+      if (count == 0)
+        return 0;
+
+#if defined(DUNE_SYS_HAS_RECVMMSG)
+      mmsghdr msgs[c_max_batch];
+      iovec iovs[c_max_batch];
+      sockaddr_in hosts[c_max_batch];
+
+      unsigned n = (unsigned)std::min(count, c_max_batch);
+      for (unsigned i = 0; i < n; ++i)
+        setupMessage(dgrams[i], msgs[i], iovs[i], hosts[i]);
+
+      int rv = recvmmsg(m_handle, msgs, n, MSG_WAITFORONE, NULL);
+      if (rv <= 0)
+        throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+
+      for (int i = 0; i < rv; ++i)
+      {
+        dgrams[i].size = msgs[i].msg_len;
+        dgrams[i].address = (::sockaddr*)&hosts[i];
+        dgrams[i].port = Utils::ByteCopy::fromBE(hosts[i].sin_port);
+      }
+
+      return rv;
+#else
+      dgrams[0].size = read(dgrams[0].data, dgrams[0].size, &dgrams[0].address, &dgrams[0].port);
+      return 1;
+#endif
+    }
+
     void
     UDPSocket::createEventHandle(void)
     {
@@ -51,6 +51,19 @@ namespace DUNE
     class UDPSocket: public IO::Handle
     {
     public:
+      //! Datagram descriptor used by batched operations.
+      struct Datagram
+      {
+        //! Payload buffer.
+        uint8_t* data;
+        //! Payload size (buffer capacity when receiving).
+        size_t size;
+        //! Remote host address.
+        Address address;
+        //! Remote host port.
+        uint16_t port;
+      };
+
       //! Create an unbound UDP socket.
       UDPSocket(void);
 
@@ -97,6 +110,26 @@ namespace DUNE
       size_t
       read(uint8_t* buffer, size_t size, Address* addr = NULL, uint16_t* port = NULL);
 
+      //! Send a batch of UDP datagrams, using as few system calls as
+      //! the platform allows. Datagrams that cannot be delivered
+      //! (e.g., unreachable hosts) are skipped.
+      //! @param dgrams datagrams to send.
+      //! @param count number of datagrams.
+      //! @return number of datagrams sent.
+      size_t
+      write(const Datagram* dgrams, size_t count);
+
+      //! Receive a batch of UDP datagrams. Blocks until at least one
+      //! datagram is available and then returns all datagrams that
+      //! can be read without blocking, up to the given count.
+      //! @param dgrams datagram buffers, each datagram's size is
+      //! updated with the number of bytes received and its address
+      //! and port with the source host.
+      //! @param count number of datagram buffers.
+      //! @return number of datagrams received.
+      size_t
+      read(Datagram* dgrams, size_t count);
+
     private:
       //! Platform specific handle.
 #if defined(DUNE_OS_WINDOWS)
@@ -37,6 +37,7 @@
 // DUNE headers.
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 
 namespace DUNE
 {
@@ -57,9 +58,9 @@ namespace DUNE
       { }
 
       //! Queue a message for later consumption.
-      //! @param msg message object.
+      //! @param msg shared message object.
       virtual void
-      receive(const IMC::Message* msg) = 0;
+      receive(const IMC::SharedMessage& msg) = 0;
 
       //! Retrieve task name.
       //! @return task name.
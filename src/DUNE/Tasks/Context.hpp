@@ -42,6 +42,7 @@
 #include <DUNE/Tasks/Profiles.hpp>
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
+#include <DUNE/IO/ReactorService.hpp>
 
 namespace DUNE
 {
@@ -66,6 +67,8 @@ namespace DUNE
       IMC::AddressResolver resolver;
       //! Label data base.
       Entities::EntityDataBase entities;
+      //! Shared I/O event reactor.
+      IO::ReactorService reactor;
       //! Execution profiles.
       Profiles profiles;
       //! DUNE's directory.
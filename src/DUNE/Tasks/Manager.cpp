@@ -234,6 +234,41 @@ namespace DUNE
       }
     }
 
+    void
+    Manager::reportQueueUsage(void)
+    {
+      std::map<std::string, Task*>::const_iterator itr = m_tasks.begin();
+
+      for ( ; itr != m_tasks.end(); ++itr)
+      {
+        Task* task = itr->second;
+        Recipient::QueueStatistics stats = task->getQueueStatistics();
+
+        std::map<std::string, Recipient::QueueStatistics>::iterator sitr = m_queue_stats.find(itr->first);
+        if (sitr == m_queue_stats.end())
+        {
+          Recipient::QueueStatistics none = {0, 0, 0, 0};
+          sitr = m_queue_stats.insert(std::make_pair(itr->first, none)).first;
+        }
+
+        if (stats.dropped == sitr->second.dropped && stats.conflated == sitr->second.conflated)
+          continue;
+
+        if (stats.dropped != sitr->second.dropped)
+          task->war(DTR("message queue full, discarded %u messages"), stats.dropped - sitr->second.dropped);
+
+        IMC::Event event;
+        event.setSourceEntity(task->getEntityId());
+        event.topic = "Message Queue";
+        event.data = Utils::String::str("Capacity=%u;Depth=%u;Dropped=%u;Conflated=%u",
+                                        (unsigned)stats.capacity, (unsigned)stats.depth,
+                                        stats.dropped, stats.conflated);
+        task->dispatch(event);
+
+        sitr->second = stats;
+      }
+    }
+
     void
     Manager::adjustPriorities(void)
     {
@@ -37,6 +37,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Tasks/Recipient.hpp>
 
 namespace DUNE
 {
@@ -110,6 +111,11 @@ namespace DUNE
       void
       adjustPriorities(void);
 
+      //! Report message queue statistics of tasks that discarded
+      //! messages since the last report.
+      void
+      reportQueueUsage(void);
+
     private:
       struct TaskCpuUsage
       {
@@ -135,6 +141,8 @@ namespace DUNE
       std::priority_queue<TaskCpuUsage> m_cpu_usage_hogs;
       //! Buffer message to dispatch CPU usage of tasks.
       IMC::CpuUsage m_task_cpu_usage;
+      //! Last reported message queue statistics of each task.
+      std::map<std::string, Recipient::QueueStatistics> m_queue_stats;
 
       void
       createTask(const std::string& section);
@@ -29,6 +29,10 @@
 // Author: José Braga                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Time/Clock.hpp>
@@ -40,91 +44,117 @@ namespace DUNE
 {
   namespace Tasks
   {
-    MessageFilter::MessageFilter(void)
+    //! Hash a message identification number.
+    static inline unsigned
+    hashId(uint32_t id, size_t mask)
+    {
+      return (id * 2654435761u) & mask;
+    }
+
+    MessageFilter::MessageFilter(void):
+      m_filtered(0)
     { }
 
     MessageFilter::~MessageFilter(void)
     { }
 
-    //! Filter message
-    //! @param[in] msg IMC Message.
-    //! @return true if message filtered, false otherwise.
     bool
     MessageFilter::filter(const IMC::Message* msg)
     {
-      uint32_t mid = msg->getId();
+      Rule* rule = find(msg->getId());
+      if (rule == NULL)
+        return false;
+
+      unsigned entity = msg->getSourceEntity() % c_entities;
 
       // Filter message by entity.
-      if (m_filtered[mid].size() > 0)
+      if (rule->entity_filter && !(rule->entities[entity / 64] & ((uint64_t)1 << (entity % 64))))
       {
-        bool matched = false;
-        std::vector<uint32_t>::iterator itr = m_filtered[mid].begin();
-        for (; itr != m_filtered[mid].end(); ++itr)
-        {
-          if (*itr == msg->getSourceEntity())
-          {
-            matched = true;
-            break;
-          }
-        }
-
-        // This entity is not listed to be passed.
-        if (!matched)
-          return true;
+        ++rule->filtered;
+        ++m_filtered;
+        return true;
       }
 
       // Filter message by rate.
-      RateMap::iterator rmitr = m_rates.find(mid);
-
-      if (rmitr != m_rates.end())
+      if (rule->rate > 0)
       {
+        Bucket& bucket = rule->buckets[entity];
         double now = Time::Clock::get();
-        double& stime = m_stimes[MsgKey(mid, msg->getSourceEntity())];
 
-        if (stime + rmitr->second > now)
+        bucket.tokens = std::min(rule->burst, bucket.tokens + (now - bucket.time) * rule->rate);
+        bucket.time = now;
+
+        if (bucket.tokens < 1.0)
+        {
+          ++rule->filtered;
+          ++m_filtered;
           return true;
+        }
 
-        stime = now;
+        bucket.tokens -= 1.0;
       }
 
       return false;
     }
 
-    //! Setup rate filters.
-    //! @param[in] spec String specification.
+    uint64_t
+    MessageFilter::getFilteredCount(uint32_t id) const
+    {
+      for (size_t i = 0; i < m_rules.size(); ++i)
+      {
+        if (m_rules[i].id == id)
+          return m_rules[i].filtered;
+      }
+
+      return 0;
+    }
+
     void
     MessageFilter::setupRates(const std::vector<std::string>& spec)
     {
-      m_rates.clear();
-      m_stimes.clear();
+      for (size_t i = 0; i < m_rules.size(); ++i)
+      {
+        m_rules[i].rate = 0;
+        m_rules[i].buckets.clear();
+      }
 
       for (unsigned int i = 0; i < spec.size(); ++i)
       {
         std::vector<std::string> parts;
         Utils::String::split(spec[i], ":", parts);
 
-        if (parts.size() == 2)
+        if (parts.size() == 2 || parts.size() == 3)
         {
           uint32_t id = IMC::Factory::getIdFromAbbrev(parts[0]);
           double rate = 0;
-          if (std::sscanf(parts[1].c_str(), "%lf", &rate) && rate > 0)
+          double burst = 1;
+          if (std::sscanf(parts[1].c_str(), "%lf", &rate) == 1 && rate > 0
+              && (parts.size() == 2 || (std::sscanf(parts[2].c_str(), "%lf", &burst) == 1 && burst >= 1)))
           {
-            m_rates[id] = 1.0 / rate;
+            Rule& rule = get(id);
+            rule.rate = rate;
+            rule.burst = burst;
+
+            // Buckets start full.
+            Bucket full = {burst, Time::Clock::get()};
+            rule.buckets.assign(c_entities, full);
             continue;
           }
         }
+
+        rebuild();
         throw std::runtime_error(Utils::String::str(DTR("invalid filter: %s"), spec[i].c_str()));
       }
+
+      rebuild();
     }
 
-    //! Setup entities filter.
-    //! @param[in] spec String specification.
-    //! @param[in] task Pointer to Task object.
     void
     MessageFilter::setupEntities(const std::vector<std::string>& spec, Tasks::Task* task)
     {
-      // Process filtered entities.
-      m_filtered.clear();
+      for (size_t i = 0; i < m_rules.size(); ++i)
+        m_rules[i].entity_filter = false;
+
       for (unsigned int i = 0; i < spec.size(); ++i)
       {
         std::vector<std::string> parts;
@@ -136,22 +166,96 @@ namespace DUNE
         uint32_t id = IMC::Factory::getIdFromAbbrev(parts[0]);
         std::vector<std::string> entities;
         Utils::String::split(parts[1], "+", entities);
-        m_filtered[id].resize(entities.size());
+        if (entities.empty())
+          continue;
+
+        Rule& rule = get(id);
+        rule.entity_filter = true;
+        std::memset(rule.entities, 0, sizeof(rule.entities));
 
-        // Resolve entities id.
+        // Resolve entities id, unknown entities never match.
         for (unsigned j = 0; j < entities.size(); j++)
         {
-          // Resolve entities.
           try
           {
-            m_filtered[id][j] = task->resolveEntity(entities[j]);
+            unsigned eid = task->resolveEntity(entities[j]);
+            if (eid < c_entities)
+              rule.entities[eid / 64] |= (uint64_t)1 << (eid % 64);
           }
           catch (...)
-          {
-            m_filtered[id][j] = UINT_MAX;
-          }
+          { }
         }
       }
+
+      rebuild();
+    }
+
+    MessageFilter::Rule*
+    MessageFilter::find(uint32_t id)
+    {
+      if (m_index.empty())
+        return NULL;
+
+      size_t mask = m_index.size() - 1;
+      for (unsigned i = hashId(id, mask); m_index[i] >= 0; i = (i + 1) & mask)
+      {
+        if (m_rules[m_index[i]].id == id)
+          return &m_rules[m_index[i]];
+      }
+
+      return NULL;
+    }
+
+    MessageFilter::Rule&
+    MessageFilter::get(uint32_t id)
+    {
+      for (size_t i = 0; i < m_rules.size(); ++i)
+      {
+        if (m_rules[i].id == id)
+          return m_rules[i];
+      }
+
+      Rule rule;
+      rule.id = id;
+      rule.rate = 0;
+      rule.burst = 1;
+      rule.entity_filter = false;
+      rule.filtered = 0;
+      std::memset(rule.entities, 0, sizeof(rule.entities));
+      m_rules.push_back(rule);
+      return m_rules.back();
+    }
+
+    void
+    MessageFilter::rebuild(void)
+    {
+      std::vector<Rule> rules;
+      for (size_t i = 0; i < m_rules.size(); ++i)
+      {
+        if (m_rules[i].rate > 0 || m_rules[i].entity_filter)
+          rules.push_back(m_rules[i]);
+      }
+
+      m_rules.swap(rules);
+      m_index.clear();
+
+      if (m_rules.empty())
+        return;
+
+      // Keep the load factor at or below one half.
+      size_t size = 4;
+      while (size < m_rules.size() * 2)
+        size <<= 1;
+
+      m_index.assign(size, -1);
+      for (size_t i = 0; i < m_rules.size(); ++i)
+      {
+        unsigned j = hashId(m_rules[i].id, size - 1);
+        while (m_index[j] >= 0)
+          j = (j + 1) & (size - 1);
+
+        m_index[j] = (int)i;
+      }
     }
   }
 }
@@ -32,7 +32,7 @@
 
 // ISO C++ 98 headers.
 #include <vector>
-#include <map>
+#include <string>
 
 // DUNE headers.
 #include <DUNE/Tasks/Task.hpp>
@@ -42,6 +42,14 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Filter of outgoing messages by source entity and rate.
+    //!
+    //! Rates are enforced per (message, source entity) pair with
+    //! token buckets: each pair may send a burst of messages and then
+    //! at most the configured frequency. Rules are kept in a flat
+    //! table indexed by an open-addressing hash of the message
+    //! identifier; all state is allocated when the filter is
+    //! configured, filter() never allocates.
     class MessageFilter
     {
     public:
@@ -49,28 +57,87 @@ namespace DUNE
 
       ~MessageFilter(void);
 
+      //! Setup rate filters.
+      //! @param[in] spec list of <Message>:<Frequency>[:<Burst>].
       void
       setupRates(const std::vector<std::string>& spec);
 
+      //! Setup entities filter.
+      //! @param[in] spec list of <Message>:<Entity>+<Entity>.
+      //! @param[in] task task used to resolve entity labels.
       void
       setupEntities(const std::vector<std::string>& spec, Tasks::Task* task);
 
+      //! Filter message.
+      //! @param[in] msg IMC Message.
+      //! @return true if message filtered, false otherwise.
       bool
       filter(const IMC::Message* msg);
 
+      //! Get the number of messages filtered so far.
+      //! @return number of filtered messages.
+      uint64_t
+      getFilteredCount(void) const
+      {
+        return m_filtered;
+      }
+
+      //! Get the number of messages of a given type filtered so far.
+      //! @param[in] id message identification number.
+      //! @return number of filtered messages.
+      uint64_t
+      getFilteredCount(uint32_t id) const;
+
     private:
-      // Rate limiters.
-      typedef std::map<uint32_t, double> RateMap;
-      RateMap m_rates;
-
-      // Send times.
-      typedef std::pair<uint32_t, unsigned int> MsgKey;
-      typedef std::map<MsgKey, double> STimesMap;
-      STimesMap m_stimes;
-
-      // List of entities to be passed by given message
-      typedef std::vector<uint32_t> Entities;
-      std::map<uint32_t, Entities> m_filtered;
+      //! Number of possible source entities.
+      static const unsigned c_entities = 256;
+
+      //! Token bucket.
+      struct Bucket
+      {
+        //! Available tokens.
+        double tokens;
+        //! Time of the last refill.
+        double time;
+      };
+
+      //! Filtering rule of a message type.
+      struct Rule
+      {
+        //! Message identification number.
+        uint32_t id;
+        //! Tokens added per second, zero if there is no rate limit.
+        double rate;
+        //! Maximum number of tokens.
+        double burst;
+        //! True if only some entities may pass.
+        bool entity_filter;
+        //! Entities allowed to pass.
+        uint64_t entities[c_entities / 64];
+        //! Number of messages filtered.
+        uint64_t filtered;
+        //! Token buckets, by source entity.
+        std::vector<Bucket> buckets;
+      };
+
+      //! Rules.
+      std::vector<Rule> m_rules;
+      //! Hash table of rule indices (-1 if empty).
+      std::vector<int> m_index;
+      //! Total number of filtered messages.
+      uint64_t m_filtered;
+
+      //! Find the rule of a message type.
+      Rule*
+      find(uint32_t id);
+
+      //! Find the rule of a message type, creating it if needed.
+      Rule&
+      get(uint32_t id);
+
+      //! Rebuild the hash table and drop empty rules.
+      void
+      rebuild(void);
     };
   }
 }
@@ -28,11 +28,13 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cstddef>
 
 // DUNE headers.
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IO/Reactor.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 
@@ -40,21 +42,27 @@ namespace DUNE
 {
   namespace Tasks
   {
-    Recipient::Recipient(AbstractTask* task, Context& ctx):
+    //! Maximum number of messages popped from the queue at once.
+    static const size_t c_batch_size = 64;
+
+    const size_t Recipient::c_default_capacity;
+
+    Recipient::Recipient(AbstractTask* task, Context& ctx, size_t capacity):
       m_task(task),
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_mqueue(capacity),
+      m_reactor(NULL),
+      m_policy(QP_DROP_NEWEST),
+      m_batch(c_batch_size)
     { }
 
     Recipient::~Recipient(void)
     {
       unbindAll();
 
-      while (!m_mqueue.empty())
-      {
-        IMC::Message* msg = m_mqueue.pop();
-        if (msg)
-          delete msg;
-      }
+      IMC::SharedMessage msg;
+      while (m_mqueue.pop(msg))
+        msg.reset();
     }
 
     void
@@ -91,26 +99,159 @@ namespace DUNE
     }
 
     void
-    Recipient::put(const IMC::Message* msg)
+    Recipient::waitForMessages(IO::Reactor& reactor, double timeout)
+    {
+      m_reactor.store(&reactor);
+
+      // Block only if there are no messages, but always poll I/O so
+      // that handles are serviced under steady message traffic.
+      if (!m_mqueue.beginWait())
+        timeout = 0;
+
+      try
+      {
+        reactor.run(timeout);
+      }
+      catch (...)
+      {
+        m_mqueue.endWait();
+        m_reactor.store(NULL);
+        throw;
+      }
+
+      m_mqueue.endWait();
+      m_reactor.store(NULL);
+      runCallBacks();
+    }
+
+    void
+    Recipient::wakeUpReactor(void)
     {
-      m_mqueue.push(msg->clone());
+      if (!m_mqueue.isWaiting())
+        return;
+
+      IO::Reactor* reactor = m_reactor.load();
+      if (reactor != NULL)
+        reactor->wakeUp();
+    }
+
+    void
+    Recipient::put(const IMC::SharedMessage& msg)
+    {
+      if (m_mqueue.push(msg))
+      {
+        wakeUpReactor();
+        return;
+      }
+
+      if (m_policy.load() == QP_DROP_NEWEST)
+      {
+        m_dropped.add(1);
+        return;
+      }
+
+      // Make room by discarding the oldest messages.
+      IMC::SharedMessage oldest;
+      while (!m_mqueue.push(msg))
+      {
+        if (m_mqueue.pop(oldest))
+          m_dropped.add(1);
+      }
+
+      wakeUpReactor();
+    }
+
+    Recipient::QueueStatistics
+    Recipient::getQueueStatistics(void)
+    {
+      QueueStatistics stats;
+      stats.capacity = m_mqueue.capacity();
+      stats.depth = m_mqueue.size();
+      stats.dropped = m_dropped.add(0);
+      stats.conflated = m_conflated.add(0);
+      return stats;
+    }
+
+    Recipient::QueuePolicy
+    Recipient::queuePolicyFromString(const std::string& str)
+    {
+      if (str == "Drop Oldest")
+        return QP_DROP_OLDEST;
+
+      if (str == "Keep Latest")
+        return QP_KEEP_LATEST;
+
+      return QP_DROP_NEWEST;
     }
 
     void
     Recipient::runCallBacks(void)
     {
-      unsigned int size = m_mqueue.size();
+      // Only consume the messages available at this point, new
+      // messages will be handled in the next call.
+      size_t size = m_mqueue.size();
 
-      for (unsigned int i = 0; i < size; ++i)
+      if (m_policy.load() == QP_KEEP_LATEST)
       {
-        const IMC::Message* msg = m_mqueue.pop();
-        if (msg)
+        // Conflation needs to see the whole backlog at once.
+        if (m_batch.size() < size)
+          m_batch.resize(size);
+
+        size_t count = m_mqueue.pop(&m_batch[0], size);
+        conflate(count);
+        consume(count);
+        return;
+      }
+
+      while (size > 0)
+      {
+        size_t count = m_mqueue.pop(&m_batch[0], std::min(size, m_batch.size()));
+        if (count == 0)
+          break;
+
+        size -= count;
+        consume(count);
+      }
+    }
+
+    void
+    Recipient::consume(size_t count)
+    {
+      for (size_t i = 0; i < count; ++i)
+      {
+        if (m_batch[i].isNull())
+          continue;
+
+        std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.find(m_batch[i]->getId());
+        if (itr != m_cbacks.end())
         {
-          uint32_t id = msg->getId();
-          for (size_t j = 0; j < m_cbacks[id].size(); ++j)
-            m_cbacks[id][j]->consume(msg);
-          delete msg;
+          for (size_t j = 0; j < itr->second.size(); ++j)
+            itr->second[j]->consume(m_batch[i].get());
         }
+
+        m_batch[i].reset();
+      }
+    }
+
+    void
+    Recipient::conflate(size_t count)
+    {
+      m_latest.clear();
+
+      // Walk backwards so the newest message of each key is kept.
+      for (size_t i = count; i > 0; --i)
+      {
+        IMC::SharedMessage& msg = m_batch[i - 1];
+        uint32_t id = msg->getId();
+        if (!m_conflated_ids.empty() && m_conflated_ids.find(id) == m_conflated_ids.end())
+          continue;
+
+        uint64_t key = ((uint64_t)id << 32) | ((uint64_t)msg->getSource() << 8) | msg->getSourceEntity();
+        if (m_latest.insert(key).second)
+          continue;
+
+        msg.reset();
+        m_conflated.add(1);
       }
     }
   }
@@ -32,15 +32,27 @@
 
 // ISO C++ 98 headers.
 #include <map>
+#include <set>
 #include <vector>
 
+// ISO C++ 11 headers.
+#include <atomic>
+
 // DUNE headers.
-#include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/MPSCQueue.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
 
 namespace DUNE
 {
+  namespace IO
+  {
+    // Forward declarations.
+    class Reactor;
+  }
+
   namespace Tasks
   {
     // Forward declarations.
@@ -52,8 +64,37 @@ namespace DUNE
     class Recipient
     {
     public:
+      //! What to do when the message queue is full.
+      enum QueuePolicy
+      {
+        //! Discard the incoming message.
+        QP_DROP_NEWEST,
+        //! Discard the oldest queued message.
+        QP_DROP_OLDEST,
+        //! Only consume the latest message of each type, source and
+        //! source entity (conflation). Discards the oldest queued
+        //! message when full.
+        QP_KEEP_LATEST
+      };
+
+      //! Message queue statistics.
+      struct QueueStatistics
+      {
+        //! Maximum number of queued messages.
+        size_t capacity;
+        //! Number of queued messages.
+        size_t depth;
+        //! Number of messages discarded because the queue was full.
+        unsigned dropped;
+        //! Number of messages superseded by newer messages.
+        unsigned conflated;
+      };
+
       //! Constructor.
-      Recipient(AbstractTask* task, Context& ctx);
+      //! @param task task object.
+      //! @param ctx context.
+      //! @param capacity maximum number of queued messages.
+      Recipient(AbstractTask* task, Context& ctx, size_t capacity = c_default_capacity);
 
       //! Destructor.
       ~Recipient(void);
@@ -61,8 +102,11 @@ namespace DUNE
       void
       unbindAll(void);
 
+      //! Queue a message for later consumption. The message is
+      //! shared with other recipients and must not be modified.
+      //! @param msg shared message object.
       void
-      put(const IMC::Message*);
+      put(const IMC::SharedMessage& msg);
 
       void
       bind(uint32_t id, AbstractConsumer* c);
@@ -70,9 +114,50 @@ namespace DUNE
       void
       waitForMessages(double timeout);
 
+      //! Wait for messages and I/O events of a reactor in a single
+      //! blocking wait and then consume queued messages. Listeners of
+      //! the reactor are called from this function. I/O is polled on
+      //! every call, even when messages are already queued.
+      //! @param reactor I/O event reactor.
+      //! @param timeout maximum amount of time to wait in seconds.
+      void
+      waitForMessages(IO::Reactor& reactor, double timeout);
+
       void
       runCallBacks(void);
 
+      //! Select the queue policy.
+      //! @param policy queue policy.
+      void
+      setQueuePolicy(QueuePolicy policy)
+      {
+        m_policy.store(policy);
+      }
+
+      //! Select the messages subject to conflation when using
+      //! QP_KEEP_LATEST.
+      //! @param ids message identification numbers (empty for all).
+      void
+      setConflatedMessages(const std::vector<uint32_t>& ids)
+      {
+        m_conflated_ids = std::set<uint32_t>(ids.begin(), ids.end());
+      }
+
+      //! Retrieve message queue statistics.
+      //! @return queue statistics.
+      QueueStatistics
+      getQueueStatistics(void);
+
+      //! Convert a string to a queue policy.
+      //! @param str policy name ("Drop Newest", "Drop Oldest" or
+      //! "Keep Latest").
+      //! @return queue policy.
+      static QueuePolicy
+      queuePolicyFromString(const std::string& str);
+
+      //! Default maximum number of queued messages.
+      static const size_t c_default_capacity = 8192;
+
     private:
       //! Task.
       AbstractTask* m_task;
@@ -81,7 +166,36 @@ namespace DUNE
       //! Callbacks.
       std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
       //! Message queue.
-      Concurrency::TSQueue<IMC::Message*> m_mqueue;
+      Concurrency::MPSCQueue<IMC::SharedMessage> m_mqueue;
+      //! Reactor the consumer is waiting on, if any.
+      std::atomic<IO::Reactor*> m_reactor;
+      //! Queue policy.
+      std::atomic<int> m_policy;
+      //! Messages subject to conflation (empty for all).
+      std::set<uint32_t> m_conflated_ids;
+      //! Messages being consumed.
+      std::vector<IMC::SharedMessage> m_batch;
+      //! Keys of messages already seen while conflating.
+      std::set<uint64_t> m_latest;
+      //! Number of messages discarded due to a full queue.
+      Concurrency::AtomicCounter m_dropped;
+      //! Number of messages superseded by newer messages.
+      Concurrency::AtomicCounter m_conflated;
+
+      //! Wake up the consumer if it is waiting on a reactor.
+      void
+      wakeUpReactor(void);
+
+      //! Consume a batch of messages.
+      //! @param count number of messages in m_batch.
+      void
+      consume(size_t count);
+
+      //! Discard queued messages that are superseded by newer
+      //! messages in the batch.
+      //! @param count number of messages in m_batch.
+      void
+      conflate(size_t count);
     };
   }
 }
@@ -36,9 +36,15 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Period of the filtered messages report (s).
+    static const double c_rl_report_per = 10.0;
+
     SimpleTransport::SimpleTransport(const std::string& name, Tasks::Context& ctx):
       Tasks::Task(name, ctx),
-      m_buf(2048)
+      m_buf(2048),
+      m_rl_reported(0),
+      m_receiver(*this),
+      m_filter(*this)
     {
       param("Transports", m_gargs.transports)
       .defaultValue("")
@@ -46,7 +52,7 @@ namespace DUNE
 
       param("Rate Limiters", m_gargs.rlim)
       .defaultValue("")
-      .description("List of <Message>:<Frequency>");
+      .description("List of <Message>:<Frequency>[:<Burst>]");
 
       param("Filtered Entities", m_gargs.entities_flt)
       .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
@@ -98,30 +104,48 @@ namespace DUNE
       m_rl.setupEntities(m_gargs.entities_flt, this);
       bind(this, m_gargs.transports);
 
+      m_rl_report_counter.setTop(c_rl_report_per);
+
       while (!stopping())
       {
-        consumeMessages();
+        waitForMessages(m_reactor, 1.0);
 
-        onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.005);
+        if (m_rl_report_counter.overflow())
+        {
+          reportFiltered();
+          m_rl_report_counter.reset();
+        }
       }
     }
 
+    void
+    SimpleTransport::reportFiltered(void)
+    {
+      uint64_t filtered = m_rl.getFilteredCount();
+      if (filtered == m_rl_reported)
+        return;
+
+      debug("filtered %llu outgoing messages (%llu total)",
+            (unsigned long long)(filtered - m_rl_reported),
+            (unsigned long long)filtered);
+      m_rl_reported = filtered;
+    }
+
     void
     SimpleTransport::handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n)
     {
-      for (const uint8_t* e = p + n; p != e; ++p)
-      {
-        IMC::Message* m = parser.parse(*p);
+      size_t size = n;
+      IMC::Message* m = NULL;
 
-        if (m)
-        {
-          dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+      parser.setFilter(&m_filter);
+      while ((m = parser.parse(p, size)) != NULL)
+      {
+        dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
 
-          if (m_gargs.trace_in)
-            inf(DTR("incoming: %s"), m->getName());
+        if (m_gargs.trace_in)
+          inf(DTR("incoming: %s"), m->getName());
 
-          delete m;
-        }
+        delete m;
       }
     }
   }
@@ -37,8 +37,11 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Utils/ByteBuffer.hpp>
 #include <DUNE/IMC/Parser.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Reactor.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
+#include <DUNE/Time/Counter.hpp>
 
 namespace DUNE
 {
@@ -64,13 +67,92 @@ namespace DUNE
       virtual void
       onDataTransmission(const uint8_t* p, unsigned int n) = 0;
 
+      //! Called when a handle registered with addHandle() has data
+      //! to read.
+      //! @param[in] p reception buffer.
+      //! @param[in] n capacity of the reception buffer.
       virtual void
-      onDataReception(uint8_t* p, unsigned int n, double timeout) = 0;
+      onDataReception(uint8_t* p, unsigned int n)
+      {
+        (void)p;
+        (void)n;
+      }
 
       void
       handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n);
 
+      //! Report the number of messages dropped by the message filter
+      //! since the last report.
+      void
+      reportFiltered(void);
+
+    protected:
+      //! Wait for data on an I/O handle together with incoming
+      //! messages. onDataReception() is called when the handle has
+      //! data to read.
+      //! @param[in] handle I/O handle.
+      void
+      addHandle(IO::Handle& handle)
+      {
+        m_reactor.add(handle, &m_receiver);
+      }
+
+      //! Stop waiting for data on an I/O handle.
+      //! @param[in] handle I/O handle.
+      void
+      removeHandle(IO::Handle& handle)
+      {
+        m_reactor.remove(handle);
+      }
+
+      //! Get the reactor used to wait for I/O events and incoming
+      //! messages. Derived classes may register their own listeners,
+      //! which are called from the task thread.
+      //! @return I/O event reactor.
+      IO::Reactor&
+      getReactor(void)
+      {
+        return m_reactor;
+      }
+
     private:
+      //! Calls onDataReception() when a registered handle is readable.
+      class Receiver: public IO::Reactor::Listener
+      {
+      public:
+        Receiver(SimpleTransport& owner):
+          m_owner(owner)
+        { }
+
+        void
+        onReadable(const IO::NativeHandle& handle)
+        {
+          (void)handle;
+          m_owner.onDataReception(m_owner.m_buf.getBuffer(), m_owner.m_buf.getCapacity());
+        }
+
+      private:
+        SimpleTransport& m_owner;
+      };
+
+      //! Skips packets of messages without recipients.
+      class RecipientFilter: public IMC::Parser::Filter
+      {
+      public:
+        RecipientFilter(SimpleTransport& owner):
+          m_owner(owner)
+        { }
+
+        bool
+        accept(const IMC::Header& hdr)
+        {
+          return m_owner.hasRecipients(hdr.mgid);
+        }
+
+      private:
+        SimpleTransport& m_owner;
+      };
+
       struct GArguments
       {
         // List of messages to publish.
@@ -87,6 +169,16 @@ namespace DUNE
       GArguments m_gargs;
       Utils::ByteBuffer m_buf;
       MessageFilter m_rl;
+      //! Filtered messages report counter.
+      Time::Counter<double> m_rl_report_counter;
+      //! Number of filtered messages at the last report.
+      uint64_t m_rl_reported;
+      //! Waits for I/O events and incoming messages.
+      IO::Reactor m_reactor;
+      //! Listener of handles registered with addHandle().
+      Receiver m_receiver;
+      //! Packet filter of incoming data.
+      RecipientFilter m_filter;
     };
   }
 }
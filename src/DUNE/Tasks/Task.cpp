@@ -35,6 +35,7 @@
 // DUNE headers.
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/PeriodicDelay.hpp>
 #include <DUNE/Time/Counter.hpp>
@@ -88,7 +89,28 @@ namespace DUNE
       .defaultValue("None")
       .values("None, Debug, Trace, Spew");
 
-      m_recipient = new Recipient(this, ctx);
+      param(DTR_RT("Queue - Capacity"), m_args.queue_capacity)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue(uncastLexical(Recipient::c_default_capacity))
+      .description(DTR("Maximum number of messages waiting to be consumed."
+                       " Changes only take effect after a restart"));
+
+      param(DTR_RT("Queue - Policy"), m_args.queue_policy)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("Drop Newest")
+      .values("Drop Newest, Drop Oldest, Keep Latest")
+      .description(DTR("Action taken when the message queue is full. 'Keep Latest'"
+                       " also discards messages superseded by newer ones"));
+
+      param(DTR_RT("Queue - Conflated Messages"), m_args.queue_conflated)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("")
+      .description(DTR("Messages subject to the 'Keep Latest' policy (empty for all)"));
+
+      // The message queue is created before parameters are loaded.
+      m_ctx.config.get(getName(), "Queue - Capacity",
+                       uncastLexical(Recipient::c_default_capacity), m_args.queue_capacity);
+      m_recipient = new Recipient(this, ctx, m_args.queue_capacity);
       m_entity = new Entities::StatefulEntity(this, m_ctx);
       m_entities.push_back(m_entity);
 
@@ -239,6 +261,27 @@ namespace DUNE
       else
         m_debug_level = DEBUG_LEVEL_NONE;
 
+      if (paramChanged(m_args.queue_policy))
+        m_recipient->setQueuePolicy(Recipient::queuePolicyFromString(m_args.queue_policy));
+
+      if (paramChanged(m_args.queue_conflated))
+      {
+        std::vector<uint32_t> ids;
+        for (size_t i = 0; i < m_args.queue_conflated.size(); ++i)
+        {
+          try
+          {
+            ids.push_back(IMC::Factory::getIdFromAbbrev(m_args.queue_conflated[i]));
+          }
+          catch (...)
+          {
+            err(DTR("invalid message '%s'"), m_args.queue_conflated[i].c_str());
+          }
+        }
+
+        m_recipient->setConflatedMessages(ids);
+      }
+
       onUpdateParameters();
 
       if (m_honours_active)
@@ -442,6 +485,15 @@ namespace DUNE
         m_ctx.mbus.dispatch(msg);
     }
 
+    bool
+    Task::hasRecipients(uint16_t id, unsigned int flags) const
+    {
+      if ((flags & DF_LOOP_BACK) == 0)
+        return m_ctx.mbus.hasRecipients(id, this);
+
+      return m_ctx.mbus.hasRecipients(id);
+    }
+
     void
     Task::onQueryEntityParameters(const IMC::QueryEntityParameters* msg)
     {
@@ -315,6 +315,16 @@ namespace DUNE
         dispatch(&msg, flags);
       }
 
+      //! Test if a message with the given identification number
+      //! dispatched by this task would reach any recipient.
+      //! Transports use this to discard packets before decoding
+      //! their payload.
+      //! @param[in] id message identification number.
+      //! @param[in] flags bitfield with flags (see DispatchFlags).
+      //! @return true if the message has recipients, false otherwise.
+      bool
+      hasRecipients(uint16_t id, unsigned int flags = 0) const;
+
       //! Dispatch message to the message bus in reply to another
       //! message.
       //! @param[in] original original message.
@@ -329,11 +339,27 @@ namespace DUNE
       }
 
       //! Queue a message for later consumption.
+      //! @param msg shared message object.
+      void
+      receive(const IMC::SharedMessage& msg)
+      {
+        m_recipient->put(msg);
+      }
+
+      //! Queue a copy of a message for later consumption.
       //! @param msg message object.
       void
       receive(const IMC::Message* msg)
       {
-        m_recipient->put(msg);
+        receive(IMC::SharedMessage(msg->clone()));
+      }
+
+      //! Retrieve statistics of the message queue.
+      //! @return message queue statistics.
+      Recipient::QueueStatistics
+      getQueueStatistics(void)
+      {
+        return m_recipient->getQueueStatistics();
       }
 
       //! Instruct task to reserve all entity identifiers that it
@@ -496,6 +522,19 @@ namespace DUNE
         m_recipient->waitForMessages(timeout);
       }
 
+      //! Wait for the receiving queue to contain at least one message
+      //! or for I/O events of a reactor, whichever comes first, and
+      //! then call the consumer functions for all the messages
+      //! currently in the queue. Reactor listeners are called from
+      //! this function.
+      //! @param[in] reactor I/O event reactor.
+      //! @param[in] timeout wait for timeout seconds.
+      void
+      waitForMessages(IO::Reactor& reactor, double timeout)
+      {
+        m_recipient->waitForMessages(reactor, timeout);
+      }
+
       //! Call the consumers of all messages currently in the
       //! receiving queue.
       void
@@ -785,6 +824,12 @@ namespace DUNE
         std::string active_scope;
         //! Visibility of 'Active' parameter.
         std::string active_visibility;
+        //! Maximum number of queued messages.
+        unsigned queue_capacity;
+        //! Message queue policy.
+        std::string queue_policy;
+        //! Messages subject to conflation.
+        std::vector<std::string> queue_conflated;
       };
 
       //! Message recipient (queue).
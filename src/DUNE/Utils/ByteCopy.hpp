@@ -45,6 +45,17 @@
 #  include <winsock2.h>
 #endif
 
+// Vector extensions.
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSSE3__)
+#  include <tmmintrin.h>
+#elif defined(__SSE2__)
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#endif
+
 namespace DUNE
 {
   namespace Utils
@@ -323,6 +334,48 @@ namespace DUNE
         return 8;
       }
 
+      //! Copy an array of 16-bit words while reversing the order of
+      //! the bytes of each word. Vector instructions are used when
+      //! available.
+      //! @param dest destination memory area (must not overlap src).
+      //! @param src source memory area.
+      //! @param count number of words.
+      static inline void
+      rcopy2b(uint8_t* dest, const uint8_t* src, size_t count)
+      {
+        size_t bytes = count * 2;
+        for (size_t i = rcopyBlocks<2>(dest, src, bytes); i < bytes; i += 2)
+          rcopy2b(dest + i, src + i);
+      }
+
+      //! Copy an array of 32-bit words while reversing the order of
+      //! the bytes of each word. Vector instructions are used when
+      //! available.
+      //! @param dest destination memory area (must not overlap src).
+      //! @param src source memory area.
+      //! @param count number of words.
+      static inline void
+      rcopy4b(uint8_t* dest, const uint8_t* src, size_t count)
+      {
+        size_t bytes = count * 4;
+        for (size_t i = rcopyBlocks<4>(dest, src, bytes); i < bytes; i += 4)
+          rcopy4b(dest + i, src + i);
+      }
+
+      //! Copy an array of 64-bit words while reversing the order of
+      //! the bytes of each word. Vector instructions are used when
+      //! available.
+      //! @param dest destination memory area (must not overlap src).
+      //! @param src source memory area.
+      //! @param count number of words.
+      static inline void
+      rcopy8b(uint8_t* dest, const uint8_t* src, size_t count)
+      {
+        size_t bytes = count * 8;
+        for (size_t i = rcopyBlocks<8>(dest, src, bytes); i < bytes; i += 8)
+          rcopy8b(dest + i, src + i);
+      }
+
       static inline uint16_t
       copy(int8_t& dest, const uint8_t* src)
       {
@@ -491,6 +544,21 @@ namespace DUNE
         return toLE(static_cast<uint32_t>(value), dst);
       }
 
+      static inline unsigned
+      toLE(const uint64_t value, uint8_t* dst)
+      {
+        toLE(static_cast<uint32_t>(value & 0xffffffff), dst);
+        toLE(static_cast<uint32_t>(value >> 32), dst + 4);
+
+        return 8;
+      }
+
+      static inline unsigned
+      toLE(const int64_t value, uint8_t* dst)
+      {
+        return toLE(static_cast<uint64_t>(value), dst);
+      }
+
       static inline unsigned
       toLE(const float value, uint8_t* dst)
       {
@@ -568,6 +636,88 @@ namespace DUNE
         return rcopy4b(dst, (uint8_t*)&value);
 #endif
       }
+
+    private:
+      //! Reverse the bytes of the N-byte words of an array using
+      //! vector instructions, for as many whole vectors as the array
+      //! holds.
+      //! @param dest destination memory area.
+      //! @param src source memory area.
+      //! @param bytes size of the array in bytes (multiple of N).
+      //! @return number of bytes copied.
+      template <unsigned N>
+      static inline size_t
+      rcopyBlocks(uint8_t* dest, const uint8_t* src, size_t bytes)
+      {
+        size_t i = 0;
+
+#if defined(__SSSE3__)
+        const __m128i mask = (N == 2)
+        ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+        : (N == 4)
+        ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+        : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+#  if defined(__AVX2__)
+        const __m256i mask2 = _mm256_broadcastsi128_si256(mask);
+        for (; i + 32 <= bytes; i += 32)
+        {
+          __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_shuffle_epi8(v, mask2));
+        }
+#  endif
+
+        for (; i + 16 <= bytes; i += 16)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_shuffle_epi8(v, mask));
+        }
+
+#elif defined(__SSE2__)
+        for (; i + 16 <= bytes; i += 16)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+          // Reverse the 16-bit lanes of each word, then swap the
+          // bytes of every lane.
+          if (N == 4)
+          {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+          }
+          else if (N == 8)
+          {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+          }
+
+          v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), v);
+        }
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        for (; i + 16 <= bytes; i += 16)
+        {
+          uint8x16_t v = vld1q_u8(src + i);
+
+          if (N == 2)
+            v = vrev16q_u8(v);
+          else if (N == 4)
+            v = vrev32q_u8(v);
+          else
+            v = vrev64q_u8(v);
+
+          vst1q_u8(dest + i, v);
+        }
+
+#else
+        (void)dest;
+        (void)src;
+        (void)bytes;
+#endif
+
+        return i;
+      }
     };
 
     //! Copy two bytes of a memory area while reversing the order of
@@ -80,16 +80,16 @@ namespace Power
           //! Serial port
           SerialPort* m_uart;
           //! Interrupt/Poll for serial port
-          Poll m_poll;
+          Poll& m_poll;
           //! number of cell to read
           int m_numberCell;
 
 
-          DriverBatMan(DUNE::Tasks::Task* task, SerialPort* uart, Poll poll, int numberCell):
+          DriverBatMan(DUNE::Tasks::Task* task, SerialPort* uart, Poll& poll, int numberCell):
+            m_poll(poll),
             m_task(task)
           {
             m_uart = uart;
-            m_poll = poll;
             m_timeout_uart = 1.0f;
             m_numberCell = numberCell;
             resetStateNewData();
@@ -63,13 +63,13 @@ namespace Sensors
       //! Serial port
       SerialPort* m_uart;
       //! Interrupt/Poll for serial port
-      Poll m_poll;
+      Poll& m_poll;
 
-      DriverOEMX(DUNE::Tasks::Task* task, SerialPort* uart, Poll poll):
+      DriverOEMX(DUNE::Tasks::Task* task, SerialPort* uart, Poll& poll):
+        m_poll(poll),
         m_task(task)
       {
         m_uart = uart;
-        m_poll = poll;
         m_timeout_uart = 1.0f;;
       }
 
@@ -29,7 +29,7 @@
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
-#include <DUNE/Network/FragmentedMessage.hpp>
+#include <DUNE/Network/Reassembler.hpp>
 
 namespace Transports
 {
@@ -41,53 +41,82 @@ namespace Transports
     {
       // Reception timeout.
       float max_age_secs;
+      // Maximum number of concurrent transfers.
+      unsigned max_transfers;
     };
 
     struct Task: public DUNE::Tasks::Task
     {
-      std::map<uint32_t, FragmentedMessage> m_incoming;
+      Reassembler* m_incoming;
       Time::Counter<float> m_gc_counter;
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
-        DUNE::Tasks::Task(name, ctx)
+        DUNE::Tasks::Task(name, ctx),
+        m_incoming(NULL)
       {
         param("Reception timeout", m_args.max_age_secs)
         .defaultValue("1800")
         .description("Maximum amount of seconds to wait for missing fragments in incoming messages");
 
+        param("Maximum Concurrent Transfers", m_args.max_transfers)
+        .defaultValue("16")
+        .minimumValue("1")
+        .description("Maximum number of messages being reassembled at the same time");
+
         bind<IMC::MessagePart>(this);
         m_gc_counter.setTop(120);
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      ~Task(void)
+      {
+        onResourceRelease();
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        if (m_incoming != NULL)
+          m_incoming->setTimeout(m_args.max_age_secs);
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        m_incoming = new Reassembler(m_args.max_transfers, m_args.max_age_secs);
+      }
+
       void
       onResourceRelease(void)
       {
-        m_incoming.clear();
+        Memory::clear(m_incoming);
       }
 
       void
       consume(const IMC::MessagePart* msg)
       {
-        int hash = (msg->uid << 16) | msg->getSource();
+        IMC::Message* res = NULL;
 
-        if (m_incoming.find(hash) == m_incoming.end())
+        try
         {
-          FragmentedMessage incMsg;
-          incMsg.setParentTask(this);
-          m_incoming[hash] = incMsg;
+          res = m_incoming->add(msg);
+        }
+        catch (std::exception& e)
+        {
+          err(DTR("Invalid fragment received and it won't be processed: %s"), e.what());
+          return;
         }
 
-        debug("Incoming message fragment (%d still missing)",
-              m_incoming[hash].getFragmentsMissing());
-
-        IMC::Message * res = m_incoming[hash].setFragment(msg);
-        if (res != NULL)
+        if (res == NULL)
         {
-          dispatch(res);
-          m_incoming.erase(hash);
+          debug("Incoming message fragment (%d still missing)",
+                m_incoming->getFragmentsMissing(msg->getSource(), msg->uid));
+          return;
         }
+
+        dispatch(res);
+        delete res;
       }
 
       void
@@ -95,22 +124,13 @@ namespace Transports
       {
         debug("ripping old messages");
 
-        std::map<uint32_t, FragmentedMessage>::iterator it = m_incoming.begin();
-        std::vector<uint32_t> remove;
-        for ( ; it != m_incoming.end(); ++it)
+        unsigned missing = 0;
+        while (m_incoming->expire(missing))
         {
-          if (it->second.getAge() > m_args.max_age_secs)
-          {
-            remove.push_back(it->first);
-
-            // message has died of natural causes...
-            war(DTR("Removed incoming message from memory (%d fragments were still missing)."),
-                it->second.getFragmentsMissing());
-          }
+          // message has died of natural causes...
+          war(DTR("Removed incoming message from memory (%u fragments were still missing)."),
+              missing);
         }
-
-        for (size_t i = 0; i < remove.size(); ++i)
-          m_incoming.erase(remove[i]);
       }
 
       void
@@ -27,6 +27,10 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <iomanip>
+#include <sstream>
+
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
@@ -39,10 +43,24 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Maximum number of cached delta documents.
+    static const size_t c_max_deltas = 32;
+
     MessageMonitor::MessageMonitor(const std::string& system, uint64_t uid):
       m_uid(uid),
+      m_seq(0),
+      m_released(false),
+      m_waiters(0),
+      m_max_waiters(0),
       m_last_msgs_json(0),
+      m_msgs_json_seq(0),
+      m_msgs_json_gen(0),
+      m_msgs_json_stored(0),
+      m_deltas_seq(0),
       m_last_logbook_json(0),
+      m_logbook_dirty(false),
+      m_logbook_gen(0),
+      m_logbook_stored(0),
       m_log_entry(100)
     {
       // Initialize meta information.
@@ -56,172 +74,282 @@ namespace Transports
     }
 
     MessageMonitor::~MessageMonitor(void)
-    {
-      ScopedMutex l(m_mutex);
-
-      {
-        std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-        for (; itr != m_msgs.end(); ++itr)
-          delete itr->second;
-      }
-
-      {
-        for (PowerChannelMap::iterator itr = m_power_channels.begin(); itr != m_power_channels.end(); ++itr)
-          delete itr->second;
-      }
-
-      {
-        for(unsigned int itr = 0; itr < m_logbook.size(); ++itr)
-          delete m_logbook[itr];
-      }
-    }
+    { }
 
     void
     MessageMonitor::setEntities(const std::map<unsigned, std::string>& entities)
     {
-      ScopedMutex l(m_mutex);
+      ScopedCondition l(m_cond);
       m_entities = entities;
+      // Force the state document to be rebuilt.
+      m_msgs_json_seq = 0;
+    }
+
+    void
+    MessageMonitor::setMaxWaiters(unsigned count)
+    {
+      ScopedCondition l(m_cond);
+      m_max_waiters = count;
     }
 
-    ByteBuffer*
-    MessageMonitor::messagesJSON(void)
+    void
+    MessageMonitor::messagesJSON(std::vector<char>& data)
     {
-      ScopedMutex l(m_mutex);
+      std::string doc;
+      uint64_t gen = 0;
 
-      uint64_t now = Clock::getMsec();
+      {
+        ScopedCondition l(m_cond);
+
+        uint64_t now = Clock::getMsec();
+
+        if (m_msgs.empty() || m_msgs_json_seq == m_seq || (now - m_last_msgs_json) <= 2000)
+        {
+          data = m_msgs_json;
+          return;
+        }
 
-      if ((now - m_last_msgs_json) > 2000)
         m_last_msgs_json = now;
-      else
-        return &m_msgs_json;
+        m_msgs_json_seq = m_seq;
+        gen = ++m_msgs_json_gen;
+
+        std::ostringstream os;
+        os << m_meta
+           << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n"
+           << "  'dune_seq': '" << m_seq << "',\n";
+
+        if (m_entities.empty())
+        {
+          os << "  'dune_entities': { },\n";
+        }
+        else
+        {
+          os << "  'dune_entities': {\n";
+          EntityMap::iterator itr = m_entities.begin();
+          os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
+          ++itr;
+          for (; itr != m_entities.end(); ++itr)
+            os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
+          os << "\n},";
+        }
+
+        os << "  'dune_messages': ";
+
+        JSONWriter writer;
+        writer.beginArray();
+
+        std::map<unsigned, Entry>::iterator itr = m_msgs.begin();
+        for (; itr != m_msgs.end(); ++itr)
+          writer.writeRaw(itr->second.json.data(), itr->second.json.size());
 
-      if (m_msgs.empty())
-        return &m_msgs_json;
+        for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
+          writer.writeRaw(pitr->second.json.data(), pitr->second.json.size());
 
-      std::ostringstream os;
-      os << m_meta
-         << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n";
+        writer.endArray();
 
-      if (m_entities.empty())
-      {
-        os << "  'dune_entities': { },\n";
-      }
-      else
-      {
-        os << "  'dune_entities': {\n";
-        EntityMap::iterator itr = m_entities.begin();
-        os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        ++itr;
-        for (; itr != m_entities.end(); ++itr)
-          os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        os << "\n},";
+        doc = os.str();
+        doc.append(writer.getData(), writer.getSize());
+        doc.append("\n};");
       }
 
-      os << "  'dune_messages': [\n";
+      compress(doc, data);
 
-      std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-      itr->second->toJSON(os);
-      ++itr;
-
-      for (; itr != m_msgs.end(); ++itr)
+      ScopedCondition l(m_cond);
+      if (gen > m_msgs_json_stored)
       {
-        os << ",\n";
-        itr->second->toJSON(os);
+        m_msgs_json = data;
+        m_msgs_json_stored = gen;
       }
+    }
+
+    void
+    MessageMonitor::messagesDelta(uint64_t since, double timeout, std::vector<char>& data)
+    {
+      JSONWriter writer;
+      uint64_t seq = 0;
 
-      for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
       {
-        os << ",\n";
-        pitr->second->toJSON(os);
+        ScopedCondition l(m_cond);
+
+        // Client state is from a previous instance: send everything.
+        if (since > m_seq)
+          since = 0;
+
+        // Each waiting client holds a server worker: beyond the limit
+        // answer right away and let the client poll again later.
+        if (since == m_seq && timeout > 0 && !m_released && m_waiters < m_max_waiters)
+        {
+          ++m_waiters;
+          m_cond.wait(timeout);
+          --m_waiters;
+        }
+
+        seq = m_seq;
+
+        if (m_deltas_seq == seq)
+        {
+          std::map<uint64_t, std::vector<char> >::iterator ditr = m_deltas.find(since);
+          if (ditr != m_deltas.end())
+          {
+            data = ditr->second;
+            return;
+          }
+        }
+
+        writer.beginObject();
+        writer.write("uid", m_uid);
+        writer.write("seq", seq);
+        writer.beginArray("keys");
+
+        std::map<unsigned, Entry>::iterator itr = m_msgs.begin();
+        for (; itr != m_msgs.end(); ++itr)
+        {
+          if (itr->second.seq > since)
+            writer.write(NULL, (uint32_t)itr->first);
+        }
+
+        for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
+        {
+          if (pitr->second.seq > since)
+            writer.write(NULL, "PowerChannelState:" + pitr->first);
+        }
+
+        writer.endArray();
+        writer.beginArray("messages");
+
+        for (itr = m_msgs.begin(); itr != m_msgs.end(); ++itr)
+        {
+          if (itr->second.seq > since)
+            writer.writeRaw(itr->second.json.data(), itr->second.json.size());
+        }
+
+        for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
+        {
+          if (pitr->second.seq > since)
+            writer.writeRaw(pitr->second.json.data(), pitr->second.json.size());
+        }
+
+        writer.endArray();
+        writer.endObject();
       }
 
-      os << "\n]"
-         << "\n};";
+      compress(std::string(writer.getData(), writer.getSize()), data);
 
-      GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_msgs_json, (char*)str.c_str(), (unsigned long)str.size());
+      // Cache the document while it is current. Clients polling with
+      // different sequence numbers get different documents.
+      ScopedCondition l(m_cond);
+      if (seq != m_seq)
+        return;
 
-      return &m_msgs_json;
+      if (m_deltas_seq != seq)
+      {
+        m_deltas.clear();
+        m_deltas_seq = seq;
+      }
+
+      if (m_deltas.size() < c_max_deltas)
+        m_deltas[since] = data;
     }
 
     void
     MessageMonitor::updateMessage(const IMC::Message* msg)
     {
-      ScopedMutex l(m_mutex);
+      // Encode outside of the critical section.
+      m_encoder.clear();
+      msg->toJSON(m_encoder);
 
-      if (msg->getId() == DUNE_IMC_POWERCHANNELSTATE)
-        updatePowerChannel(static_cast<const IMC::PowerChannelState*>(msg));
+      unsigned key = msg->getId() << 24 | msg->getSubId() << 8 | msg->getSourceEntity();
 
-      IMC::Message* tmsg = msg->clone();
-      unsigned key = tmsg->getId() << 24 | tmsg->getSubId() << 8 | tmsg->getSourceEntity();
+      ScopedCondition l(m_cond);
 
-      if (m_msgs[key])
-        delete m_msgs[key];
+      if (msg->getId() == DUNE_IMC_POWERCHANNELSTATE)
+        store(m_power_channels[static_cast<const IMC::PowerChannelState*>(msg)->name]);
 
-      m_msgs[key] = tmsg;
+      store(m_msgs[key]);
+      m_cond.broadcast();
     }
 
-    ByteBuffer*
-    MessageMonitor::logbookJSON(void)
+    void
+    MessageMonitor::logbookJSON(std::vector<char>& data)
     {
-      ScopedMutex l(m_mutex);
+      std::string doc;
+      uint64_t gen = 0;
+
+      {
+        ScopedCondition l(m_cond);
 
-      uint64_t now = Clock::getMsec();
+        uint64_t now = Clock::getMsec();
+
+        if (!m_logbook_dirty || (now - m_last_logbook_json) < 2000)
+        {
+          data = m_logbook_json;
+          return;
+        }
 
-      if ((now - m_last_logbook_json) < 2000)
-        return &m_logbook_json;
-      else
         m_last_logbook_json = now;
+        m_logbook_dirty = false;
+        gen = ++m_logbook_gen;
 
-      // Update m_logbook_json
-      if (m_logbook.empty())
-        return &m_logbook_json;
+        JSONWriter writer;
+        writer.beginArray();
 
-      std::ostringstream os;
-      unsigned int itr = 0;
+        for (unsigned int itr = 0; itr != m_logbook.size(); ++itr)
+          writer.writeRaw(m_logbook[itr].data(), m_logbook[itr].size());
 
-      os << "var logbook = {\n"
-         <<"'dune_logbook': [\n";
-      m_logbook[itr]->toJSON(os);
-      ++itr;
+        writer.endArray();
 
-      for (; itr != m_logbook.size(); ++itr)
-      {
-        os << ",\n";
-        m_logbook[itr]->toJSON(os);
+        doc = "var logbook = {\n'dune_logbook': ";
+        doc.append(writer.getData(), writer.getSize());
+        doc.append("\n};");
       }
 
-      os << "\n]"
-         << "\n};";
+      compress(doc, data);
 
-      // gzip compress
-      GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_logbook_json, (char*)str.c_str(), (unsigned long)str.size());
-
-      return &m_logbook_json;
+      ScopedCondition l(m_cond);
+      if (gen > m_logbook_stored)
+      {
+        m_logbook_json = data;
+        m_logbook_stored = gen;
+      }
     }
 
     void
     MessageMonitor::addLogEntry(const IMC::LogBookEntry* msg)
     {
-      ScopedMutex l(m_mutex);
+      m_encoder.clear();
+      msg->toJSON(m_encoder);
+
+      ScopedCondition l(m_cond);
 
       if (m_logbook.size() >= m_log_entry)
-        m_logbook.erase(m_logbook.begin());
+        m_logbook.pop_front();
+
+      m_logbook.push_back(m_encoder.str());
+      m_logbook_dirty = true;
+    }
 
-      m_logbook.push_back(new IMC::LogBookEntry(*msg));
+    void
+    MessageMonitor::release(void)
+    {
+      ScopedCondition l(m_cond);
+      m_released = true;
+      m_cond.broadcast();
     }
 
     void
-    MessageMonitor::updatePowerChannel(const IMC::PowerChannelState* msg)
+    MessageMonitor::store(Entry& entry)
     {
-      std::map<std::string, IMC::PowerChannelState*>::iterator itr = m_power_channels.find(msg->name);
-      if (itr != m_power_channels.end())
-        *itr->second = *msg;
-      else
-        m_power_channels[msg->name] = new IMC::PowerChannelState(*msg);
+      entry.seq = ++m_seq;
+      entry.json.assign(m_encoder.getData(), m_encoder.getSize());
+    }
+
+    void
+    MessageMonitor::compress(const std::string& doc, std::vector<char>& data)
+    {
+      ByteBuffer bfr;
+      GzipCompressor cmp;
+      cmp.compress(bfr, (char*)doc.c_str(), (unsigned long)doc.size());
+      data.assign(bfr.getBufferSigned(), bfr.getBufferSigned() + bfr.getSize());
     }
   }
 }
@@ -31,8 +31,10 @@
 #define TRANSPORTS_HTTP_MESSAGE_MONITOR_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <deque>
 #include <map>
 #include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -41,6 +43,11 @@ namespace Transports
 {
   namespace HTTP
   {
+    //! Keeps the latest JSON encoding of each message together with
+    //! the sequence number of its last update. Documents served to
+    //! clients are cached, so that clients asking for the same data
+    //! share one compression. Documents are compressed outside of
+    //! the lock, which only guards the tables and the caches.
     class MessageMonitor
     {
     public:
@@ -51,11 +58,34 @@ namespace Transports
       void
       setEntities(const std::map<unsigned, std::string>& entities);
 
-      DUNE::Utils::ByteBuffer*
-      messagesJSON(void);
+      //! Set the maximum number of clients waiting for updates at the
+      //! same time. Further clients are answered immediately.
+      //! @param[in] count maximum number of waiting clients.
+      void
+      setMaxWaiters(unsigned count);
+
+      //! Get the full state document (gzip compressed).
+      //! @param[out] data compressed document.
+      void
+      messagesJSON(std::vector<char>& data);
 
-      DUNE::Utils::ByteBuffer*
-      logbookJSON(void);
+      //! Get the messages updated after a given sequence number (gzip
+      //! compressed JSON). If there are no updates, wait for up to
+      //! 'timeout' seconds for new ones (long-polling). The document
+      //! holds DUNE's UID ("uid"), the current sequence number
+      //! ("seq"), the updated messages ("messages") and a key
+      //! identifying the slot of each one ("keys"), so that clients
+      //! can replace previous versions.
+      //! @param[in] since last sequence number known by the client.
+      //! @param[in] timeout maximum amount of time to wait.
+      //! @param[out] data compressed document.
+      void
+      messagesDelta(uint64_t since, double timeout, std::vector<char>& data);
+
+      //! Get the logbook document (gzip compressed).
+      //! @param[out] data compressed document.
+      void
+      logbookJSON(std::vector<char>& data);
 
       void
       addLogEntry(const DUNE::IMC::LogBookEntry* msg);
@@ -63,50 +93,85 @@ namespace Transports
       void
       updateMessage(const DUNE::IMC::Message* msg);
 
+      //! Wake up and refuse further waits of long-polling clients.
       void
-      readLock(void)
-      {
-        m_mutex.lock();
-      }
+      release(void);
 
-      void
-      readUnlock(void)
+    private:
+      //! Cached message.
+      struct Entry
       {
-        m_mutex.unlock();
-      }
+        //! Sequence number of the last update.
+        uint64_t seq;
+        //! JSON encoding of the message.
+        std::string json;
+      };
 
-    private:
       //! Convenience type definition for a map of power channels.
-      typedef std::map<std::string, DUNE::IMC::PowerChannelState*> PowerChannelMap;
+      typedef std::map<std::string, Entry> PowerChannelMap;
       // Convenience type definition for a map of entity labels.
       typedef std::map<unsigned, std::string> EntityMap;
       // Software meta information.
       std::string m_meta;
       // Table of messages.
-      std::map<unsigned, DUNE::IMC::Message*> m_msgs;
+      std::map<unsigned, Entry> m_msgs;
       // Entity map.
       EntityMap m_entities;
-      // Concurrency mutex.
-      DUNE::Concurrency::Mutex m_mutex;
+      // Concurrency lock and update notification.
+      DUNE::Concurrency::Condition m_cond;
       // DUNE's UID.
       uint64_t m_uid;
+      // Sequence number of the last update.
+      uint64_t m_seq;
+      // True if waiting clients must no longer block.
+      bool m_released;
+      // Number of clients waiting for updates.
+      unsigned m_waiters;
+      // Maximum number of clients waiting for updates.
+      unsigned m_max_waiters;
       // JSON messages.
-      DUNE::Utils::ByteBuffer m_msgs_json;
+      std::vector<char> m_msgs_json;
       // Last JSON messages refresh.
       uint64_t m_last_msgs_json;
+      // Sequence number of the JSON messages.
+      uint64_t m_msgs_json_seq;
+      // Number of JSON messages documents started.
+      uint64_t m_msgs_json_gen;
+      // Number of the stored JSON messages document.
+      uint64_t m_msgs_json_stored;
+      // Delta documents, by sequence number requested by the clients.
+      std::map<uint64_t, std::vector<char> > m_deltas;
+      // Sequence number of the cached delta documents.
+      uint64_t m_deltas_seq;
       //! Power channels.
       PowerChannelMap m_power_channels;
       // Logbook messages.
-      std::vector<DUNE::IMC::LogBookEntry*> m_logbook;
+      std::deque<std::string> m_logbook;
       // Logbook messages' JSON.
-      DUNE::Utils::ByteBuffer m_logbook_json;
+      std::vector<char> m_logbook_json;
       // Last logbook generation timestamp.
       uint64_t m_last_logbook_json;
+      // True if the logbook changed since the last generation.
+      bool m_logbook_dirty;
+      // Number of logbook documents started.
+      uint64_t m_logbook_gen;
+      // Number of the stored logbook document.
+      uint64_t m_logbook_stored;
       // Number of logbook messages to show.
       unsigned int m_log_entry;
+      // JSON encoder of incoming messages.
+      DUNE::IMC::JSONWriter m_encoder;
 
+      //! Store the current encoding of m_encoder.
+      //! @param[out] entry destination entry.
       void
-      updatePowerChannel(const DUNE::IMC::PowerChannelState* msg);
+      store(Entry& entry);
+
+      //! Compress a document.
+      //! @param[in] doc document.
+      //! @param[out] data compressed document.
+      static void
+      compress(const std::string& doc, std::vector<char>& data);
     };
   }
 }
@@ -67,6 +67,10 @@ namespace Transports
     static const unsigned c_buffer_len = 4096;
     //! Maximum number of ports to try before giving up.
     static const int c_max_port_tries = 10;
+    //! Maximum size of a JSON request body.
+    static const unsigned c_max_json_size = 1024 * 1024;
+    //! Maximum amount of time a client waits for new messages.
+    static const double c_poll_timeout = 10.0;
 
     struct Task: public Tasks::Task, public RequestHandler
     {
@@ -111,6 +115,10 @@ namespace Transports
       {
         bind(this, m_args.messages);
 
+        // Keep half of the workers available for requests other than
+        // long-polls.
+        m_msg_mon.setMaxWaiters(m_args.threads / 2);
+
         uint16_t last_port = m_args.port + c_max_port_tries;
 
         for (uint16_t port = m_args.port; port < last_port; ++port)
@@ -151,6 +159,7 @@ namespace Transports
       void
       onResourceRelease(void)
       {
+        m_msg_mon.release();
         Memory::clear(m_server);
       }
 
@@ -206,6 +215,8 @@ namespace Transports
             sendAgentJSON(sock, headers, uri);
           else if (matchURL(uri, "/dune/state/messages.js"))
             showMessages(sock, headers, uri);
+          else if (matchURL(uri, "/dune/state/messages/", true))
+            showMessagesDelta(sock, headers, uri);
           else if (matchURL(uri, "/dune/power/channel/", true))
             handlePowerChannel(sock, headers, uri);
           else if (matchURL(uri, "/dune/state/logbook.js", true))
@@ -234,6 +245,8 @@ namespace Transports
         {
           if (matchURL(uri, "/dune/messages/imc/", true))
             getMessage(sock, headers, uri);
+          else if (matchURL(uri, "/dune/messages/json/", true))
+            getMessagesJSON(sock, headers, uri);
           else
             sendResponse403(sock);
         }
@@ -306,6 +319,61 @@ namespace Transports
         sendData(sock, ss.str());
       }
 
+      //! Dispatch messages encoded in JSON. The request body may hold
+      //! a single message, an array of messages or JSON lines.
+      void
+      getMessagesJSON(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)uri;
+
+        unsigned size = headers.get("content-length", 0);
+        if (size == 0 || size > c_max_json_size)
+        {
+          sendResponse500(sock);
+          return;
+        }
+
+        std::vector<char> bfr(size);
+        size_t rv = 0;
+        while (rv < size)
+        {
+          size_t n = sock->read(&bfr[rv], size - rv);
+          if (n == 0)
+          {
+            sendResponse500(sock);
+            return;
+          }
+          rv += n;
+        }
+
+        std::vector<IMC::Message*> msgs;
+
+        try
+        {
+          IMC::JSONReader reader(&bfr[0], size);
+          IMC::Message* msg = NULL;
+          while ((msg = reader.readMessage()) != NULL)
+            msgs.push_back(msg);
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("invalid JSON request: %s"), e.what());
+          for (size_t i = 0; i < msgs.size(); ++i)
+            delete msgs[i];
+          sendResponse500(sock);
+          return;
+        }
+
+        for (size_t i = 0; i < msgs.size(); ++i)
+        {
+          // Stamp messages that were sent without a timestamp.
+          dispatch(msgs[i], (msgs[i]->getTimeStamp() < 0) ? 0 : DF_KEEP_TIME);
+          delete msgs[i];
+        }
+
+        sendResponse200(sock);
+      }
+
       void
       setTime(TCPSocket* sock, TupleList& headers, const char* uri)
       {
@@ -336,8 +404,33 @@ namespace Transports
         hdr["Content-Type"] = "text/javascript";
         hdr["Content-Encoding"] = "gzip";
 
-        ByteBuffer* bfr = m_msg_mon.messagesJSON();
-        sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+        std::vector<char> data;
+        m_msg_mon.messagesJSON(data);
+        sendData(sock, data.empty() ? NULL : &data[0], (int)data.size(), &hdr);
+      }
+
+      //! Send the messages updated after the sequence number given in
+      //! the URI, waiting for updates if there are none.
+      void
+      showMessagesDelta(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        uint64_t since = 0;
+        if (!castLexical(String::getRemaining("/dune/state/messages/", uri), since))
+        {
+          sendResponse500(sock);
+          return;
+        }
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/json";
+        hdr["Content-Encoding"] = "gzip";
+        hdr["Cache-Control"] = "no-cache";
+
+        std::vector<char> data;
+        m_msg_mon.messagesDelta(since, c_poll_timeout, data);
+        sendData(sock, &data[0], (int)data.size(), &hdr);
       }
 
       void
@@ -350,8 +443,9 @@ namespace Transports
         hdr["Content-Type"] = "text/javascript";
         hdr["Content-Encoding"] = "gzip";
 
-        ByteBuffer* bfr = m_msg_mon.logbookJSON();
-        sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+        std::vector<char> data;
+        m_msg_mon.logbookJSON(data);
+        sendData(sock, data.empty() ? NULL : &data[0], (int)data.size(), &hdr);
       }
 
       void
@@ -37,6 +37,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Writer.hpp"
+
 namespace Transports
 {
   namespace Logging
@@ -58,6 +61,12 @@ namespace Transports
       unsigned lsf_volume_size;
       // Compression method.
       std::string lsf_compression;
+      // Size of write buffers.
+      unsigned buffer_size;
+      // Maximum size of write buffers.
+      unsigned buffer_limit;
+      // True to write LSF index.
+      bool lsf_index;
     };
 
     struct Task: public Tasks::Task
@@ -72,12 +81,12 @@ namespace Transports
       std::string m_volume_dir;
       // Compression format.
       Compression::Methods m_compression;
-      // Output file stream for LSF/LSF_GZ formats.
-      std::ostream* m_lsf;
+      // Asynchronous writer for LSF/LSF_GZ formats.
+      Writer* m_writer;
       // Path to LSF file.
       Path m_lsf_file;
-      // Serialization buffer.
-      ByteBuffer m_buffer;
+      // Buffer used to copy LSF files.
+      ByteBuffer m_bfr;
       // Logging control message.
       IMC::LoggingControl m_log_ctl;
       // True if logging is enabled.
@@ -88,7 +97,7 @@ namespace Transports
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_last_flush(0),
-        m_lsf(NULL),
+        m_writer(NULL),
         m_active(true)
       {
         // Define configuration parameters.
@@ -108,9 +117,28 @@ namespace Transports
         param("LSF Volume Directories", m_args.lsf_volumes)
         .defaultValue("");
 
+        param("LSF Index", m_args.lsf_index)
+        .defaultValue("true")
+        .description("Write a sidecar index of the LSF file to allow"
+                     " fast seeking by time and message");
+
         param("Transports", m_args.messages)
         .defaultValue("");
 
+        param("Write Buffer Size", m_args.buffer_size)
+        .units(Units::Kibibyte)
+        .defaultValue("1024")
+        .minimumValue("4")
+        .description("Amount of serialized data accumulated before being"
+                     " handed over to the background writer thread");
+
+        param("Write Buffer Limit", m_args.buffer_limit)
+        .units(Units::Kibibyte)
+        .defaultValue("16384")
+        .description("Maximum amount of serialized data kept in memory while"
+                     " the storage device is stalled. Messages are dropped"
+                     " once this limit is reached");
+
         m_log_ctl.setSource(getSystemId());
 
         bind<IMC::CacheControl>(this);
@@ -141,10 +169,22 @@ namespace Transports
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        m_writer = new Writer(m_args.buffer_size * 1024, m_args.buffer_limit * 1024);
+        m_writer->start();
+      }
+
       void
       onResourceRelease(void)
       {
-        Memory::clear(m_lsf);
+        if (m_writer == NULL)
+          return;
+
+        m_writer->close();
+        m_writer->stopAndJoin();
+        Memory::clear(m_writer);
       }
 
       void
@@ -296,11 +336,22 @@ namespace Transports
         if (!ifs.is_open())
           return;
 
-        char bfr[16 * 1024];
-        while (!ifs.eof())
+        if (m_writer == NULL || !m_writer->isOpen())
+          return;
+
+        // Messages are copied one by one so that they are indexed.
+        try
         {
-          ifs.read(bfr, sizeof(bfr));
-          m_lsf->write(bfr, ifs.gcount());
+          IMC::Message* msg = NULL;
+          while ((msg = IMC::Packet::deserialize(ifs, m_bfr)) != NULL)
+          {
+            m_writer->write(msg);
+            delete msg;
+          }
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("failed to copy '%s': %s"), file.c_str(), e.what());
         }
       }
 
@@ -311,7 +362,7 @@ namespace Transports
         if (!m_active)
           return;
 
-        if (m_lsf == NULL)
+        if (m_writer == NULL || !m_writer->isOpen())
           return;
 
         m_active = keep_logging;
@@ -328,7 +379,7 @@ namespace Transports
         inf(DTR("log stopped '%s'"), m_log_ctl.name.c_str());
         m_log_ctl.name.clear();
 
-        onResourceRelease();
+        m_writer->close();
       }
 
       void
@@ -358,10 +409,14 @@ namespace Transports
 
         m_lsf_file = m_dir / "Data.lsf" + Compression::Factory::extension(m_compression);
 
+        std::ostream* index = NULL;
+        if (m_args.lsf_index)
+          index = new std::ofstream(IMC::LSFIndex::getPath(m_lsf_file.str()).c_str(), std::ios::binary);
+
         if (m_compression == METHOD_UNKNOWN)
-          m_lsf = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
+          m_writer->open(new std::ofstream(m_lsf_file.c_str(), std::ios::binary), index);
         else
-          m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
+          m_writer->open(new Compression::FileOutput(m_lsf_file.c_str(), m_compression), index);
 
         // Log LoggingControl to facilitate posterior conversion to LLF.
         m_log_ctl.op = IMC::LoggingControl::COP_STARTED;
@@ -392,13 +447,21 @@ namespace Transports
       void
       tryRotate(void)
       {
-        if (m_lsf == NULL)
+        if (m_writer == NULL || !m_writer->isOpen())
           return;
 
+        std::string error;
+        if (m_writer->failed(error))
+          throw std::runtime_error(error);
+
+        unsigned dropped = m_writer->takeDroppedCount();
+        if (dropped > 0)
+          war(DTR("storage is stalled, dropped %u messages"), dropped);
+
         int64_t mib = Path(m_lsf_file).size();
         mib /= c_bytes_per_mib;
 
-        m_lsf->flush();
+        m_writer->flush();
 
         if ((m_args.lsf_volume_size > 0) && (mib >= m_args.lsf_volume_size))
           tryStartLog(m_label);
@@ -429,11 +492,10 @@ namespace Transports
       void
       logMessage(const IMC::Message* msg)
       {
-        if (m_lsf == NULL)
+        if (m_writer == NULL || !m_writer->isOpen())
           return;
 
-        IMC::Packet::serialize(msg, m_buffer);
-        m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        m_writer->write(msg);
       }
 
       void
@@ -0,0 +1,393 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+#define TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace Logging
+  {
+    using DUNE_NAMESPACES;
+
+    //! Maximum amount of time to wait for a stalled background thread.
+    static const double c_stall_wait = 0.1;
+
+    //! Asynchronous LSF writer. Messages are serialized into a front
+    //! buffer by the logging task and handed over in large chunks to
+    //! a background thread that writes (and compresses) them, so the
+    //! logging task does not wait for the storage device. If the
+    //! background thread is still busy when the front buffer fills,
+    //! the front buffer grows up to a given limit. Past that limit the
+    //! task waits briefly for the background thread and, if the
+    //! storage is still stalled, messages are dropped and counted.
+    //! Optionally, the writer also produces the sidecar LSF index.
+    class Writer: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] size nominal size of each buffer in bytes.
+      //! @param[in] limit maximum size of each buffer in bytes.
+      Writer(size_t size, size_t limit):
+        m_size(size),
+        m_limit(std::max(limit, size + DUNE_IMC_CONST_MAX_SIZE)),
+        m_front_size(0),
+        m_back_size(0),
+        m_pending(false),
+        m_flush(false),
+        m_stream(NULL),
+        m_index_stream(NULL),
+        m_offset(0),
+        m_failed(false),
+        m_dropped(0)
+      {
+        m_front.resize(size);
+        m_back.resize(size);
+      }
+
+      ~Writer(void)
+      {
+        Memory::clear(m_stream);
+        Memory::clear(m_index_stream);
+      }
+
+      //! Start writing to a new output stream. Pending data is written
+      //! to the previous stream, which is closed.
+      //! @param[in] stream output stream (the writer takes ownership).
+      //! @param[in] index_stream output stream for the LSF index or
+      //! NULL to disable indexing (the writer takes ownership).
+      void
+      open(std::ostream* stream, std::ostream* index_stream = NULL)
+      {
+        close();
+
+        m_offset = 0;
+        m_index.clear();
+        if (index_stream != NULL)
+          IMC::LSFIndex::writeHeader(m_index_front);
+
+        ScopedCondition l(m_cond);
+        m_stream = stream;
+        m_index_stream = index_stream;
+        m_failed = false;
+        m_error.clear();
+      }
+
+      //! Write all pending data and close the current output streams.
+      void
+      close(void)
+      {
+        drain();
+
+        ScopedCondition l(m_cond);
+        Memory::clear(m_stream);
+        Memory::clear(m_index_stream);
+      }
+
+      //! Test if there is an open output stream. The stream is only
+      //! replaced by the logging task, so no locking is needed.
+      //! @return true if there is an open output stream, false otherwise.
+      bool
+      isOpen(void) const
+      {
+        return m_stream != NULL;
+      }
+
+      //! Serialize a message to the front buffer.
+      //! @param[in] msg message object.
+      //! @return true if the message was written, false if it was
+      //! dropped because the buffer limit was reached.
+      bool
+      write(const IMC::Message* msg)
+      {
+        unsigned size = msg->getSerializationSize();
+        if (!reserve(size))
+        {
+          ++m_dropped;
+          return false;
+        }
+
+        uint8_t* packet = (uint8_t*)&m_front[m_front_size];
+        uint16_t rv = IMC::Packet::serialize(msg, packet, size);
+
+        if (m_index_stream != NULL)
+        {
+          IMC::Header hdr;
+          IMC::Packet::deserializeHeader(hdr, packet, rv);
+          m_index.add(hdr, m_offset, rv);
+          if (m_index.isBlockFull())
+            m_index.writeBlock(m_index_front);
+        }
+
+        m_front_size += rv;
+        m_offset += rv;
+        tryCommit();
+        return true;
+      }
+
+      //! Retrieve and reset the number of dropped messages.
+      //! @return number of messages dropped since the last call.
+      unsigned
+      takeDroppedCount(void)
+      {
+        unsigned rv = m_dropped;
+        m_dropped = 0;
+        return rv;
+      }
+
+      //! Hand over the front buffer to the background thread and
+      //! request the output stream to be flushed. The current index
+      //! block is terminated so that the index covers all data handed
+      //! over. Does not wait.
+      void
+      flush(void)
+      {
+        m_index.writeBlock(m_index_front);
+
+        ScopedCondition l(m_cond);
+        m_flush = true;
+        commit();
+      }
+
+      //! Wait for all data to be written.
+      void
+      drain(void)
+      {
+        m_index.writeBlock(m_index_front);
+
+        ScopedCondition l(m_cond);
+
+        while (true)
+        {
+          while (m_pending && !m_failed)
+            m_cond.wait(1.0);
+
+          if ((m_front_size == 0 && m_index_front.empty()) || m_failed)
+            break;
+
+          m_flush = true;
+          commit();
+        }
+      }
+
+      //! Check if the background thread failed to write data.
+      //! @param[out] error error description.
+      //! @return true if writing failed, false otherwise.
+      bool
+      failed(std::string& error)
+      {
+        ScopedCondition l(m_cond);
+        error = m_error;
+        return m_failed;
+      }
+
+    private:
+      //! Nominal buffer size.
+      size_t m_size;
+      //! Maximum buffer size.
+      size_t m_limit;
+      //! Buffer being filled by the logging task.
+      std::vector<char> m_front;
+      //! Number of bytes in the front buffer.
+      size_t m_front_size;
+      //! Buffer being written by the background thread.
+      std::vector<char> m_back;
+      //! Number of bytes in the back buffer.
+      size_t m_back_size;
+      //! True if the back buffer has data to write.
+      bool m_pending;
+      //! True if the output stream must be flushed.
+      bool m_flush;
+      //! Index data being filled by the logging task.
+      std::vector<char> m_index_front;
+      //! Index data being written by the background thread.
+      std::vector<char> m_index_back;
+      //! Output stream.
+      std::ostream* m_stream;
+      //! Index output stream.
+      std::ostream* m_index_stream;
+      //! Index builder.
+      IMC::LSFIndex m_index;
+      //! Number of bytes written to the current output stream.
+      uint64_t m_offset;
+      //! True if writing failed.
+      bool m_failed;
+      //! Write error description.
+      std::string m_error;
+      //! Synchronization between the task and the background thread.
+      Condition m_cond;
+      //! Number of messages dropped since the last report.
+      unsigned m_dropped;
+
+      //! Make sure the front buffer can hold more data.
+      //! @param[in] size number of bytes to add.
+      //! @return true if there is room for the data, false if the
+      //! buffer limit was reached and the background thread is stalled.
+      bool
+      reserve(size_t size)
+      {
+        size_t needed = m_front_size + size;
+
+        if (needed > m_limit)
+        {
+          ScopedCondition l(m_cond);
+          if (m_pending && !m_failed)
+            m_cond.wait(c_stall_wait);
+
+          if (m_pending)
+            return false;
+
+          commit();
+          needed = size;
+        }
+
+        if (needed > m_front.size())
+          m_front.resize(std::min(m_limit, std::max(m_front.size() * 2, needed)));
+
+        return true;
+      }
+
+      //! Hand over the front buffer if it is full enough.
+      void
+      tryCommit(void)
+      {
+        if (m_front_size < m_size)
+          return;
+
+        ScopedCondition l(m_cond);
+        commit();
+      }
+
+      //! Swap front and back buffers if the background thread is
+      //! idle. Must be called with the condition locked.
+      void
+      commit(void)
+      {
+        if (m_pending)
+          return;
+
+        if (m_front_size == 0 && m_index_front.empty() && !m_flush)
+          return;
+
+        m_front.swap(m_back);
+        m_index_front.swap(m_index_back);
+        m_index_front.clear();
+        m_back_size = m_front_size;
+        m_front_size = 0;
+        m_pending = true;
+        m_cond.broadcast();
+      }
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          std::ostream* stream = NULL;
+          std::ostream* index_stream = NULL;
+          bool flush = false;
+
+          {
+            ScopedCondition l(m_cond);
+            if (!m_pending)
+              m_cond.wait(1.0);
+
+            if (!m_pending)
+              continue;
+
+            stream = m_stream;
+            index_stream = m_index_stream;
+            flush = m_flush;
+            m_flush = false;
+          }
+
+          bool failed = false;
+          std::string error;
+
+          try
+          {
+            if (stream != NULL)
+            {
+              stream->write(&m_back[0], m_back_size);
+              if (flush)
+                stream->flush();
+
+              if (stream->bad())
+                throw std::runtime_error(DTR("failed to write to log file"));
+            }
+
+            // Index data is written after the data it refers to.
+            if (index_stream != NULL && !m_index_back.empty())
+            {
+              index_stream->write(&m_index_back[0], m_index_back.size());
+              if (flush)
+                index_stream->flush();
+
+              if (index_stream->bad())
+                throw std::runtime_error(DTR("failed to write to log index file"));
+            }
+          }
+          catch (std::exception& e)
+          {
+            failed = true;
+            error = e.what();
+          }
+
+          // Release memory of buffers that grew during a stall.
+          if (m_back.size() > m_size)
+            std::vector<char>(m_size).swap(m_back);
+
+          ScopedCondition l(m_cond);
+          if (failed)
+          {
+            m_failed = true;
+            m_error = error;
+          }
+
+          m_back_size = 0;
+          m_index_back.clear();
+          m_pending = false;
+          m_cond.broadcast();
+        }
+      }
+    };
+  }
+}
+
+#endif
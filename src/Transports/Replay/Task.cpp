@@ -31,7 +31,6 @@
 #include <string>
 #include <vector>
 #include <map>
-#include <fstream>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -72,8 +71,8 @@ namespace Transports
       double m_ts_delta;
       double m_start_time;
 
-      // Replay file handle
-      std::istream* m_is;
+      // Replay file reader
+      IMC::LSFReader* m_reader;
       // last state from replay file
       IMC::EstimatedState m_estate;
 
@@ -98,7 +97,7 @@ namespace Transports
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
-        m_is(0)
+        m_reader(0)
       {
         param("Load At Start", m_args.startup_file)
         .defaultValue("")
@@ -240,11 +239,7 @@ namespace Transports
 
         try
         {
-          Compression::Methods method = Compression::Factory::detect(file.c_str());
-          if (method == Compression::METHOD_UNKNOWN)
-            m_is = new std::ifstream(file.c_str(), std::ios::binary);
-          else
-            m_is = new Compression::FileInput(file.c_str(), method);
+          m_reader = new IMC::LSFReader(file);
         }
         catch (std::exception& e)
         {
@@ -256,7 +251,7 @@ namespace Transports
 
         try
         {
-          m = IMC::Packet::deserialize(*m_is);
+          m = m_reader->next();
         }
         catch (std::exception& e)
         {
@@ -319,24 +314,28 @@ namespace Transports
       getFirstMessageAfterSkip(double time_to_skip)
       {
         IMC::Message* m = 0;
-        double time_origin = m_ts_delta;
-        m = IMC::Packet::deserialize(*m_is);
-        while (m)
+        double time_target = m_ts_delta + time_to_skip;
+
+        // Do not miss information from EntityInfo: only these
+        // messages are decoded while skipping.
+        m_reader->addFilter(DUNE_IMC_ENTITYINFO);
+        while ((m = m_reader->next()) != 0)
         {
-          if (m->getTimeStamp() - time_origin >= time_to_skip)
-            return m;
-          // Do not miss information from EntityInfo
-          if (m->getId() == DUNE_IMC_ENTITYINFO)
-          {
-            updateEntityMap(m);
-          }
+          if (m->getTimeStamp() >= time_target)
+            break;
 
+          updateEntityMap(m);
           delete m;
-          m = IMC::Packet::deserialize(*m_is);
-          if(getDebugLevel() >= DEBUG_LEVEL_SPEW)
-            m->toText(std::cout);
         }
-        return NULL;
+        delete m;
+
+        m_reader->clearFilter();
+        m_reader->seek(time_target);
+        m = m_reader->next();
+        if (m && getDebugLevel() >= DEBUG_LEVEL_SPEW)
+          m->toText(std::cout);
+
+        return m;
       }
 
       void
@@ -384,10 +383,10 @@ namespace Transports
       {
         requestDeactivation();
 
-        if (m_is)
+        if (m_reader)
         {
-          delete m_is;
-          m_is = 0;
+          delete m_reader;
+          m_reader = 0;
         }
         m_eid2eid.clear();
         m_tstats.clear();
@@ -465,7 +464,7 @@ namespace Transports
 
           IMC::Message* m = 0;
 
-          while (!stopping() && (m = DUNE::IMC::Packet::deserialize(*m_is)) != 0 && !m_is->eof())
+          while (!stopping() && (m = m_reader->next()) != 0)
           {
             consumeMessages();
 
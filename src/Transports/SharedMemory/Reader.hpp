@@ -0,0 +1,110 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef TRANSPORTS_SHARED_MEMORY_READER_HPP_INCLUDED_
+#define TRANSPORTS_SHARED_MEMORY_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Ring.hpp"
+
+namespace Transports
+{
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! Maximum time to wait for messages in seconds.
+    static const double c_wait_timeout = 1.0;
+
+    //! Thread dispatching the messages written by one peer.
+    class Reader: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] task parent task.
+      //! @param[in] name shared memory area name.
+      //! @param[in] capacity buffer capacity in bytes.
+      Reader(Tasks::Task& task, const std::string& name, unsigned capacity):
+        m_task(task),
+        m_ring(name, capacity)
+      {
+        m_ring.create();
+      }
+
+    private:
+      //! Parent task.
+      Tasks::Task& m_task;
+      //! Incoming messages.
+      Ring m_ring;
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          m_ring.beat();
+
+          unsigned size = 0;
+          const uint8_t* data = NULL;
+          while ((data = m_ring.peek(size)) != NULL)
+          {
+            try
+            {
+              IMC::Header hdr;
+              IMC::Packet::deserializeHeader(hdr, data, size);
+
+              if (m_task.hasRecipients(hdr.mgid))
+              {
+                IMC::Message* msg = IMC::Packet::deserialize(data, size);
+                m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+                delete msg;
+              }
+            }
+            catch (std::exception& e)
+            {
+              m_task.debug("error while unpacking message: %s", e.what());
+            }
+
+            m_ring.pop();
+          }
+
+          m_ring.wait(c_wait_timeout);
+        }
+      }
+    };
+  }
+}
+
+#endif
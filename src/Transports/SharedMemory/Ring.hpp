@@ -0,0 +1,347 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef TRANSPORTS_SHARED_MEMORY_RING_HPP_INCLUDED_
+#define TRANSPORTS_SHARED_MEMORY_RING_HPP_INCLUDED_
+
+// ISO C++ 11 headers.
+#include <atomic>
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Linux headers.
+#if defined(DUNE_SYS_HAS_LINUX_FUTEX_H) && defined(DUNE_SYS_HAS_SYS_SYSCALL_H)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  define TRANSPORTS_SHARED_MEMORY_FUTEX
+#endif
+
+namespace Transports
+{
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! Single-producer, single-consumer ring buffer of variable size
+    //! records living in a shared memory area. Records are written
+    //! and read in place, the only system calls are the futex
+    //! operations used to wake up a sleeping consumer.
+    //!
+    //! Each record is a 32-bit length followed by the record's data,
+    //! padded to 8 bytes. A length of c_padding marks unused space at
+    //! the end of the buffer.
+    class Ring
+    {
+    public:
+      //! Constructor.
+      //! @param[in] name shared memory area name.
+      //! @param[in] capacity capacity in bytes (rounded up to the
+      //! next power of two).
+      Ring(const std::string& name, unsigned capacity):
+        m_capacity(roundCapacity(capacity)),
+        m_shm(name.c_str(), sizeof(Header) + m_capacity),
+        m_header(NULL),
+        m_data(NULL),
+        m_reserved(0)
+      { }
+
+      //! Create and initialize the shared memory area. Called by the
+      //! consumer.
+      void
+      create(void)
+      {
+        m_shm.create();
+        void* ptr = *m_shm;
+        if (ptr == NULL)
+          throw std::runtime_error(DTR("shared memory is not supported"));
+
+        m_header = new (ptr) Header;
+        m_header->capacity = m_capacity;
+        m_header->head.store(0, std::memory_order_relaxed);
+        m_header->tail.store(0, std::memory_order_relaxed);
+        m_header->sequence.store(0, std::memory_order_relaxed);
+        m_header->waiting.store(0, std::memory_order_relaxed);
+        m_header->heartbeat.store(0, std::memory_order_relaxed);
+        m_data = (uint8_t*)ptr + sizeof(Header);
+        m_header->magic.store(c_magic, std::memory_order_release);
+      }
+
+      //! Open a shared memory area created by the consumer. Called by
+      //! the producer.
+      void
+      open(void)
+      {
+        m_shm.open();
+        void* ptr = *m_shm;
+        if (ptr == NULL)
+          throw std::runtime_error(DTR("shared memory is not supported"));
+
+        Header* header = (Header*)ptr;
+        if (header->magic.load(std::memory_order_acquire) != c_magic)
+          throw std::runtime_error(DTR("shared memory area is not initialized"));
+
+        if (header->capacity != m_capacity)
+          throw std::runtime_error(DTR("shared memory buffer size mismatch"));
+
+        m_header = header;
+        m_data = (uint8_t*)ptr + sizeof(Header);
+      }
+
+      //! Reserve space for a record, to be published with commit().
+      //! Nothing is visible to the consumer until then, so a
+      //! reservation may be abandoned (e.g., if filling it fails): the
+      //! next reserve() starts again from the last committed record.
+      //! @param[in] size record size.
+      //! @return pointer to the record's data, or NULL if there is
+      //! not enough free space.
+      uint8_t*
+      reserve(unsigned size)
+      {
+        uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+        uint64_t head = m_header->head.load(std::memory_order_acquire);
+        uint64_t need = align(c_prefix + size);
+        uint64_t pos = tail & (m_capacity - 1);
+        uint64_t contiguous = m_capacity - pos;
+        uint64_t skip = (contiguous < need) ? contiguous : 0;
+
+        if (tail + skip + need - head > m_capacity)
+          return NULL;
+
+        if (skip)
+        {
+          setLength(pos, c_padding);
+          tail += skip;
+          pos = 0;
+        }
+
+        setLength(pos, size);
+        m_reserved = tail + need;
+        return m_data + pos + c_prefix;
+      }
+
+      //! Publish the last reserved record and wake up the consumer if
+      //! it is sleeping.
+      void
+      commit(void)
+      {
+        m_header->tail.store(m_reserved, std::memory_order_release);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_header->waiting.load(std::memory_order_relaxed))
+        {
+          m_header->sequence.fetch_add(1, std::memory_order_release);
+          wake(m_header->sequence);
+        }
+      }
+
+      //! Retrieve the first record.
+      //! @param[out] size record size.
+      //! @return pointer to the record's data, or NULL if the buffer
+      //! is empty.
+      const uint8_t*
+      peek(unsigned& size)
+      {
+        uint64_t head = m_header->head.load(std::memory_order_relaxed);
+        uint64_t tail = m_header->tail.load(std::memory_order_acquire);
+
+        while (head != tail)
+        {
+          uint64_t pos = head & (m_capacity - 1);
+          uint32_t length = getLength(pos);
+
+          if (length != c_padding)
+          {
+            size = length;
+            return m_data + pos + c_prefix;
+          }
+
+          head += m_capacity - pos;
+          m_header->head.store(head, std::memory_order_release);
+        }
+
+        return NULL;
+      }
+
+      //! Release the first record.
+      void
+      pop(void)
+      {
+        uint64_t head = m_header->head.load(std::memory_order_relaxed);
+        uint64_t pos = head & (m_capacity - 1);
+        head += align(c_prefix + getLength(pos));
+        m_header->head.store(head, std::memory_order_release);
+      }
+
+      //! Wait for records. Called by the consumer.
+      //! @param[in] timeout maximum amount of time to wait in seconds.
+      void
+      wait(double timeout)
+      {
+        uint32_t seq = m_header->sequence.load(std::memory_order_acquire);
+        m_header->waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (empty())
+        {
+#if defined(TRANSPORTS_SHARED_MEMORY_FUTEX)
+          timespec ts;
+          ts.tv_sec = (time_t)timeout;
+          ts.tv_nsec = (long)((timeout - ts.tv_sec) * 1e9);
+          syscall(SYS_futex, (uint32_t*)&m_header->sequence, FUTEX_WAIT, seq, &ts, NULL, 0);
+#else
+          (void)seq;
+          Delay::wait(std::min(timeout, 0.001));
+#endif
+        }
+
+        m_header->waiting.store(0, std::memory_order_relaxed);
+      }
+
+      //! Check if the buffer has no records.
+      //! @return true if the buffer is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return m_header->head.load(std::memory_order_relaxed)
+        == m_header->tail.load(std::memory_order_acquire);
+      }
+
+      //! Signal that the consumer is alive.
+      void
+      beat(void)
+      {
+        m_header->heartbeat.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      //! Retrieve the consumer's heartbeat counter.
+      //! @return heartbeat counter.
+      uint64_t
+      getHeartbeat(void) const
+      {
+        return m_header->heartbeat.load(std::memory_order_relaxed);
+      }
+
+    private:
+      //! Shared control block.
+      struct Header
+      {
+        //! Initialization marker.
+        std::atomic<uint32_t> magic;
+        //! Data capacity in bytes.
+        uint32_t capacity;
+        //! Consumer heartbeat.
+        std::atomic<uint64_t> heartbeat;
+        //! Futex word, incremented to wake up the consumer.
+        std::atomic<uint32_t> sequence;
+        //! Non-zero while the consumer is waiting.
+        std::atomic<uint32_t> waiting;
+        //! Read position (consumer), on its own cache line.
+        alignas(64) std::atomic<uint64_t> head;
+        //! Write position (producer), on its own cache line.
+        alignas(64) std::atomic<uint64_t> tail;
+      };
+
+      //! Initialization marker value.
+      static const uint32_t c_magic = 0x53484d31;
+      //! Length marker of unused space.
+      static const uint32_t c_padding = 0xffffffff;
+      //! Size of the length prefix.
+      static const unsigned c_prefix = 8;
+
+      //! Data capacity.
+      unsigned m_capacity;
+      //! Shared memory area.
+      Concurrency::SharedMemory m_shm;
+      //! Control block.
+      Header* m_header;
+      //! Start of data.
+      uint8_t* m_data;
+      //! Write position after the reserved record.
+      uint64_t m_reserved;
+
+      static unsigned
+      roundCapacity(unsigned capacity)
+      {
+        unsigned rv = 4096;
+        while (rv < capacity)
+          rv <<= 1;
+        return rv;
+      }
+
+      static uint64_t
+      align(uint64_t value)
+      {
+        return (value + 7) & ~(uint64_t)7;
+      }
+
+      uint32_t
+      getLength(uint64_t pos) const
+      {
+        uint32_t length;
+        std::memcpy(&length, m_data + pos, sizeof(length));
+        return length;
+      }
+
+      void
+      setLength(uint64_t pos, uint32_t length)
+      {
+        std::memcpy(m_data + pos, &length, sizeof(length));
+      }
+
+      static void
+      wake(std::atomic<uint32_t>& word)
+      {
+#if defined(TRANSPORTS_SHARED_MEMORY_FUTEX)
+        syscall(SYS_futex, (uint32_t*)&word, FUTEX_WAKE, 1, NULL, NULL, 0);
+#else
+        (void)word;
+#endif
+      }
+
+      //! Non-copyable.
+      Ring(const Ring&);
+
+      //! Non-assignable.
+      Ring&
+      operator=(const Ring&);
+    };
+  }
+}
+
+#endif
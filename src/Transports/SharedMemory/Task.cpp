@@ -0,0 +1,284 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Ring.hpp"
+#include "Reader.hpp"
+
+namespace Transports
+{
+  //! Transport of IMC messages between DUNE instances running on
+  //! the same computer.
+  //!
+  //! Every pair of peers exchanges messages through two shared
+  //! memory ring buffers, one for each direction. The buffer is
+  //! created by the receiving side and written by the sending side.
+  //! Messages are serialized directly into the buffer and
+  //! deserialized from it, and a futex is only touched when the
+  //! receiver is waiting for data.
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! Time without heartbeats after which a peer's buffer is
+    //! reopened.
+    static const double c_peer_timeout = 5.0;
+
+    //! %Task arguments.
+    struct Arguments
+    {
+      //! Local channel name.
+      std::string channel;
+      //! Peer channel names.
+      std::vector<std::string> peers;
+      //! Buffer size.
+      unsigned buffer_size;
+      //! List of messages to transport.
+      std::vector<std::string> messages;
+    };
+
+    //! Outgoing buffer of a peer.
+    struct Peer
+    {
+      //! Peer channel name.
+      std::string name;
+      //! Buffer, NULL if not opened.
+      Ring* ring;
+      //! Last heartbeat counter.
+      uint64_t heartbeat;
+      //! Heartbeat timer.
+      Time::Counter<double> timer;
+      //! Number of messages dropped because the buffer was full.
+      unsigned dropped;
+    };
+
+    struct Task: public DUNE::Tasks::Task
+    {
+      //! Task arguments.
+      Arguments m_args;
+      //! Local channel name.
+      std::string m_channel;
+      //! Outgoing buffers.
+      std::vector<Peer> m_peers;
+      //! Incoming buffers.
+      std::vector<Reader*> m_readers;
+      //! Timer to check peers.
+      Time::Counter<double> m_check_timer;
+
+      Task(const std::string& name, Tasks::Context& ctx):
+        DUNE::Tasks::Task(name, ctx),
+        m_check_timer(1.0)
+      {
+        param("Local Channel", m_args.channel)
+        .defaultValue("")
+        .description("Name of the local channel, empty to use the system name");
+
+        param("Peers", m_args.peers)
+        .defaultValue("")
+        .description("Channel names of the DUNE instances to exchange messages with");
+
+        param("Buffer Size", m_args.buffer_size)
+        .defaultValue("4194304")
+        .units(Units::Byte)
+        .minimumValue("65536")
+        .description("Size of each ring buffer, must be the same in all peers");
+
+        param("Transports", m_args.messages)
+        .defaultValue("")
+        .description("List of messages to transport");
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        bind(this, m_args.messages);
+
+        m_channel = m_args.channel.empty() ? getSystemName() : m_args.channel;
+
+        for (unsigned i = 0; i < m_args.peers.size(); ++i)
+        {
+          Reader* reader = new Reader(*this, getRingName(m_args.peers[i], m_channel),
+                                      m_args.buffer_size);
+          reader->start();
+          m_readers.push_back(reader);
+
+          Peer peer;
+          peer.name = m_args.peers[i];
+          peer.ring = NULL;
+          peer.heartbeat = 0;
+          peer.timer.setTop(c_peer_timeout);
+          peer.dropped = 0;
+          m_peers.push_back(peer);
+        }
+
+        checkPeers();
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        for (unsigned i = 0; i < m_readers.size(); ++i)
+        {
+          m_readers[i]->stopAndJoin();
+          delete m_readers[i];
+        }
+
+        m_readers.clear();
+
+        for (unsigned i = 0; i < m_peers.size(); ++i)
+          Memory::clear(m_peers[i].ring);
+
+        m_peers.clear();
+      }
+
+      //! Get the name of the buffer carrying messages between two
+      //! channels.
+      //! @param[in] from sending channel.
+      //! @param[in] to receiving channel.
+      //! @return shared memory area name.
+      static std::string
+      getRingName(const std::string& from, const std::string& to)
+      {
+        return String::str("imc-%s-%s", from.c_str(), to.c_str());
+      }
+
+      //! Open buffers of new peers and reopen those whose receiver
+      //! has stopped.
+      void
+      checkPeers(void)
+      {
+        for (unsigned i = 0; i < m_peers.size(); ++i)
+        {
+          Peer& peer = m_peers[i];
+
+          if (peer.ring != NULL)
+          {
+            uint64_t heartbeat = peer.ring->getHeartbeat();
+            if (heartbeat != peer.heartbeat)
+            {
+              peer.heartbeat = heartbeat;
+              peer.timer.reset();
+              continue;
+            }
+
+            if (!peer.timer.overflow())
+              continue;
+
+            war(DTR("peer '%s' is not responding"), peer.name.c_str());
+            Memory::clear(peer.ring);
+          }
+
+          Ring* ring = new Ring(getRingName(m_channel, peer.name), m_args.buffer_size);
+          try
+          {
+            ring->open();
+          }
+          catch (std::exception& e)
+          {
+            debug("unable to open channel to '%s': %s", peer.name.c_str(), e.what());
+            delete ring;
+            continue;
+          }
+
+          inf(DTR("connected to peer '%s'"), peer.name.c_str());
+          peer.ring = ring;
+          peer.heartbeat = ring->getHeartbeat();
+          peer.timer.reset();
+        }
+      }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        unsigned size = msg->getSerializationSize();
+        if (size > 65535)
+          return;
+
+        for (unsigned i = 0; i < m_peers.size(); ++i)
+        {
+          Peer& peer = m_peers[i];
+          if (peer.ring == NULL)
+            continue;
+
+          uint8_t* data = peer.ring->reserve(size);
+          if (data == NULL)
+          {
+            if (peer.dropped++ == 0)
+              war(DTR("buffer of peer '%s' is full, dropping messages"), peer.name.c_str());
+            continue;
+          }
+
+          try
+          {
+            IMC::Packet::serialize(msg, data, size);
+            peer.ring->commit();
+          }
+          catch (std::exception& e)
+          {
+            // The reservation is left uncommitted, which the ring
+            // allows: the next record reuses its space.
+            war(DTR("failed to serialize message %s: %s"), msg->getName(), e.what());
+            return;
+          }
+
+          if (peer.dropped > 0)
+          {
+            war(DTR("dropped %u messages to peer '%s'"), peer.dropped, peer.name.c_str());
+            peer.dropped = 0;
+          }
+        }
+      }
+
+      void
+      onMain(void)
+      {
+        while (!stopping())
+        {
+          waitForMessages(1.0);
+
+          if (m_check_timer.overflow())
+          {
+            checkPeers();
+            m_check_timer.reset();
+          }
+        }
+      }
+    };
+  }
+}
+
+DUNE_TASK
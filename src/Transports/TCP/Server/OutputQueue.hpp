@@ -0,0 +1,293 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef TRANSPORTS_TCP_SERVER_OUTPUT_QUEUE_HPP_INCLUDED_
+#define TRANSPORTS_TCP_SERVER_OUTPUT_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace TCP
+  {
+    namespace Server
+    {
+      using DUNE_NAMESPACES;
+
+      //! Bounded queue of outgoing packets of one client. Packets are
+      //! stored back to back in a ring buffer and written to the socket
+      //! as soon as it accepts more data. A packet being written is
+      //! never dropped, so the byte stream stays consistent.
+      class OutputQueue
+      {
+      public:
+        //! Policy applied when a packet does not fit in the queue.
+        enum OverflowPolicy
+        {
+          //! Discard the new packet.
+          OVERFLOW_DROP_NEWEST,
+          //! Discard the oldest packets until the new one fits.
+          OVERFLOW_DROP_OLDEST
+        };
+
+        //! Queue statistics.
+        struct Statistics
+        {
+          //! Number of packets queued.
+          uint64_t queued;
+          //! Number of packets dropped due to overflow.
+          uint64_t dropped;
+          //! Number of packets replaced by newer ones.
+          uint64_t conflated;
+          //! Number of bytes written.
+          uint64_t sent;
+          //! Maximum number of bytes queued.
+          size_t peak;
+        };
+
+        //! Constructor.
+        //! @param[in] capacity queue capacity in bytes.
+        //! @param[in] policy overflow policy.
+        OutputQueue(size_t capacity, OverflowPolicy policy):
+          m_ring(capacity),
+          m_head(0),
+          m_used(0),
+          m_front_sent(0),
+          m_policy(policy)
+        {
+          std::memset(&m_stats, 0, sizeof(m_stats));
+        }
+
+        //! Add a packet to the queue.
+        //! @param[in] data packet data.
+        //! @param[in] size packet size.
+        //! @param[in] key packet key (same key means same stream).
+        //! @param[in] conflate true to discard an older queued packet
+        //! with the same key.
+        //! @return true if the packet was queued, false if it was
+        //! dropped.
+        bool
+        push(const uint8_t* data, size_t size, uint64_t key, bool conflate)
+        {
+          if (conflate)
+            conflateKey(key);
+
+          while (m_ring.size() - m_used < size)
+          {
+            if (m_policy == OVERFLOW_DROP_NEWEST || !dropOldest())
+            {
+              ++m_stats.dropped;
+              return false;
+            }
+          }
+
+          size_t tail = (m_head + m_used) % m_ring.size();
+          size_t first = std::min(size, m_ring.size() - tail);
+          std::memcpy(&m_ring[tail], data, first);
+          std::memcpy(&m_ring[0], data + first, size - first);
+
+          Entry entry;
+          entry.key = key;
+          entry.size = size;
+          entry.valid = true;
+          m_entries.push_back(entry);
+
+          m_used += size;
+          m_stats.peak = std::max(m_stats.peak, m_used);
+          ++m_stats.queued;
+          return true;
+        }
+
+        //! Test if the queue is empty.
+        //! @return true if the queue is empty, false otherwise.
+        bool
+        empty(void) const
+        {
+          return m_entries.empty();
+        }
+
+        //! Get the number of queued bytes.
+        //! @return number of queued bytes.
+        size_t
+        size(void) const
+        {
+          return m_used;
+        }
+
+        //! Get the longest contiguous sequence of queued bytes, which
+        //! may span several packets.
+        //! @param[out] size number of bytes.
+        //! @return pointer to the first byte.
+        const uint8_t*
+        getData(size_t& size) const
+        {
+          size_t limit = m_ring.size() - m_head;
+          size = 0;
+
+          for (size_t i = 0; i < m_entries.size() && size < limit; ++i)
+          {
+            if (!m_entries[i].valid)
+              break;
+
+            size += m_entries[i].size;
+          }
+
+          size = std::min(size - m_front_sent, limit);
+          return &m_ring[m_head];
+        }
+
+        //! Remove bytes that were written.
+        //! @param[in] size number of bytes.
+        void
+        consume(size_t size)
+        {
+          m_stats.sent += size;
+          advance(size);
+
+          while (size > 0)
+          {
+            size_t left = m_entries.front().size - m_front_sent;
+            if (size < left)
+            {
+              m_front_sent += size;
+              break;
+            }
+
+            size -= left;
+            m_front_sent = 0;
+            m_entries.pop_front();
+          }
+
+          trim();
+        }
+
+        //! Get queue statistics.
+        //! @return queue statistics.
+        const Statistics&
+        getStatistics(void) const
+        {
+          return m_stats;
+        }
+
+      private:
+        //! Queued packet.
+        struct Entry
+        {
+          //! Packet key.
+          uint64_t key;
+          //! Packet size.
+          size_t size;
+          //! False if the packet was replaced and must be skipped.
+          bool valid;
+        };
+
+        //! Ring buffer.
+        std::vector<uint8_t> m_ring;
+        //! Position of the first queued byte.
+        size_t m_head;
+        //! Number of queued bytes (including replaced packets).
+        size_t m_used;
+        //! Number of bytes of the first packet already written.
+        size_t m_front_sent;
+        //! Queued packets.
+        std::deque<Entry> m_entries;
+        //! Overflow policy.
+        OverflowPolicy m_policy;
+        //! Statistics.
+        Statistics m_stats;
+
+        //! Release bytes at the head of the ring buffer.
+        //! @param[in] size number of bytes.
+        void
+        advance(size_t size)
+        {
+          m_head = (m_head + size) % m_ring.size();
+          m_used -= size;
+        }
+
+        //! Release replaced packets at the head of the queue.
+        void
+        trim(void)
+        {
+          while (!m_entries.empty() && !m_entries.front().valid)
+          {
+            advance(m_entries.front().size);
+            m_entries.pop_front();
+          }
+        }
+
+        //! Drop the oldest packet, unless it is being written.
+        //! @return true if a packet was dropped, false otherwise.
+        bool
+        dropOldest(void)
+        {
+          if (m_entries.empty() || m_front_sent > 0)
+            return false;
+
+          advance(m_entries.front().size);
+          m_entries.pop_front();
+          ++m_stats.dropped;
+          trim();
+          return true;
+        }
+
+        //! Discard the queued packet with a given key, unless it is
+        //! being written.
+        //! @param[in] key packet key.
+        void
+        conflateKey(uint64_t key)
+        {
+          size_t first = (m_front_sent > 0) ? 1 : 0;
+
+          for (size_t i = m_entries.size(); i > first; --i)
+          {
+            Entry& entry = m_entries[i - 1];
+            if (entry.valid && entry.key == key)
+            {
+              entry.valid = false;
+              ++m_stats.conflated;
+              break;
+            }
+          }
+
+          trim();
+        }
+      };
+    }
+  }
+}
+
+#endif
@@ -27,9 +27,16 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <map>
+#include <set>
+
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "OutputQueue.hpp"
+
 namespace Transports
 {
   namespace TCP
@@ -45,9 +52,17 @@ namespace Transports
         uint16_t port;
         //! True to announce service.
         bool announce;
+        //! Size of the send queue of each client.
+        unsigned queue_size;
+        //! Send queue overflow policy.
+        std::string overflow;
+        //! Messages that can be conflated.
+        std::vector<std::string> conflated;
+        //! Maximum time without sending queued data.
+        double send_timeout;
       };
 
-      struct Task: public Tasks::SimpleTransport
+      struct Task: public Tasks::SimpleTransport, public IO::Reactor::Listener
       {
         // Arguments
         Arguments m_args;
@@ -55,8 +70,12 @@ namespace Transports
         static const int c_port_retries = 5;
         // Server socket handle.
         TCPSocket* m_sock;
-        // I/O selector.
-        Poll m_poll;
+        // Send queue overflow policy.
+        OutputQueue::OverflowPolicy m_overflow;
+        // Identifiers of messages that can be conflated.
+        std::set<uint16_t> m_conflated;
+        // Reception buffer.
+        uint8_t m_rbuf[4096];
 
         // Client data.
         struct Client
@@ -65,15 +84,19 @@ namespace Transports
           Address address; // Client address.
           uint16_t port; // Client port.
           IMC::Parser parser; // Parser handle
+          OutputQueue* queue; // Send queue.
+          double last_progress; // Last time data was sent or queued in an empty queue.
+          bool dropping; // True if the client is dropping data.
         };
 
-        // Client list.
-        typedef std::list<Client> ClientList;
+        // Client list, indexed by native handle.
+        typedef std::map<IO::NativeHandle, Client*> ClientList;
         ClientList m_clients;
 
         Task(const std::string& name, Tasks::Context& ctx):
           Tasks::SimpleTransport(name, ctx),
-          m_sock(0)
+          m_sock(0),
+          m_overflow(OutputQueue::OVERFLOW_DROP_OLDEST)
         {
           param("Port", m_args.port)
           .defaultValue("7001")
@@ -82,6 +105,27 @@ namespace Transports
           param("Announce Service", m_args.announce)
           .defaultValue("true")
           .description("Set to true to announce the service");
+
+          param("Send Queue Size", m_args.queue_size)
+          .defaultValue("262144")
+          .units(Units::Byte)
+          .description("Amount of outgoing data buffered for each client");
+
+          param("Send Queue Overflow Policy", m_args.overflow)
+          .defaultValue("Drop Oldest")
+          .values("Drop Oldest, Drop Newest")
+          .description("Data discarded when the send queue of a client is full");
+
+          param("Conflated Messages", m_args.conflated)
+          .defaultValue("")
+          .description("Messages of which only the latest of each source is"
+                       " queued for clients that fall behind");
+
+          param("Send Timeout", m_args.send_timeout)
+          .defaultValue("5")
+          .units(Units::Second)
+          .description("Close connections that do not accept data for this"
+                       " amount of time");
         }
 
         ~Task(void)
@@ -89,6 +133,28 @@ namespace Transports
           onResourceRelease();
         }
 
+        void
+        onUpdateParameters(void)
+        {
+          if (m_args.overflow == "Drop Newest")
+            m_overflow = OutputQueue::OVERFLOW_DROP_NEWEST;
+          else
+            m_overflow = OutputQueue::OVERFLOW_DROP_OLDEST;
+
+          m_conflated.clear();
+          for (size_t i = 0; i < m_args.conflated.size(); ++i)
+          {
+            try
+            {
+              m_conflated.insert(IMC::Factory::getIdFromAbbrev(m_args.conflated[i]));
+            }
+            catch (std::runtime_error& e)
+            {
+              war(DTR("invalid conflated message: %s"), e.what());
+            }
+          }
+        }
+
         void
         onResourceAcquisition(void)
         {
@@ -118,7 +184,7 @@ namespace Transports
           }
 
           m_sock->listen(5);
-          m_poll.add(*m_sock);
+          getReactor().add(*m_sock, this);
           inf(DTR("listening on %s:%u"), Address(Address::Any).c_str(), m_args.port);
 
           if (m_args.announce)
@@ -163,16 +229,26 @@ namespace Transports
         }
 
         void
-        closeConnection(Client& c, std::exception& e)
+        closeConnection(ClientList::iterator itr, const char* reason)
         {
+          Client* c = itr->second;
           long unsigned int client_count = m_clients.size() - 1;
           updateEntityState(client_count);
 
+          const OutputQueue::Statistics& stats = c->queue->getStatistics();
           debug("closing connection to %s:%u (%s), client count is %lu",
-                c.address.c_str(), c.port, e.what(), client_count);
-
-          m_poll.remove(*c.socket);
-          delete c.socket;
+                c->address.c_str(), c->port, reason, client_count);
+          debug("%s:%u: queued %llu, dropped %llu, conflated %llu, sent %llu bytes, peak queue %lu bytes",
+                c->address.c_str(), c->port,
+                (unsigned long long)stats.queued, (unsigned long long)stats.dropped,
+                (unsigned long long)stats.conflated, (unsigned long long)stats.sent,
+                (long unsigned int)stats.peak);
+
+          getReactor().remove(*c->socket);
+          delete c->socket;
+          delete c->queue;
+          delete c;
+          m_clients.erase(itr);
         }
 
         void
@@ -180,114 +256,168 @@ namespace Transports
         {
           for (ClientList::iterator itr = m_clients.begin(); itr != m_clients.end(); ++itr)
           {
-            m_poll.remove(*itr->socket);
-            delete itr->socket;
+            getReactor().remove(*itr->second->socket);
+            delete itr->second->socket;
+            delete itr->second->queue;
+            delete itr->second;
           }
 
           m_clients.clear();
 
           if (m_sock)
           {
-            m_poll.remove(*m_sock);
+            getReactor().remove(*m_sock);
             delete m_sock;
             m_sock = 0;
           }
         }
 
+        //! Write queued data until the socket would block.
+        //! @param[in] c client.
+        void
+        flush(Client* c)
+        {
+          while (!c->queue->empty())
+          {
+            size_t size = 0;
+            const uint8_t* data = c->queue->getData(size);
+            size_t rv = c->socket->write(data, size);
+            if (rv == 0)
+              break;
+
+            c->queue->consume(rv);
+            c->last_progress = Clock::get();
+
+            if (rv < size)
+              break;
+          }
+
+          if (c->queue->empty())
+            c->dropping = false;
+
+          getReactor().setWritable(*c->socket, !c->queue->empty());
+        }
+
         void
         onDataTransmission(const uint8_t* p, unsigned int n)
         {
+          IMC::Header hdr;
+          IMC::Packet::deserializeHeader(hdr, p, n);
+          uint64_t key = ((uint64_t)hdr.mgid << 24) | ((uint64_t)hdr.src << 8) | hdr.src_ent;
+          bool conflate = m_conflated.find(hdr.mgid) != m_conflated.end();
+          double now = Clock::get();
+
           ClientList::iterator itr = m_clients.begin();
 
           while (itr != m_clients.end())
           {
+            Client* c = itr->second;
+
+            if (!c->queue->empty() && now - c->last_progress > m_args.send_timeout)
+            {
+              closeConnection(itr++, DTR("send timeout"));
+              continue;
+            }
+
+            if (c->queue->empty())
+              c->last_progress = now;
+
+            if (!c->queue->push(p, n, key, conflate) && !c->dropping)
+            {
+              war(DTR("client %s:%u is not keeping up, dropping data"),
+                  c->address.c_str(), c->port);
+              c->dropping = true;
+            }
+
             try
             {
-              itr->socket->write((char*)p, n);
+              flush(c);
             }
             catch (std::runtime_error& e)
             {
-              closeConnection(*itr, e);
-              itr = m_clients.erase(itr);
+              closeConnection(itr++, e.what());
               continue;
             }
+
             ++itr;
           }
         }
 
         void
-        onDataReception(uint8_t* buf, unsigned int cap, double timeout)
+        onReadable(const IO::NativeHandle& handle)
         {
-          // Poll for connections and client data
-          if (!m_poll.poll(timeout))
+          if (m_sock != NULL && handle == m_sock->getNative())
+          {
+            acceptNewClient();
             return;
+          }
 
-          // Check for new clients.
-          if (m_poll.wasTriggered(*m_sock))
-            acceptNewClient();
+          ClientList::iterator itr = m_clients.find(handle);
+          if (itr == m_clients.end())
+            return;
+
+          size_t n = 0;
+
+          try
+          {
+            n = itr->second->socket->read(m_rbuf, sizeof(m_rbuf));
+          }
+          catch (std::runtime_error& e)
+          {
+            closeConnection(itr, e.what());
+            return;
+          }
 
-          // Check for client data
-          handleClients(buf, cap);
+          if (n > 0)
+            handleData(itr->second->parser, m_rbuf, n);
         }
 
         void
-        acceptNewClient(void)
+        onWritable(const IO::NativeHandle& handle)
         {
-          Client c;
-          c.socket = 0;
+          ClientList::iterator itr = m_clients.find(handle);
+          if (itr == m_clients.end())
+            return;
+
           try
           {
-            c.socket = m_sock->accept(&c.address, &c.port);
-            c.socket->setKeepAlive(true);
-            c.socket->setNoDelay(true);
-            c.socket->setReceiveTimeout(5);
-            c.socket->setSendTimeout(5);
-            m_poll.add(*c.socket);
-            m_clients.push_back(c);
-            updateEntityState(m_clients.size());
-
-            debug("accepted connection from %s:%u, client count is %lu",
-                  c.address.c_str(), c.port, (long unsigned int)m_clients.size());
+            flush(itr->second);
           }
           catch (std::runtime_error& e)
           {
-            if (c.socket)
-              delete c.socket;
-            err(DTR("error accepting new client connection: %s"), e.what());
+            closeConnection(itr, e.what());
           }
         }
 
         void
-        handleClients(uint8_t* buf, unsigned int cap)
+        acceptNewClient(void)
         {
-          // Check for new data from clients.
-          ClientList::iterator itr = m_clients.begin();
+          Client* c = new Client;
+          c->socket = 0;
+          c->queue = 0;
 
-          while (itr != m_clients.end())
+          try
           {
-            if (!m_poll.wasTriggered(*itr->socket))
-            {
-              ++itr;
-              continue;
-            }
-
-            int n;
-
-            try
-            {
-              n = itr->socket->read((char*)buf, cap);
-            }
-            catch (std::runtime_error& e)
-            {
-              closeConnection(*itr, e);
-              itr = m_clients.erase(itr);
-              continue;
-            }
-
-            if (n > 0)
-              handleData(itr->parser, buf, n);
+            c->socket = m_sock->accept(&c->address, &c->port);
+            c->socket->setKeepAlive(true);
+            c->socket->setNoDelay(true);
+            c->socket->setBlocking(false);
+            c->queue = new OutputQueue(m_args.queue_size, m_overflow);
+            c->last_progress = Clock::get();
+            c->dropping = false;
+            getReactor().add(*c->socket, this);
+            m_clients[c->socket->getNative()] = c;
+            updateEntityState(m_clients.size());
 
-            ++itr;
+            debug("accepted connection from %s:%u, client count is %lu",
+                  c->address.c_str(), c->port, (long unsigned int)m_clients.size());
+          }
+          catch (std::runtime_error& e)
+          {
+            delete c->socket;
+            delete c->queue;
+            delete c;
+            err(DTR("error accepting new client connection: %s"), e.what());
           }
         }
       };
@@ -0,0 +1,198 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_FRAME_HPP_INCLUDED_
+#define TRANSPORTS_UDP_FRAME_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace UDP
+  {
+    using DUNE_NAMESPACES;
+
+    //! A frame packs several IMC packets in one datagram. All fields
+    //! are little-endian:
+    //!
+    //! - sync (2 bytes): 'I', 'F'.
+    //! - codec (1 byte): 0 if the payload is stored uncompressed,
+    //!   otherwise the Compression::Methods value plus one.
+    //! - reserved (1 byte): zero.
+    //! - payload size (2 bytes): size of the uncompressed payload.
+    //! - payload: sequence of packets, each preceded by its size in
+    //!   two bytes.
+    namespace Frame
+    {
+      //! Size of the frame header.
+      static const unsigned c_header_size = 6;
+      //! Size of the packet length prefix.
+      static const unsigned c_prefix_size = 2;
+      //! Maximum size of an uncompressed payload.
+      static const unsigned c_max_payload = 65535;
+      //! Name of the service announcing frame support.
+      static const char* const c_service = "imc+udp+frame";
+      //! Compression methods supported by the decoder.
+      static const char* const c_codecs = "zlib,gzip,bzip2";
+
+      //! Test if a datagram contains a frame.
+      //! @param[in] data datagram.
+      //! @param[in] size datagram size.
+      //! @return true if the datagram is a frame, false otherwise.
+      inline bool
+      isFrame(const uint8_t* data, size_t size)
+      {
+        return size >= c_header_size && data[0] == 'I' && data[1] == 'F';
+      }
+
+      //! Encode a frame.
+      //! @param[in] payload frame payload.
+      //! @param[in] size payload size.
+      //! @param[in] compressor compressor or NULL to store the payload
+      //! uncompressed. The payload is also stored uncompressed if
+      //! compression does not reduce its size.
+      //! @param[in] method compression method used by the compressor.
+      //! @param[out] dst destination buffer, must hold at least
+      //! c_header_size + size bytes.
+      //! @return size of the frame.
+      inline size_t
+      encode(const uint8_t* payload, size_t size, Compression::Compressor* compressor,
+             Compression::Methods method, uint8_t* dst)
+      {
+        size_t rv = 0;
+
+        if (compressor != NULL && size > 1)
+        {
+          try
+          {
+            compressor->compress((char*)dst + c_header_size, size - 1,
+                                 (char*)payload, size);
+            rv = compressor->compressed();
+          }
+          catch (std::exception&)
+          {
+            rv = 0;
+          }
+        }
+
+        dst[0] = 'I';
+        dst[1] = 'F';
+        dst[3] = 0;
+        ByteCopy::toLE((uint16_t)size, dst + 4);
+
+        if (rv == 0 || rv >= size)
+        {
+          dst[2] = 0;
+          std::memcpy(dst + c_header_size, payload, size);
+          return c_header_size + size;
+        }
+
+        dst[2] = (uint8_t)(method + 1);
+        return c_header_size + rv;
+      }
+
+      //! Frame decoder.
+      class Decoder
+      {
+      public:
+        Decoder(void)
+        {
+          for (unsigned i = 0; i < Compression::METHOD_UNKNOWN; ++i)
+            m_decompressors[i] = NULL;
+        }
+
+        ~Decoder(void)
+        {
+          for (unsigned i = 0; i < Compression::METHOD_UNKNOWN; ++i)
+            delete m_decompressors[i];
+        }
+
+        //! Retrieve the uncompressed payload of a frame.
+        //! @param[in] data frame.
+        //! @param[in] size frame size.
+        //! @param[out] payload_size payload size.
+        //! @return pointer to the payload, valid until the next call.
+        const uint8_t*
+        decode(const uint8_t* data, size_t size, size_t& payload_size)
+        {
+          uint16_t expected = 0;
+          ByteCopy::fromLE(expected, data + 4);
+
+          if (data[2] == 0)
+          {
+            if (size - c_header_size != expected)
+              throw std::runtime_error(DTR("invalid frame size"));
+
+            payload_size = expected;
+            return data + c_header_size;
+          }
+
+          unsigned method = data[2] - 1;
+          if (method >= Compression::METHOD_UNKNOWN)
+            throw std::runtime_error(DTR("unknown frame compression method"));
+
+          Compression::Decompressor*& dec = m_decompressors[method];
+          if (dec == NULL)
+            dec = Compression::Factory::decompressor((Compression::Methods)method);
+
+          try
+          {
+            dec->decompress((char*)m_payload, sizeof(m_payload),
+                            (char*)data + c_header_size, size - c_header_size);
+
+            if (dec->decompressed() != expected)
+              throw std::runtime_error(DTR("invalid frame size"));
+          }
+          catch (...)
+          {
+            // Decompressor state is undefined, start afresh next time.
+            Memory::clear(dec);
+            throw;
+          }
+
+          payload_size = expected;
+          return m_payload;
+        }
+
+      private:
+        //! Decompressors, by method.
+        Compression::Decompressor* m_decompressors[Compression::METHOD_UNKNOWN];
+        //! Uncompressed payload.
+        uint8_t m_payload[c_max_payload];
+      };
+    }
+  }
+}
+
+#endif
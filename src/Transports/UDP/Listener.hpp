@@ -40,6 +40,7 @@
 // Local headers.
 #include "ContactTable.hpp"
 #include "LimitedComms.hpp"
+#include "Frame.hpp"
 
 namespace Transports
 {
@@ -47,18 +48,37 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
-    class Listener: public Concurrency::Thread
+    //! Receives datagrams from the shared reactor service, so that
+    //! UDP transports do not need a thread of their own.
+    class Listener: public IO::Reactor::Listener
     {
     public:
-      Listener(Tasks::Task& task, UDPSocket& sock, LimitedComms* lcomms,
-               float contact_timeout, bool trace = false):
+      Listener(Tasks::Task& task, IO::ReactorService& reactor, UDPSocket& sock,
+               LimitedComms* lcomms, float contact_timeout, bool trace = false):
         m_task(task),
+        m_reactor(reactor),
         m_sock(sock),
         m_trace(trace),
         m_contacts(contact_timeout),
-        m_lcomms(lcomms)
+        m_lcomms(lcomms),
+        m_bfr(c_bfr_size * c_batch_size)
       {  }
 
+      //! Start receiving datagrams.
+      void
+      start(void)
+      {
+        m_reactor.add(m_sock, this);
+      }
+
+      //! Stop receiving datagrams. The listener is not called after
+      //! this function returns.
+      void
+      stop(void)
+      {
+        m_reactor.remove(this);
+      }
+
       void
       getContacts(std::vector<Contact>& list)
       {
@@ -80,10 +100,12 @@ namespace Transports
     private:
       // Buffer capacity.
       static const int c_bfr_size = 65535;
-      // Poll timeout in milliseconds.
-      static const int c_poll_tout = 1000;
+      // Maximum number of datagrams received per system call.
+      static const int c_batch_size = 16;
       // Parent task.
       Tasks::Task& m_task;
+      // Shared reactor service.
+      IO::ReactorService& m_reactor;
       // Reference to socket used for sending data.
       UDPSocket& m_sock;
       // True to print incoming messages.
@@ -94,56 +116,121 @@ namespace Transports
       RWLock m_contacts_lock;
       // LimitedComms object
       LimitedComms* m_lcomms;
+      // Frame decoder.
+      Frame::Decoder m_decoder;
+      // Reception buffer.
+      std::vector<uint8_t> m_bfr;
+      // Received datagrams.
+      UDPSocket::Datagram m_dgrams[c_batch_size];
 
       void
-      run(void)
+      handleDatagram(const UDPSocket::Datagram& dgram)
       {
-        Address addr;
-        uint8_t* bfr = new uint8_t[c_bfr_size];
-        double poll_tout = c_poll_tout / 1000.0;
+        if (!Frame::isFrame(dgram.data, dgram.size))
+        {
+          handlePacket(dgram.data, dgram.size, dgram.address);
+          return;
+        }
 
-        while (!isStopping())
+        try
         {
-          try
+          size_t size = 0;
+          const uint8_t* payload = m_decoder.decode(dgram.data, dgram.size, size);
+
+          uint16_t packet_size = 0;
+          for (size_t i = 0; i + Frame::c_prefix_size <= size; i += Frame::c_prefix_size + packet_size)
           {
-            if (!Poll::poll(m_sock, poll_tout))
-              continue;
+            ByteCopy::fromLE(packet_size, payload + i);
+            if (i + Frame::c_prefix_size + packet_size > size)
+              throw std::runtime_error(DTR("truncated frame"));
+
+            handlePacket(payload + i + Frame::c_prefix_size, packet_size, dgram.address);
+          }
+        }
+        catch (std::exception & e)
+        {
+          m_task.debug("error while unpacking frame: %s", e.what());
+        }
+      }
+
+      void
+      handlePacket(const uint8_t* data, size_t size, const Address& addr)
+      {
+        try
+        {
+          IMC::Header hdr;
+          IMC::Packet::deserializeHeader(hdr, data, size);
 
-            uint16_t rv = m_sock.read(bfr, c_bfr_size, &addr);
-            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
+          // Drop messages nobody subscribed to before decoding their
+          // payload. Announces are still needed by limited comms.
+          if (!m_task.hasRecipients(hdr.mgid)
+              && !(m_lcomms->isActive() && hdr.mgid == DUNE_IMC_ANNOUNCE))
+          {
+            IMC::Packet::validate(hdr, data, size);
 
-            if (m_lcomms->isActive())
-            {
-              if (msg->getId() == DUNE_IMC_ANNOUNCE)
-              {
-                m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
-              }
-
-              if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
-              {
-                delete msg;
-                continue;
-              }
-            }
+            if (m_lcomms->isActive() && !m_lcomms->isNodeWithinRange(hdr.src, hdr.mgid))
+              return;
 
             m_contacts_lock.lockWrite();
-            m_contacts.update(msg->getSource(), addr);
+            m_contacts.update(hdr.src, addr);
             m_contacts_lock.unlock();
+            return;
+          }
 
-            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+          IMC::Message* msg = IMC::Packet::deserialize(data, size);
 
-            if (m_trace)
-              msg->toText(std::cerr);
+          if (m_lcomms->isActive())
+          {
+            if (msg->getId() == DUNE_IMC_ANNOUNCE)
+            {
+              m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
+            }
 
-            delete msg;
+            if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+            {
+              delete msg;
+              return;
+            }
           }
-          catch (std::exception & e)
+
+          m_contacts_lock.lockWrite();
+          m_contacts.update(msg->getSource(), addr);
+          m_contacts_lock.unlock();
+
+          m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+          if (m_trace)
+            msg->toText(std::cerr);
+
+          delete msg;
+        }
+        catch (std::exception & e)
+        {
+          m_task.debug("error while unpacking message: %s",e.what());
+        }
+      }
+
+      void
+      onReadable(const NativeHandle& handle)
+      {
+        (void)handle;
+
+        try
+        {
+          for (int i = 0; i < c_batch_size; ++i)
           {
-            m_task.debug("error while unpacking message: %s",e.what());
+            m_dgrams[i].data = &m_bfr[i * c_bfr_size];
+            m_dgrams[i].size = c_bfr_size;
           }
-        }
 
-        delete [] bfr;
+          size_t count = m_sock.read(m_dgrams, c_batch_size);
+          for (size_t i = 0; i < count; ++i)
+            handleDatagram(m_dgrams[i]);
+        }
+        catch (std::exception & e)
+        {
+          m_task.debug("error while receiving data: %s", e.what());
+        }
       }
     };
   }
@@ -34,11 +34,16 @@
 #include <string>
 #include <vector>
 #include <cstdio>
+#include <cstring>
 #include <map>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Frame.hpp"
+#include "Outbox.hpp"
+
 namespace Transports
 {
   namespace UDP
@@ -50,6 +55,7 @@ namespace Transports
     public:
       Node(const std::string& name, const std::string& services):
         m_name(name),
+        m_frames(false),
         m_active(m_addrs.end())
       {
         // Search for IMC + UDP services.
@@ -58,6 +64,12 @@ namespace Transports
 
         for (unsigned i = 0; i < list.size(); ++i)
         {
+          if (String::startsWith(list[i], std::string(Frame::c_service) + "://"))
+          {
+            parseFrameService(list[i]);
+            continue;
+          }
+
           if (list[i].compare(0, 10, "imc+udp://", 10) != 0)
             continue;
 
@@ -73,6 +85,8 @@ namespace Transports
       {
         m_name = node.m_name;
         m_addrs = node.m_addrs;
+        m_frames = node.m_frames;
+        m_codecs = node.m_codecs;
 
         if (node.m_active == node.m_addrs.end())
           m_active = m_addrs.end();
@@ -137,31 +151,53 @@ namespace Transports
         return true;
       }
 
-      //! Send data to node.
-      //! @param[in] sock UDP destination socket.
+      //! Queue data addressed to this node.
+      //! @param[in] outbox outgoing datagrams.
       //! @param[in] data data to be transmitted.
       //! @param[in] data_len length of data to be transmitted.
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len)
+      send(Outbox& outbox, uint8_t* data, unsigned data_len)
       {
         if (m_active == m_addrs.end())
           return;
 
-        try
-        {
-          sock.write(data, data_len, m_active->first, m_active->second);
-        }
-        catch (...)
-        { }
+        outbox.add(data, data_len, m_active->first, m_active->second,
+                   m_frames ? &m_codecs : NULL);
       }
 
     private:
       // Node name.
       std::string m_name;
+      // True if the node accepts frames.
+      bool m_frames;
+      // Compression methods accepted in frames.
+      std::vector<Compression::Methods> m_codecs;
       // Addresses
       std::map<Address, unsigned> m_addrs;
       // Active address.
       std::map<Address, unsigned>::iterator m_active;
+
+      //! Parse a frame service: imc+udp+frame://<address>:<port>/<codec>,...
+      //! @param[in] service service URL.
+      void
+      parseFrameService(const std::string& service)
+      {
+        m_frames = true;
+
+        size_t slash = service.find('/', std::strlen(Frame::c_service) + 3);
+        if (slash == std::string::npos)
+          return;
+
+        std::vector<std::string> codecs;
+        String::split(service.substr(slash + 1), ",", codecs);
+
+        for (unsigned i = 0; i < codecs.size(); ++i)
+        {
+          Compression::Methods method = Compression::Factory::method(codecs[i]);
+          if (method != Compression::METHOD_UNKNOWN)
+            m_codecs.push_back(method);
+        }
+      }
     };
   }
 }
@@ -96,8 +96,13 @@ namespace Transports
         return m_active_count;
       }
 
+      //! Queue data addressed to all active nodes.
+      //! @param[in] outbox outgoing datagrams.
+      //! @param[in] data data to be transmitted.
+      //! @param[in] data_len length of data to be transmitted.
+      //! @param[in] msgid message identification number.
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len, unsigned msgid)
+      send(Outbox& outbox, uint8_t* data, unsigned data_len, unsigned msgid)
       {
         if (m_lcomms != NULL)
         {
@@ -106,7 +111,7 @@ namespace Transports
             for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
             {
               if (m_lcomms->isNodeWithinRange(itr->first, msgid))
-                itr->second.send(sock, data, data_len);
+                itr->second.send(outbox, data, data_len);
             }
 
             return;
@@ -114,7 +119,7 @@ namespace Transports
         }
 
         for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          itr->second.send(sock, data, data_len);
+          itr->second.send(outbox, data, data_len);
       }
 
       void
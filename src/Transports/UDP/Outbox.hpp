@@ -0,0 +1,236 @@
+//***************************************************************************
+// Copyright 2007-2022 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: LSTS                                                             *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_OUTBOX_HPP_INCLUDED_
+#define TRANSPORTS_UDP_OUTBOX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+#include <utility>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Frame.hpp"
+
+namespace Transports
+{
+  namespace UDP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Outgoing datagrams accumulated during one wake-up of the
+    //! transport. Packets addressed to nodes that support frames are
+    //! packed into frames of up to a given size, the remaining ones
+    //! are sent in individual datagrams.
+    class Outbox
+    {
+    public:
+      Outbox(void):
+        m_mtu(0),
+        m_method(Compression::METHOD_UNKNOWN),
+        m_compressor(NULL),
+        m_frame_count(0)
+      { }
+
+      ~Outbox(void)
+      {
+        Memory::clear(m_compressor);
+      }
+
+      //! Configure framing.
+      //! @param[in] mtu maximum frame size, zero disables framing.
+      //! @param[in] method compression method, METHOD_UNKNOWN to
+      //! send uncompressed frames.
+      void
+      setFraming(unsigned mtu, Compression::Methods method)
+      {
+        m_mtu = std::min(mtu, Frame::c_header_size + Frame::c_max_payload);
+        m_method = method;
+        Memory::clear(m_compressor);
+
+        if (m_method != Compression::METHOD_UNKNOWN)
+          m_compressor = Compression::Factory::compressor(m_method);
+      }
+
+      //! Check if framing is enabled.
+      //! @return true if framing is enabled, false otherwise.
+      bool
+      isFraming(void) const
+      {
+        return m_mtu > 0;
+      }
+
+      //! Queue a packet.
+      //! @param[in] data packet, must remain valid until flush().
+      //! @param[in] size packet size.
+      //! @param[in] addr destination address.
+      //! @param[in] port destination port.
+      //! @param[in] codecs compression methods supported by the
+      //! destination, or NULL if it does not support frames.
+      void
+      add(uint8_t* data, unsigned size, const Address& addr, unsigned port,
+          const std::vector<Compression::Methods>* codecs = NULL)
+      {
+        Destination dst(addr, port);
+
+        if (codecs == NULL || !isFraming()
+            || Frame::c_header_size + Frame::c_prefix_size + size > m_mtu)
+        {
+          // Keep packets to the same destination in order.
+          if (codecs != NULL)
+            m_open.erase(dst);
+
+          addDatagram(data, size, addr, port);
+          return;
+        }
+
+        std::map<Destination, size_t>::iterator itr = m_open.find(dst);
+        if (itr != m_open.end())
+        {
+          PendingFrame& frame = m_frames[itr->second];
+          if (Frame::c_header_size + frame.payload.size() + Frame::c_prefix_size + size > m_mtu)
+            m_open.erase(itr);
+          else
+          {
+            appendPacket(frame, data, size);
+            return;
+          }
+        }
+
+        if (m_frame_count == m_frames.size())
+          m_frames.push_back(PendingFrame());
+
+        PendingFrame& frame = m_frames[m_frame_count];
+        frame.payload.clear();
+        frame.dgram = m_dgrams.size();
+        frame.compressed = m_compressor != NULL
+        && std::find(codecs->begin(), codecs->end(), m_method) != codecs->end();
+
+        m_open[dst] = m_frame_count++;
+        appendPacket(frame, data, size);
+        addDatagram(NULL, 0, addr, port);
+      }
+
+      //! Transmit all queued datagrams.
+      //! @param[in] sock socket.
+      void
+      flush(UDPSocket& sock)
+      {
+        if (m_dgrams.empty())
+          return;
+
+        // Reserve space for the worst case before taking pointers.
+        size_t total = 0;
+        for (size_t i = 0; i < m_frame_count; ++i)
+          total += Frame::c_header_size + m_frames[i].payload.size();
+
+        if (m_encoded.size() < total)
+          m_encoded.resize(total);
+
+        uint8_t* ptr = m_encoded.empty() ? NULL : &m_encoded[0];
+        for (size_t i = 0; i < m_frame_count; ++i)
+        {
+          PendingFrame& frame = m_frames[i];
+          size_t rv = Frame::encode(&frame.payload[0], frame.payload.size(),
+                                    frame.compressed ? m_compressor : NULL,
+                                    m_method, ptr);
+
+          m_dgrams[frame.dgram].data = ptr;
+          m_dgrams[frame.dgram].size = rv;
+          ptr += rv;
+        }
+
+        sock.write(&m_dgrams[0], m_dgrams.size());
+
+        m_dgrams.clear();
+        m_open.clear();
+        m_frame_count = 0;
+      }
+
+    private:
+      //! Destination address and port.
+      typedef std::pair<Address, unsigned> Destination;
+
+      //! Frame being assembled.
+      struct PendingFrame
+      {
+        //! Uncompressed payload.
+        std::vector<uint8_t> payload;
+        //! Index of the frame's datagram.
+        size_t dgram;
+        //! True if the payload should be compressed.
+        bool compressed;
+      };
+
+      //! Maximum frame size.
+      unsigned m_mtu;
+      //! Compression method.
+      Compression::Methods m_method;
+      //! Compressor.
+      Compression::Compressor* m_compressor;
+      //! Queued datagrams.
+      std::vector<UDPSocket::Datagram> m_dgrams;
+      //! Frames, only the first m_frame_count are in use.
+      std::vector<PendingFrame> m_frames;
+      //! Number of frames in use.
+      size_t m_frame_count;
+      //! Frames still accepting packets, by destination.
+      std::map<Destination, size_t> m_open;
+      //! Encoded frames.
+      std::vector<uint8_t> m_encoded;
+
+      void
+      addDatagram(uint8_t* data, unsigned size, const Address& addr, unsigned port)
+      {
+        UDPSocket::Datagram dgram;
+        dgram.data = data;
+        dgram.size = size;
+        dgram.address = addr;
+        dgram.port = port;
+        m_dgrams.push_back(dgram);
+      }
+
+      void
+      appendPacket(PendingFrame& frame, const uint8_t* data, unsigned size)
+      {
+        size_t offset = frame.payload.size();
+        frame.payload.resize(offset + Frame::c_prefix_size + size);
+        ByteCopy::toLE((uint16_t)size, &frame.payload[offset]);
+        std::memcpy(&frame.payload[offset + Frame::c_prefix_size], data, size);
+      }
+    };
+  }
+}
+
+#endif
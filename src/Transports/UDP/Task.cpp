@@ -42,6 +42,8 @@
 #include "NodeTable.hpp"
 #include "Listener.hpp"
 #include "LimitedComms.hpp"
+#include "Frame.hpp"
+#include "Outbox.hpp"
 
 namespace Transports
 {
@@ -84,17 +86,29 @@ namespace Transports
       bool only_local;
       // Optional custom service type
       std::string custom_service;
+      // Pack messages in multi-message frames.
+      bool framing;
+      // Maximum frame size.
+      unsigned frame_mtu;
+      // Frame compression method.
+      std::string frame_codec;
     };
 
     // Internal buffer size.
     static const int c_bfr_size = 65535;
     // Port bind retries.
     static const int c_port_retries = 5;
+    //! Period of the filtered messages report (s).
+    static const double c_filter_report_per = 10.0;
 
     struct Task: public DUNE::Tasks::Task
     {
       //! Serialization buffer.
       uint8_t* m_bfr;
+      //! Number of bytes used in the serialization buffer.
+      unsigned m_bfr_used;
+      //! Datagrams waiting to be transmitted.
+      Outbox m_outbox;
       //! UDP Socket.
       UDPSocket m_sock;
       //! Set of static nodes.
@@ -107,7 +121,7 @@ namespace Transports
       bool m_comm_limitations;
       //! Allow underwater communications when simulating limited comms
       bool m_underwater_comms;
-      //! Listener thread.
+      //! Listener of incoming datagrams.
       Listener* m_listener;
       //! Contact refresh counter.
       Time::Counter<float> m_contacts_refresh_counter;
@@ -115,12 +129,18 @@ namespace Transports
       LimitedComms* m_lcomms;
       //! Message Filter
       MessageFilter m_filter;
+      //! Filtered messages report counter.
+      Time::Counter<float> m_filter_report_counter;
+      //! Number of filtered messages at the last report.
+      uint64_t m_filter_reported;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_bfr(NULL),
+        m_bfr_used(0),
         m_listener(NULL),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_filter_reported(0)
       {
         param("Local Port", m_args.port)
         .defaultValue("6002")
@@ -146,7 +166,7 @@ namespace Transports
         .description("List of <IPv4>:<Port> destinations that will always receive outgoing messages");
 
         param("Rate Limiters", m_args.rate_lims)
-        .description("List of <Message>:<Frequency>");
+        .description("List of <Message>:<Frequency>[:<Burst>]");
 
         param("Filtered Entities", m_args.entities_flt)
         .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
@@ -184,6 +204,21 @@ namespace Transports
         .defaultValue("")
         .description("Optional custom service type (imc+udp+<Custom Service Type>), empty entry gives default service (imc+udp)");
 
+        param("Message Framing", m_args.framing)
+        .defaultValue("false")
+        .description("Pack messages sent to nodes that announce support for it in multi-message frames");
+
+        param("Frame MTU", m_args.frame_mtu)
+        .defaultValue("1400")
+        .units(Units::Byte)
+        .minimumValue("64")
+        .description("Maximum size of a multi-message frame");
+
+        param("Frame Compression", m_args.frame_codec)
+        .defaultValue("None")
+        .values("None, zlib, gzip, bzip2")
+        .description("Compression method of multi-message frames, used when accepted by the destination");
+
         // Allocate space for internal buffer.
         m_bfr = new uint8_t[c_bfr_size];
 
@@ -215,6 +250,9 @@ namespace Transports
 
         m_underwater_comms = m_args.underwater_comms;
 
+        m_outbox.setFraming(m_args.framing ? m_args.frame_mtu : 0,
+                            Compression::Factory::method(m_args.frame_codec));
+
         // Initialize communication limitations parameters.
         if (m_ctx.profiles.isSelected("Simulation") && m_args.comm_range > 0)
         {
@@ -289,6 +327,15 @@ namespace Transports
               announce.service_type = IMC::AnnounceService::SRV_TYPE_EXTERNAL;
 
             dispatch(announce);
+
+            if (m_outbox.isFraming() && m_args.custom_service.empty())
+            {
+              std::stringstream fs;
+              fs << Frame::c_service << "://" << itfs[i].address().str() << ":" << m_args.port
+                 << "/" << Frame::c_codecs;
+              announce.service = fs.str();
+              dispatch(announce);
+            }
           }
         }
 
@@ -297,8 +344,8 @@ namespace Transports
         m_lcomms->setActive(m_comm_limitations);
         m_node_table.setLimitedComms(m_lcomms);
 
-        // Start listener thread.
-        m_listener = new Listener(*this, m_sock, m_lcomms,
+        // Start receiving datagrams in the shared reactor.
+        m_listener = new Listener(*this, m_ctx.reactor, m_sock, m_lcomms,
                                   m_args.contact_timeout, m_args.trace_in);
         m_listener->start();
 
@@ -310,7 +357,7 @@ namespace Transports
       {
         if (m_listener != NULL)
         {
-          m_listener->stopAndJoin();
+          m_listener->stop();
           delete m_listener;
           m_listener = NULL;
         }
@@ -339,10 +386,15 @@ namespace Transports
         if (m_args.trace_out)
           msg->toText(std::cerr);
 
+        // Make room for this message.
+        if (m_bfr_used + msg->getSerializationSize() > (unsigned)c_bfr_size)
+          flush();
+
+        uint8_t* data = m_bfr + m_bfr_used;
         uint16_t rv;
         try
         {
-          rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
+          rv = IMC::Packet::serialize(msg, data, c_bfr_size - m_bfr_used);
         }
         catch(const std::exception& e)
         {
@@ -350,25 +402,30 @@ namespace Transports
           return;
         }
 
+        m_bfr_used += rv;
+
         // Send to static nodes.
         std::set<NodeAddress>::iterator itr = m_static_dsts.begin();
         for (; itr != m_static_dsts.end(); ++itr)
         {
-          try
-          {
-            m_sock.write(m_bfr, rv, itr->getAddress(), itr->getPort());
-          }
-          catch (...)
-          { }
+          m_outbox.add(data, rv, itr->getAddress(), itr->getPort());
         }
 
         if (m_args.dynamic_nodes)
         {
           // Send to dynamic nodes.
-          m_node_table.send(m_sock, m_bfr, rv, msg->getId());
+          m_node_table.send(m_outbox, data, rv, msg->getId());
         }
       }
 
+      //! Transmit all queued datagrams.
+      void
+      flush(void)
+      {
+        m_outbox.flush(m_sock);
+        m_bfr_used = 0;
+      }
+
       void
       consume(const IMC::Announce* msg)
       {
@@ -413,19 +470,45 @@ namespace Transports
         m_listener->unlockContacts();
       }
 
+      //! Report the number of messages dropped by the message filter
+      //! since the last report.
+      void
+      reportFiltered(void)
+      {
+        uint64_t filtered = m_filter.getFilteredCount();
+        if (filtered == m_filter_reported)
+          return;
+
+        debug("filtered %llu outgoing messages (%llu total)",
+              (unsigned long long)(filtered - m_filter_reported),
+              (unsigned long long)filtered);
+        m_filter_reported = filtered;
+      }
+
       void
       onMain(void)
       {
+        m_filter_report_counter.setTop(c_filter_report_per);
+
         while (!stopping())
         {
           waitForMessages(1.0);
 
+          // Send everything consumed during this wake-up.
+          flush();
+
           // Check if it's time to update the contact list.
           if (m_contacts_refresh_counter.overflow())
           {
             refreshContacts();
             m_contacts_refresh_counter.reset();
           }
+
+          if (m_filter_report_counter.overflow())
+          {
+            reportFiltered();
+            m_filter_report_counter.reset();
+          }
         }
       }
     };
@@ -27,7 +27,6 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-var g_timer = null;
 var g_icons = new Icons();
 var g_uid = null;
 var g_log_uid = null;
@@ -35,12 +34,19 @@ var g_data = null;
 var g_dune_logs = null;
 var g_dune_logbook = null;
 var g_logbook_timer = null;
+// Sequence number of the last message update received.
+var g_seq = 0;
+// Latest messages, by key.
+var g_messages = {};
+// Offset between the clocks of DUNE and the browser (s).
+var g_time_offset = 0;
 
 window.onload = function()
 {
     setConnected(false);
     g_sections.create();
     requestData();
+    requestMessages();
     requestLogs();
     requestLogBookEntries();
 };
@@ -109,18 +115,21 @@ function requestData()
 {
     var options = Array();
     options.timeout = 10000;
-    options.timeoutHandler = timeoutHandler;
-    options.errorHandler = errorHandler;
+    options.timeoutHandler = dataErrorHandler;
+    options.errorHandler = dataErrorHandler;
     HTTP.get('dune/state/messages.js', handleData, options);
 };
 
+function dataErrorHandler()
+{
+    timeoutHandler();
+    setTimeout(requestData, 4000);
+}
+
 function handleData(text)
 {
     setConnected(true);
 
-    if (g_timer == null)
-        g_timer = setInterval(requestData, 4000);
-
     eval(text);
 
     // Check UID.
@@ -136,18 +145,84 @@ function handleData(text)
         g_uid = data.dune_uid;
     }
 
+    g_time_offset = parseFloat(data.dune_time_current) - Date.now() / 1000;
+    g_data = data;
+    updateData();
+};
+
+// Long-poll the messages updated after the last known sequence
+// number. The reply arrives as soon as there are updates, or after
+// DUNE's poll timeout if there are none.
+function requestMessages()
+{
+    var options = Array();
+    options.timeout = 15000;
+    options.timeoutHandler = messagesErrorHandler;
+    options.errorHandler = messagesErrorHandler;
+    HTTP.get('dune/state/messages/' + g_seq, handleMessages, options);
+};
+
+function messagesErrorHandler()
+{
+    timeoutHandler();
+    setTimeout(requestMessages, 4000);
+}
+
+function handleMessages(text)
+{
+    setConnected(true);
+
+    var delta = JSON.parse(text);
+
+    // DUNE was restarted: start over and reload entities.
+    if (g_uid != null && delta.uid != g_uid)
+    {
+        g_sections.clear();
+        g_sections.create();
+        g_uid = delta.uid;
+        g_data = null;
+        g_seq = 0;
+        g_messages = {};
+        requestData();
+        setTimeout(requestMessages, 0);
+        return;
+    }
+
+    for (var i = 0; i < delta.keys.length; ++i)
+        g_messages[delta.keys[i]] = delta.messages[i];
+
+    g_seq = parseInt(delta.seq);
+
+    if (g_data != null)
+        updateData();
+
+    // Refresh at most once per second.
+    setTimeout(requestMessages, 1000);
+};
+
+function updateData()
+{
+    g_data.dune_time_current = Date.now() / 1000 + g_time_offset;
+
+    // Prefer the incremental updates over the state document.
+    if (g_seq > 0)
+    {
+        g_data.dune_messages = [];
+        for (var key in g_messages)
+            g_data.dune_messages.push(g_messages[key]);
+    }
+
     // Process entities.
-    for (var i in data.dune_messages)
+    for (var i in g_data.dune_messages)
     {
-        var msg = data.dune_messages[i];
-        if (msg.abbrev != 'EntityState')
+        var msg = g_data.dune_messages[i];
+        if (msg.abbrev != 'EntityState' || !(msg.src_ent in g_data.dune_entities))
             continue;
 
-        data.dune_entities[msg.src_ent].state = msg.state;
-        data.dune_entities[msg.src_ent].description = msg.description;
+        g_data.dune_entities[msg.src_ent].state = msg.state;
+        g_data.dune_entities[msg.src_ent].description = msg.description;
     }
 
-    g_data = data;
     g_sections.update();
 };
 